@@ -13,6 +13,8 @@
 #include "Services/Filesystem.h"
 #include "Services/Options.h"
 #include "Services/Toasts.h"
+#include "Tests/Tests.h"
+#include "Utils/AllocCounter.h"
 #include "Utils/Font.h"
 #include "Utils/Parallel.h"
 #include "Utils/Translator.h"
@@ -96,15 +98,33 @@ namespace Silent
         return res;
     }
 
-    void ApplicationManager::Initialize()
+    void ApplicationManager::Initialize(const std::vector<std::string>& args)
     {
+        constexpr char RECORD_ARG[] = "--record";
+        constexpr char REPLAY_ARG[] = "--replay";
+        constexpr char BENCH_ARG[]  = "--bench";
+        constexpr char TEST_ARG[]   = "--test";
+
         _isPaused = false;
         _quit     = false;
 
         InitializeSignals();
 
+        // Find benchmark first, since benchmark runs use their own savegame folder.
+        for (int i = 0; (i + 1) < args.size(); i++)
+        {
+            if (args[i] == BENCH_ARG)
+            {
+                _benchName = args[i + 1];
+            }
+            else if (args[i] == TEST_ARG)
+            {
+                _testName = args[i + 1];
+            }
+        }
+
         // Filesystem.
-        _work.Filesystem.Initialize();
+        _work.Filesystem.Initialize(!_benchName.empty());
 
         // Debug.
         Debug::Initialize();
@@ -114,6 +134,14 @@ namespace Silent
         _work.Options.Initialize();
         _work.Options.Load();
 
+        // Use offscreen video and dummy audio drivers for headless runs without a display or audio device.
+        bool isHeadless = _work.Options->RenderBackend == RendererType::Null;
+        if (isHeadless)
+        {
+            SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+            SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+        }
+
         // SDL.
         if (!SDL_Init(SDL_INIT_AUDIO | SDL_INIT_VIDEO))
         {
@@ -123,7 +151,8 @@ namespace Silent
         // Collect window flags.
         int fullscreenFlag = _work.Options->EnableFullscreen ? SDL_WINDOW_FULLSCREEN : 0;
         int maximizedFlag  = _work.Options->EnableMaximized  ? SDL_WINDOW_MAXIMIZED  : 0;
-        int flags          = SDL_WINDOW_RESIZABLE | fullscreenFlag | maximizedFlag;
+        int hiddenFlag     = isHeadless                      ? SDL_WINDOW_HIDDEN     : 0;
+        int flags          = SDL_WINDOW_RESIZABLE | fullscreenFlag | maximizedFlag | hiddenFlag;
 
         // Create window.
         _window = SDL_CreateWindow(APP_NAME, _work.Options->WindowedSize.x, _work.Options->WindowedSize.y, flags);
@@ -137,11 +166,13 @@ namespace Silent
         _work.Translator.Initialize(_work.Filesystem.GetAssetsDirectory() / ASSETS_LOCALES_DIR_NAME, LOCALE_NAMES);
         for (const auto& fontMetadata : FONTS_METADATA)
         {
-            _work.Fonts.LoadFont(fontMetadata.Name, fontMetadata.Filenames, _work.Filesystem.GetAssetsDirectory() / ASSETS_FONTS_DIR_NAME, fontMetadata.PointSize, GLYPH_PRECACHE);
+            _work.Fonts.LoadFont(fontMetadata.Name, fontMetadata.Filenames, _work.Filesystem.GetAssetsDirectory() / ASSETS_FONTS_DIR_NAME, fontMetadata.PointSize,
+                                 fontMetadata.RasterMode, GLYPH_PRECACHE);
         }
+        _work.Fonts.PrecacheGlyphs(_work.Translator.GetActiveLocaleCharacters());
 
         // Renderer.
-        _work.Renderer = CreateRenderer(RendererType::SdlGpu);
+        _work.Renderer = CreateRenderer(_work.Options->RenderBackend);
         if (_work.Renderer == nullptr)
         {
             throw std::runtime_error("Failed to create renderer.");
@@ -154,6 +185,31 @@ namespace Silent
         // Input.
         _work.Input.Initialize();
 
+        // Savegame.
+        _work.Savegame.Initialize();
+
+        // Input recording and replay.
+        for (int i = 0; i < args.size(); i++)
+        {
+            if (args[i] == RECORD_ARG)
+            {
+                _work.Input.StartRecording();
+            }
+            else if (args[i] == REPLAY_ARG && (i + 1) < args.size())
+            {
+                if (!_work.Input.StartReplay(args[++i]))
+                {
+                    throw std::runtime_error(Fmt("Failed to start input replay of {}.", args[i]));
+                }
+
+                _isBenchmark = true;
+            }
+            else if (args[i] == BENCH_ARG || args[i] == TEST_ARG)
+            {
+                i++;
+            }
+        }
+
         // Finish.
         Debug::Log("Startup complete.");
     }
@@ -162,7 +218,16 @@ namespace Silent
     {
         Debug::Log("Shutting down...");
 
+        // Wait for in-flight frame.
+        if (_renderFuture.valid())
+        {
+            _renderFuture.wait();
+        }
+
         // Workspace.
+        _work.Options.Flush();
+        _work.Savegame.Flush();
+        _work.Fonts.WaitForGlyphs();
         _work.Audio.Deinitialize();
         _work.Input.Deinitialize();
         _work.Renderer->Deinitialize();
@@ -179,20 +244,51 @@ namespace Silent
 
     void ApplicationManager::Run()
     {
+        if (!_benchName.empty())
+        {
+            RunBench();
+            return;
+        }
+
+        if (!_testName.empty())
+        {
+            Tests::RunTests(_testName);
+            return;
+        }
+
         _work.Clock.Initialize();
 
         while (!_quit)
         {
+            auto startTime = std::chrono::steady_clock::now();
+
             _work.Clock.Update();
             PollEvents();
 
-            // Step game state and render.
-            if (!_isPaused)
+            // Step game state and render. Replay benchmarks ignore focus.
+            if (!_isPaused || _isBenchmark)
             {
                 Update();
                 Render();
             }
 
+            // Run replay benchmark unthrottled, waiting for each frame's render so every replayed update is rendered and timed.
+            if (_isBenchmark)
+            {
+                if (_renderFuture.valid())
+                {
+                    _renderFuture.wait();
+                }
+                _frameTimes.push_back((uint)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count());
+
+                if (!_work.Input.IsReplaying())
+                {
+                    SaveFrameTimes();
+                    Quit();
+                }
+                continue;
+            }
+
             _work.Clock.WaitForNextTick();
         }
     }
@@ -255,6 +351,7 @@ namespace Silent
     {
         // Update input.
         _work.Input.Update(*_window, _mouseWheelAxis);
+        _inputTime = std::chrono::steady_clock::now();
 
         // Update game state.
         for (int i = 0; i < _work.Clock.GetTicks(); i++)
@@ -265,6 +362,12 @@ namespace Silent
         // Update audio.
         _work.Audio.Update();
 
+        // Write coalesced options saves.
+        _work.Options.Update();
+
+        // Publish background glyph rasterization.
+        _work.Fonts.Update();
+
         // Update debug and toasts.
         Debug::Update();
         _work.Toaster.Update();
@@ -272,7 +375,7 @@ namespace Silent
 
     void ApplicationManager::UpdateRenderBuffer()
     {
-        // @todo
+        _work.Renderer->PublishSnapshot(_inputTime);
     }
 
     void ApplicationManager::Render()
@@ -282,16 +385,17 @@ namespace Silent
             return;
         }
 
-        // Wait for previous frame to finish rendering.
-        static auto prevFrameFuture = std::future<void>();
-        if (prevFrameFuture.valid())
+        // Hand off tick submissions.
+        UpdateRenderBuffer();
+
+        // If previous frame is still rendering, skip. It will pick up the newest snapshot on the next tick.
+        if (_renderFuture.valid() && _renderFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
         {
-            prevFrameFuture.wait();
+            return;
         }
 
         // Render frame asynchronously.
-        UpdateRenderBuffer();
-        prevFrameFuture = _work.Executor.AddTask(TASK(_work.Renderer->Update()));
+        _renderFuture = _work.Executor.AddTask(TASK(_work.Renderer->Update()));
     }
 
     void ApplicationManager::PollEvents()
@@ -409,4 +513,179 @@ namespace Silent
             }
         }
     }
+
+    void ApplicationManager::SaveFrameTimes() const
+    {
+        constexpr char BENCHMARK_FILENAME_BASE[] = "ReplayBenchmark_";
+        constexpr char CSV_FILE_EXT[]            = ".csv";
+
+        if (_frameTimes.empty())
+        {
+            return;
+        }
+
+        // Compute summary.
+        auto sortedFrameTimes = _frameTimes;
+        std::sort(sortedFrameTimes.begin(), sortedFrameTimes.end());
+
+        uint64 totalTime = 0;
+        for (uint frameTime : _frameTimes)
+        {
+            totalTime += frameTime;
+        }
+
+        uint avgTime = (uint)(totalTime / _frameTimes.size());
+        uint p50Time = sortedFrameTimes[sortedFrameTimes.size() / 2];
+        uint p99Time = sortedFrameTimes[((sortedFrameTimes.size() - 1) * 99) / 100];
+        uint maxTime = sortedFrameTimes.back();
+
+        Debug::Log(Fmt("Replay benchmark: {} frames in {:.3f} sec.", _frameTimes.size(), (double)totalTime / 1000000.0));
+        Debug::Log(Fmt("    Frame time (microsec): avg {}, p50 {}, p99 {}, max {}.", avgTime, p50Time, p99Time, maxTime));
+
+        // Write frame time series.
+        auto timestamp = GetCurrentDateString() + "_" + GetCurrentTimeString();
+        auto path      = _work.Filesystem.GetRecordingsDirectory() / ((BENCHMARK_FILENAME_BASE + timestamp) + CSV_FILE_EXT);
+        std::filesystem::create_directories(path.parent_path());
+
+        auto file = std::ofstream(path, std::ios::trunc);
+        if (!file.is_open())
+        {
+            Debug::Log("Failed to save replay benchmark frame times.", Debug::LogLevel::Warning);
+            return;
+        }
+
+        file << "frame,frame_time_us\n";
+        for (int i = 0; i < _frameTimes.size(); i++)
+        {
+            file << i << ',' << _frameTimes[i] << '\n';
+        }
+
+        Debug::Log(Fmt("Saved replay benchmark frame times to {}.", path.string()));
+    }
+
+    void ApplicationManager::RunBench()
+    {
+        constexpr char SAVEGAME_METADATA_BENCH_NAME[]    = "savegame-metadata";
+        constexpr char SAVEGAME_IO_BENCH_NAME[]          = "savegame-io";
+        constexpr char INPUT_RECORDING_BENCH_NAME[]      = "input-recording";
+        constexpr char INPUT_ACTIONS_BENCH_NAME[]        = "input-actions";
+        constexpr char TEXT_SHAPING_BENCH_NAME[]         = "text-shaping";
+        constexpr char TICK_ALLOCATIONS_BENCH_NAME[]     = "tick-allocations";
+        constexpr char FRAME_PACING_BENCH_NAME[]         = "frame-pacing";
+        constexpr uint SAVEGAME_METADATA_ITERATION_COUNT = 100;
+        constexpr uint INPUT_RECORDING_FRAME_COUNT       = 20000;
+        constexpr uint INPUT_ACTIONS_ITERATION_COUNT     = 100000;
+        constexpr uint TEXT_SHAPING_FRAME_COUNT          = 1000;
+        constexpr uint TICK_ALLOCATIONS_WARM_UP_COUNT    = 120;
+        constexpr uint TICK_ALLOCATIONS_TICK_COUNT       = 600;
+        constexpr uint FRAME_PACING_TICK_COUNT           = TICKS_PER_SECOND * 5;
+
+        Debug::Log(Fmt("Running {} benchmark...", _benchName));
+
+        if (_benchName == SAVEGAME_METADATA_BENCH_NAME)
+        {
+            _work.Savegame.BenchmarkMetadata(SAVEGAME_METADATA_ITERATION_COUNT);
+        }
+        else if (_benchName == SAVEGAME_IO_BENCH_NAME)
+        {
+            _work.Savegame.BenchmarkSaves();
+        }
+        else if (_benchName == INPUT_RECORDING_BENCH_NAME)
+        {
+            _work.Input.BenchmarkRecording(INPUT_RECORDING_FRAME_COUNT);
+        }
+        else if (_benchName == INPUT_ACTIONS_BENCH_NAME)
+        {
+            _work.Input.BenchmarkActions(INPUT_ACTIONS_ITERATION_COUNT);
+        }
+        else if (_benchName == TEXT_SHAPING_BENCH_NAME)
+        {
+            _work.Fonts.BenchmarkShaping(TEXT_SHAPING_FRAME_COUNT);
+        }
+        else if (_benchName == TICK_ALLOCATIONS_BENCH_NAME)
+        {
+            BenchmarkTickAllocations(TICK_ALLOCATIONS_WARM_UP_COUNT, TICK_ALLOCATIONS_TICK_COUNT);
+        }
+        else if (_benchName == FRAME_PACING_BENCH_NAME)
+        {
+            BenchmarkFramePacing(FRAME_PACING_TICK_COUNT);
+        }
+        else
+        {
+            Debug::Log(Fmt("Unknown benchmark `{}`.", _benchName), Debug::LogLevel::Warning);
+        }
+    }
+
+    void ApplicationManager::BenchmarkTickAllocations(uint warmUpTickCount, uint tickCount)
+    {
+        _work.Clock.Initialize();
+
+        uint allocCount        = 0;
+        uint allocTickCount    = 0;
+        uint allocCountMaxTick = 0;
+        for (int i = 0; i < (warmUpTickCount + tickCount); i++)
+        {
+            _work.Clock.Update();
+            PollEvents();
+
+            // Count game thread allocations of the tick's update and snapshot handoff.
+            bool isCounted = i >= warmUpTickCount;
+            if (isCounted)
+            {
+                BeginAllocCount();
+            }
+
+            Update();
+            UpdateRenderBuffer();
+
+            if (isCounted)
+            {
+                uint tickAllocCount = EndAllocCount();
+                allocCount         += tickAllocCount;
+                allocTickCount     += (tickAllocCount > 0) ? 1 : 0;
+                allocCountMaxTick   = std::max(allocCountMaxTick, tickAllocCount);
+            }
+
+            // Render every tick so that snapshots cycle through the triple buffer as in the application loop.
+            _work.Executor.AddTask(TASK(_work.Renderer->Update())).wait();
+            _work.Clock.WaitForNextTick();
+        }
+
+        Debug::Log(Fmt("Tick allocations: {} allocations in {} of {} ticks, max {} per tick.", allocCount, allocTickCount, tickCount, allocCountMaxTick));
+        if (allocCount > 0)
+        {
+            throw std::runtime_error(Fmt("Steady-state ticks allocated {} times.", allocCount));
+        }
+    }
+
+    void ApplicationManager::BenchmarkFramePacing(uint tickCount)
+    {
+        _work.Clock.Initialize();
+
+        // Run application loop as is, so that slow frames skip ticks instead of stalling the game thread.
+        for (int i = 0; i < tickCount; i++)
+        {
+            _work.Clock.Update();
+            PollEvents();
+            Update();
+            Render();
+            _work.Clock.WaitForNextTick();
+        }
+
+        // Stats are owned by render worker. Read once last frame has finished.
+        if (_renderFuture.valid())
+        {
+            _renderFuture.wait();
+        }
+
+        const auto& stats = _work.Renderer->GetFramePacingStats();
+        if (stats.FrameCount == 0)
+        {
+            throw std::runtime_error("No complete frame pacing window was recorded.");
+        }
+
+        Debug::Log(Fmt("Frame pacing: interval {} us (max {} us), input-to-submit latency {} us (max {} us), {} of {} ticks dropped.",
+                       stats.FrameIntervalAvg, stats.FrameIntervalMax, stats.LatencyAvg, stats.LatencyMax,
+                       stats.DroppedCount, stats.FrameCount + stats.DroppedCount));
+    }
 }
@@ -57,6 +57,14 @@ namespace Silent
         ApplicationWork _work           = {};            /** Subsystem workspace. */
         Vector2         _mouseWheelAxis = Vector2::Zero; /** Mouse wheel axis input. */
 
+        std::future<void>                     _renderFuture = {}; /** In-flight render task. */
+        std::chrono::steady_clock::time_point _inputTime    = {}; /** Time of the most recent input poll. */
+
+        bool              _isBenchmark = false; /** Replay benchmark state. Runs unthrottled until the input replay ends, then quits. */
+        std::vector<uint> _frameTimes  = {};    /** Replay benchmark frame time series in microseconds. */
+        std::string       _benchName   = {};    /** Subsystem benchmark to run instead of the application loop. */
+        std::string       _testName    = {};    /** Test suite to run instead of the application loop. */
+
     public:
         // =============
         // Constructors
@@ -92,8 +100,29 @@ namespace Silent
         // Utilities
         // ==========
 
-        /** @brief Initializes the application and its subsystems. */
-        void Initialize();
+        /** @brief Initializes the application and its subsystems.
+         *
+         * @param args Command line arguments without the executable path.
+         * @note Supported arguments:
+         * - `--record`: Records input from startup and saves it on shutdown.
+         * - `--replay <path>`: Runs a replay benchmark of an input recording, then writes the frame time series and quits.
+         * - `--bench <name>`: Runs a subsystem benchmark, logs its results, and quits. Benchmarks write savegames to a separate `Benchmark` workspace folder.
+         *   - `savegame-metadata`: Fills every slot with savegames, then times loading slot indices and rescanning slots.
+         *   - `savegame-io`: Writes and loads a full slot file of savegames with and without snapshot mode, then times the quicksave ring.
+         *   - `input-recording`: Encodes and replays a synthetic input session.
+         *   - `input-actions`: Times input action updates across all actions.
+         *   - `text-shaping`: Shapes a screen of messages every frame with and without the shaped text cache.
+         *   - `tick-allocations`: Runs steady-state ticks and fails if a tick's update and snapshot handoff allocate on the game thread.
+         *   - `frame-pacing`: Runs the application loop for a few seconds, then logs frame intervals, input-to-submit latency, and dropped ticks of the last sampling window.
+         * - `--test <name>`: Runs a CPU-side test suite, or every suite if the name is `all`, and quits. Fails startup with an exception on the first failed check.
+         *   - `batcher`: Checks 2D batch merging across blend modes, scale modes, and textures.
+         *   - `debug-shapes`: Checks debug shape instance grouping and that instance transforms place unit meshes in world space.
+         *   - `texture-atlas`: Checks atlas image placement, edge padding, page limits, texture indices, and UV remapping.
+         *   - `upload-ring`: Simulates upload frames in flight and checks page reuse only after retirement.
+         *   - `ordering-table`: Checks ordering table draw order, same-Z LIFO order, Z clamping, arena limits, and clearing.
+         *   - `distance-field`: Checks a generated distance field of an anti-aliased disc against its analytic signed distance.
+         */
+        void Initialize(const std::vector<std::string>& args = {});
 
         /** @brief Gracefully deinitializes the application and its subsystems. */
         void Deinitialize();
@@ -121,10 +150,10 @@ namespace Silent
         /** @brief Updates the game application at a fixed timestep. */
         void Update();
 
-        /** @brief Updates the game render buffer. */
+        /** @brief Publishes the game tick's render submissions to the render worker. Never blocks. */
         void UpdateRenderBuffer();
 
-        /** @brief Renders the application scene. */
+        /** @brief Renders the application scene on a worker if the previous frame has finished. Never blocks. */
         void Render();
 
         /** @brief Polls window events to handle quitting, window resizing, toggling fullscreen mode, and connecting or disconnecting a gamepad.
@@ -132,6 +161,27 @@ namespace Silent
          * @note Additionally polls mouse wheel input as a workaround to input device query limitations.
          */
         void PollEvents();
+
+        /** @brief Writes the replay benchmark frame time series to a CSV file and logs a summary. */
+        void SaveFrameTimes() const;
+
+        /** @brief Runs the subsystem benchmark named on the command line. */
+        void RunBench();
+
+        /** @brief Runs ticks at the fixed timestep, rendering each one, and counts game thread heap allocations after a warm-up.
+         *
+         * @param warmUpTickCount Ticks to run before counting, so that lazily grown storage reaches its steady-state capacity.
+         * @param tickCount Ticks to count.
+         * @exception `std::runtime_error` if any counted tick allocates.
+         */
+        void BenchmarkTickAllocations(uint warmUpTickCount, uint tickCount);
+
+        /** @brief Runs the application loop for a number of ticks and logs the render worker's last frame pacing window.
+         *
+         * @param tickCount Ticks to run. Must span at least one full sampling window.
+         * @exception `std::runtime_error` if no sampling window completed.
+         */
+        void BenchmarkFramePacing(uint tickCount);
     };
 
     extern ApplicationManager g_App;
@@ -2,8 +2,10 @@
 #include "Assets/Assets.h"
 
 #include "Application.h"
+#include "Assets/Parsers/Kdt.h"
 #include "Assets/Parsers/Tim.h"
 #include "Assets/Parsers/Tmd.h"
+#include "Assets/Parsers/Vab.h"
 #include "Utils/Parallel.h"
 #include "Utils/Utils.h"
 
@@ -31,7 +33,9 @@ namespace Silent::Assets
     static const auto PARSER_FUNCS = std::unordered_map<AssetType, std::function<std::shared_ptr<void>(const std::filesystem::path& file)>>
     {
         { AssetType::Tim, ParseTim },
-        { AssetType::Tmd, ParseTmd }
+        { AssetType::Vab, ParseVab },
+        { AssetType::Tmd, ParseTmd },
+        { AssetType::Kdt, ParseKdt }
     };
 
     const std::string& AssetManager::GetAssetName(int assetIdx) const
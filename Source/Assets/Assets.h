@@ -1,7 +1,9 @@
 #pragma once
 
+#include "Assets/Parsers/Kdt.h"
 #include "Assets/Parsers/Tim.h"
 #include "Assets/Parsers/Tmd.h"
+#include "Assets/Parsers/Vab.h"
 
 namespace Silent::Assets
 {
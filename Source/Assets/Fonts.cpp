@@ -1,6 +1,8 @@
 #include "Framework.h"
 #include "Assets/Fonts.h"
 
+using namespace Silent::Utils;
+
 namespace Silent::Assets
 {
     /** @brief String color IDs for strings displayed in screen space.
@@ -34,14 +36,15 @@ namespace Silent::Assets
     {
         FontMetadata
         {
-            .Name      = "Smooth",
-            .Filenames =
+            .Name       = "Smooth",
+            .Filenames  =
             {
                 "FreeSerif.otf",
                 "NotoSerifJP-Medium.ttf",
                 "NotoSerifKR-Medium.ttf"
             },
-            .PointSize = 48
+            .PointSize  = 48,
+            .RasterMode = GlyphRasterMode::DistanceField
         },
         FontMetadata
         {
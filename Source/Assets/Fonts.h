@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Utils/Font.h"
+
 namespace Silent::Assets
 {
     constexpr char ASSETS_FONTS_DIR_NAME[] = "Fonts";
@@ -16,9 +18,10 @@ namespace Silent::Assets
 
     struct FontMetadata
     {
-        std::string              Name      = {};
-        std::vector<std::string> Filenames = {};
-        int                      PointSize = 0;
+        std::string              Name       = {};
+        std::vector<std::string> Filenames  = {};
+        int                      PointSize  = 0;
+        Utils::GlyphRasterMode   RasterMode = Utils::GlyphRasterMode::Coverage;
     };
 
     extern const std::vector<FontMetadata> FONTS_METADATA;
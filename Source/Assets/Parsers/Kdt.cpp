@@ -0,0 +1,232 @@
+#include "Framework.h"
+#include "Assets/Parsers/Kdt.h"
+
+namespace Silent::Assets
+{
+    constexpr uint KDT_TRACK_COUNT_MAX = 32;
+
+    /** @brief KDT file header. Followed by a table of 16-bit track sizes, then the track data. */
+    struct KdtHeader
+    {
+        uint32 Magic        = 0;
+        uint32 FileSize     = 0;
+        uint32 TicksPerBeat = 0;
+        uint32 TrackCount   = 0;
+    };
+    static_assert(sizeof(KdtHeader) == 16);
+
+    /** @brief Parses one KDT track of MIDI-style events with variable-length delta times and running status.
+     *
+     * @param filename File path for error messages.
+     * @param trackIdx Track index for error messages.
+     * @param track Track data.
+     * @param[out] events Events to append to.
+     * @return End tick of the track.
+     * @exception std::runtime_error if the track contains an unsupported event.
+     */
+    static uint32 ParseKdtTrack(const std::filesystem::path& filename, int trackIdx, std::span<const uint8> track, std::vector<KdtEvent>& events)
+    {
+        constexpr uint8 CC_NRPN_MSB     = 99;
+        constexpr uint8 NRPN_LOOP_START = 20;
+        constexpr uint8 NRPN_LOOP_END   = 30;
+        constexpr uint8 META_END        = 0x2F;
+        constexpr uint8 META_TEMPO      = 0x51;
+
+        uint   offset  = 0;
+        uint32 tick    = 0;
+        uint8  status  = 0;
+        auto   readVar = [&]()
+        {
+            uint32 value = 0;
+            for (int i = 0; i < 4 && offset < track.size(); i++)
+            {
+                uint8 curByte = track[offset++];
+                value         = (value << 7) | (curByte & 0x7F);
+                if (!(curByte & 0x80))
+                {
+                    break;
+                }
+            }
+
+            return value;
+        };
+        auto readByte = [&]()
+        {
+            return (offset < track.size()) ? track[offset++] : (uint8)0;
+        };
+
+        while (offset < track.size())
+        {
+            tick += readVar();
+
+            // Use running status if no status byte.
+            if (offset < track.size() && (track[offset] & 0x80))
+            {
+                status = track[offset++];
+            }
+
+            uint8 channel = status & 0xF;
+            switch (status & 0xF0)
+            {
+                case 0x80:
+                case 0x90:
+                {
+                    uint8 key      = readByte();
+                    uint8 velocity = readByte();
+                    bool  isOn     = (status & 0xF0) == 0x90 && velocity != 0;
+                    events.push_back(KdtEvent{ .Tick = tick, .Type = isOn ? KdtEventType::NoteOn : KdtEventType::NoteOff, .Channel = channel, .Data0 = key, .Data1 = velocity });
+                    break;
+                }
+
+                case 0xB0:
+                {
+                    uint8 ctrl  = readByte();
+                    uint8 value = readByte();
+
+                    // Loop markers use the PsyQ NRPN convention.
+                    if (ctrl == CC_NRPN_MSB && (value == NRPN_LOOP_START || value == NRPN_LOOP_END))
+                    {
+                        events.push_back(KdtEvent{ .Tick = tick, .Type = (value == NRPN_LOOP_START) ? KdtEventType::LoopStart : KdtEventType::LoopEnd, .Channel = channel });
+                        break;
+                    }
+
+                    events.push_back(KdtEvent{ .Tick = tick, .Type = KdtEventType::Controller, .Channel = channel, .Data0 = ctrl, .Data1 = value });
+                    break;
+                }
+
+                case 0xC0:
+                {
+                    events.push_back(KdtEvent{ .Tick = tick, .Type = KdtEventType::ProgramChange, .Channel = channel, .Data0 = readByte() });
+                    break;
+                }
+
+                case 0xE0:
+                {
+                    uint8 lsb = readByte();
+                    uint8 msb = readByte();
+                    events.push_back(KdtEvent{ .Tick = tick, .Type = KdtEventType::PitchBend, .Channel = channel, .Value = (uint32)((msb << 7) | lsb) });
+                    break;
+                }
+
+                // Aftertouch is ignored.
+                case 0xA0:
+                {
+                    offset += 2;
+                    break;
+                }
+
+                case 0xD0:
+                {
+                    offset += 1;
+                    break;
+                }
+
+                case 0xF0:
+                {
+                    // Meta event.
+                    if (status == 0xFF)
+                    {
+                        uint8  type = readByte();
+                        uint32 size = readVar();
+                        if (type == META_END)
+                        {
+                            return tick;
+                        }
+
+                        if (type == META_TEMPO && size == 3 && (offset + 3) <= track.size())
+                        {
+                            uint32 tempo = (track[offset] << 16) | (track[offset + 1] << 8) | track[offset + 2];
+                            events.push_back(KdtEvent{ .Tick = tick, .Type = KdtEventType::Tempo, .Value = tempo });
+                        }
+
+                        offset += size;
+                        break;
+                    }
+
+                    // SysEx is ignored.
+                    offset += readVar();
+                    break;
+                }
+
+                default:
+                {
+                    throw std::runtime_error(Fmt("KDT `{}` track {} has unsupported status {:#04x} at offset {}.", filename.string(), trackIdx, status, offset));
+                }
+            }
+        }
+
+        return tick;
+    }
+
+    std::shared_ptr<void> ParseKdt(const std::filesystem::path& filename)
+    {
+        constexpr uint32 HEADER_MAGIC = 0x3154444B; // "KDT1".
+
+        // Read file.
+        auto file = std::ifstream(filename, std::ios::binary);
+        if (!file.is_open())
+        {
+            throw std::runtime_error(Fmt("Failed to open KDT `{}`.", filename.string()));
+        }
+
+        auto data = std::vector<uint8>(std::filesystem::file_size(filename));
+        file.read((byte*)data.data(), data.size());
+
+        // Read and validate header.
+        auto header = KdtHeader{};
+        if (data.size() < sizeof(header))
+        {
+            throw std::runtime_error(Fmt("Invalid KDT `{}`.", filename.string()));
+        }
+        std::memcpy(&header, data.data(), sizeof(header));
+
+        uint trackDataOffset = sizeof(header) + (header.TrackCount * sizeof(uint16));
+        if (header.Magic != HEADER_MAGIC || header.TrackCount == 0 || header.TrackCount > KDT_TRACK_COUNT_MAX || header.TicksPerBeat == 0 ||
+            trackDataOffset > data.size())
+        {
+            throw std::runtime_error(Fmt("Invalid KDT `{}`.", filename.string()));
+        }
+
+        // Parse tracks.
+        auto   asset   = KdtAsset{ .TicksPerBeat = header.TicksPerBeat };
+        uint32 endTick = 0;
+        uint   offset  = trackDataOffset;
+        for (int i = 0; i < header.TrackCount; i++)
+        {
+            uint16 trackSize = 0;
+            std::memcpy(&trackSize, &data[sizeof(header) + (i * sizeof(uint16))], sizeof(uint16));
+            if ((offset + trackSize) > data.size())
+            {
+                throw std::runtime_error(Fmt("KDT `{}` track {} is truncated.", filename.string(), i));
+            }
+
+            endTick  = std::max(endTick, ParseKdtTrack(filename, i, std::span<const uint8>(data).subspan(offset, trackSize), asset.Events));
+            offset  += trackSize;
+        }
+
+        // Merge tracks in playback order. Note offs come first so retriggered keys aren't cut.
+        std::stable_sort(asset.Events.begin(), asset.Events.end(), [](const KdtEvent& event0, const KdtEvent& event1)
+        {
+            if (event0.Tick != event1.Tick)
+            {
+                return event0.Tick < event1.Tick;
+            }
+
+            return event0.Type == KdtEventType::NoteOff && event1.Type != KdtEventType::NoteOff;
+        });
+
+        // Find loop start.
+        for (int i = 0; i < asset.Events.size(); i++)
+        {
+            if (asset.Events[i].Type == KdtEventType::LoopStart)
+            {
+                asset.LoopStartEventIdx = i;
+                break;
+            }
+        }
+
+        uint32 lastTick = asset.Events.empty() ? 0 : asset.Events.back().Tick;
+        asset.Events.push_back(KdtEvent{ .Tick = std::max(endTick, lastTick), .Type = KdtEventType::End });
+        return std::make_shared<KdtAsset>(std::move(asset));
+    }
+}
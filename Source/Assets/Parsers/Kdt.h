@@ -0,0 +1,46 @@
+#pragma once
+
+namespace Silent::Assets
+{
+    /** @brief KDT sequence event types. */
+    enum class KdtEventType
+    {
+        NoteOn,
+        NoteOff,
+        Controller,
+        ProgramChange,
+        PitchBend,
+        Tempo,
+        LoopStart,
+        LoopEnd,
+        End,
+
+        Count
+    };
+
+    /** @brief KDT sequence event. Events of all tracks are merged in playback order. */
+    struct KdtEvent
+    {
+        uint32       Tick    = 0;                   /** Absolute time in ticks. */
+        KdtEventType Type    = KdtEventType::Count;
+        uint8        Channel = 0;
+        uint8        Data0   = 0;                   /** Key, controller, or program. */
+        uint8        Data1   = 0;                   /** Velocity or controller value. */
+        uint32       Value   = 0;                   /** Pitch bend from 0 to 16383 with 8192 = center, or tempo in microseconds per beat. */
+    };
+
+    /** @brief KDT asset data. */
+    struct KdtAsset
+    {
+        uint                  TicksPerBeat      = 0;
+        int                   LoopStartEventIdx = NO_VALUE; /** Loop start marker event, or `NO_VALUE` to loop from the beginning. */
+        std::vector<KdtEvent> Events            = {};       /** Sorted by tick. Always ends with a single `End` event. */
+    };
+
+    /** @brief Parses a KDT file to a usable asset.
+     *
+     * @param filename Absolute asset file path on the system.
+     * @return Parsed KDT asset data as a `void` pointer.
+     */
+    std::shared_ptr<void> ParseKdt(const std::filesystem::path& filename);
+}
@@ -0,0 +1,177 @@
+#include "Framework.h"
+#include "Assets/Parsers/Vab.h"
+
+namespace Silent::Assets
+{
+    constexpr uint VAB_PROGRAM_COUNT_MAX  = 128;
+    constexpr uint VAB_PROGRAM_TONE_COUNT = 16;
+    constexpr uint VAB_VAG_COUNT_MAX      = 256;
+
+    /** @brief VAB file header. Matches the PsyQ `VabHdr` layout. */
+    struct VabHeader
+    {
+        uint32 Magic        = 0;
+        uint32 Version      = 0;
+        uint32 Id           = 0;
+        uint32 FileSize     = 0;
+        uint16 Reserved0    = 0;
+        uint16 ProgramCount = 0;
+        uint16 ToneCount    = 0;
+        uint16 VagCount     = 0;
+        uint8  Volume       = 0;
+        uint8  Pan          = 0;
+        uint8  Attrib0      = 0;
+        uint8  Attrib1      = 0;
+        uint32 Reserved1    = 0;
+    };
+    static_assert(sizeof(VabHeader) == 32);
+
+    /** @brief VAB program attributes. Matches the PsyQ `ProgAtr` layout. */
+    struct VabProgramAttribs
+    {
+        uint8  ToneCount = 0;
+        uint8  Volume    = 0;
+        uint8  Priority  = 0;
+        uint8  Mode      = 0;
+        uint8  Pan       = 0;
+        uint8  Reserved0 = 0;
+        int16  Attrib    = 0;
+        uint32 Reserved1 = 0;
+        uint32 Reserved2 = 0;
+    };
+    static_assert(sizeof(VabProgramAttribs) == 16);
+
+    /** @brief VAB tone attributes. Matches the PsyQ `VagAtr` layout. */
+    struct VabToneAttribs
+    {
+        uint8                Priority     = 0;
+        uint8                Mode         = 0;
+        uint8                Volume       = 0;
+        uint8                Pan          = 0;
+        uint8                CenterNote   = 0;
+        uint8                CenterFine   = 0;
+        uint8                NoteMin      = 0;
+        uint8                NoteMax      = 0;
+        uint8                VibratoWidth = 0;
+        uint8                VibratoTime  = 0;
+        uint8                PortaWidth   = 0;
+        uint8                PortaTime    = 0;
+        uint8                PitchBendMin = 0;
+        uint8                PitchBendMax = 0;
+        uint8                Reserved0    = 0;
+        uint8                Reserved1    = 0;
+        uint16               Adsr1        = 0;
+        uint16               Adsr2        = 0;
+        int16                Program      = 0;
+        int16                Vag          = 0;
+        std::array<int16, 4> Reserved2    = {};
+    };
+    static_assert(sizeof(VabToneAttribs) == 32);
+
+    std::shared_ptr<void> ParseVab(const std::filesystem::path& filename)
+    {
+        constexpr uint32 HEADER_MAGIC   = 0x56414270; // "pBAV".
+        constexpr uint   VAG_SIZE_SHIFT = 3;
+
+        // Read file.
+        auto file = std::ifstream(filename, std::ios::binary);
+        if (!file.is_open())
+        {
+            throw std::runtime_error(Fmt("Failed to open VAB `{}`.", filename.string()));
+        }
+
+        // Read and validate header.
+        auto header = VabHeader{};
+        file.read((byte*)&header, sizeof(header));
+        if (!file || header.Magic != HEADER_MAGIC)
+        {
+            throw std::runtime_error(Fmt("Invalid VAB `{}`.", filename.string()));
+        }
+
+        if (header.ProgramCount > VAB_PROGRAM_COUNT_MAX || header.VagCount >= VAB_VAG_COUNT_MAX)
+        {
+            throw std::runtime_error(Fmt("VAB `{}` has invalid program count {} or VAG count {}.", filename.string(), header.ProgramCount, header.VagCount));
+        }
+
+        // Read program attributes.
+        auto programAttribs = std::array<VabProgramAttribs, VAB_PROGRAM_COUNT_MAX>{};
+        file.read((byte*)programAttribs.data(), sizeof(programAttribs));
+
+        // Read tone attributes. Each used program owns one block of tones.
+        auto toneAttribs = std::vector<VabToneAttribs>(header.ProgramCount * VAB_PROGRAM_TONE_COUNT);
+        file.read((byte*)toneAttribs.data(), toneAttribs.size() * sizeof(VabToneAttribs));
+
+        // Read VAG sizes. First entry is unused.
+        auto vagSizes = std::array<uint16, VAB_VAG_COUNT_MAX>{};
+        file.read((byte*)vagSizes.data(), sizeof(vagSizes));
+        if (!file)
+        {
+            throw std::runtime_error(Fmt("VAB `{}` header is truncated.", filename.string()));
+        }
+
+        // Create asset.
+        auto asset = VabAsset
+        {
+            .Volume   = header.Volume,
+            .Pan      = header.Pan,
+            .Programs = std::vector<VabProgram>(VAB_PROGRAM_COUNT_MAX),
+            .Samples  = std::vector<VabSample>(header.VagCount)
+        };
+
+        // Collect programs and tones.
+        uint blockIdx = 0;
+        for (int i = 0; i < VAB_PROGRAM_COUNT_MAX && blockIdx < header.ProgramCount; i++)
+        {
+            const auto& programAttrib = programAttribs[i];
+            if (programAttrib.ToneCount == 0)
+            {
+                continue;
+            }
+
+            auto& program    = asset.Programs[i];
+            program.Volume   = programAttrib.Volume;
+            program.Priority = programAttrib.Priority;
+            program.Mode     = programAttrib.Mode;
+            program.Pan      = programAttrib.Pan;
+
+            uint toneCount = std::min<uint>(programAttrib.ToneCount, VAB_PROGRAM_TONE_COUNT);
+            program.Tones.reserve(toneCount);
+            for (int j = 0; j < toneCount; j++)
+            {
+                const auto& toneAttrib = toneAttribs[(blockIdx * VAB_PROGRAM_TONE_COUNT) + j];
+                program.Tones.push_back(VabTone
+                {
+                    .Priority     = toneAttrib.Priority,
+                    .Mode         = toneAttrib.Mode,
+                    .Volume       = toneAttrib.Volume,
+                    .Pan          = toneAttrib.Pan,
+                    .CenterNote   = toneAttrib.CenterNote,
+                    .CenterFine   = toneAttrib.CenterFine,
+                    .NoteMin      = toneAttrib.NoteMin,
+                    .NoteMax      = toneAttrib.NoteMax,
+                    .PitchBendMin = toneAttrib.PitchBendMin,
+                    .PitchBendMax = toneAttrib.PitchBendMax,
+                    .Adsr1        = toneAttrib.Adsr1,
+                    .Adsr2        = toneAttrib.Adsr2,
+                    .VagIdx       = (toneAttrib.Vag > 0 && toneAttrib.Vag <= header.VagCount) ? (toneAttrib.Vag - 1) : NO_VALUE
+                });
+            }
+
+            blockIdx++;
+        }
+
+        // Read VAG sample bodies.
+        for (int i = 0; i < header.VagCount; i++)
+        {
+            auto& sample = asset.Samples[i];
+            sample.Adpcm.resize(vagSizes[i + 1] << VAG_SIZE_SHIFT);
+            file.read(sample.Adpcm.data(), sample.Adpcm.size());
+            if (!file)
+            {
+                throw std::runtime_error(Fmt("VAB `{}` sample {} is truncated.", filename.string(), i));
+            }
+        }
+
+        return std::make_shared<VabAsset>(std::move(asset));
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+namespace Silent::Assets
+{
+    /** @brief VAB tone attributes. Maps a note range of a program to a VAG sample. */
+    struct VabTone
+    {
+        uint8  Priority     = 0;
+        uint8  Mode         = 0;  /** Reverb flag in bit 2. */
+        uint8  Volume       = 0;
+        uint8  Pan          = 0;  /** 64 = center. */
+        uint8  CenterNote   = 0;  /** Note at which the sample plays at its base rate. */
+        uint8  CenterFine   = 0;  /** Center note fine tune in 1/128 semitones. */
+        uint8  NoteMin      = 0;
+        uint8  NoteMax      = 0;
+        uint8  PitchBendMin = 0;
+        uint8  PitchBendMax = 0;
+        uint16 Adsr1        = 0;  /** SPU attack, decay, and sustain level register value. */
+        uint16 Adsr2        = 0;  /** SPU sustain and release register value. */
+        int    VagIdx       = 0;  /** Index into `VabAsset::Samples`, or `NO_VALUE` if invalid. */
+    };
+
+    /** @brief VAB program attributes. Equivalent to a MIDI instrument. */
+    struct VabProgram
+    {
+        uint8                Volume   = 0;
+        uint8                Priority = 0;
+        uint8                Mode     = 0;
+        uint8                Pan      = 0;  /** 64 = center. */
+        std::vector<VabTone> Tones    = {};
+    };
+
+    /** @brief VAG sample data. */
+    struct VabSample
+    {
+        std::vector<byte> Adpcm = {}; /** SPU ADPCM data in 16-byte blocks. Decoded on demand or up front by the audio sound bank. */
+    };
+
+    /** @brief VAB asset data. */
+    struct VabAsset
+    {
+        uint8                   Volume   = 0;
+        uint8                   Pan      = 0;  /** 64 = center. */
+        std::vector<VabProgram> Programs = {}; /** Index = program number. Unused programs have no tones. */
+        std::vector<VabSample>  Samples  = {}; /** Index = VAG number - 1. */
+    };
+
+    /** @brief Parses a VAB file to a usable asset.
+     *
+     * @param filename Absolute asset file path on the system.
+     * @return Parsed VAB asset data as a `void` pointer.
+     */
+    std::shared_ptr<void> ParseVab(const std::filesystem::path& filename);
+}
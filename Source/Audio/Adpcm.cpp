@@ -0,0 +1,92 @@
+#include "Framework.h"
+#include "Audio/Adpcm.h"
+
+namespace Silent::Audio
+{
+    constexpr uint ADPCM_FILTER_COUNT = 5;
+
+    constexpr std::array<int32, ADPCM_FILTER_COUNT> ADPCM_POS_COEFFS = { 0, 60, 115, 98, 122 };
+    constexpr std::array<int32, ADPCM_FILTER_COUNT> ADPCM_NEG_COEFFS = { 0, 0, -52, -55, -60 };
+
+    void DecodeAdpcmBlock(uint8 header, std::span<const uint8, ADPCM_BLOCK_SAMPLE_COUNT> nibbles, AdpcmHistory& history,
+                          std::span<int16, ADPCM_BLOCK_SAMPLE_COUNT> samples)
+    {
+        constexpr uint SHIFT_MAX      = 12;
+        constexpr uint SHIFT_RESERVED = 9;
+
+        // Reserved shifts behave like 9 and reserved filters like the last filter on hardware.
+        uint shift  = header & 0xF;
+        uint filter = std::min<uint>((header >> 4) & 0xF, ADPCM_FILTER_COUNT - 1);
+        if (shift > SHIFT_MAX)
+        {
+            shift = SHIFT_RESERVED;
+        }
+
+        // Expand residuals. Samples are independent here, so the loop vectorizes.
+        auto residuals = std::array<int32, ADPCM_BLOCK_SAMPLE_COUNT>{};
+        for (int i = 0; i < ADPCM_BLOCK_SAMPLE_COUNT; i++)
+        {
+            residuals[i] = (int32)(int16)(nibbles[i] << 12) >> shift;
+        }
+
+        // Apply prediction filter.
+        int32 posCoeff = ADPCM_POS_COEFFS[filter];
+        int32 negCoeff = ADPCM_NEG_COEFFS[filter];
+        int32 prev0    = history.Prev0;
+        int32 prev1    = history.Prev1;
+        for (int i = 0; i < ADPCM_BLOCK_SAMPLE_COUNT; i++)
+        {
+            int32 sample = residuals[i] + (((prev0 * posCoeff) + (prev1 * negCoeff) + 32) >> 6);
+            sample       = std::clamp<int32>(sample, std::numeric_limits<int16>::min(), std::numeric_limits<int16>::max());
+            samples[i]   = (int16)sample;
+
+            prev1 = prev0;
+            prev0 = sample;
+        }
+
+        history.Prev0 = prev0;
+        history.Prev1 = prev1;
+    }
+
+    AdpcmPcm DecodeSpuAdpcm(std::span<const byte> adpcm)
+    {
+        uint blockCount = (uint)(adpcm.size() / ADPCM_BLOCK_SIZE);
+
+        auto pcm     = AdpcmPcm{};
+        auto history = AdpcmHistory{};
+        auto nibbles = std::array<uint8, ADPCM_BLOCK_SAMPLE_COUNT>{};
+        pcm.Samples.resize(blockCount * ADPCM_BLOCK_SAMPLE_COUNT);
+
+        // Decode blocks.
+        uint sampleCount = 0;
+        for (uint i = 0; i < blockCount; i++)
+        {
+            const auto* block = (const uint8*)&adpcm[i * ADPCM_BLOCK_SIZE];
+            uint8       flags = block[1];
+
+            // Unpack nibbles, low nibble first.
+            for (int j = 0; j < (ADPCM_BLOCK_SAMPLE_COUNT / 2); j++)
+            {
+                nibbles[(j * 2) + 0] = block[2 + j] & 0xF;
+                nibbles[(j * 2) + 1] = block[2 + j] >> 4;
+            }
+
+            if (flags & (int)AdpcmBlockFlags::LoopStart)
+            {
+                pcm.LoopStart = sampleCount;
+            }
+
+            DecodeAdpcmBlock(block[0], nibbles, history, std::span<int16, ADPCM_BLOCK_SAMPLE_COUNT>(&pcm.Samples[sampleCount], ADPCM_BLOCK_SAMPLE_COUNT));
+            sampleCount += ADPCM_BLOCK_SAMPLE_COUNT;
+
+            if (flags & (int)AdpcmBlockFlags::End)
+            {
+                pcm.IsLooping = flags & (int)AdpcmBlockFlags::Repeat;
+                break;
+            }
+        }
+
+        pcm.Samples.resize(sampleCount);
+        return pcm;
+    }
+}
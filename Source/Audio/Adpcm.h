@@ -0,0 +1,49 @@
+#pragma once
+
+namespace Silent::Audio
+{
+    constexpr uint ADPCM_BLOCK_SIZE         = 16;
+    constexpr uint ADPCM_BLOCK_SAMPLE_COUNT = 28;
+
+    /** @brief SPU ADPCM block flags. */
+    enum class AdpcmBlockFlags
+    {
+        End       = 1 << 0, /** Last block. Jumps to the loop start if `Repeat` is set, otherwise the voice stops. */
+        Repeat    = 1 << 1,
+        LoopStart = 1 << 2
+    };
+
+    /** @brief ADPCM prediction filter history. Carried across blocks of the same stream. */
+    struct AdpcmHistory
+    {
+        int32 Prev0 = 0; /** Last decoded sample. */
+        int32 Prev1 = 0; /** Second to last decoded sample. */
+    };
+
+    /** @brief Decoded SPU ADPCM stream. */
+    struct AdpcmPcm
+    {
+        std::vector<int16> Samples   = {};
+        uint               LoopStart = 0;     /** Sample at which playback restarts if looping. */
+        bool               IsLooping = false;
+    };
+
+    /** @brief Decodes one PSX ADPCM block of 28 4-bit samples. Shared by SPU and XA streams, which pack nibbles differently
+     * but use the same prediction filters. Residuals are expanded in an independent pass that compilers vectorize,
+     * followed by the serial prediction filter pass.
+     *
+     * @param header Block header byte with the shift in the low nibble and the filter in the high nibble.
+     * @param nibbles 28 unpacked 4-bit samples, one per byte.
+     * @param history Filter history, updated in place.
+     * @param[out] samples 28 decoded samples.
+     */
+    void DecodeAdpcmBlock(uint8 header, std::span<const uint8, ADPCM_BLOCK_SAMPLE_COUNT> nibbles, AdpcmHistory& history,
+                          std::span<int16, ADPCM_BLOCK_SAMPLE_COUNT> samples);
+
+    /** @brief Decodes a whole SPU ADPCM stream such as a VAG sample body, stopping at the first block with the end flag.
+     *
+     * @param adpcm SPU ADPCM data in 16-byte blocks.
+     * @return Decoded PCM with loop points.
+     */
+    AdpcmPcm DecodeSpuAdpcm(std::span<const byte> adpcm);
+}
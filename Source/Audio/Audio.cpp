@@ -1,19 +1,60 @@
 #include "Framework.h"
 #include "Audio/Audio.h"
 
+#include "Audio/SoundBank.h"
+
+using namespace Silent::Assets;
+
 namespace Silent::Audio
 {
-    void AudioManager::Initialize()
+    MixerStats AudioManager::GetMixerStats() const
     {
+        return _mixer.GetStats();
+    }
+
+    uint AudioManager::GetOverflowCommandCount() const
+    {
+        return (uint)_overflowCommands.size();
+    }
+
+    StreamBuffer* AudioManager::GetStream(int streamId)
+    {
+        if (streamId < 0 || streamId >= _streams.size())
+        {
+            return nullptr;
+        }
+
+        return &_streams[streamId];
+    }
+
+    bool AudioManager::IsSequencePlaying(int seqId) const
+    {
+        if (seqId < 0 || seqId >= _sequencers.size())
+        {
+            return false;
+        }
+
+        return _sequencers[seqId].IsPlaying();
+    }
+
+    void AudioManager::Initialize(bool isOffline)
+    {
+        _isOffline = isOffline;
+        if (_isOffline)
+        {
+            return;
+        }
+
         // Desired output format.
         static auto spec = SDL_AudioSpec
         {
-            .format   = SDL_AUDIO_S16, // 16-bit signed samples.
-            .channels = 2,             // Stereo.
-            .freq     = 44100          // 44.1 kHz sample rate.
+            .format   = SDL_AUDIO_S16,       // 16-bit signed samples.
+            .channels = MIXER_CHANNEL_COUNT, // Stereo.
+            .freq     = MIXER_SAMPLE_RATE    // 44.1 kHz sample rate.
         };
 
-        _stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, nullptr, nullptr);
+        // Open stream pulling mixer output on audio thread.
+        _stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, HandleStreamCallback, this);
         if (_stream == nullptr)
         {
             throw std::runtime_error(Fmt("Failed to open audio stream: {}", std::string(SDL_GetError())));
@@ -24,31 +65,195 @@ namespace Silent::Audio
 
     void AudioManager::Deinitialize()
     {
-        SDL_CloseAudioDevice(SDL_GetAudioStreamDevice(_stream));
-        SDL_DestroyAudioStream(_stream);
+        if (_stream != nullptr)
+        {
+            SDL_CloseAudioDevice(SDL_GetAudioStreamDevice(_stream));
+            SDL_DestroyAudioStream(_stream);
+            _stream = nullptr;
+        }
+
+        // Sounds are freed once no voice can reference them.
+        _overflowCommands.clear();
+        _sounds.clear();
+        _streams.clear();
+        _sequencers.clear();
     }
 
     void AudioManager::Update()
     {
-        // @todo Memory leak.
-        return;
+        // Resend overflowing commands in order.
+        uint sentCount = 0;
+        for (const auto& cmd : _overflowCommands)
+        {
+            if (!_mixer.Submit(cmd))
+            {
+                break;
+            }
+
+            sentCount++;
+        }
+        _overflowCommands.erase(_overflowCommands.begin(), _overflowCommands.begin() + sentCount);
+    }
+
+    int AudioManager::AddSound(SoundData&& sound)
+    {
+        _sounds.push_back(std::move(sound));
+        return (int)_sounds.size() - 1;
+    }
+
+    int AudioManager::AddStream()
+    {
+        _streams.emplace_back();
+        return (int)_streams.size() - 1;
+    }
+
+    int AudioManager::AddSequence(std::shared_ptr<KdtAsset> kdt, SoundBank& bank)
+    {
+        // Decode all samples and resolve sounds.
+        bank.Predecode(*this);
+
+        auto vab    = bank.GetVab();
+        auto sounds = std::vector<const SoundData*>((vab != nullptr) ? vab->Samples.size() : 0);
+        for (int i = 0; i < sounds.size(); i++)
+        {
+            int soundId = bank.GetSoundId(*this, i);
+            sounds[i]   = (soundId != NO_VALUE) ? &_sounds[soundId] : nullptr;
+        }
+
+        _sequencers.emplace_back(kdt, vab, std::move(sounds));
+        return (int)_sequencers.size() - 1;
+    }
+
+    int AudioManager::PlaySound(int soundId, float gain, float pan, float pitch, bool isLooping)
+    {
+        if (soundId < 0 || soundId >= _sounds.size())
+        {
+            Debug::Log(Fmt("Attempted to play invalid sound {}.", soundId), Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return NO_VALUE;
+        }
+
+        int voiceId  = _nextVoiceId;
+        _nextVoiceId = (_nextVoiceId + 1) & std::numeric_limits<int>::max();
+
+        SubmitCommand(AudioCommand
+        {
+            .Type      = AudioCommandType::Play,
+            .VoiceId   = voiceId,
+            .Sound     = &_sounds[soundId],
+            .Gain      = gain,
+            .Pan       = pan,
+            .Pitch     = pitch,
+            .IsLooping = isLooping
+        });
+        return voiceId;
+    }
+
+    int AudioManager::PlayStream(int streamId, float gain, float pan)
+    {
+        auto* stream = GetStream(streamId);
+        if (stream == nullptr)
+        {
+            Debug::Log(Fmt("Attempted to play invalid stream {}.", streamId), Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return NO_VALUE;
+        }
 
-        static float time = 0.0f;
+        int voiceId  = _nextVoiceId;
+        _nextVoiceId = (_nextVoiceId + 1) & std::numeric_limits<int>::max();
 
-        // Generate a sine wave continuously.
-        const int sampleCount = 4096; // Number of samples to push per frame.
-        auto buf = std::vector<short>(sampleCount * 2); // Stereo.
+        SubmitCommand(AudioCommand
+        {
+            .Type    = AudioCommandType::PlayStream,
+            .VoiceId = voiceId,
+            .Stream  = stream,
+            .Gain    = gain,
+            .Pan     = pan
+        });
+        return voiceId;
+    }
 
-        float freq = 400.0f;
-        for (int i = 0; i < sampleCount; i++)
+    void AudioManager::PlaySequence(int seqId, float gain, bool isLooping)
+    {
+        if (seqId < 0 || seqId >= _sequencers.size())
         {
-            float alpha = time + (float)i / 44100.0f;
-            short sample = (short)(std::sin((PI_MUL_2 * freq) * alpha) * 3000.0f);
-            buf[(i * 2) + 0] = sample; // Left.
-            buf[(i * 2) + 1] = sample; // Right.
+            Debug::Log(Fmt("Attempted to play invalid sequence {}.", seqId), Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return;
         }
-        time += (float)sampleCount / 44100.0f;
 
-        SDL_PutAudioStreamData(_stream, buf.data(), buf.size() * sizeof(short));
+        SubmitCommand(AudioCommand{ .Type = AudioCommandType::PlaySequence, .Sequence = &_sequencers[seqId], .Gain = gain, .IsLooping = isLooping });
+    }
+
+    void AudioManager::StopSequence(int seqId)
+    {
+        if (seqId < 0 || seqId >= _sequencers.size())
+        {
+            return;
+        }
+
+        SubmitCommand(AudioCommand{ .Type = AudioCommandType::StopSequence, .Sequence = &_sequencers[seqId] });
+    }
+
+    void AudioManager::StopSound(int voiceId)
+    {
+        SubmitCommand(AudioCommand{ .Type = AudioCommandType::Stop, .VoiceId = voiceId });
+    }
+
+    void AudioManager::StopAllSounds()
+    {
+        SubmitCommand(AudioCommand{ .Type = AudioCommandType::StopAll });
+    }
+
+    void AudioManager::SetSoundGain(int voiceId, float gain)
+    {
+        SubmitCommand(AudioCommand{ .Type = AudioCommandType::SetGain, .VoiceId = voiceId, .Gain = gain });
+    }
+
+    void AudioManager::SetSoundPan(int voiceId, float pan)
+    {
+        SubmitCommand(AudioCommand{ .Type = AudioCommandType::SetPan, .VoiceId = voiceId, .Pan = pan });
+    }
+
+    void AudioManager::SetSoundPitch(int voiceId, float pitch)
+    {
+        SubmitCommand(AudioCommand{ .Type = AudioCommandType::SetPitch, .VoiceId = voiceId, .Pitch = pitch });
+    }
+
+    void AudioManager::Render(std::span<int16> samples)
+    {
+        if (!_isOffline)
+        {
+            Debug::Log("Attempted to render audio manually while audio device is open.", Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return;
+        }
+
+        Update();
+        _mixer.Render(samples);
+    }
+
+    void AudioManager::SubmitCommand(const AudioCommand& cmd)
+    {
+        // Queue behind earlier overflowing commands to preserve order.
+        if (!_overflowCommands.empty() || !_mixer.Submit(cmd))
+        {
+            _overflowCommands.push_back(cmd);
+        }
+    }
+
+    void SDLCALL AudioManager::HandleStreamCallback(void* userData, SDL_AudioStream* stream, int additionalAmount, int totalAmount)
+    {
+        constexpr int FRAME_SIZE = sizeof(int16) * MIXER_CHANNEL_COUNT;
+
+        auto& audio = *(AudioManager*)userData;
+
+        // Mix requested frames in blocks.
+        int frameCount = (additionalAmount + (FRAME_SIZE - 1)) / FRAME_SIZE;
+        while (frameCount > 0)
+        {
+            int blockFrameCount = std::min<int>(frameCount, Mixer::BLOCK_FRAME_COUNT);
+            auto samples        = std::span<int16>(audio._renderBuffer.data(), blockFrameCount * MIXER_CHANNEL_COUNT);
+
+            audio._mixer.Render(samples);
+            SDL_PutAudioStreamData(stream, samples.data(), (int)samples.size_bytes());
+            frameCount -= blockFrameCount;
+        }
     }
 }
@@ -1,8 +1,15 @@
 #pragma once
 
+#include "Assets/Parsers/Kdt.h"
+#include "Audio/Mixer.h"
+
 namespace Silent::Audio
 {
-    /** @brief Audio manager. */
+    class SoundBank;
+
+    /** @brief Audio manager. Sounds are mixed by a software mixer in the audio device callback, and the game thread
+     * controls voices through the mixer's lock-free command queue, so it never blocks on audio.
+     */
     class AudioManager
     {
     private:
@@ -10,7 +17,16 @@ namespace Silent::Audio
         // Fields
         // =======
 
-        SDL_AudioStream* _stream = nullptr;
+        SDL_AudioStream* _stream    = nullptr;
+        bool             _isOffline = false;
+
+        Mixer                                                             _mixer            = {};
+        std::array<int16, Mixer::BLOCK_FRAME_COUNT * MIXER_CHANNEL_COUNT> _renderBuffer     = {}; /** Device callback output block. */
+        std::deque<SoundData>                                             _sounds           = {}; /** Index = sound ID. Addresses stay stable for voices in flight. */
+        std::deque<StreamBuffer>                                          _streams          = {}; /** Index = stream ID. Addresses stay stable for voices in flight. */
+        std::deque<Sequencer>                                             _sequencers       = {}; /** Index = sequence ID. Addresses stay stable for the mixer. */
+        std::vector<AudioCommand>                                         _overflowCommands = {}; /** Commands rejected by a full queue, retried on update. */
+        int                                                               _nextVoiceId      = 0;
 
     public:
         // =============
@@ -19,17 +35,167 @@ namespace Silent::Audio
 
         AudioManager() = default;
 
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the mixer statistics.
+         *
+         * @return Mixer statistics.
+         */
+        MixerStats GetMixerStats() const;
+
+        /** @brief Gets the number of commands waiting for space in the mixer queue.
+         *
+         * @return Overflow command count.
+         */
+        uint GetOverflowCommandCount() const;
+
+        /** @brief Gets a registered stream buffer.
+         *
+         * @param streamId Stream ID.
+         * @return Stream buffer, or `nullptr` if the stream ID is invalid.
+         */
+        StreamBuffer* GetStream(int streamId);
+
+        // ==========
+        // Inquirers
+        // ==========
+
+        /** @brief Checks if a sequence is playing.
+         *
+         * @param seqId Sequence ID.
+         * @return `true` if playing, `false` otherwise.
+         */
+        bool IsSequencePlaying(int seqId) const;
+
         // ==========
         // Utilities
         // ==========
 
-        /** @brief Initializes the audio stream. */
-        void Initialize();
+        /** @brief Initializes the audio stream.
+         *
+         * @param isOffline If `true`, no audio device is opened and output is pulled with `Render` instead.
+         */
+        void Initialize(bool isOffline = false);
 
         /** @brief Gracefully deinitializes the audio manager. */
         void Deinitialize();
 
-        /** @brief Updates the audio system. */
+        /** @brief Updates the audio system, resending commands that didn't fit in the mixer queue. */
         void Update();
+
+        /** @brief Registers a sound for playback. Sounds stay loaded until deinitialization.
+         *
+         * @param sound PCM sound data.
+         * @return Sound ID.
+         */
+        int AddSound(SoundData&& sound);
+
+        /** @brief Registers a stream buffer for decoders to fill. Streams stay registered until deinitialization and should be reused.
+         *
+         * @return Stream ID.
+         */
+        int AddStream();
+
+        /** @brief Registers a KDT sequence with its VAB instrument bank, decoding all bank samples up front so the mixer never waits on them.
+         * Sequences stay registered until deinitialization.
+         *
+         * @param kdt Sequence.
+         * @param bank Instrument bank.
+         * @return Sequence ID.
+         */
+        int AddSequence(std::shared_ptr<Assets::KdtAsset> kdt, SoundBank& bank);
+
+        /** @brief Starts playing a sound on a new voice. The oldest voice is stolen if all are busy.
+         *
+         * @param soundId Sound ID.
+         * @param gain Linear gain.
+         * @param pan Stereo pan. -1 = left, 1 = right.
+         * @param pitch Playback rate multiplier.
+         * @param isLooping Loop flag.
+         * @return Voice ID, or `NO_VALUE` if the sound ID is invalid.
+         */
+        int PlaySound(int soundId, float gain = 1.0f, float pan = 0.0f, float pitch = 1.0f, bool isLooping = false);
+
+        /** @brief Starts playing a stream on a new voice. The oldest voice is stolen if all are busy.
+         *
+         * @param streamId Stream ID.
+         * @param gain Linear gain.
+         * @param pan Stereo pan. -1 = left, 1 = right.
+         * @return Voice ID, or `NO_VALUE` if the stream ID is invalid.
+         */
+        int PlayStream(int streamId, float gain = 1.0f, float pan = 0.0f);
+
+        /** @brief Starts playing a sequence from the beginning, restarting it if already playing.
+         * Sequences beyond `Mixer::SEQUENCER_COUNT_MAX` playing at once are ignored.
+         *
+         * @param seqId Sequence ID.
+         * @param gain Linear gain.
+         * @param isLooping Loop flag.
+         */
+        void PlaySequence(int seqId, float gain = 1.0f, bool isLooping = true);
+
+        /** @brief Stops a sequence and releases its notes.
+         *
+         * @param seqId Sequence ID.
+         */
+        void StopSequence(int seqId);
+
+        /** @brief Stops a voice. Finished or stolen voices are ignored.
+         *
+         * @param voiceId Voice ID.
+         */
+        void StopSound(int voiceId);
+
+        /** @brief Stops all voices. */
+        void StopAllSounds();
+
+        /** @brief Sets the gain of a voice.
+         *
+         * @param voiceId Voice ID.
+         * @param gain Linear gain.
+         */
+        void SetSoundGain(int voiceId, float gain);
+
+        /** @brief Sets the stereo pan of a voice.
+         *
+         * @param voiceId Voice ID.
+         * @param pan Stereo pan. -1 = left, 1 = right.
+         */
+        void SetSoundPan(int voiceId, float pan);
+
+        /** @brief Sets the pitch of a voice.
+         *
+         * @param voiceId Voice ID.
+         * @param pitch Playback rate multiplier.
+         */
+        void SetSoundPitch(int voiceId, float pitch);
+
+        /** @brief Renders mixer output on the calling thread. Only valid in offline mode, e.g. to check output in headless runs.
+         *
+         * @param samples Interleaved stereo 16-bit output at `MIXER_SAMPLE_RATE`.
+         */
+        void Render(std::span<int16> samples);
+
+    private:
+        // ========
+        // Helpers
+        // ========
+
+        /** @brief Sends a command to the mixer, deferring it to the next update if the queue is full.
+         *
+         * @param cmd Command to send.
+         */
+        void SubmitCommand(const AudioCommand& cmd);
+
+        /** @brief Audio device callback. Mixes the requested amount of audio into the stream on the audio thread.
+         *
+         * @param userData Audio manager.
+         * @param stream Audio stream.
+         * @param additionalAmount Bytes needed.
+         * @param totalAmount Bytes needed including queued data.
+         */
+        static void SDLCALL HandleStreamCallback(void* userData, SDL_AudioStream* stream, int additionalAmount, int totalAmount);
     };
 }
@@ -0,0 +1,543 @@
+#include "Framework.h"
+#include "Audio/Mixer.h"
+
+using namespace Silent::Assets;
+
+namespace Silent::Audio
+{
+    MixerStats Mixer::GetStats() const
+    {
+        return MixerStats
+        {
+            .ActiveVoiceCount     = _activeVoiceCount.load(std::memory_order_relaxed),
+            .RenderedFrameCount   = _renderedFrameCount.load(std::memory_order_relaxed),
+            .MixedVoiceFrameCount = _mixedVoiceFrameCount.load(std::memory_order_relaxed)
+        };
+    }
+
+    bool Mixer::Submit(const AudioCommand& cmd)
+    {
+        return _commands.Push(cmd);
+    }
+
+    void Mixer::Render(std::span<int16> samples)
+    {
+        constexpr float SAMPLE_SCALE = (float)std::numeric_limits<int16>::max();
+
+        // Apply pending commands.
+        auto cmd = AudioCommand{};
+        while (_commands.Pop(cmd))
+        {
+            HandleCommand(cmd);
+        }
+
+        // Mix in blocks.
+        uint frameCount = (uint)(samples.size() / MIXER_CHANNEL_COUNT);
+        for (uint frameOffset = 0; frameOffset < frameCount; frameOffset += BLOCK_FRAME_COUNT)
+        {
+            uint blockFrameCount  = std::min(BLOCK_FRAME_COUNT, frameCount - frameOffset);
+            uint blockSampleCount = blockFrameCount * MIXER_CHANNEL_COUNT;
+            std::fill(_mixBlock.begin(), _mixBlock.begin() + blockSampleCount, 0.0f);
+
+            // Split block at sequence events.
+            uint runOffset = 0;
+            while (runOffset < blockFrameCount)
+            {
+                uint runFrameCount = blockFrameCount - runOffset;
+                for (auto*& seq : _sequencers)
+                {
+                    if (seq == nullptr)
+                    {
+                        continue;
+                    }
+
+                    HandleSequenceEvents(*seq);
+                    if (!seq->IsPlaying())
+                    {
+                        seq = nullptr;
+                        continue;
+                    }
+
+                    runFrameCount = std::min(runFrameCount, seq->GetFramesUntilEvent());
+                }
+                runFrameCount = std::max(runFrameCount, 1u);
+
+                MixBlock(runOffset, runFrameCount);
+                for (auto* seq : _sequencers)
+                {
+                    if (seq != nullptr)
+                    {
+                        seq->Advance(runFrameCount);
+                    }
+                }
+
+                runOffset += runFrameCount;
+            }
+
+            // Convert to 16-bit.
+            auto* dst = &samples[frameOffset * MIXER_CHANNEL_COUNT];
+            for (uint i = 0; i < blockSampleCount; i++)
+            {
+                dst[i] = (int16)(std::clamp(_mixBlock[i], -1.0f, 1.0f) * SAMPLE_SCALE);
+            }
+        }
+
+        // Silence trailing partial frame.
+        for (uint i = frameCount * MIXER_CHANNEL_COUNT; i < samples.size(); i++)
+        {
+            samples[i] = 0;
+        }
+
+        // Update statistics.
+        uint activeVoiceCount = 0;
+        for (const auto& voice : _voices)
+        {
+            activeVoiceCount += voice.IsActive ? 1 : 0;
+        }
+        _activeVoiceCount.store(activeVoiceCount, std::memory_order_relaxed);
+        _renderedFrameCount.fetch_add(frameCount, std::memory_order_relaxed);
+    }
+
+    void Mixer::HandleCommand(const AudioCommand& cmd)
+    {
+        switch (cmd.Type)
+        {
+            case AudioCommandType::Play:
+            {
+                if (cmd.Sound == nullptr || cmd.Sound->ChannelCount == 0 || cmd.Sound->Samples.size() < cmd.Sound->ChannelCount)
+                {
+                    break;
+                }
+
+                // Use free voice or steal oldest.
+                auto* voice = AllocateVoice();
+                *voice      = Voice
+                {
+                    .Id         = cmd.VoiceId,
+                    .Sound      = cmd.Sound,
+                    .FrameCount = (uint)(cmd.Sound->Samples.size() / cmd.Sound->ChannelCount),
+                    .StartOrder = _startOrder++,
+                    .Gain       = cmd.Gain,
+                    .Pan        = cmd.Pan,
+                    .Pitch      = cmd.Pitch,
+                    .IsLooping  = cmd.IsLooping,
+                    .IsActive   = true
+                };
+                break;
+            }
+
+            case AudioCommandType::PlayStream:
+            {
+                if (cmd.Stream == nullptr)
+                {
+                    break;
+                }
+
+                // Use free voice or steal oldest.
+                auto* voice = AllocateVoice();
+                *voice      = Voice
+                {
+                    .Id         = cmd.VoiceId,
+                    .Stream     = cmd.Stream,
+                    .Phase      = 1 << PHASE_SHIFT, // Consume first frame before sampling.
+                    .StartOrder = _startOrder++,
+                    .Gain       = cmd.Gain,
+                    .Pan        = cmd.Pan,
+                    .Pitch      = cmd.Pitch,
+                    .IsActive   = true
+                };
+                break;
+            }
+
+            case AudioCommandType::PlaySequence:
+            {
+                if (cmd.Sequence == nullptr)
+                {
+                    break;
+                }
+
+                // Restart if playing, otherwise take free slot.
+                Sequencer** slot = nullptr;
+                for (auto*& seq : _sequencers)
+                {
+                    if (seq == cmd.Sequence)
+                    {
+                        slot = &seq;
+                        break;
+                    }
+
+                    if (seq == nullptr && slot == nullptr)
+                    {
+                        slot = &seq;
+                    }
+                }
+
+                if (slot == nullptr)
+                {
+                    break;
+                }
+
+                ReleaseSequenceVoices(*cmd.Sequence, NO_VALUE, NO_VALUE);
+                cmd.Sequence->Start(cmd.Gain, cmd.IsLooping);
+                *slot = cmd.Sequence;
+                break;
+            }
+
+            case AudioCommandType::Stop:
+            {
+                auto* voice = FindVoice(cmd.VoiceId);
+                if (voice != nullptr)
+                {
+                    voice->IsActive = false;
+                }
+                break;
+            }
+
+            case AudioCommandType::StopAll:
+            {
+                for (auto& voice : _voices)
+                {
+                    voice.IsActive = false;
+                }
+
+                for (auto*& seq : _sequencers)
+                {
+                    if (seq != nullptr)
+                    {
+                        seq->Stop();
+                        seq = nullptr;
+                    }
+                }
+                break;
+            }
+
+            case AudioCommandType::SetGain:
+            {
+                auto* voice = FindVoice(cmd.VoiceId);
+                if (voice != nullptr)
+                {
+                    voice->Gain = cmd.Gain;
+                }
+                break;
+            }
+
+            case AudioCommandType::SetPan:
+            {
+                auto* voice = FindVoice(cmd.VoiceId);
+                if (voice != nullptr)
+                {
+                    voice->Pan = cmd.Pan;
+                }
+                break;
+            }
+
+            case AudioCommandType::SetPitch:
+            {
+                auto* voice = FindVoice(cmd.VoiceId);
+                if (voice != nullptr)
+                {
+                    voice->Pitch = cmd.Pitch;
+                }
+                break;
+            }
+
+            case AudioCommandType::StopSequence:
+            {
+                if (cmd.Sequence == nullptr)
+                {
+                    break;
+                }
+
+                for (auto*& seq : _sequencers)
+                {
+                    if (seq == cmd.Sequence)
+                    {
+                        seq = nullptr;
+                    }
+                }
+
+                cmd.Sequence->Stop();
+                ReleaseSequenceVoices(*cmd.Sequence, NO_VALUE, NO_VALUE);
+                break;
+            }
+
+            default:
+            {
+                break;
+            }
+        }
+    }
+
+    Mixer::Voice* Mixer::AllocateVoice()
+    {
+        auto* voice = &_voices.front();
+        for (auto& curVoice : _voices)
+        {
+            if (!curVoice.IsActive)
+            {
+                return &curVoice;
+            }
+
+            if (curVoice.StartOrder < voice->StartOrder)
+            {
+                voice = &curVoice;
+            }
+        }
+
+        return voice;
+    }
+
+    Mixer::Voice* Mixer::FindVoice(int voiceId)
+    {
+        // Sequenced voices have no ID.
+        if (voiceId == NO_VALUE)
+        {
+            return nullptr;
+        }
+
+        for (auto& voice : _voices)
+        {
+            if (voice.IsActive && voice.Id == voiceId)
+            {
+                return &voice;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void Mixer::HandleSequenceEvents(Sequencer& seq)
+    {
+        auto layers = std::array<SequencerNote, Sequencer::NOTE_LAYER_COUNT_MAX>{};
+        while (const auto* event = seq.PopEvent())
+        {
+            switch (event->Type)
+            {
+                case KdtEventType::NoteOn:
+                {
+                    // Retrigger key.
+                    ReleaseSequenceVoices(seq, event->Channel, event->Data0);
+
+                    uint layerCount = seq.GetNoteLayers(*event, layers);
+                    for (int i = 0; i < layerCount; i++)
+                    {
+                        const auto& layer = layers[i];
+                        if (layer.Sound->ChannelCount == 0 || layer.Sound->Samples.size() < layer.Sound->ChannelCount)
+                        {
+                            continue;
+                        }
+
+                        // Use free voice or steal oldest.
+                        auto* voice = AllocateVoice();
+                        *voice      = Voice
+                        {
+                            .Sound      = layer.Sound,
+                            .Sequence   = &seq,
+                            .Note       = layer,
+                            .FrameCount = (uint)(layer.Sound->Samples.size() / layer.Sound->ChannelCount),
+                            .StartOrder = _startOrder++,
+                            .IsLooping  = layer.Sound->IsLooping,
+                            .IsActive   = true
+                        };
+                        UpdateSequenceVoice(*voice);
+                    }
+                    break;
+                }
+
+                case KdtEventType::NoteOff:
+                {
+                    ReleaseSequenceVoices(seq, event->Channel, event->Data0);
+                    break;
+                }
+
+                case KdtEventType::Controller:
+                case KdtEventType::PitchBend:
+                {
+                    for (auto& voice : _voices)
+                    {
+                        if (voice.IsActive && voice.Sequence == &seq && voice.Note.Channel == event->Channel)
+                        {
+                            UpdateSequenceVoice(voice);
+                        }
+                    }
+                    break;
+                }
+
+                case KdtEventType::End:
+                {
+                    ReleaseSequenceVoices(seq, NO_VALUE, NO_VALUE);
+                    break;
+                }
+
+                default:
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    void Mixer::ReleaseSequenceVoices(const Sequencer& seq, int channel, int key)
+    {
+        for (auto& voice : _voices)
+        {
+            if (!voice.IsActive || voice.Sequence != &seq)
+            {
+                continue;
+            }
+
+            if ((channel == NO_VALUE || voice.Note.Channel == channel) && (key == NO_VALUE || voice.Note.Key == key))
+            {
+                voice.IsReleasing = true;
+            }
+        }
+    }
+
+    void Mixer::UpdateSequenceVoice(Voice& voice)
+    {
+        const auto& seq = *voice.Sequence;
+        voice.Gain      = voice.Note.Gain * seq.GetChannelGain(voice.Note.Channel);
+        voice.Pan       = std::clamp(voice.Note.Pan + seq.GetChannelPan(voice.Note.Channel), -1.0f, 1.0f);
+        voice.Pitch     = voice.Note.Pitch * seq.GetChannelBendPitch(voice.Note);
+    }
+
+    void Mixer::MixBlock(uint frameOffset, uint frameCount)
+    {
+        uint64 mixedVoiceFrameCount = 0;
+        for (auto& voice : _voices)
+        {
+            if (!voice.IsActive)
+            {
+                continue;
+            }
+
+            // Fade out released notes.
+            if (voice.IsReleasing)
+            {
+                voice.Release = std::max(0.0f, voice.Release - ((float)frameCount / (float)RELEASE_FRAME_COUNT));
+            }
+
+            // Compute constant-power pan gains.
+            float panAngle        = (std::clamp(voice.Pan, -1.0f, 1.0f) + 1.0f) * PI_DIV_4;
+            float targetLeftGain  = voice.Gain * voice.Release * std::cos(panAngle);
+            float targetRightGain = voice.Gain * voice.Release * std::sin(panAngle);
+
+            if (voice.Stream != nullptr)
+            {
+                ResampleStreamVoice(voice, frameCount);
+            }
+            else
+            {
+                ResampleVoice(voice, frameCount);
+            }
+
+            // Accumulate with gains ramped across block to avoid clicks on parameter changes.
+            float  leftGain       = voice.LeftGain;
+            float  rightGain      = voice.RightGain;
+            float  leftGainDelta  = (targetLeftGain  - leftGain)  / (float)frameCount;
+            float  rightGainDelta = (targetRightGain - rightGain) / (float)frameCount;
+            float* dst            = &_mixBlock[frameOffset * MIXER_CHANNEL_COUNT];
+            for (uint i = 0; i < frameCount; i++)
+            {
+                dst[(i * 2) + 0] += _voiceLeft[i]  * (leftGain  + (leftGainDelta  * (float)i));
+                dst[(i * 2) + 1] += _voiceRight[i] * (rightGain + (rightGainDelta * (float)i));
+            }
+
+            voice.LeftGain        = targetLeftGain;
+            voice.RightGain       = targetRightGain;
+            mixedVoiceFrameCount += frameCount;
+
+            // Stop fully released notes.
+            if (voice.IsReleasing && voice.Release <= 0.0f)
+            {
+                voice.IsActive = false;
+            }
+        }
+
+        _mixedVoiceFrameCount.fetch_add(mixedVoiceFrameCount, std::memory_order_relaxed);
+    }
+
+    void Mixer::ResampleVoice(Voice& voice, uint frameCount)
+    {
+        constexpr float SAMPLE_SCALE = 1.0f / 32768.0f;
+        constexpr float PHASE_SCALE  = 1.0f / (float)(1 << PHASE_SHIFT);
+
+        const auto& sound          = *voice.Sound;
+        uint        loopStart      = (sound.LoopStart < voice.FrameCount) ? sound.LoopStart : 0;
+        uint64      phaseLoopStart = (uint64)loopStart << PHASE_SHIFT;
+        uint64      phaseEnd       = (uint64)voice.FrameCount << PHASE_SHIFT;
+        uint64      phaseStep      = (uint64)std::max(0.0f, ((voice.Pitch * (float)sound.SampleRate) / (float)MIXER_SAMPLE_RATE) * (float)(1 << PHASE_SHIFT));
+        uint        rightOffset    = (sound.ChannelCount > 1) ? 1 : 0;
+
+        for (uint i = 0; i < frameCount; i++)
+        {
+            // Wrap or end.
+            if (voice.Phase >= phaseEnd)
+            {
+                if (!voice.IsLooping)
+                {
+                    voice.IsActive = false;
+                    std::fill(_voiceLeft.begin()  + i, _voiceLeft.begin()  + frameCount, 0.0f);
+                    std::fill(_voiceRight.begin() + i, _voiceRight.begin() + frameCount, 0.0f);
+                    return;
+                }
+
+                voice.Phase = phaseLoopStart + ((voice.Phase - phaseEnd) % (phaseEnd - phaseLoopStart));
+            }
+
+            // Interpolate between neighboring frames.
+            uint  frame     = (uint)(voice.Phase >> PHASE_SHIFT);
+            uint  nextFrame = ((frame + 1) < voice.FrameCount) ? (frame + 1) : (voice.IsLooping ? loopStart : frame);
+            float alpha     = (float)(voice.Phase & ((1 << PHASE_SHIFT) - 1)) * PHASE_SCALE;
+
+            const int16* sample     = &sound.Samples[frame     * sound.ChannelCount];
+            const int16* nextSample = &sound.Samples[nextFrame * sound.ChannelCount];
+            _voiceLeft[i]  = std::lerp((float)sample[0],           (float)nextSample[0],           alpha) * SAMPLE_SCALE;
+            _voiceRight[i] = std::lerp((float)sample[rightOffset], (float)nextSample[rightOffset], alpha) * SAMPLE_SCALE;
+
+            voice.Phase += phaseStep;
+        }
+    }
+
+    void Mixer::ResampleStreamVoice(Voice& voice, uint frameCount)
+    {
+        constexpr uint64 PHASE_ONE    = 1 << PHASE_SHIFT;
+        constexpr float  SAMPLE_SCALE = 1.0f / 32768.0f;
+        constexpr float  PHASE_SCALE  = 1.0f / (float)PHASE_ONE;
+
+        auto&  stream    = *voice.Stream;
+        uint64 phaseStep = (uint64)std::max(0.0f, ((voice.Pitch * (float)stream.GetSampleRate()) / (float)MIXER_SAMPLE_RATE) * (float)PHASE_ONE);
+        phaseStep        = std::min<uint64>(phaseStep, STREAM_PHASE_STEP_MAX);
+
+        // Read exactly the source frames this block consumes. Missing frames are silent.
+        uint sourceFrameCount = (uint)((voice.Phase + (phaseStep * (frameCount - 1))) >> PHASE_SHIFT);
+        auto sourceSamples    = std::span<int16>(_streamScratch.data(), sourceFrameCount * MIXER_CHANNEL_COUNT);
+        uint readCount        = stream.Read(sourceSamples);
+        std::fill(sourceSamples.begin() + (readCount * MIXER_CHANNEL_COUNT), sourceSamples.end(), 0);
+
+        uint sourceFrame = 0;
+        for (uint i = 0; i < frameCount; i++)
+        {
+            // Advance to source frames surrounding phase.
+            while (voice.Phase >= PHASE_ONE)
+            {
+                voice.StreamPrev     = voice.StreamNext;
+                voice.StreamNext[0]  = (float)sourceSamples[(sourceFrame * MIXER_CHANNEL_COUNT) + 0] * SAMPLE_SCALE;
+                voice.StreamNext[1]  = (float)sourceSamples[(sourceFrame * MIXER_CHANNEL_COUNT) + 1] * SAMPLE_SCALE;
+                voice.Phase         -= PHASE_ONE;
+                sourceFrame++;
+            }
+
+            float alpha    = (float)voice.Phase * PHASE_SCALE;
+            _voiceLeft[i]  = std::lerp(voice.StreamPrev[0], voice.StreamNext[0], alpha);
+            _voiceRight[i] = std::lerp(voice.StreamPrev[1], voice.StreamNext[1], alpha);
+
+            voice.Phase += phaseStep;
+        }
+
+        if (stream.IsDrained())
+        {
+            voice.IsActive = false;
+        }
+    }
+}
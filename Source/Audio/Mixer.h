@@ -0,0 +1,231 @@
+#pragma once
+
+#include "Audio/Sequencer.h"
+#include "Audio/StreamBuffer.h"
+#include "Utils/SpscQueue.h"
+
+namespace Silent::Audio
+{
+    constexpr uint MIXER_SAMPLE_RATE   = 44100;
+    constexpr uint MIXER_CHANNEL_COUNT = 2;
+
+    /** @brief PCM sound data. Must outlive every voice playing it. */
+    struct SoundData
+    {
+        std::vector<int16> Samples      = {}; /** Interleaved if stereo. Must stay unmodified while played. */
+        uint               ChannelCount = 1;
+        uint               SampleRate   = MIXER_SAMPLE_RATE;
+        uint               LoopStart    = 0;                 /** Frame at which looping voices restart. */
+        bool               IsLooping    = false;             /** Loop flag of the sample itself. Used by sequenced notes. */
+    };
+
+    /** @brief Mixer command types. */
+    enum class AudioCommandType
+    {
+        Play,
+        PlayStream,
+        PlaySequence,
+        Stop,
+        StopAll,
+        SetGain,
+        SetPan,
+        SetPitch,
+        StopSequence,
+
+        Count
+    };
+
+    /** @brief Mixer command sent from the game thread. Voices are addressed by IDs assigned on play. */
+    struct AudioCommand
+    {
+        AudioCommandType Type      = AudioCommandType::Count;
+        int              VoiceId   = NO_VALUE;
+        const SoundData* Sound     = nullptr; /** Play only. */
+        StreamBuffer*    Stream    = nullptr; /** Play stream only. */
+        Sequencer*       Sequence  = nullptr; /** Sequence commands only. */
+        float            Gain      = 1.0f;
+        float            Pan       = 0.0f;    /** -1 = left, 1 = right. */
+        float            Pitch     = 1.0f;    /** Playback rate multiplier. */
+        bool             IsLooping = false;   /** Play and play sequence only. */
+    };
+
+    /** @brief Mixer statistics. */
+    struct MixerStats
+    {
+        uint   ActiveVoiceCount     = 0;
+        uint64 RenderedFrameCount   = 0;
+        uint64 MixedVoiceFrameCount = 0; /** Sum of frames mixed by each voice. Divided by wall time, gives mixing throughput. */
+    };
+
+    /** @brief Real-time software mixer. Commands are sent from one producer thread through a lock-free queue and drained by `Render`,
+     * which mixes active voices with gain, constant-power pan, and pitch into interleaved stereo 16-bit output.
+     * Voices play either a whole `SoundData` or frames pulled from a `StreamBuffer`. Playing sequences start and release voices
+     * as their events fall due, splitting mix blocks at event frames for sample-accurate timing.
+     * `Render` never blocks or allocates, so it can run in the audio device callback or offline into any buffer.
+     *
+     * @note `Submit` must only be called from the producer thread, `Render` only from the mixing thread.
+     */
+    class Mixer
+    {
+    public:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr uint VOICE_COUNT_MAX     = 32;
+        static constexpr uint SEQUENCER_COUNT_MAX = 4;
+        static constexpr uint COMMAND_QUEUE_SIZE  = 256;
+        static constexpr uint BLOCK_FRAME_COUNT   = 256;
+
+    private:
+        static constexpr uint PHASE_SHIFT                = 16;
+        static constexpr uint STREAM_SCRATCH_FRAME_COUNT = BLOCK_FRAME_COUNT * 4;
+        static constexpr uint STREAM_PHASE_STEP_MAX      = 3 << PHASE_SHIFT; /** Keeps the source frames of one block within the stream scratch buffer. */
+        static constexpr uint RELEASE_FRAME_COUNT        = 1024;             /** Fade out length of released sequenced notes. */
+
+        /** @brief Mixer voice. */
+        struct Voice
+        {
+            int              Id          = NO_VALUE;
+            const SoundData* Sound       = nullptr;
+            StreamBuffer*    Stream      = nullptr;
+            Sequencer*       Sequence    = nullptr; /** Owning sequence of a sequenced note. */
+            SequencerNote    Note        = {};      /** Sequenced note only. */
+            uint             FrameCount  = 0;
+            uint64           Phase       = 0;       /** Playback position in frames as 48.16 fixed point. Relative to `StreamPrev` for streams. */
+            uint64           StartOrder  = 0;       /** Used to steal the oldest voice. */
+            float            Gain        = 1.0f;
+            float            Pan         = 0.0f;
+            float            Pitch       = 1.0f;
+            float            LeftGain    = 0.0f;    /** Applied left gain, ramped toward the target each block. */
+            float            RightGain   = 0.0f;    /** Applied right gain, ramped toward the target each block. */
+            float            Release     = 1.0f;    /** Release fade gain. */
+            bool             IsLooping   = false;
+            bool             IsReleasing = false;
+            bool             IsActive    = false;
+
+            std::array<float, MIXER_CHANNEL_COUNT> StreamPrev = {}; /** Last consumed stream frame. */
+            std::array<float, MIXER_CHANNEL_COUNT> StreamNext = {}; /** Stream frame after `StreamPrev`. */
+        };
+
+        // =======
+        // Fields
+        // =======
+
+        SpscQueue<AudioCommand, COMMAND_QUEUE_SIZE> _commands   = {};
+        std::array<Voice, VOICE_COUNT_MAX>          _voices     = {};
+        std::array<Sequencer*, SEQUENCER_COUNT_MAX> _sequencers = {}; /** Playing sequences. Free slots are `nullptr`. */
+        uint64                                      _startOrder = 0;
+
+        std::array<float, BLOCK_FRAME_COUNT>                       _voiceLeft  = {}; /** Resampled voice block. */
+        std::array<float, BLOCK_FRAME_COUNT>                       _voiceRight = {}; /** Resampled voice block. */
+        std::array<float, BLOCK_FRAME_COUNT * MIXER_CHANNEL_COUNT> _mixBlock   = {}; /** Interleaved mix accumulator. */
+
+        std::array<int16, STREAM_SCRATCH_FRAME_COUNT * MIXER_CHANNEL_COUNT> _streamScratch = {}; /** Stream frames read for one block. */
+
+        std::atomic<uint>   _activeVoiceCount     = 0;
+        std::atomic<uint64> _renderedFrameCount   = 0;
+        std::atomic<uint64> _mixedVoiceFrameCount = 0;
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs a silent `Mixer`. */
+        Mixer() = default;
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the mixer statistics. Safe to call from any thread.
+         *
+         * @return Mixer statistics.
+         */
+        MixerStats GetStats() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Sends a command to the mixing thread without blocking.
+         *
+         * @param cmd Command to send.
+         * @return `true` if sent, `false` if the command queue is full.
+         */
+        bool Submit(const AudioCommand& cmd);
+
+        /** @brief Drains pending commands and mixes active voices.
+         *
+         * @param samples Interleaved stereo output. Trailing samples not forming a whole frame are silenced.
+         */
+        void Render(std::span<int16> samples);
+
+    private:
+        // ========
+        // Helpers
+        // ========
+
+        /** @brief Applies a command to the voices.
+         *
+         * @param cmd Command to apply.
+         */
+        void HandleCommand(const AudioCommand& cmd);
+
+        /** @brief Gets a free voice, or the oldest voice if all are busy.
+         *
+         * @return Voice to overwrite.
+         */
+        Voice* AllocateVoice();
+
+        /** @brief Finds the active voice with a given ID.
+         *
+         * @param voiceId Voice ID.
+         * @return Voice, or `nullptr` if it has finished or was stolen.
+         */
+        Voice* FindVoice(int voiceId);
+
+        /** @brief Applies the due events of a sequence to its voices.
+         *
+         * @param seq Sequence.
+         */
+        void HandleSequenceEvents(Sequencer& seq);
+
+        /** @brief Releases voices of a sequence.
+         *
+         * @param seq Sequence.
+         * @param channel Channel, or `NO_VALUE` for all channels.
+         * @param key Key, or `NO_VALUE` for all keys.
+         */
+        void ReleaseSequenceVoices(const Sequencer& seq, int channel, int key);
+
+        /** @brief Updates the gain, pan, and pitch of a sequenced voice from its note and channel state.
+         *
+         * @param voice Sequenced voice.
+         */
+        void UpdateSequenceVoice(Voice& voice);
+
+        /** @brief Mixes a run of frames into the mix accumulator.
+         *
+         * @param frameOffset First frame in the mix accumulator.
+         * @param frameCount Frame count. `frameOffset + frameCount` is at most `BLOCK_FRAME_COUNT`.
+         */
+        void MixBlock(uint frameOffset, uint frameCount);
+
+        /** @brief Resamples one block of a voice into the voice block with linear interpolation, stopping it at the end of a one-shot sound.
+         *
+         * @param voice Voice to resample.
+         * @param frameCount Frame count, at most `BLOCK_FRAME_COUNT`.
+         */
+        void ResampleVoice(Voice& voice, uint frameCount);
+
+        /** @brief Resamples one block of a stream voice into the voice block with linear interpolation, stopping it once the stream is drained.
+         * Underruns are filled with silence.
+         *
+         * @param voice Voice to resample.
+         * @param frameCount Frame count, at most `BLOCK_FRAME_COUNT`.
+         */
+        void ResampleStreamVoice(Voice& voice, uint frameCount);
+    };
+}
@@ -0,0 +1,235 @@
+#include "Framework.h"
+#include "Audio/Sequencer.h"
+
+#include "Audio/Mixer.h"
+
+using namespace Silent::Assets;
+
+namespace Silent::Audio
+{
+    Sequencer::Sequencer(std::shared_ptr<KdtAsset> kdt, std::shared_ptr<const VabAsset> vab, std::vector<const SoundData*>&& sounds)
+    {
+        _kdt    = kdt;
+        _vab    = vab;
+        _sounds = std::move(sounds);
+    }
+
+    uint Sequencer::GetFramesUntilEvent() const
+    {
+        if (!_isPlaying.load(std::memory_order_relaxed))
+        {
+            return FRAME_COUNT_NO_EVENT;
+        }
+
+        double frameCount = std::ceil(_eventFrame) - (double)_frame;
+        return (uint)std::clamp(frameCount, 0.0, (double)(FRAME_COUNT_NO_EVENT - 1));
+    }
+
+    uint Sequencer::GetNoteLayers(const KdtEvent& event, std::span<SequencerNote, NOTE_LAYER_COUNT_MAX> layers) const
+    {
+        constexpr float VOLUME_SCALE = 1.0f / 127.0f;
+        constexpr float PAN_SCALE    = 1.0f / 64.0f;
+        constexpr uint8 PAN_CENTER   = 64;
+
+        const auto& channel = _channels[event.Channel];
+        if (_vab == nullptr || channel.Program >= _vab->Programs.size())
+        {
+            return 0;
+        }
+
+        // Collect tones covering key.
+        const auto& program    = _vab->Programs[channel.Program];
+        uint        layerCount = 0;
+        for (const auto& tone : program.Tones)
+        {
+            if (layerCount >= NOTE_LAYER_COUNT_MAX)
+            {
+                break;
+            }
+
+            if (event.Data0 < tone.NoteMin || event.Data0 > tone.NoteMax ||
+                tone.VagIdx < 0 || tone.VagIdx >= _sounds.size() || _sounds[tone.VagIdx] == nullptr)
+            {
+                continue;
+            }
+
+            float semitones      = (float)event.Data0 - ((float)tone.CenterNote + ((float)tone.CenterFine / 128.0f));
+            layers[layerCount++] = SequencerNote
+            {
+                .Sound    = _sounds[tone.VagIdx],
+                .Channel  = event.Channel,
+                .Key      = event.Data0,
+                .Gain     = ((float)event.Data1 * VOLUME_SCALE) * ((float)tone.Volume * VOLUME_SCALE) * ((float)program.Volume * VOLUME_SCALE) * ((float)_vab->Volume * VOLUME_SCALE),
+                .Pan      = std::clamp((float)((tone.Pan - PAN_CENTER) + (program.Pan - PAN_CENTER)) * PAN_SCALE, -1.0f, 1.0f),
+                .Pitch    = std::exp2(semitones / 12.0f),
+                .BendUp   = (float)tone.PitchBendMax,
+                .BendDown = (float)tone.PitchBendMin
+            };
+        }
+
+        return layerCount;
+    }
+
+    float Sequencer::GetChannelGain(uint8 channel) const
+    {
+        const auto& curChannel = _channels[channel];
+        return curChannel.Volume * curChannel.Expression * _gain;
+    }
+
+    float Sequencer::GetChannelPan(uint8 channel) const
+    {
+        return _channels[channel].Pan;
+    }
+
+    float Sequencer::GetChannelBendPitch(const SequencerNote& note) const
+    {
+        float bend      = _channels[note.Channel].Bend;
+        float semitones = bend * ((bend >= 0.0f) ? note.BendUp : note.BendDown);
+        return std::exp2(semitones / 12.0f);
+    }
+
+    bool Sequencer::IsPlaying() const
+    {
+        return _isPlaying.load(std::memory_order_relaxed);
+    }
+
+    void Sequencer::Start(float gain, bool isLooping)
+    {
+        _channels      = {};
+        _frame         = 0;
+        _eventFrame    = 0.0;
+        _framesPerTick = ((double)TEMPO_DEFAULT * (double)MIXER_SAMPLE_RATE) / (1000000.0 * (double)_kdt->TicksPerBeat);
+        _gain          = gain;
+        _isLooping     = isLooping;
+
+        JumpToEvent(0, 0);
+        _isPlaying.store(true, std::memory_order_relaxed);
+    }
+
+    void Sequencer::Stop()
+    {
+        _isPlaying.store(false, std::memory_order_relaxed);
+    }
+
+    const KdtEvent* Sequencer::PopEvent()
+    {
+        constexpr uint8  CC_VOLUME     = 7;
+        constexpr uint8  CC_PAN        = 10;
+        constexpr uint8  CC_EXPRESSION = 11;
+        constexpr uint32 BEND_CENTER   = 8192;
+        constexpr float  VOLUME_SCALE  = 1.0f / 127.0f;
+
+        const auto& events = _kdt->Events;
+        while (_isPlaying.load(std::memory_order_relaxed) && (double)_frame >= _eventFrame)
+        {
+            const auto& event   = events[_eventIdx];
+            auto&       channel = _channels[event.Channel];
+            switch (event.Type)
+            {
+                case KdtEventType::NoteOn:
+                case KdtEventType::NoteOff:
+                {
+                    JumpToEvent(_eventIdx + 1, event.Tick);
+                    return &event;
+                }
+
+                case KdtEventType::Controller:
+                {
+                    switch (event.Data0)
+                    {
+                        case CC_VOLUME:
+                        {
+                            channel.Volume = (float)event.Data1 * VOLUME_SCALE;
+                            break;
+                        }
+
+                        case CC_PAN:
+                        {
+                            channel.Pan = std::clamp(((float)event.Data1 - 64.0f) / 64.0f, -1.0f, 1.0f);
+                            break;
+                        }
+
+                        case CC_EXPRESSION:
+                        {
+                            channel.Expression = (float)event.Data1 * VOLUME_SCALE;
+                            break;
+                        }
+
+                        default:
+                        {
+                            break;
+                        }
+                    }
+
+                    JumpToEvent(_eventIdx + 1, event.Tick);
+                    return &event;
+                }
+
+                case KdtEventType::PitchBend:
+                {
+                    channel.Bend = std::clamp(((float)event.Value - (float)BEND_CENTER) / (float)BEND_CENTER, -1.0f, 1.0f);
+                    JumpToEvent(_eventIdx + 1, event.Tick);
+                    return &event;
+                }
+
+                case KdtEventType::ProgramChange:
+                {
+                    channel.Program = event.Data0;
+                    JumpToEvent(_eventIdx + 1, event.Tick);
+                    break;
+                }
+
+                case KdtEventType::Tempo:
+                {
+                    if (event.Value != 0)
+                    {
+                        _framesPerTick = ((double)event.Value * (double)MIXER_SAMPLE_RATE) / (1000000.0 * (double)_kdt->TicksPerBeat);
+                    }
+
+                    JumpToEvent(_eventIdx + 1, event.Tick);
+                    break;
+                }
+
+                case KdtEventType::LoopEnd:
+                case KdtEventType::End:
+                {
+                    // Loop if the loop body has length, otherwise looping would never advance time.
+                    uint loopEventIdx = (_kdt->LoopStartEventIdx != NO_VALUE) ? _kdt->LoopStartEventIdx : 0;
+                    if (_isLooping && events[loopEventIdx].Tick < event.Tick)
+                    {
+                        JumpToEvent(loopEventIdx, (loopEventIdx == 0) ? 0 : events[loopEventIdx].Tick);
+                        break;
+                    }
+
+                    if (event.Type == KdtEventType::LoopEnd)
+                    {
+                        JumpToEvent(_eventIdx + 1, event.Tick);
+                        break;
+                    }
+
+                    _isPlaying.store(false, std::memory_order_relaxed);
+                    return &event;
+                }
+
+                default:
+                {
+                    JumpToEvent(_eventIdx + 1, event.Tick);
+                    break;
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+    void Sequencer::Advance(uint frameCount)
+    {
+        _frame += frameCount;
+    }
+
+    void Sequencer::JumpToEvent(uint eventIdx, uint32 tick)
+    {
+        _eventIdx    = eventIdx;
+        _eventFrame += (double)(_kdt->Events[_eventIdx].Tick - tick) * _framesPerTick;
+    }
+}
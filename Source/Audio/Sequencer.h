@@ -0,0 +1,173 @@
+#pragma once
+
+#include "Assets/Parsers/Kdt.h"
+#include "Assets/Parsers/Vab.h"
+
+namespace Silent::Audio
+{
+    struct SoundData;
+
+    /** @brief Sequenced note layer resolved from a VAB tone. */
+    struct SequencerNote
+    {
+        const SoundData* Sound    = nullptr;
+        uint8            Channel  = 0;
+        uint8            Key      = 0;
+        float            Gain     = 1.0f;    /** Velocity, tone, program, and bank volume. */
+        float            Pan      = 0.0f;    /** Tone and program pan. -1 = left, 1 = right. */
+        float            Pitch    = 1.0f;    /** Playback rate of the key relative to the tone's center note. */
+        float            BendUp   = 2.0f;    /** Upward pitch bend range in semitones. */
+        float            BendDown = 2.0f;    /** Downward pitch bend range in semitones. */
+    };
+
+    /** @brief KDT sequencer driving VAB instruments. Steps through events in frames at the mixer sample rate,
+     * so the mixer can split its blocks at event boundaries for sample-accurate timing.
+     *
+     * @note Playback state is only touched by the mixing thread once the sequence is started. Never allocates after construction.
+     */
+    class Sequencer
+    {
+    public:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr uint CHANNEL_COUNT        = 16;
+        static constexpr uint NOTE_LAYER_COUNT_MAX = 4;
+        static constexpr uint FRAME_COUNT_NO_EVENT = std::numeric_limits<uint>::max();
+
+    private:
+        static constexpr uint TEMPO_DEFAULT = 500000; /** Microseconds per beat. 120 BPM. */
+
+        /** @brief MIDI channel state. */
+        struct Channel
+        {
+            uint8 Program    = 0;
+            float Volume     = 100.0f / 127.0f;
+            float Expression = 1.0f;
+            float Pan        = 0.0f;            /** -1 = left, 1 = right. */
+            float Bend       = 0.0f;            /** -1 = down, 1 = up. */
+        };
+
+        // =======
+        // Fields
+        // =======
+
+        std::shared_ptr<Assets::KdtAsset>       _kdt    = nullptr;
+        std::shared_ptr<const Assets::VabAsset> _vab    = nullptr;
+        std::vector<const SoundData*>           _sounds = {};      /** Index = VAG index. */
+
+        std::array<Channel, CHANNEL_COUNT> _channels      = {};
+        uint                               _eventIdx      = 0;
+        uint64                             _frame         = 0;     /** Frames played since start. */
+        double                             _eventFrame    = 0.0;   /** Frame at which the next event is due. */
+        double                             _framesPerTick = 0.0;
+        float                              _gain          = 1.0f;
+        bool                               _isLooping     = false;
+        std::atomic<bool>                  _isPlaying     = false;
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs a stopped `Sequencer`.
+         *
+         * @param kdt Sequence.
+         * @param vab Instrument bank. If `nullptr`, the sequence advances without playing notes.
+         * @param sounds Decoded sound of each VAG sample in the bank.
+         */
+        Sequencer(std::shared_ptr<Assets::KdtAsset> kdt, std::shared_ptr<const Assets::VabAsset> vab, std::vector<const SoundData*>&& sounds);
+
+        Sequencer(const Sequencer&)            = delete;
+        Sequencer& operator=(const Sequencer&) = delete;
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the number of frames until the next event is due.
+         *
+         * @return Frame count, or `FRAME_COUNT_NO_EVENT` if stopped.
+         */
+        uint GetFramesUntilEvent() const;
+
+        /** @brief Gets the note layers started by a note on event. VAB programs may layer several tones on one key.
+         *
+         * @param event Note on event.
+         * @param[out] layers Note layers.
+         * @return Number of layers written.
+         */
+        uint GetNoteLayers(const Assets::KdtEvent& event, std::span<SequencerNote, NOTE_LAYER_COUNT_MAX> layers) const;
+
+        /** @brief Gets the current gain of a channel, including the sequence gain.
+         *
+         * @param channel Channel.
+         * @return Linear gain.
+         */
+        float GetChannelGain(uint8 channel) const;
+
+        /** @brief Gets the current pan offset of a channel.
+         *
+         * @param channel Channel.
+         * @return Pan offset. -1 = left, 1 = right.
+         */
+        float GetChannelPan(uint8 channel) const;
+
+        /** @brief Gets the pitch bend multiplier of a channel for a note.
+         *
+         * @param note Note playing on the channel.
+         * @return Playback rate multiplier.
+         */
+        float GetChannelBendPitch(const SequencerNote& note) const;
+
+        // ==========
+        // Inquirers
+        // ==========
+
+        /** @brief Checks if the sequence is playing. Safe to call from any thread.
+         *
+         * @return `true` if playing, `false` otherwise.
+         */
+        bool IsPlaying() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Restarts the sequence from the beginning.
+         *
+         * @param gain Linear gain.
+         * @param isLooping Loop flag. Looping sequences restart at their loop start marker.
+         */
+        void Start(float gain, bool isLooping);
+
+        /** @brief Stops the sequence. */
+        void Stop();
+
+        /** @brief Pops the next due event and applies channel state changes.
+         * Tempo, program, and loop events are consumed internally, and the rest are returned for the mixer to apply to voices.
+         *
+         * @return Due event, or `nullptr` if none are due. An `End` event is returned once when the sequence stops.
+         */
+        const Assets::KdtEvent* PopEvent();
+
+        /** @brief Advances the playback position.
+         *
+         * @param frameCount Frames played. Must not exceed the frames until the next event.
+         */
+        void Advance(uint frameCount);
+
+    private:
+        // ========
+        // Helpers
+        // ========
+
+        /** @brief Jumps to an event, scheduling it relative to the current event time.
+         *
+         * @param eventIdx Event index.
+         * @param tick Current event time in ticks.
+         */
+        void JumpToEvent(uint eventIdx, uint32 tick);
+    };
+}
@@ -0,0 +1,105 @@
+#include "Framework.h"
+#include "Audio/SoundBank.h"
+
+#include "Application.h"
+#include "Audio/Adpcm.h"
+#include "Audio/Audio.h"
+#include "Utils/Parallel.h"
+
+using namespace Silent::Assets;
+using namespace Silent::Utils;
+
+namespace Silent::Audio
+{
+    /** @brief Converts decoded ADPCM to mono mixer sound data at the VAB base sample rate.
+     *
+     * @param pcm Decoded ADPCM.
+     * @return Sound data.
+     */
+    static SoundData ToSoundData(AdpcmPcm&& pcm)
+    {
+        return SoundData
+        {
+            .Samples      = std::move(pcm.Samples),
+            .ChannelCount = 1,
+            .SampleRate   = MIXER_SAMPLE_RATE,
+            .LoopStart    = pcm.LoopStart,
+            .IsLooping    = pcm.IsLooping
+        };
+    }
+
+    SoundBank::SoundBank(std::shared_ptr<VabAsset> vab)
+    {
+        _vab      = vab;
+        _soundIds = std::vector<int>((_vab != nullptr) ? _vab->Samples.size() : 0, NO_VALUE);
+    }
+
+    std::shared_ptr<const VabAsset> SoundBank::GetVab() const
+    {
+        return _vab;
+    }
+
+    int SoundBank::GetSoundId(AudioManager& audio, int vagIdx)
+    {
+        if (vagIdx < 0 || vagIdx >= _soundIds.size())
+        {
+            Debug::Log(Fmt("Attempted to get invalid VAG sample {}.", vagIdx), Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return NO_VALUE;
+        }
+
+        // Decode on first use.
+        int& soundId = _soundIds[vagIdx];
+        if (soundId == NO_VALUE)
+        {
+            soundId = audio.AddSound(ToSoundData(DecodeSpuAdpcm(_vab->Samples[vagIdx].Adpcm)));
+        }
+
+        return soundId;
+    }
+
+    void SoundBank::Predecode(AudioManager& audio)
+    {
+        // Collect undecoded samples.
+        auto vagIdxs = std::vector<int>{};
+        for (int i = 0; i < _soundIds.size(); i++)
+        {
+            if (_soundIds[i] == NO_VALUE)
+            {
+                vagIdxs.push_back(i);
+            }
+        }
+
+        if (vagIdxs.empty())
+        {
+            return;
+        }
+
+        // Decode in parallel.
+        auto startTime = std::chrono::steady_clock::now();
+        auto pcms      = std::vector<AdpcmPcm>(vagIdxs.size());
+        auto tasks     = ParallelTasks{};
+        tasks.reserve(vagIdxs.size());
+        for (int i = 0; i < vagIdxs.size(); i++)
+        {
+            tasks.push_back([&, i]()
+            {
+                pcms[i] = DecodeSpuAdpcm(_vab->Samples[vagIdxs[i]].Adpcm);
+            });
+        }
+        g_App.GetExecutor().AddTasks(tasks).wait();
+
+        auto   duration   = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime);
+        uint64 frameCount = 0;
+
+        // Register sounds.
+        for (int i = 0; i < vagIdxs.size(); i++)
+        {
+            frameCount            += pcms[i].Samples.size();
+            _soundIds[vagIdxs[i]]  = audio.AddSound(ToSoundData(std::move(pcms[i])));
+        }
+
+        Debug::Log(Fmt("Decoded {} VAG samples ({} frames) in {:.2f} ms, {:.1f} Msamples/s.", vagIdxs.size(), frameCount, duration.count() * 1000.0,
+                       (duration.count() > 0.0) ? ((double)frameCount / duration.count()) / 1000000.0 : 0.0),
+                   Debug::LogLevel::Info, Debug::LogMode::Debug);
+    }
+}
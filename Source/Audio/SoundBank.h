@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Assets/Parsers/Vab.h"
+
+namespace Silent::Audio
+{
+    class AudioManager;
+
+    /** @brief VAB sound bank. Decodes VAG samples from SPU ADPCM to PCM and registers them with the audio manager,
+     * either lazily on first use or up front in parallel.
+     */
+    class SoundBank
+    {
+    private:
+        // =======
+        // Fields
+        // =======
+
+        std::shared_ptr<Assets::VabAsset> _vab      = nullptr;
+        std::vector<int>                  _soundIds = {}; /** Index = VAG index, value = registered sound ID, or `NO_VALUE` if not yet decoded. */
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs an empty default `SoundBank`. */
+        SoundBank() = default;
+
+        /** @brief Constructs a `SoundBank` for a loaded VAB. No samples are decoded yet.
+         *
+         * @param vab Loaded VAB asset.
+         */
+        SoundBank(std::shared_ptr<Assets::VabAsset> vab);
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the VAB asset.
+         *
+         * @return VAB asset.
+         */
+        std::shared_ptr<const Assets::VabAsset> GetVab() const;
+
+        /** @brief Gets the sound ID of a VAG sample, decoding and registering it on first use.
+         *
+         * @param audio Audio manager to register the sound with.
+         * @param vagIdx VAG index.
+         * @return Sound ID, or `NO_VALUE` if the VAG index is invalid.
+         */
+        int GetSoundId(AudioManager& audio, int vagIdx);
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Decodes all undecoded VAG samples in parallel and registers them. Logs decode throughput.
+         *
+         * @param audio Audio manager to register the sounds with.
+         */
+        void Predecode(AudioManager& audio);
+    };
+}
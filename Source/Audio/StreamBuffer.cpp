@@ -0,0 +1,92 @@
+#include "Framework.h"
+#include "Audio/StreamBuffer.h"
+
+namespace Silent::Audio
+{
+    StreamBuffer::StreamBuffer()
+    {
+        _samples = std::make_unique<int16[]>(FRAME_COUNT * CHANNEL_COUNT);
+    }
+
+    uint StreamBuffer::GetSampleRate() const
+    {
+        return _sampleRate.load(std::memory_order_relaxed);
+    }
+
+    uint StreamBuffer::GetFreeFrameCount() const
+    {
+        return FRAME_COUNT - GetQueuedFrameCount();
+    }
+
+    uint StreamBuffer::GetQueuedFrameCount() const
+    {
+        return _writePos.load(std::memory_order_acquire) - _readPos.load(std::memory_order_acquire);
+    }
+
+    uint StreamBuffer::GetUnderrunCount() const
+    {
+        return _underrunCount.load(std::memory_order_relaxed);
+    }
+
+    bool StreamBuffer::IsDrained() const
+    {
+        return _isEnded.load(std::memory_order_acquire) && GetQueuedFrameCount() == 0;
+    }
+
+    void StreamBuffer::SetSampleRate(uint sampleRate)
+    {
+        _sampleRate.store(sampleRate, std::memory_order_relaxed);
+    }
+
+    void StreamBuffer::SetEnded(bool isEnded)
+    {
+        _isEnded.store(isEnded, std::memory_order_release);
+    }
+
+    uint StreamBuffer::Write(std::span<const int16> samples)
+    {
+        uint writePos   = _writePos.load(std::memory_order_relaxed);
+        uint frameCount = std::min((uint)(samples.size() / CHANNEL_COUNT), GetFreeFrameCount());
+
+        // Copy in up to two contiguous runs.
+        uint offset   = writePos & (FRAME_COUNT - 1);
+        uint runCount = std::min(frameCount, FRAME_COUNT - offset);
+        std::memcpy(&_samples[offset * CHANNEL_COUNT], samples.data(), (runCount * CHANNEL_COUNT) * sizeof(int16));
+        std::memcpy(&_samples[0], samples.data() + (runCount * CHANNEL_COUNT), ((frameCount - runCount) * CHANNEL_COUNT) * sizeof(int16));
+
+        _writePos.store(writePos + frameCount, std::memory_order_release);
+        return frameCount;
+    }
+
+    void StreamBuffer::Flush()
+    {
+        _flushPos.store(_writePos.load(std::memory_order_relaxed), std::memory_order_release);
+    }
+
+    uint StreamBuffer::Read(std::span<int16> samples)
+    {
+        // Skip frames discarded by flush.
+        uint flushPos = _flushPos.exchange(NO_FLUSH, std::memory_order_acq_rel);
+        if (flushPos != NO_FLUSH)
+        {
+            _readPos.store(flushPos, std::memory_order_release);
+        }
+
+        uint readPos        = _readPos.load(std::memory_order_relaxed);
+        uint requestedCount = (uint)(samples.size() / CHANNEL_COUNT);
+        uint frameCount     = std::min(requestedCount, _writePos.load(std::memory_order_acquire) - readPos);
+        if (frameCount < requestedCount && !_isEnded.load(std::memory_order_acquire))
+        {
+            _underrunCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Copy out up to two contiguous runs.
+        uint offset   = readPos & (FRAME_COUNT - 1);
+        uint runCount = std::min(frameCount, FRAME_COUNT - offset);
+        std::memcpy(samples.data(), &_samples[offset * CHANNEL_COUNT], (runCount * CHANNEL_COUNT) * sizeof(int16));
+        std::memcpy(samples.data() + (runCount * CHANNEL_COUNT), &_samples[0], ((frameCount - runCount) * CHANNEL_COUNT) * sizeof(int16));
+
+        _readPos.store(readPos + frameCount, std::memory_order_release);
+        return frameCount;
+    }
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+namespace Silent::Audio
+{
+    /** @brief Lock-free single-producer, single-consumer ring of streamed stereo 16-bit PCM frames.
+     * A decoder on the game thread writes frames, and the mixer reads them on the audio thread. Memory is fixed at construction,
+     * so streams of any length play with bounded memory.
+     *
+     * @note `Write`, `Flush`, `SetSampleRate`, and `SetEnded` must only be called from the producer thread, `Read` only from the mixing thread.
+     */
+    class StreamBuffer
+    {
+    public:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr uint FRAME_COUNT   = 1 << 15; /** About 0.75 seconds at 44.1 kHz. */
+        static constexpr uint CHANNEL_COUNT = 2;
+
+    private:
+        static constexpr uint NO_FLUSH = std::numeric_limits<uint>::max();
+
+        // =======
+        // Fields
+        // =======
+
+        std::unique_ptr<int16[]> _samples       = nullptr;  /** Interleaved stereo frames. */
+        std::atomic<uint>        _sampleRate    = 0;
+        std::atomic<bool>        _isEnded       = false;    /** Set once the producer has written the last frame. */
+        std::atomic<uint>        _underrunCount = 0;        /** Reads that came up short before the end of the stream. */
+
+        alignas(64) std::atomic<uint> _readPos  = 0;        /** Monotonic frame position. Written by the consumer. */
+        alignas(64) std::atomic<uint> _writePos = 0;        /** Monotonic frame position. Written by the producer. */
+        std::atomic<uint>             _flushPos = NO_FLUSH; /** Write position the consumer skips to after a flush. */
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs a `StreamBuffer` and allocates its frame ring. */
+        StreamBuffer();
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the sample rate of the streamed frames.
+         *
+         * @return Sample rate in Hz.
+         */
+        uint GetSampleRate() const;
+
+        /** @brief Gets the number of frames the producer can write without overwriting unread frames.
+         *
+         * @return Free frame count.
+         */
+        uint GetFreeFrameCount() const;
+
+        /** @brief Gets the number of frames written but not yet read.
+         *
+         * @return Queued frame count.
+         */
+        uint GetQueuedFrameCount() const;
+
+        /** @brief Gets the number of reads that came up short before the end of the stream.
+         *
+         * @return Underrun count.
+         */
+        uint GetUnderrunCount() const;
+
+        // ==========
+        // Inquirers
+        // ==========
+
+        /** @brief Checks if the stream has ended and all frames were read.
+         *
+         * @return `true` if drained, `false` otherwise.
+         */
+        bool IsDrained() const;
+
+        // ========
+        // Setters
+        // ========
+
+        /** @brief Sets the sample rate of subsequently written frames.
+         *
+         * @param sampleRate Sample rate in Hz.
+         */
+        void SetSampleRate(uint sampleRate);
+
+        /** @brief Marks whether the producer has written the last frame. Short reads at the end of a stream aren't counted as underruns.
+         *
+         * @param isEnded End of stream flag.
+         */
+        void SetEnded(bool isEnded);
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Writes frames without blocking.
+         *
+         * @param samples Interleaved stereo samples.
+         * @return Number of frames written, limited by free space.
+         */
+        uint Write(std::span<const int16> samples);
+
+        /** @brief Discards all frames written so far. Frames written afterward are kept. Used when seeking. */
+        void Flush();
+
+        /** @brief Reads frames without blocking. Records an underrun if fewer frames are available than requested.
+         *
+         * @param[out] samples Interleaved stereo samples.
+         * @return Number of frames read.
+         */
+        uint Read(std::span<int16> samples);
+    };
+}
@@ -0,0 +1,404 @@
+#include "Framework.h"
+#include "Audio/XaStream.h"
+
+#include "Application.h"
+#include "Audio/Audio.h"
+#include "Utils/Parallel.h"
+
+namespace Silent::Audio
+{
+    constexpr uint XA_RAW_SECTOR_SIZE    = 2352; /** Sync, header, subheader, data, and EDC. */
+    constexpr uint XA_SECTOR_SIZE        = 2336; /** Subheader, data, and EDC. */
+    constexpr uint XA_RAW_HEADER_SIZE    = 16;
+    constexpr uint XA_SUBHEADER_SIZE     = 8;
+    constexpr uint XA_SOUND_GROUP_SIZE   = 128;
+    constexpr uint XA_SOUND_HEADER_SIZE  = 16;
+    constexpr uint XA_PROBE_SECTOR_COUNT = 64;
+
+    /** @brief XA sector subheader submode flags. */
+    enum class XaSubmodeFlags
+    {
+        Audio     = 1 << 2,
+        EndOfFile = 1 << 7
+    };
+
+    XaStream::~XaStream()
+    {
+        CancelRead();
+    }
+
+    XaStreamStats XaStream::GetStats() const
+    {
+        auto stats          = _stats;
+        const auto* stream  = (_audio != nullptr) ? _audio->GetStream(_streamId) : nullptr;
+        stats.UnderrunCount = (stream != nullptr) ? stream->GetUnderrunCount() : 0;
+        return stats;
+    }
+
+    float XaStream::GetDuration() const
+    {
+        if (_sampleRate == 0)
+        {
+            return 0.0f;
+        }
+
+        uint channelSectorCount = ((_sectorCount - _firstSector) + (_interleave - 1)) / _interleave;
+        uint sectorFrameCount   = _isStereo ? (SECTOR_FRAME_COUNT / 2) : SECTOR_FRAME_COUNT;
+        return (float)(channelSectorCount * sectorFrameCount) / (float)_sampleRate;
+    }
+
+    bool XaStream::IsOpen() const
+    {
+        return _sectorCount != 0;
+    }
+
+    bool XaStream::IsEnded() const
+    {
+        const auto* stream = (_audio != nullptr) ? _audio->GetStream(_streamId) : nullptr;
+        return stream == nullptr || stream->IsDrained();
+    }
+
+    void XaStream::Open(AudioManager& audio, const std::filesystem::path& file, uint channel)
+    {
+        constexpr std::array<uint8, 12> SYNC_PATTERN = { 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00 };
+
+        Close();
+
+        // Open file.
+        _fileStream = std::ifstream(file, std::ios::binary);
+        if (!_fileStream.is_open())
+        {
+            throw std::runtime_error(Fmt("Failed to open XA `{}`.", file.string()));
+        }
+
+        // Detect sector size from sync pattern.
+        auto sync = std::array<uint8, SYNC_PATTERN.size()>{};
+        _fileStream.read((byte*)sync.data(), sync.size());
+        _sectorSize  = (sync == SYNC_PATTERN) ? XA_RAW_SECTOR_SIZE : XA_SECTOR_SIZE;
+        _sectorCount = (uint)(std::filesystem::file_size(file) / _sectorSize);
+        _file        = file;
+        _channel     = channel;
+
+        // Probe channel format and interleave from first audio sectors. Later sectors must match the first one's file number.
+        auto sector      = std::vector<byte>(_sectorSize);
+        int  firstSector = NO_VALUE;
+        _fileStream.seekg(0);
+        for (uint i = 0; i < std::min(_sectorCount, XA_PROBE_SECTOR_COUNT); i++)
+        {
+            _fileStream.read(sector.data(), _sectorSize);
+
+            const auto* subheader = GetSubheader((const uint8*)sector.data());
+            if (firstSector == NO_VALUE)
+            {
+                if (!(subheader[2] & (int)XaSubmodeFlags::Audio) || subheader[1] != _channel)
+                {
+                    continue;
+                }
+
+                firstSector = i;
+                _fileNumber = subheader[0];
+                _isStereo   = (subheader[3] & 0x3) == 1;
+                _sampleRate = ((subheader[3] >> 2) & 0x3) ? 18900 : 37800;
+                continue;
+            }
+
+            if (IsChannelSector(subheader))
+            {
+                _interleave = i - firstSector;
+                break;
+            }
+        }
+
+        if (firstSector == NO_VALUE)
+        {
+            _sectorCount = 0;
+            throw std::runtime_error(Fmt("XA `{}` has no audio for channel {}.", file.string(), channel));
+        }
+        _fileStream.clear();
+        _firstSector = firstSector;
+
+        // Prepare stream buffer.
+        _audio = &audio;
+        if (_streamId == NO_VALUE)
+        {
+            _streamId = _audio->AddStream();
+        }
+
+        auto& stream = *_audio->GetStream(_streamId);
+        stream.Flush();
+        stream.SetSampleRate(_sampleRate);
+        stream.SetEnded(false);
+
+        for (auto& readBuffer : _readBuffers)
+        {
+            readBuffer.Data.resize(READ_SECTOR_COUNT * _sectorSize);
+        }
+        _nextReadSector = _firstSector;
+        DispatchRead();
+    }
+
+    void XaStream::Close()
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        Stop();
+        CancelRead();
+        _fileStream.close();
+
+        Debug::Log(Fmt("Closed XA `{}`: {} sectors read at {:.1f} MB/s, {} frames decoded at {:.1f} Mframes/s, {} underruns, {} read stalls.",
+                       _file.filename().string(), _stats.ReadSectorCount,
+                       (_stats.ReadSec > 0.0) ? (((double)(_stats.ReadSectorCount * _sectorSize) / _stats.ReadSec) / (1024.0 * 1024.0)) : 0.0,
+                       _stats.DecodedFrameCount, (_stats.DecodeSec > 0.0) ? (((double)_stats.DecodedFrameCount / _stats.DecodeSec) / 1000000.0) : 0.0,
+                       GetStats().UnderrunCount, _stats.ReadStallCount),
+                   Debug::LogLevel::Info, Debug::LogMode::Debug);
+
+        // Reset stream format and decode state so that the next `Open` probes from scratch.
+        _sectorCount     = 0;
+        _fileNumber      = 0;
+        _firstSector     = 0;
+        _interleave      = 1;
+        _sampleRate      = 0;
+        _isStereo        = false;
+        _decodeBufferIdx = 0;
+        _decodeSectorIdx = 0;
+        _filledCount     = 0;
+        _nextReadSector  = 0;
+        _isChannelEnded  = false;
+        _histories       = {};
+        _pcmCount        = 0;
+        _pcmOffset       = 0;
+        _stats           = {};
+    }
+
+    void XaStream::Play(float gain, float pan)
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        Stop();
+        _voiceId = _audio->PlayStream(_streamId, gain, pan);
+    }
+
+    void XaStream::Stop()
+    {
+        if (_voiceId == NO_VALUE)
+        {
+            return;
+        }
+
+        _audio->StopSound(_voiceId);
+        _voiceId = NO_VALUE;
+    }
+
+    void XaStream::Seek(float timeSec)
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        // Find sector of channel containing time.
+        uint sectorFrameCount = _isStereo ? (SECTOR_FRAME_COUNT / 2) : SECTOR_FRAME_COUNT;
+        uint channelSector    = (uint)((std::max(timeSec, 0.0f) * (float)_sampleRate) / (float)sectorFrameCount);
+
+        // Discard buffered data.
+        CancelRead();
+        _filledCount     = 0;
+        _decodeSectorIdx = 0;
+        _pcmCount        = 0;
+        _pcmOffset       = 0;
+        _histories       = {};
+        _isChannelEnded  = false;
+        _nextReadSector  = std::min(_firstSector + (channelSector * _interleave), _sectorCount);
+
+        auto& stream = *_audio->GetStream(_streamId);
+        stream.Flush();
+        stream.SetEnded(false);
+        DispatchRead();
+    }
+
+    void XaStream::Update()
+    {
+        if (!IsOpen())
+        {
+            return;
+        }
+
+        // Complete finished read.
+        if (_readFuture.valid() && _readFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        {
+            _readFuture.get();
+
+            const auto& readBuffer = _readBuffers[(_decodeBufferIdx + _filledCount) % READ_BUFFER_COUNT];
+            _stats.ReadSectorCount += readBuffer.SectorCount;
+            _stats.ReadSec         += readBuffer.ReadSec;
+            _filledCount++;
+        }
+        DispatchRead();
+
+        // Decode until stream buffer is full.
+        auto& stream    = *_audio->GetStream(_streamId);
+        auto  startTime = std::chrono::steady_clock::now();
+        while (true)
+        {
+            // Write pending frames.
+            if (_pcmOffset < _pcmCount)
+            {
+                _pcmOffset += stream.Write(std::span<const int16>(&_pcm[_pcmOffset * 2], (_pcmCount - _pcmOffset) * 2));
+                if (_pcmOffset < _pcmCount)
+                {
+                    break;
+                }
+            }
+
+            // Stop at end of channel.
+            if (_isChannelEnded || (_filledCount == 0 && !_readFuture.valid() && _nextReadSector >= _sectorCount))
+            {
+                stream.SetEnded(true);
+                break;
+            }
+
+            // Wait for next read.
+            if (_filledCount == 0)
+            {
+                _stats.ReadStallCount++;
+                break;
+            }
+
+            // Release fully decoded buffer.
+            auto& readBuffer = _readBuffers[_decodeBufferIdx];
+            if (_decodeSectorIdx >= readBuffer.SectorCount)
+            {
+                _decodeBufferIdx = (_decodeBufferIdx + 1) % READ_BUFFER_COUNT;
+                _decodeSectorIdx = 0;
+                _filledCount--;
+                DispatchRead();
+                continue;
+            }
+
+            // Decode next sector.
+            DecodeSector((const uint8*)&readBuffer.Data[_decodeSectorIdx * _sectorSize]);
+            _decodeSectorIdx++;
+        }
+
+        _stats.DecodeSec += std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    }
+
+    void XaStream::DispatchRead()
+    {
+        if (_readFuture.valid() || _filledCount >= READ_BUFFER_COUNT || _nextReadSector >= _sectorCount || _isChannelEnded)
+        {
+            return;
+        }
+
+        auto& readBuffer       = _readBuffers[(_decodeBufferIdx + _filledCount) % READ_BUFFER_COUNT];
+        uint  firstSector      = _nextReadSector;
+        readBuffer.SectorCount = std::min(READ_SECTOR_COUNT, _sectorCount - firstSector);
+        _nextReadSector       += readBuffer.SectorCount;
+
+        // Read sectors on I/O task.
+        _readFuture = g_App.GetExecutor().AddTask([this, &readBuffer, firstSector]()
+        {
+            auto startTime = std::chrono::steady_clock::now();
+
+            _fileStream.clear();
+            _fileStream.seekg((uint64)firstSector * _sectorSize);
+            _fileStream.read(readBuffer.Data.data(), readBuffer.SectorCount * _sectorSize);
+            readBuffer.SectorCount = (uint)(_fileStream.gcount() / _sectorSize);
+
+            readBuffer.ReadSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        });
+    }
+
+    void XaStream::CancelRead()
+    {
+        if (_readFuture.valid())
+        {
+            _readFuture.wait();
+            _readFuture.get();
+        }
+    }
+
+    bool XaStream::IsChannelSector(const uint8* subheader) const
+    {
+        return (subheader[2] & (int)XaSubmodeFlags::Audio) && subheader[0] == _fileNumber && subheader[1] == _channel;
+    }
+
+    bool XaStream::DecodeSector(const uint8* sector)
+    {
+        constexpr uint BIT_DEPTH_8 = 1;
+
+        // Skip sectors of other files and channels.
+        const auto* subheader = GetSubheader(sector);
+        if (!IsChannelSector(subheader))
+        {
+            return false;
+        }
+
+        if (subheader[2] & (int)XaSubmodeFlags::EndOfFile)
+        {
+            _isChannelEnded = true;
+        }
+
+        if (((subheader[3] >> 4) & 0x3) == BIT_DEPTH_8)
+        {
+            Debug::Log("Attempted to decode unsupported 8-bit XA sector.", Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return false;
+        }
+
+        // Decode sound groups. Stereo alternates left and right blocks.
+        auto nibbles = std::array<uint8, ADPCM_BLOCK_SAMPLE_COUNT>{};
+        auto samples = std::array<int16, ADPCM_BLOCK_SAMPLE_COUNT>{};
+        const auto* data = subheader + XA_SUBHEADER_SIZE;
+        for (int i = 0; i < SECTOR_GROUP_COUNT; i++)
+        {
+            const auto* group = data + (i * XA_SOUND_GROUP_SIZE);
+            for (int j = 0; j < GROUP_BLOCK_COUNT; j++)
+            {
+                // Gather nibbles of block from interleaved sample words.
+                uint nibbleShift = (j & 1) * 4;
+                for (int k = 0; k < ADPCM_BLOCK_SAMPLE_COUNT; k++)
+                {
+                    nibbles[k] = (group[XA_SOUND_HEADER_SIZE + (k * 4) + (j / 2)] >> nibbleShift) & 0xF;
+                }
+
+                int channelIdx = _isStereo ? (j & 1) : 0;
+                DecodeAdpcmBlock(group[4 + j], nibbles, _histories[channelIdx], samples);
+
+                // Write stereo frames, duplicating mono.
+                if (_isStereo)
+                {
+                    uint frameOffset = (i * (GROUP_BLOCK_COUNT / 2) + (j / 2)) * ADPCM_BLOCK_SAMPLE_COUNT;
+                    for (int k = 0; k < ADPCM_BLOCK_SAMPLE_COUNT; k++)
+                    {
+                        _pcm[((frameOffset + k) * 2) + channelIdx] = samples[k];
+                    }
+                }
+                else
+                {
+                    uint frameOffset = ((i * GROUP_BLOCK_COUNT) + j) * ADPCM_BLOCK_SAMPLE_COUNT;
+                    for (int k = 0; k < ADPCM_BLOCK_SAMPLE_COUNT; k++)
+                    {
+                        _pcm[((frameOffset + k) * 2) + 0] = samples[k];
+                        _pcm[((frameOffset + k) * 2) + 1] = samples[k];
+                    }
+                }
+            }
+        }
+
+        _pcmCount                 = _isStereo ? (SECTOR_FRAME_COUNT / 2) : SECTOR_FRAME_COUNT;
+        _pcmOffset                = 0;
+        _stats.DecodedFrameCount += _pcmCount;
+        return true;
+    }
+
+    const uint8* XaStream::GetSubheader(const uint8* sector) const
+    {
+        return sector + ((_sectorSize == XA_RAW_SECTOR_SIZE) ? XA_RAW_HEADER_SIZE : 0);
+    }
+}
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "Audio/Adpcm.h"
+
+namespace Silent::Audio
+{
+    class AudioManager;
+
+    /** @brief XA stream statistics. */
+    struct XaStreamStats
+    {
+        uint64 ReadSectorCount   = 0;
+        uint64 DecodedFrameCount = 0;
+        uint   ReadStallCount    = 0;    /** Updates that found no sectors ready to decode before the end of the stream. */
+        uint   UnderrunCount     = 0;    /** Mixer reads that came up short. */
+        double ReadSec           = 0.0;  /** Time spent reading sectors on the I/O task. */
+        double DecodeSec         = 0.0;  /** Time spent decoding sectors. */
+    };
+
+    /** @brief Streaming PSX XA ADPCM decoder. Sectors are read on a background I/O task into a ring of read buffers,
+     * and one interleaved file channel is decoded on demand into an audio stream buffer. Memory is bounded regardless of track length.
+     *
+     * @note Not thread-safe. All calls must come from the game thread.
+     */
+    class XaStream
+    {
+    public:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr uint READ_BUFFER_COUNT = 3;
+        static constexpr uint READ_SECTOR_COUNT = 16; /** Sectors per read buffer. */
+
+    private:
+        static constexpr uint SECTOR_GROUP_COUNT = 18;
+        static constexpr uint GROUP_BLOCK_COUNT  = 8;
+        static constexpr uint SECTOR_FRAME_COUNT = SECTOR_GROUP_COUNT * GROUP_BLOCK_COUNT * ADPCM_BLOCK_SAMPLE_COUNT; /** Mono frames per sector. */
+
+        /** @brief Read buffer filled by the I/O task. */
+        struct ReadBuffer
+        {
+            std::vector<byte> Data        = {};
+            uint              SectorCount = 0;
+            double            ReadSec     = 0.0;
+        };
+
+        // =======
+        // Fields
+        // =======
+
+        std::filesystem::path _file        = {};
+        std::ifstream         _fileStream  = {}; /** Only accessed by the I/O task while a read is in flight. */
+        uint                  _sectorSize  = 0;
+        uint                  _sectorCount = 0;
+        uint                  _fileNumber  = 0;  /** Interleaved file number of the channel, taken from its first audio sector. */
+        uint                  _channel     = 0;  /** Interleaved file channel to decode. */
+        uint                  _firstSector = 0;  /** First sector of the channel. */
+        uint                  _interleave  = 1;  /** Sector stride between consecutive sectors of the channel. */
+        uint                  _sampleRate  = 0;
+        bool                  _isStereo    = false;
+
+        std::array<ReadBuffer, READ_BUFFER_COUNT> _readBuffers     = {};
+        uint                                      _decodeBufferIdx = 0; /** Oldest filled buffer. */
+        uint                                      _decodeSectorIdx = 0; /** Next sector to decode in the oldest filled buffer. */
+        uint                                      _filledCount     = 0;
+        uint                                      _nextReadSector  = 0;
+        bool                                      _isChannelEnded  = false;
+        std::future<void>                         _readFuture      = {};
+
+        std::array<AdpcmHistory, 2>               _histories = {}; /** Index = left or mono, right. */
+        std::array<int16, SECTOR_FRAME_COUNT * 2> _pcm       = {}; /** Decoded stereo frames of one sector. */
+        uint                                      _pcmCount  = 0;
+        uint                                      _pcmOffset = 0;  /** Frames already written to the stream buffer. */
+
+        AudioManager* _audio    = nullptr;
+        int           _streamId = NO_VALUE;
+        int           _voiceId  = NO_VALUE;
+        XaStreamStats _stats    = {};
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs a closed default `XaStream`. */
+        XaStream() = default;
+
+        /** @brief Gracefully destroys the `XaStream`, waiting for the I/O task. */
+        ~XaStream();
+
+        XaStream(const XaStream&)            = delete;
+        XaStream& operator=(const XaStream&) = delete;
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the stream statistics.
+         *
+         * @return XA stream statistics.
+         */
+        XaStreamStats GetStats() const;
+
+        /** @brief Gets the duration of the open channel.
+         *
+         * @return Duration in seconds.
+         */
+        float GetDuration() const;
+
+        // ==========
+        // Inquirers
+        // ==========
+
+        /** @brief Checks if a file is open.
+         *
+         * @return `true` if open, `false` otherwise.
+         */
+        bool IsOpen() const;
+
+        /** @brief Checks if the channel has been fully decoded and played.
+         *
+         * @return `true` if ended, `false` otherwise.
+         */
+        bool IsEnded() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Opens an XA file and prepares a channel for streaming. Raw 2352-byte and 2336-byte sector dumps are supported.
+         *
+         * @param audio Audio manager to stream through.
+         * @param file XA file path.
+         * @param channel Interleaved file channel to decode. Sectors must also match the file number of the channel's first audio sector.
+         * @exception std::runtime_error if the file can't be opened or contains no audio for the channel.
+         */
+        void Open(AudioManager& audio, const std::filesystem::path& file, uint channel);
+
+        /** @brief Stops playback, waits for the I/O task, and closes the file. The stream buffer is kept for reuse. */
+        void Close();
+
+        /** @brief Starts playback from the current position.
+         *
+         * @param gain Linear gain.
+         * @param pan Stereo pan. -1 = left, 1 = right.
+         */
+        void Play(float gain = 1.0f, float pan = 0.0f);
+
+        /** @brief Stops playback. Decoding continues until the stream buffer is full. */
+        void Stop();
+
+        /** @brief Seeks the channel to the sector containing a given time.
+         *
+         * @param timeSec Time in seconds.
+         */
+        void Seek(float timeSec);
+
+        /** @brief Completes finished reads, dispatches new reads, and decodes sectors until the stream buffer is full. Never blocks. */
+        void Update();
+
+    private:
+        // ========
+        // Helpers
+        // ========
+
+        /** @brief Dispatches a background read into the next free read buffer if none is in flight. */
+        void DispatchRead();
+
+        /** @brief Waits for the in-flight read and discards its data. */
+        void CancelRead();
+
+        /** @brief Checks if a sector is an audio sector of the open file number and channel.
+         *
+         * @param subheader Sector subheader.
+         * @return `true` if the sector belongs to the open channel, `false` otherwise.
+         */
+        bool IsChannelSector(const uint8* subheader) const;
+
+        /** @brief Decodes one sector into PCM frames if it belongs to the open channel.
+         *
+         * @param sector Sector data.
+         * @return `true` if frames were decoded, `false` if the sector was skipped.
+         */
+        bool DecodeSector(const uint8* sector);
+
+        /** @brief Gets the subheader of a sector.
+         *
+         * @param sector Sector data.
+         * @return Subheader pointer.
+         */
+        const uint8* GetSubheader(const uint8* sector) const;
+    };
+}
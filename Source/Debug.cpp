@@ -3,8 +3,10 @@
 
 #include "Application.h"
 #include "Assets/Locales.h"
+#include "Audio/Audio.h"
 #include "Input/Input.h"
 #include "Renderer/Renderer.h"
+#include "Savegame/Savegame.h"
 #include "Services/Clock.h"
 #include "Services/Options.h"
 #include "Utils/Bitfield.h"
@@ -13,7 +15,9 @@
 #include "Utils/Utils.h"
 
 using namespace Silent::Assets;
+using namespace Silent::Audio;
 using namespace Silent::Renderer;
+using namespace Silent::Savegame;
 using namespace Silent::Services;
 using namespace Silent::Utils;
 
@@ -262,6 +266,35 @@ namespace Silent::Debug
                         ImGui::EndChild();
                     }
 
+                    // `Audio` section.
+                    ImGui::SeparatorText("Audio");
+                    {
+                        const auto& audio      = g_App.GetAudio();
+                        auto        mixerStats = audio.GetMixerStats();
+                        ImGui::Text("Voices: %d / %d", mixerStats.ActiveVoiceCount, Mixer::VOICE_COUNT_MAX);
+                        ImGui::Text("Frames mixed: %llu", (unsigned long long)mixerStats.RenderedFrameCount);
+                        ImGui::Text("Voice frames mixed: %llu", (unsigned long long)mixerStats.MixedVoiceFrameCount);
+                        ImGui::Text("Deferred commands: %d", audio.GetOverflowCommandCount());
+                    }
+
+                    // `Savegame` section.
+                    ImGui::SeparatorText("Savegame");
+                    {
+                        const auto& savegame  = g_App.GetSavegame();
+                        auto        saveStats = savegame.GetStats();
+                        ImGui::Text("Snapshot mode: %s", savegame.IsSnapshotMode() ? "On" : "Off");
+                        ImGui::Text("Save latency: %.2f ms", saveStats.SaveSec * 1000.0);
+                        ImGui::Text("Load latency: %.2f ms", saveStats.LoadSec * 1000.0);
+                        ImGui::Text("Quicksave latency: %.3f ms", saveStats.QuicksaveSec * 1000.0);
+                        ImGui::Text("Quickload latency: %.3f ms", saveStats.QuickloadSec * 1000.0);
+                        ImGui::Text("Quicksaves: %d / %d", savegame.GetQuicksaveCount(), QUICKSAVE_COUNT_MAX);
+                        ImGui::Text("Last save size: %d / %d bytes", saveStats.SaveDiskSize, saveStats.SaveSize);
+                        for (int i = 0; i < SAVEGAME_SLOT_COUNT; i++)
+                        {
+                            ImGui::Text("Slot %d footprint: %llu bytes", i + 1, (unsigned long long)saveStats.SlotDiskSizes[i]);
+                        }
+                    }
+
                     ImGui::EndTabItem();
                 }
 
@@ -289,12 +322,99 @@ namespace Silent::Debug
                             ImGui::TableSetColumnIndex(1);
                             ImGui::Text("%d", g_Work.FrameTime, 1, 1);
 
+                            const auto& renderer    = g_App.GetRenderer();
+                            auto        bucketStats = renderer.GetBucketStats();
+
                             // `Draw calls` info.
-                            /*ImGui::TableNextRow();
+                            ImGui::TableNextRow();
                             ImGui::TableSetColumnIndex(0);
                             ImGui::Text("Draw calls:", 2, 0);
                             ImGui::TableSetColumnIndex(1);
-                            ImGui::Text("%d", renderer.GetDrawCallCount(), 2, 1);*/
+                            ImGui::Text("%d", renderer.GetDrawCallCount(), 2, 1);
+
+                            // `Draw items` info.
+                            ImGui::TableNextRow();
+                            ImGui::TableSetColumnIndex(0);
+                            ImGui::Text("Draw items:", 3, 0);
+                            ImGui::TableSetColumnIndex(1);
+                            ImGui::Text("%d", bucketStats.ItemCount, 3, 1);
+
+                            // `Buckets` info.
+                            ImGui::TableNextRow();
+                            ImGui::TableSetColumnIndex(0);
+                            ImGui::Text("Buckets:", 4, 0);
+                            ImGui::TableSetColumnIndex(1);
+                            ImGui::Text("%d", bucketStats.BucketCount, 4, 1);
+
+                            // `State changes` info.
+                            ImGui::TableNextRow();
+                            ImGui::TableSetColumnIndex(0);
+                            ImGui::Text("State changes:", 5, 0);
+                            ImGui::TableSetColumnIndex(1);
+                            ImGui::Text("%d", bucketStats.StateChangeCount, 5, 1);
+
+                            // `State changes saved` info.
+                            ImGui::TableNextRow();
+                            ImGui::TableSetColumnIndex(0);
+                            ImGui::Text("State changes saved:", 6, 0);
+                            ImGui::TableSetColumnIndex(1);
+                            ImGui::Text("%d", bucketStats.GetSavedStateChangeCount(), 6, 1);
+
+                            // `Frame arena` info.
+                            const auto& frameArena = renderer.GetFrameArena();
+                            ImGui::TableNextRow();
+                            ImGui::TableSetColumnIndex(0);
+                            ImGui::Text("Frame arena (KB):", 7, 0);
+                            ImGui::TableSetColumnIndex(1);
+                            ImGui::Text("%.1f / %.1f (peak %.1f)", frameArena.GetUsedSize() / 1024.0f, frameArena.GetCapacity() / 1024.0f, frameArena.GetPeakSize() / 1024.0f, 7, 1);
+
+                            const auto& pacingStats = renderer.GetFramePacingStats();
+
+                            // `Frame interval` info.
+                            ImGui::TableNextRow();
+                            ImGui::TableSetColumnIndex(0);
+                            ImGui::Text("Frame interval (microsec):", 8, 0);
+                            ImGui::TableSetColumnIndex(1);
+                            ImGui::Text("%d (max %d)", pacingStats.FrameIntervalAvg, pacingStats.FrameIntervalMax, 8, 1);
+
+                            // `Input-to-submit latency` info.
+                            ImGui::TableNextRow();
+                            ImGui::TableSetColumnIndex(0);
+                            ImGui::Text("Input-to-submit latency (microsec):", 9, 0);
+                            ImGui::TableSetColumnIndex(1);
+                            ImGui::Text("%d (max %d)", pacingStats.LatencyAvg, pacingStats.LatencyMax, 9, 1);
+
+                            // `Dropped ticks` info.
+                            ImGui::TableNextRow();
+                            ImGui::TableSetColumnIndex(0);
+                            ImGui::Text("Dropped ticks:", 10, 0);
+                            ImGui::TableSetColumnIndex(1);
+                            ImGui::Text("%d / %d", pacingStats.DroppedCount, pacingStats.FrameCount + pacingStats.DroppedCount, 10, 1);
+
+                            // `Texture atlas` info.
+                            auto atlasStats = renderer.GetTextureAtlasStats();
+                            ImGui::TableNextRow();
+                            ImGui::TableSetColumnIndex(0);
+                            ImGui::Text("Texture atlas:", 11, 0);
+                            ImGui::TableSetColumnIndex(1);
+                            ImGui::Text("%d images, %d pages, %.1f%% used", atlasStats.ImageCount, atlasStats.PageCount, atlasStats.Occupancy * 100.0f, 11, 1);
+
+                            // `Text shaping` info.
+                            auto shapingStats = g_App.GetFonts().GetShapedTextStats();
+                            ImGui::TableNextRow();
+                            ImGui::TableSetColumnIndex(0);
+                            ImGui::Text("Text shaping:", 12, 0);
+                            ImGui::TableSetColumnIndex(1);
+                            ImGui::Text("%d shaped, %d cached hits, %d entries", shapingStats.ShapeCount, shapingStats.HitCount, shapingStats.EntryCount, 12, 1);
+
+                            // `Glyph atlases` info.
+                            auto glyphStats = g_App.GetFonts().GetAtlasStats();
+                            ImGui::TableNextRow();
+                            ImGui::TableSetColumnIndex(0);
+                            ImGui::Text("Glyph atlases:", 13, 0);
+                            ImGui::TableSetColumnIndex(1);
+                            ImGui::Text("%s: %d glyphs, %d atlases, %.1f MB, %.1f%% used", glyphStats.LocaleName.c_str(), glyphStats.GlyphCount,
+                                        glyphStats.AtlasCount, (float)glyphStats.MemorySize / (1024.0f * 1024.0f), glyphStats.Occupancy * 100.0f, 13, 1);
 
                             ImGui::EndTable();
                         }
@@ -303,6 +423,13 @@ namespace Silent::Debug
                     // `Wireframe mode` checkbox.
                     ImGui::Checkbox("Wireframe mode", &g_Work.EnableWireframeMode);
 
+                    // `Ordering table mode` checkbox.
+                    bool enableOt = g_Work.EnableOrderingTable;
+                    if (ImGui::Checkbox("Ordering table mode", &enableOt))
+                    {
+                        g_Work.EnableOrderingTable = enableOt;
+                    }
+
                     ImGui::EndTabItem();
                 }
                 
@@ -333,6 +460,44 @@ namespace Silent::Debug
                             ImGui::TableSetColumnIndex(1);
                             ImGui::Text("(%.2f, %.2f)", cursorPos.x, cursorPos.y, 1, 1);
 
+                            // `Recording` info.
+                            auto recorderStats = input.GetRecorderStats();
+                            ImGui::TableNextRow();
+                            ImGui::TableSetColumnIndex(0);
+                            ImGui::Text("Recording:", 2, 0);
+                            ImGui::TableSetColumnIndex(1);
+                            switch (recorderStats.Mode)
+                            {
+                                case InputRecorderMode::None:
+                                {
+                                    ImGui::Text("Off (F9 to record)", 2, 1);
+                                    break;
+                                }
+                                case InputRecorderMode::Record:
+                                {
+                                    ImGui::Text("Recording %u updates, %u bytes%s", recorderStats.FrameCount, recorderStats.DataSize,
+                                                recorderStats.IsTruncated ? " (truncated)" : "", 2, 1);
+                                    break;
+                                }
+                                case InputRecorderMode::Replay:
+                                {
+                                    ImGui::Text("Replaying %u/%u updates", recorderStats.FrameIdx, recorderStats.FrameCount, 2, 1);
+                                    break;
+                                }
+                            }
+
+                            // `Action update` benchmark.
+                            ImGui::TableNextRow();
+                            ImGui::TableSetColumnIndex(0);
+                            ImGui::Text("Action update (ns):", 3, 0);
+                            ImGui::TableSetColumnIndex(1);
+                            if (ImGui::Button("Benchmark"))
+                            {
+                                g_App.GetInput().RequestActionBenchmark();
+                            }
+                            ImGui::SameLine();
+                            ImGui::Text("%.1f", g_App.GetInput().GetActionBenchmarkNs(), 3, 1);
+
                             ImGui::EndTable();
                         }
                     }
@@ -904,7 +1069,7 @@ namespace Silent::Debug
         }
     }
 
-    void CreateGui(std::function<void()> drawFunc)
+    void CreateGui(void (*drawFunc)())
     {
         auto& renderer = g_App.GetRenderer();
         renderer.SubmitDebugGui(drawFunc);
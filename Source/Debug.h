@@ -62,7 +62,8 @@ namespace Silent::Debug
 
         /** Renderer (user) */
 
-        bool EnableWireframeMode = false;
+        bool              EnableWireframeMode = false;
+        std::atomic<bool> EnableOrderingTable = false; /** Order 2D draws by PSX ordering table traversal instead of sorting. Set by debug GUI, latched into snapshots by game thread. */
 
         /** Cheats */
 
@@ -117,7 +118,7 @@ namespace Silent::Debug
      *
      * @param drawFunc Function defining the GUI to construct.
      */
-    void CreateGui(std::function<void()> drawFunc);
+    void CreateGui(void (*drawFunc)());
 
     /** @brief Creates a 3D line with additive blending and submits it to the renderer for drawing.
      * Used to construct more complex geometry.
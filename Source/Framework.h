@@ -23,6 +23,7 @@
 #include <future>
 #include <iostream>
 #include <limits>
+#include <list>
 #include <map>
 #include <optional>
 #include <queue>
@@ -316,6 +316,11 @@ namespace Silent::Input
         return *profile;
     }
 
+    const CompiledBindingProfile& BindingManager::GetCompiledBindingProfile(BindingProfileId profileId) const
+    {
+        return _compiledBindings[(int)profileId];
+    }
+
     void BindingManager::Initialize(const BindingProfile& customKeyboardMouseBinds, const BindingProfile& customGamepadBinds)
     {
         _bindings =
@@ -332,6 +337,12 @@ namespace Silent::Input
             { BindingProfileId::RawMouse,            RAW_MOUSE_BINDING_PROFILE                  },
             { BindingProfileId::RawGamepad,          RAW_GAMEPAD_BINDING_PROFILE                }
         };
+
+        // Compile all profiles so switching active profiles needs no work.
+        for (int i = 0; i < (int)BindingProfileId::Count; i++)
+        {
+            CompileBindingProfile((BindingProfileId)i);
+        }
     }
 
     void BindingManager::BindEventId(BindingProfileId profileId, ActionId actionId, EventId eventId)
@@ -344,10 +355,51 @@ namespace Silent::Input
         }
 
         _bindings[profileId][actionId].push_back(eventId);
+        CompileBindingProfile(profileId);
     }
 
     void BindingManager::UnbindEventIds(BindingProfileId profileId, ActionId actionId)
     {
         _bindings[profileId][actionId].clear();
+        CompileBindingProfile(profileId);
+    }
+
+    void BindingManager::CompileBindingProfile(BindingProfileId profileId)
+    {
+        auto& compiledProfile = _compiledBindings[(int)profileId];
+        compiledProfile       = {};
+
+        const auto* profile = Find(_bindings, profileId);
+        if (profile == nullptr)
+        {
+            compiledProfile.EventOffsets.resize((int)ActionId::Count + 1);
+            return;
+        }
+
+        // Collect present actions in ascending order.
+        for (const auto& [actionId, eventIds] : *profile)
+        {
+            compiledProfile.ActionIds.push_back(actionId);
+        }
+        std::sort(compiledProfile.ActionIds.begin(), compiledProfile.ActionIds.end());
+
+        // Flatten bound events per action.
+        compiledProfile.EventOffsets.reserve((int)ActionId::Count + 1);
+        for (int i = 0; i < (int)ActionId::Count; i++)
+        {
+            compiledProfile.EventOffsets.push_back((uint16)compiledProfile.EventIdxs.size());
+
+            const auto* eventIds = Find(*profile, (ActionId)i);
+            if (eventIds == nullptr)
+            {
+                continue;
+            }
+
+            for (auto eventId : *eventIds)
+            {
+                compiledProfile.EventIdxs.push_back((uint16)eventId);
+            }
+        }
+        compiledProfile.EventOffsets.push_back((uint16)compiledProfile.EventIdxs.size());
     }
 }
@@ -49,6 +49,16 @@ namespace Silent::Input
     extern const std::vector<BindingProfileId> USER_GAMEPAD_BINDING_PROFILE_IDS;
     extern const std::vector<BindingProfileId> RAW_EVENT_BINDING_PROFILE_IDS;
 
+    /** @brief Input binding profile compiled into flat event index tables for per-tick action resolution.
+     * The events bound to an action are `EventIdxs[EventOffsets[actionId]]` up to `EventIdxs[EventOffsets[actionId + 1]]`.
+     */
+    struct CompiledBindingProfile
+    {
+        std::vector<ActionId> ActionIds    = {}; /** Action IDs present in the profile in ascending order. */
+        std::vector<uint16>   EventOffsets = {}; /** Index = `ActionId`, value = offset into `EventIdxs`. Has `ActionId::Count + 1` entries. */
+        std::vector<uint16>   EventIdxs    = {}; /** Bound event indices, grouped by action. */
+    };
+
     /** @brief Input binder. */
     class BindingManager
     {
@@ -57,7 +67,8 @@ namespace Silent::Input
         // Fields
         // =======
 
-        std::unordered_map<BindingProfileId, BindingProfile> _bindings = {}; /** Key = binding profile ID, value = binding profile. */
+        std::unordered_map<BindingProfileId, BindingProfile>             _bindings         = {}; /** Key = binding profile ID, value = binding profile. */
+        std::array<CompiledBindingProfile, (int)BindingProfileId::Count> _compiledBindings = {}; /** Index = `BindingProfileId`. Recompiled when bindings change. */
 
     public:
         // =============
@@ -85,6 +96,13 @@ namespace Silent::Input
          */
         const BindingProfile& GetBindingProfile(BindingProfileId profileId) const;
 
+        /** @brief Gets a reference to a compiled input binding profile.
+         *
+         * @param profileId Input binding profile ID to retrieve.
+         * @return Compiled input binding profile reference.
+         */
+        const CompiledBindingProfile& GetCompiledBindingProfile(BindingProfileId profileId) const;
+
         // ==========
         // Utilities
         // ==========
@@ -110,5 +128,16 @@ namespace Silent::Input
          * @param actionId Input action ID to clear all bindings for.
          */
         void UnbindEventIds(BindingProfileId profileId, ActionId actionId);
+
+    private:
+        // ========
+        // Helpers
+        // ========
+
+        /** @brief Compiles an input binding profile into flat event index tables.
+         *
+         * @param profileId Input binding profile ID to compile.
+         */
+        void CompileBindingProfile(BindingProfileId profileId);
     };
 }
@@ -6,8 +6,10 @@
 #include "Input/Action.h"
 #include "Input/Binding.h"
 #include "Input/Event.h"
+#include "Input/Recording.h"
 #include "Input/Text.h"
 #include "Services/Clock.h"
+#include "Services/Filesystem.h"
 #include "Services/Options.h"
 #include "Services/Toasts.h"
 #include "Utils/Parallel.h"
@@ -19,6 +21,29 @@ using namespace Silent::Utils;
 
 namespace Silent::Input
 {
+    // Event states, cursor position, and analog axes.
+    constexpr uint RECORDING_CHANNEL_COUNT = (uint)EventId::Count + Vector2::AXIS_COUNT + ((uint)AnalogAxisId::Count * Vector2::AXIS_COUNT);
+
+    constexpr uint ACTION_BENCHMARK_ITERATION_COUNT = 100000;
+
+    /** @brief Gets the max state of the events bound to an input action in a compiled binding profile.
+     *
+     * @param profile Compiled binding profile.
+     * @param actionId Input action ID.
+     * @param events Event states.
+     * @return Max bound event state.
+     */
+    static float GetMaxEventState(const CompiledBindingProfile& profile, ActionId actionId, std::span<const float> events)
+    {
+        float state = 0.0f;
+        for (uint i = profile.EventOffsets[(int)actionId]; i < profile.EventOffsets[(int)actionId + 1]; i++)
+        {
+            state = std::max(state, events[profile.EventIdxs[i]]);
+        }
+
+        return state;
+    }
+
     const Action& InputManager::GetAction(ActionId actionId) const
     {
         return _actions[(int)actionId];
@@ -39,6 +64,11 @@ namespace Silent::Input
         return _gamepad.VendorId;
     }
 
+    double InputManager::GetActionBenchmarkNs() const
+    {
+        return _actionBenchmarkNs;
+    }
+
     const std::string& InputManager::GetText(const std::string& textId) const
     {
         return _text.GetText(textId);
@@ -54,6 +84,13 @@ namespace Silent::Input
         return _text.GetCursorPosition(textId);
     }
 
+    InputRecorderStats InputManager::GetRecorderStats() const
+    {
+        // @lock Restrict stats access, which the game thread writes after each update.
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        return _recorderStats;
+    }
+
     void InputManager::SetRumble(RumbleMode mode, float intensityFrom, float intensityTo, float durationSec)
     {
         _rumble.Mode          = mode;
@@ -73,6 +110,16 @@ namespace Silent::Input
         return _states.IsUsingGamepad;
     }
 
+    bool InputManager::IsRecording() const
+    {
+        return _recorder.GetMode() == InputRecorderMode::Record;
+    }
+
+    bool InputManager::IsReplaying() const
+    {
+        return _recorder.GetMode() == InputRecorderMode::Replay;
+    }
+
     void InputManager::Initialize()
     {
         const auto& options = g_App.GetOptions();
@@ -94,27 +141,58 @@ namespace Silent::Input
             _actions.push_back(Action(actionId));
         }
 
+        // Collect user action IDs.
+        for (auto actionGroupId : USER_ACTION_GROUP_IDS)
+        {
+            const auto& actionIds = ACTION_ID_GROUPS.at(actionGroupId);
+            _userActionIds.insert(_userActionIds.end(), actionIds.begin(), actionIds.end());
+        }
+
         // Initialize bindings.
         _bindings.Initialize(options->KeyboardMouseBindings, options->GamepadBindings);
     }
 
     void InputManager::Deinitialize()
     {
+        if (IsRecording())
+        {
+            StopRecording();
+        }
+
         DisconnectGamepad(_gamepad.Id);
     }
 
     void InputManager::Update(SDL_Window& window, const Vector2& mouseWheelAxis)
     {
+        auto& clock    = g_App.GetClock();
         auto& executor = g_App.GetExecutor();
 
+        // Replay recorded event states and timestep. The final update keeps the live timestep.
+        if (IsReplaying())
+        {
+            uint ticks = 0;
+            if (_recorder.ReplayFrame(_states, _analogAxes, ticks))
+            {
+                clock.SetTicks(ticks);
+            }
+            else
+            {
+                Debug::Log(Fmt("Input replay finished after {} updates.", _recorder.GetFrameIdx()));
+            }
+        }
         // Capture event states asynchronously.
-        auto tasks = ParallelTasks
+        else
         {
-            TASK(ReadKeyboard()),
-            TASK(ReadMouse(window, mouseWheelAxis)),
-            TASK(ReadGamepad())
-        };
-        executor.AddTasks(tasks).wait();
+            auto tasks = ParallelTasks
+            {
+                TASK(ReadKeyboard()),
+                TASK(ReadMouse(window, mouseWheelAxis)),
+                TASK(ReadGamepad())
+            };
+            executor.AddTasks(tasks).wait();
+
+            _recorder.RecordFrame(_states, _analogAxes, clock.GetTicks());
+        }
 
         // Update "using gamepad" state.
         if (_states.HasKeyboardInput || _states.HasMouseInput)
@@ -128,13 +206,27 @@ namespace Silent::Input
 
         // Update components.
         UpdateRumble();
-        UpdateActions();
+        UpdateActions(_actions);
         HandleHotkeyActions();
 
+        // Run requested action benchmark.
+        if (_isActionBenchmarkPending.exchange(false))
+        {
+            BenchmarkActions(ACTION_BENCHMARK_ITERATION_COUNT);
+        }
+
         // Clear data.
         _states.HasKeyboardInput = false;
         _states.HasMouseInput    = false;
         _states.HasGamepadInput  = false;
+
+        // Publish recorder stats.
+        auto recorderStats = _recorder.GetStats();
+        {
+            // @lock Restrict stats access, which the render worker reads for the debug GUI.
+            std::lock_guard<std::mutex> lock(_statsMutex);
+            _recorderStats = recorderStats;
+        }
     }
 
     void InputManager::ConnectGamepad(int deviceId)
@@ -208,6 +300,146 @@ namespace Silent::Input
         Debug::Log("Gamepad disconnected.");
     }
 
+    void InputManager::StartRecording()
+    {
+        _recorder.StartRecording(RECORDING_CHANNEL_COUNT);
+        Debug::Log("Started input recording.", Debug::LogLevel::Info, Debug::LogMode::All, true);
+    }
+
+    void InputManager::StopRecording()
+    {
+        const auto& fs = g_App.GetFilesystem();
+
+        _recorder.Stop();
+
+        // Write recording file.
+        auto timestamp = GetCurrentDateString() + "_" + GetCurrentTimeString();
+        auto filename  = (INPUT_RECORDING_FILENAME_BASE + timestamp) + INPUT_RECORDING_FILE_EXT;
+        auto path      = fs.GetRecordingsDirectory() / filename;
+        if (_recorder.Save(path))
+        {
+            Debug::Log(Fmt("Saved input recording of {} updates ({} bytes).", _recorder.GetFrameCount(), _recorder.GetDataSize()),
+                       Debug::LogLevel::Info, Debug::LogMode::All, true);
+        }
+        else
+        {
+            Debug::Log("Failed to save input recording.", Debug::LogLevel::Warning, Debug::LogMode::All, true);
+        }
+    }
+
+    bool InputManager::StartReplay(const std::filesystem::path& path)
+    {
+        if (IsRecording())
+        {
+            StopRecording();
+        }
+
+        try
+        {
+            _recorder.Load(path, RECORDING_CHANNEL_COUNT);
+        }
+        catch (const std::exception& ex)
+        {
+            Debug::Log(Fmt("Failed to load input recording: {}", ex.what()), Debug::LogLevel::Error);
+            return false;
+        }
+
+        if (!_recorder.StartReplay(RECORDING_CHANNEL_COUNT))
+        {
+            Debug::Log(Fmt("Input recording {} was made with a different event layout.", path.string()), Debug::LogLevel::Error);
+            return false;
+        }
+
+        Debug::Log(Fmt("Started input replay of {} updates.", _recorder.GetFrameCount()));
+        return true;
+    }
+
+    void InputManager::RequestActionBenchmark()
+    {
+        _isActionBenchmarkPending = true;
+    }
+
+    double InputManager::BenchmarkActions(uint iterationCount)
+    {
+        if (iterationCount == 0)
+        {
+            return 0.0;
+        }
+
+        auto actions = _actions;
+
+        auto startTime = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterationCount; i++)
+        {
+            UpdateActions(actions);
+        }
+        auto duration = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime);
+
+        double updateNs    = duration.count() / iterationCount;
+        _actionBenchmarkNs = updateNs;
+        Debug::Log(Fmt("Action benchmark: {} actions, {:.1f} ns per update, {:.2f} ns per action.",
+                       _actions.size(), updateNs, updateNs / _actions.size()));
+        return updateNs;
+    }
+
+    void InputManager::BenchmarkRecording(uint frameCount) const
+    {
+        constexpr uint HOLD_INTERVAL_TICKS = 120; // Key press every 2 seconds.
+        constexpr uint HOLD_TICKS          = 20;
+        constexpr uint MOVE_INTERVAL_TICKS = 300; // Cursor movement every 5 seconds.
+        constexpr uint MOVE_TICKS          = 60;
+
+        if (frameCount == 0)
+        {
+            return;
+        }
+
+        auto states     = States{ .Events = std::vector<float>((int)EventId::Count) };
+        auto analogAxes = std::vector<Vector2>((int)AnalogAxisId::Count);
+        auto recorder   = InputRecorder();
+
+        // Record session.
+        auto startTime = std::chrono::steady_clock::now();
+        recorder.StartRecording(RECORDING_CHANNEL_COUNT);
+        for (int i = 0; i < frameCount; i++)
+        {
+            std::fill(states.Events.begin(), states.Events.end(), 0.0f);
+            if ((i % HOLD_INTERVAL_TICKS) < HOLD_TICKS)
+            {
+                states.Events[(i / HOLD_INTERVAL_TICKS) % states.Events.size()] = 1.0f;
+            }
+
+            states.HasMouseInput = (i % MOVE_INTERVAL_TICKS) < MOVE_TICKS;
+            if (states.HasMouseInput)
+            {
+                states.CursorPosition += Vector2(2.0f, 1.0f);
+            }
+
+            recorder.RecordFrame(states, analogAxes, 1);
+        }
+        recorder.Stop();
+        auto recordDuration = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime);
+
+        // Replay session.
+        uint ticks       = 0;
+        uint replayCount = 0;
+        startTime        = std::chrono::steady_clock::now();
+        recorder.StartReplay(RECORDING_CHANNEL_COUNT);
+        for (int i = 0; i < frameCount; i++)
+        {
+            if (recorder.ReplayFrame(states, analogAxes, ticks))
+            {
+                replayCount++;
+            }
+        }
+        auto replayDuration = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime);
+
+        Debug::Log(Fmt("Recording benchmark: {} updates encoded to {} bytes ({:.2f} bytes per update), {} updates replayed.",
+                       recorder.GetFrameCount(), recorder.GetDataSize(), (double)recorder.GetDataSize() / frameCount, replayCount));
+        Debug::Log(Fmt("    Record {:.1f} ns per update, replay {:.1f} ns per update.",
+                       recordDuration.count() / frameCount, replayDuration.count() / frameCount));
+    }
+
     void InputManager::InsertText(const std::string& textId, uint lineWidthMax, uint charCountMax)
     {
         _text.InsertBuffer(textId, lineWidthMax, charCountMax);
@@ -497,93 +729,59 @@ namespace Silent::Input
         _rumble.Ticks--;
     }
 
-    void InputManager::UpdateActions()
+    void InputManager::UpdateActions(std::vector<Action>& actions) const
     {
-        const auto& options  = g_App.GetOptions();
-        auto&       executor = g_App.GetExecutor();
+        const auto& options = g_App.GetOptions();
 
         // 1) Update user action states.
-        auto updateUserActions = [&]()
+        const auto& gamepadProfile     = _bindings.GetCompiledBindingProfile(options->ActiveGamepadProfileId);
+        const auto& kmProfile          = _bindings.GetCompiledBindingProfile(options->ActiveKeyboardMouseProfileId);
+        bool        isGamepadConnected = IsGamepadConnected();
+        for (auto actionId : _userActionIds)
         {
-            // Get user action binding profiles.
-            auto gamepadProfile = _bindings.GetBindingProfile(options->ActiveGamepadProfileId);
-            auto kmProfile      = _bindings.GetBindingProfile(options->ActiveKeyboardMouseProfileId);
+            // Get max gamepad event state.
+            float state = isGamepadConnected ? GetMaxEventState(gamepadProfile, actionId, _states.Events) : 0.0f;
 
-            for (auto actionGroupId : USER_ACTION_GROUP_IDS)
+            // If no valid gamepad event state, get max keyboard/mouse event state.
+            if (state == 0.0f)
             {
-                const auto& actionIds = ACTION_ID_GROUPS.at(actionGroupId);
-                for (auto actionId : actionIds)
-                {
-                    auto& action = _actions[(int)actionId];
-                    float state  = 0.0f;
-
-                    // Get max gamepad event state.
-                    if (IsGamepadConnected())
-                    {
-                        auto gamepadEventIds = gamepadProfile.at(actionId);
-                        for (const auto& eventId : gamepadEventIds)
-                        {
-                            state = std::max(state, _states.Events[(int)eventId]);
-                        }
-                    }
-
-                    // If no valid gamepad event state, get max keyboard/mouse event state.
-                    if (state == 0.0f)
-                    {
-                        auto kmEventIds = kmProfile.at(actionId);
-                        for (const auto& eventId : kmEventIds)
-                        {
-                            state = std::max(state, _states.Events[(int)eventId]);
-                        }
-                    }
-
-                    // Use max bound event state.
-                    action.Update(state);
-                }
+                state = GetMaxEventState(kmProfile, actionId, _states.Events);
             }
-        };
+
+            // Use max bound event state.
+            actions[(int)actionId].Update(state);
+        }
 
         // 2) Update raw action states.
-        auto updateRawActions = [&]()
+        for (auto profileId : RAW_EVENT_BINDING_PROFILE_IDS)
         {
-            for (auto profileId : RAW_EVENT_BINDING_PROFILE_IDS)
+            const auto& profile = _bindings.GetCompiledBindingProfile(profileId);
+            for (auto actionId : profile.ActionIds)
             {
-                const auto& profile = _bindings.GetBindingProfile(profileId);
-                for (auto& [keyActionId, eventIds] : profile)
-                {
-                    auto& action = _actions[(int)keyActionId];
-                    float state  = 0.0f;
-
-                    for (auto eventId : eventIds)
-                    {
-                        state = std::max(state, _states.Events[(int)eventId]);
-                    }
-
-                    // Use max bound event state.
-                    action.Update(state);
-                }
+                actions[(int)actionId].Update(GetMaxEventState(profile, actionId, _states.Events));
             }
-        };
-
-        // Update action states asynchronously.
-        auto tasks = ParallelTasks
-        {
-            TASK(updateUserActions()),
-            TASK(updateRawActions())
-        };
-        executor.AddTasks(tasks).wait();
+        }
     }
 
     void InputManager::HandleHotkeyActions()
     {
         // Capture screenshot.
         static bool dbScreenshot = true;
-        if ((_states.Events[(int)EventId::PrintScreen] || _states.Events[(int)EventId::F12]) && dbScreenshot)
+        if ((_states.Events[(int)EventId::PrintScreen] || (_states.Events[(int)EventId::F12] && !_states.Events[(int)EventId::Shift])) && dbScreenshot)
         {
-            const auto& renderer = g_App.GetRenderer();
+            auto& renderer = g_App.GetRenderer();
             renderer.SaveScreenshot();
         }
-        dbScreenshot = !(_states.Events[(int)EventId::PrintScreen] || _states.Events[(int)EventId::F12]);
+        dbScreenshot = !(_states.Events[(int)EventId::PrintScreen] || (_states.Events[(int)EventId::F12] && !_states.Events[(int)EventId::Shift]));
+
+        // Toggle continuous frame capture.
+        static bool dbContinuousCapture = true;
+        if ((_states.Events[(int)EventId::Shift] && _states.Events[(int)EventId::F12]) && dbContinuousCapture)
+        {
+            auto& renderer = g_App.GetRenderer();
+            renderer.ToggleContinuousCapture();
+        }
+        dbContinuousCapture = !(_states.Events[(int)EventId::Shift] && _states.Events[(int)EventId::F12]);
 
         // Toggle fullscreen.
         static bool dbFullscreen = true;
@@ -603,6 +801,14 @@ namespace Silent::Input
                 g_App.ToggleDebugGui();
             }
             dbDebugGui = !_states.Events[(int)EventId::Grave];
+
+            // Toggle input recording. Ignored while replaying.
+            static bool dbRecording = true;
+            if (_states.Events[(int)EventId::F9] && dbRecording && !IsReplaying())
+            {
+                IsRecording() ? StopRecording() : StartRecording();
+            }
+            dbRecording = !_states.Events[(int)EventId::F9];
         }
     }
 }
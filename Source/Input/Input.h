@@ -3,6 +3,7 @@
 #include "Input/Action.h"
 #include "Input/Binding.h"
 #include "Input/Event.h"
+#include "Input/Recording.h"
 #include "Input/Text.h"
 
 namespace Silent::Input
@@ -80,13 +81,21 @@ namespace Silent::Input
         // Fields
         // =======
 
-        Gamepad              _gamepad    = {};
-        BindingManager       _bindings   = BindingManager();
-        TextManager          _text       = TextManager();
-        States               _states     = {};
-        Rumble               _rumble     = {};
-        std::vector<Action>  _actions    = {};
-        std::vector<Vector2> _analogAxes = {}; /** Index = `AnalogAxisId`. */
+        Gamepad               _gamepad       = {};
+        BindingManager        _bindings      = BindingManager();
+        TextManager           _text          = TextManager();
+        InputRecorder         _recorder      = InputRecorder();
+        States                _states        = {};
+        Rumble                _rumble        = {};
+        std::vector<Action>   _actions       = {};
+        std::vector<ActionId> _userActionIds = {}; /** User actions resolved through the active user binding profiles. */
+        std::vector<Vector2>  _analogAxes    = {}; /** Index = `AnalogAxisId`. */
+
+        std::atomic<bool>   _isActionBenchmarkPending = false; /** Action benchmark requested by any thread, run by game thread on next update. */
+        std::atomic<double> _actionBenchmarkNs        = 0.0;   /** Result of the latest action benchmark. */
+
+        InputRecorderStats _recorderStats = {}; /** Recorder statistics published by the game thread after each update. */
+        mutable std::mutex _statsMutex    = {};
 
     public:
         // =============
@@ -125,12 +134,24 @@ namespace Silent::Input
          */
         GamepadVendorId GetGamepadVendorId() const;
 
+        /** @brief Gets the result of the latest action benchmark. Safe to call from any thread.
+         *
+         * @return Average duration of one update of all actions in nanoseconds, or 0 if no benchmark has run.
+         */
+        double GetActionBenchmarkNs() const;
+
         const std::string& GetText(const std::string& textId) const;
 
         std::vector<std::string> GetTextLines(const std::string& bufferId, uint low = (uint)NO_VALUE, uint high = (uint)NO_VALUE) const;
 
         uint GetTextCursorPosition(const std::string& textId) const;
 
+        /** @brief Gets the input recorder statistics as of the last update. Safe to call from the render worker.
+         *
+         * @return Input recorder statistics.
+         */
+        InputRecorderStats GetRecorderStats() const;
+
         // ========
         // Setters
         // ========
@@ -160,6 +181,18 @@ namespace Silent::Input
          * @return `true` if a gamepad is being used, `false` otherwise.
          */
         bool IsUsingGamepad() const;
+
+        /** @brief Checks if input is currently being recorded.
+         *
+         * @return `true` if recording, `false` otherwise.
+         */
+        bool IsRecording() const;
+
+        /** @brief Checks if a recording is currently being replayed in place of device input.
+         *
+         * @return `true` if replaying, `false` otherwise.
+         */
+        bool IsReplaying() const;
         
         // ==========
         // Utilities
@@ -190,6 +223,38 @@ namespace Silent::Input
          */
         void DisconnectGamepad(int deviceId);
 
+        /** @brief Starts recording the input state and timestep of every update. */
+        void StartRecording();
+
+        /** @brief Stops recording and saves the recording to the recordings folder. */
+        void StopRecording();
+
+        /** @brief Starts replaying a recording in place of device input. Replayed updates also override the clock's tick count,
+         * so game state advances exactly as recorded. Replay stops after the last recorded update.
+         *
+         * @param path Recording file path.
+         * @return `true` if replay started, `false` if the recording failed to load or was made with a different event layout.
+         */
+        bool StartReplay(const std::filesystem::path& path);
+
+        /** @brief Requests an action benchmark to run on the game thread during the next update. Safe to call from any thread. */
+        void RequestActionBenchmark();
+
+        /** @brief Measures input action resolution by updating a scratch copy of all actions from the current event states repeatedly.
+         * Live action states are untouched. Must be called from the game thread.
+         *
+         * @param iterationCount Number of action updates to run.
+         * @return Average duration of one update of all actions in nanoseconds.
+         */
+        double BenchmarkActions(uint iterationCount);
+
+        /** @brief Measures input recording by encoding and replaying a synthetic session of idle stretches, held keys, and cursor movement.
+         * Logs the encoded size and the record and replay durations per update.
+         *
+         * @param frameCount Number of updates in the session.
+         */
+        void BenchmarkRecording(uint frameCount) const;
+
         void InsertText(const std::string& textId, uint lineWidthMax = 50, uint charCountMax = UINT_MAX);
         void UpdateText(const std::string& textId);
         void RemoveText(const std::string& textId);
@@ -218,15 +283,20 @@ namespace Silent::Input
         /** @brief Updates rumble data for the current tick if a rumble is active. */
         void UpdateRumble();
 
-        /** @brief Updates input actions for the current tick. */
-        void UpdateActions();
+        /** @brief Updates input actions for the current tick from the compiled active binding profiles. Doesn't allocate.
+         *
+         * @param[out] actions Input actions to update. Index = `ActionId`.
+         */
+        void UpdateActions(std::vector<Action>& actions) const;
 
         /** @brief Handles hardcoded hotkey actions for the current tick.
          *
          * @note Hotkey actions include:
          * - Screenshot capture
+         * - Continuous frame capture toggle
          * - Fullscreen toggle
          * - Debug GUI toggle
+         * - Input recording toggle
          */
         void HandleHotkeyActions();
     };
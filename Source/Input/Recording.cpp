@@ -0,0 +1,471 @@
+#include "Framework.h"
+#include "Input/Recording.h"
+
+#include "Input/Input.h"
+#include "Utils/Stream.h"
+
+using namespace Silent::Utils;
+
+namespace Silent::Input
+{
+    constexpr uint  RECORD_SIZE_MAX      = 16; // Upper bound of an encoded record's size beyond its changes.
+    constexpr uint  CURSOR_CHANNEL_COUNT = Vector2::AXIS_COUNT;
+    constexpr uint8 KEYBOARD_INPUT_FLAG  = 1 << 0;
+    constexpr uint8 MOUSE_INPUT_FLAG     = 1 << 1;
+    constexpr uint8 GAMEPAD_INPUT_FLAG   = 1 << 2;
+
+    /** @brief Channel value kinds. Stored in the low 2 bits of each change's varint. */
+    enum class ChannelValueKind
+    {
+        Zero,
+        One,
+        Raw
+    };
+
+    /** @brief Writes a variable-length integer of 7 bits per byte, low bits first. */
+    static void WriteVarint(std::vector<byte>& output, uint64 value)
+    {
+        while (value >= 0x80)
+        {
+            output.push_back((byte)((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        output.push_back((byte)value);
+    }
+
+    /** @brief Reads a variable-length integer and advances the offset.
+     *
+     * @return `true` if read, `false` if truncated.
+     */
+    static bool ReadVarint(std::span<const byte> input, uint& offset, uint64& value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            if (offset >= input.size())
+            {
+                return false;
+            }
+
+            auto curByte  = (uint8)input[offset++];
+            value        |= (uint64)(curByte & 0x7F) << shift;
+            if (!(curByte & 0x80))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /** @brief Gets a channel value from input states and analog axes. Channels are event states, then cursor position, then analog axes. */
+    static float GetChannel(const States& states, std::span<const Vector2> analogAxes, uint channelIdx)
+    {
+        if (channelIdx < states.Events.size())
+        {
+            return states.Events[channelIdx];
+        }
+        channelIdx -= (uint)states.Events.size();
+
+        if (channelIdx < CURSOR_CHANNEL_COUNT)
+        {
+            return (channelIdx == 0) ? states.CursorPosition.x : states.CursorPosition.y;
+        }
+        channelIdx -= CURSOR_CHANNEL_COUNT;
+
+        const auto& axis = analogAxes[channelIdx / Vector2::AXIS_COUNT];
+        return ((channelIdx % Vector2::AXIS_COUNT) == 0) ? axis.x : axis.y;
+    }
+
+    /** @brief Writes channel values to input states and analog axes. */
+    static void SetChannels(std::span<const float> channels, States& states, std::span<Vector2> analogAxes)
+    {
+        uint channelIdx = 0;
+        for (auto& state : states.Events)
+        {
+            state = channels[channelIdx++];
+        }
+
+        states.PrevCursorPosition = states.CursorPosition;
+        states.CursorPosition     = Vector2(channels[channelIdx], channels[channelIdx + 1]);
+        channelIdx               += CURSOR_CHANNEL_COUNT;
+
+        for (auto& axis : analogAxes)
+        {
+            axis        = Vector2(channels[channelIdx], channels[channelIdx + 1]);
+            channelIdx += Vector2::AXIS_COUNT;
+        }
+    }
+
+    /** @brief Reads a record and applies its changes to channel values.
+     *
+     * @return `true` if read, `false` if truncated or corrupt.
+     */
+    static bool ReadRecord(std::span<const byte> data, uint& offset, std::span<float> channels, uint& ticks, uint8& flags, uint& repeatCount)
+    {
+        uint64 changeCount = 0;
+        if (!ReadVarint(data, offset, changeCount))
+        {
+            return false;
+        }
+
+        // Apply changes.
+        uint64 channelIdx = 0;
+        for (uint64 i = 0; i < changeCount; i++)
+        {
+            uint64 change = 0;
+            if (!ReadVarint(data, offset, change))
+            {
+                return false;
+            }
+
+            channelIdx += change >> 2;
+            if (channelIdx >= channels.size())
+            {
+                return false;
+            }
+
+            switch ((ChannelValueKind)(change & 0x3))
+            {
+                case ChannelValueKind::Zero:
+                {
+                    channels[channelIdx] = 0.0f;
+                    break;
+                }
+                case ChannelValueKind::One:
+                {
+                    channels[channelIdx] = 1.0f;
+                    break;
+                }
+                case ChannelValueKind::Raw:
+                {
+                    if ((offset + sizeof(float)) > data.size())
+                    {
+                        return false;
+                    }
+
+                    std::memcpy(&channels[channelIdx], &data[offset], sizeof(float));
+                    offset += sizeof(float);
+                    break;
+                }
+                default:
+                {
+                    return false;
+                }
+            }
+
+            channelIdx++;
+        }
+
+        // Read run.
+        uint64 tickCount = 0;
+        uint64 repeats   = 0;
+        if (!ReadVarint(data, offset, tickCount) || offset >= data.size())
+        {
+            return false;
+        }
+        flags = (uint8)data[offset++];
+        if (!ReadVarint(data, offset, repeats) || tickCount > UINT_MAX || repeats > UINT_MAX)
+        {
+            return false;
+        }
+
+        ticks       = (uint)tickCount;
+        repeatCount = (uint)repeats;
+        return true;
+    }
+
+    InputRecorderMode InputRecorder::GetMode() const
+    {
+        return _mode;
+    }
+
+    uint InputRecorder::GetFrameCount() const
+    {
+        return _frameCount;
+    }
+
+    uint InputRecorder::GetFrameIdx() const
+    {
+        return _frameIdx;
+    }
+
+    uint InputRecorder::GetDataSize() const
+    {
+        return (uint)_data.size();
+    }
+
+    InputRecorderStats InputRecorder::GetStats() const
+    {
+        return InputRecorderStats
+        {
+            .Mode        = _mode,
+            .FrameCount  = _frameCount,
+            .FrameIdx    = _frameIdx,
+            .DataSize    = (uint)_data.size(),
+            .IsTruncated = _isTruncated
+        };
+    }
+
+    bool InputRecorder::IsTruncated() const
+    {
+        return _isTruncated;
+    }
+
+    void InputRecorder::StartRecording(uint channelCount)
+    {
+        _mode         = InputRecorderMode::Record;
+        _channelCount = channelCount;
+        _frameCount   = 0;
+        _frameIdx     = 0;
+        _isTruncated  = false;
+        _isRunOpen    = false;
+        _data.clear();
+        _channels.assign(channelCount, 0.0f);
+    }
+
+    void InputRecorder::Stop()
+    {
+        if (_mode == InputRecorderMode::Record && _isRunOpen)
+        {
+            CloseRun();
+        }
+
+        _mode = InputRecorderMode::None;
+    }
+
+    void InputRecorder::RecordFrame(const States& states, std::span<const Vector2> analogAxes, uint ticks)
+    {
+        if (_mode != InputRecorderMode::Record || _isTruncated)
+        {
+            return;
+        }
+
+        if ((states.Events.size() + CURSOR_CHANNEL_COUNT + (analogAxes.size() * Vector2::AXIS_COUNT)) != _channelCount)
+        {
+            Debug::Log("Input recording channel count mismatch. Stopping recording.", Debug::LogLevel::Error);
+            Stop();
+            return;
+        }
+
+        // Collect changed channels. Values are compared bitwise so replay reproduces them exactly.
+        auto changes     = std::vector<byte>();
+        uint changeCount = 0;
+        uint nextIdx     = 0;
+        for (uint i = 0; i < _channelCount; i++)
+        {
+            float value = GetChannel(states, analogAxes, i);
+            if (std::memcmp(&value, &_channels[i], sizeof(float)) == 0)
+            {
+                continue;
+            }
+
+            auto kind = ChannelValueKind::Raw;
+            if (value == 0.0f && !std::signbit(value))
+            {
+                kind = ChannelValueKind::Zero;
+            }
+            else if (value == 1.0f)
+            {
+                kind = ChannelValueKind::One;
+            }
+
+            WriteVarint(changes, ((uint64)(i - nextIdx) << 2) | (uint64)kind);
+            if (kind == ChannelValueKind::Raw)
+            {
+                const auto* bytes = (const byte*)&value;
+                changes.insert(changes.end(), bytes, bytes + sizeof(float));
+            }
+
+            _channels[i] = value;
+            nextIdx      = i + 1;
+            changeCount++;
+        }
+
+        // Collect device input flags.
+        uint8 flags = (states.HasKeyboardInput ? KEYBOARD_INPUT_FLAG : 0) |
+                      (states.HasMouseInput    ? MOUSE_INPUT_FLAG    : 0) |
+                      (states.HasGamepadInput  ? GAMEPAD_INPUT_FLAG  : 0);
+
+        // Extend active run if idle.
+        if (_isRunOpen && changeCount == 0 && ticks == _runTicks && flags == _runFlags)
+        {
+            _runRepeatCount++;
+            _frameCount++;
+            return;
+        }
+
+        if (_isRunOpen)
+        {
+            CloseRun();
+        }
+
+        // Stop recording at size limit.
+        if ((_data.size() + changes.size() + (RECORD_SIZE_MAX * 2)) > DATA_SIZE_MAX)
+        {
+            _isTruncated = true;
+            Debug::Log("Input recording reached size limit. Further input is not recorded.", Debug::LogLevel::Warning);
+            return;
+        }
+
+        // Open new run.
+        WriteVarint(_data, changeCount);
+        _data.insert(_data.end(), changes.begin(), changes.end());
+
+        _runTicks       = ticks;
+        _runFlags       = flags;
+        _runRepeatCount = 0;
+        _isRunOpen      = true;
+        _frameCount++;
+    }
+
+    bool InputRecorder::StartReplay(uint channelCount)
+    {
+        Stop();
+        if (channelCount != _channelCount)
+        {
+            return false;
+        }
+
+        _mode           = InputRecorderMode::Replay;
+        _frameIdx       = 0;
+        _offset         = 0;
+        _runRepeatCount = 0;
+        _channels.assign(channelCount, 0.0f);
+        return true;
+    }
+
+    bool InputRecorder::ReplayFrame(States& states, std::span<Vector2> analogAxes, uint& ticks)
+    {
+        if (_mode != InputRecorderMode::Replay)
+        {
+            return false;
+        }
+
+        // Repeat idle update of active run or read next record.
+        if (_runRepeatCount > 0)
+        {
+            _runRepeatCount--;
+        }
+        else
+        {
+            if (_frameIdx >= _frameCount)
+            {
+                Stop();
+                return false;
+            }
+
+            if (!ReadRecord(_data, _offset, _channels, _runTicks, _runFlags, _runRepeatCount))
+            {
+                Debug::Log("Input recording is corrupt. Stopping replay.", Debug::LogLevel::Error);
+                Stop();
+                return false;
+            }
+        }
+
+        SetChannels(_channels, states, analogAxes);
+        states.HasKeyboardInput = _runFlags & KEYBOARD_INPUT_FLAG;
+        states.HasMouseInput    = _runFlags & MOUSE_INPUT_FLAG;
+        states.HasGamepadInput  = _runFlags & GAMEPAD_INPUT_FLAG;
+        ticks                   = _runTicks;
+
+        _frameIdx++;
+        return true;
+    }
+
+    bool InputRecorder::Save(const std::filesystem::path& path) const
+    {
+        auto stream = Stream(path, false, true);
+        if (!stream.IsOpen())
+        {
+            return false;
+        }
+
+        stream.WriteUint32(MAGIC);
+        stream.WriteUint16(VERSION);
+        stream.WriteUint32(_channelCount);
+        stream.WriteUint32(_frameCount);
+        stream.WriteUint32((uint32)_data.size());
+        stream.Write(_data.data(), (uint)_data.size());
+        return true;
+    }
+
+    void InputRecorder::Load(const std::filesystem::path& path, uint channelCount)
+    {
+        auto stream = Stream(path, true, false);
+        if (!stream.IsOpen())
+        {
+            throw std::runtime_error(Fmt("Failed to open input recording file {}.", path.string()));
+        }
+
+        // Read header.
+        if (stream.ReadUint32() != MAGIC)
+        {
+            throw std::runtime_error(Fmt("{} is not an input recording file.", path.string()));
+        }
+
+        uint16 version = stream.ReadUint16();
+        if (version != VERSION)
+        {
+            throw std::runtime_error(Fmt("Unsupported input recording version {} in {}.", version, path.string()));
+        }
+
+        // Check channel layout before allocating for it.
+        uint fileChannelCount = stream.ReadUint32();
+        if (fileChannelCount != channelCount)
+        {
+            throw std::runtime_error(Fmt("Input recording {} has {} channels, expected {}.", path.string(), fileChannelCount, channelCount));
+        }
+
+        // Read updates.
+        Stop();
+        _channelCount = fileChannelCount;
+        _frameCount   = stream.ReadUint32();
+        _frameIdx     = 0;
+        _isTruncated  = false;
+        _isRunOpen    = false;
+
+        // Check update data size against remaining file size before allocating.
+        constexpr uint HEADER_SIZE = sizeof(uint32) + sizeof(uint16) + (sizeof(uint32) * 3);
+
+        uint fileSize = stream.GetSize();
+        uint dataSize = stream.ReadUint32();
+        if (fileSize < HEADER_SIZE || dataSize > (fileSize - HEADER_SIZE))
+        {
+            throw std::runtime_error(Fmt("Input recording data size {} exceeds file size in {}.", dataSize, path.string()));
+        }
+
+        _data.resize(dataSize);
+        stream.Read(_data.data(), dataSize);
+
+        // Validate records.
+        auto channels   = std::vector<float>(_channelCount);
+        uint offset     = 0;
+        uint frameCount = 0;
+        while (offset < _data.size())
+        {
+            uint  ticks       = 0;
+            uint8 flags       = 0;
+            uint  repeatCount = 0;
+            if (!ReadRecord(_data, offset, channels, ticks, flags, repeatCount))
+            {
+                throw std::runtime_error(Fmt("Input recording {} is corrupt.", path.string()));
+            }
+
+            frameCount += repeatCount + 1;
+        }
+
+        if (frameCount != _frameCount)
+        {
+            throw std::runtime_error(Fmt("Input recording {} has {} updates, expected {}.", path.string(), frameCount, _frameCount));
+        }
+    }
+
+    void InputRecorder::CloseRun()
+    {
+        WriteVarint(_data, _runTicks);
+        _data.push_back((byte)_runFlags);
+        WriteVarint(_data, _runRepeatCount);
+        _isRunOpen = false;
+    }
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+namespace Silent::Input
+{
+    struct States;
+
+    constexpr char INPUT_RECORDING_FILENAME_BASE[] = "InputRecording_";
+    constexpr char INPUT_RECORDING_FILE_EXT[]      = ".inputrec";
+
+    /** @brief Input recorder modes. */
+    enum class InputRecorderMode
+    {
+        None,
+        Record,
+        Replay
+    };
+
+    /** @brief Input recorder statistics. */
+    struct InputRecorderStats
+    {
+        InputRecorderMode Mode        = InputRecorderMode::None;
+        uint              FrameCount  = 0;     /** Updates in the recording. */
+        uint              FrameIdx    = 0;     /** Next update to replay. */
+        uint              DataSize    = 0;     /** Encoded update stream size in bytes. */
+        bool              IsTruncated = false;
+    };
+
+    /** @brief Deterministic recording of per-tick input state. Replaying a recording in place of device reads
+     * reproduces a play session's event states, cursor position, analog axes, and timestep exactly.
+     *
+     * @note Each input update is stored as a record of changed channels followed by its tick count, device input flags,
+     * and a repeat count of identical idle updates after it. Channels are the event states, cursor position, and analog axes
+     * flattened to floats. A change is a varint of the index delta to the previous change and a value kind, followed by the raw
+     * float only if the value is neither 0 nor 1. An idle update therefore costs nothing beyond incrementing its run's repeat count.
+     */
+    class InputRecorder
+    {
+    public:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr uint32 MAGIC         = 0x524E4953;       // "SINR" little-endian.
+        static constexpr uint16 VERSION       = 1;
+        static constexpr uint   DATA_SIZE_MAX = 64 * 1024 * 1024; /** Recording stops once it reaches this size in bytes. */
+
+    private:
+        // =======
+        // Fields
+        // =======
+
+        InputRecorderMode  _mode         = InputRecorderMode::None;
+        std::vector<byte>  _data         = {}; /** Encoded updates without file header. */
+        std::vector<float> _channels     = {}; /** Channel values of the previous update. */
+        uint               _channelCount = 0;
+        uint               _frameCount   = 0;  /** Updates in the recording. */
+        uint               _frameIdx     = 0;  /** Next update to replay. */
+        bool               _isTruncated  = false;
+
+        uint  _runTicks       = 0; /** Tick count of the active run. */
+        uint8 _runFlags       = 0; /** Device input flags of the active run. */
+        uint  _runRepeatCount = 0; /** Identical idle updates following the active run's first update. */
+        bool  _isRunOpen      = false;
+        uint  _offset         = 0; /** Replay read offset. */
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs an empty default `InputRecorder`. */
+        InputRecorder() = default;
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the active mode.
+         *
+         * @return Recorder mode.
+         */
+        InputRecorderMode GetMode() const;
+
+        /** @brief Gets the number of updates in the recording.
+         *
+         * @return Update count.
+         */
+        uint GetFrameCount() const;
+
+        /** @brief Gets the index of the next update to replay.
+         *
+         * @return Replay position.
+         */
+        uint GetFrameIdx() const;
+
+        /** @brief Gets the encoded update stream size in bytes.
+         *
+         * @return Data size.
+         */
+        uint GetDataSize() const;
+
+        /** @brief Gets the recorder statistics.
+         *
+         * @return Input recorder statistics.
+         */
+        InputRecorderStats GetStats() const;
+
+        // ==========
+        // Inquirers
+        // ==========
+
+        /** @brief Checks if recording stopped because the recording reached `DATA_SIZE_MAX`.
+         *
+         * @return `true` if truncated, `false` otherwise.
+         */
+        bool IsTruncated() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Starts recording, clearing previously recorded updates.
+         *
+         * @param channelCount Number of channels per update.
+         */
+        void StartRecording(uint channelCount);
+
+        /** @brief Stops recording or replaying. Recorded updates are kept and can be saved. */
+        void Stop();
+
+        /** @brief Records the input state of an update.
+         *
+         * @param states Input states captured from devices.
+         * @param analogAxes Analog axes captured from devices.
+         * @param ticks Tick count of the update.
+         */
+        void RecordFrame(const States& states, std::span<const Vector2> analogAxes, uint ticks);
+
+        /** @brief Starts replaying loaded or recorded updates from the beginning.
+         *
+         * @param channelCount Number of channels per update. Must match the recording's channel count.
+         * @return `true` if started, `false` if the recording's channel count doesn't match.
+         */
+        bool StartReplay(uint channelCount);
+
+        /** @brief Replays the next update's input state, overwriting device-captured states. Stops replaying after the last update.
+         *
+         * @param[out] states Input states to write.
+         * @param[out] analogAxes Analog axes to write.
+         * @param[out] ticks Recorded tick count of the update.
+         * @return `true` if an update was replayed, `false` if the recording has ended or is corrupt.
+         */
+        bool ReplayFrame(States& states, std::span<Vector2> analogAxes, uint& ticks);
+
+        /** @brief Saves the recording to a binary file.
+         *
+         * @param path File path.
+         * @return `true` if saved, `false` otherwise.
+         */
+        bool Save(const std::filesystem::path& path) const;
+
+        /** @brief Loads a recording from a binary file, replacing recorded updates. Throws if the file is not a valid recording.
+         *
+         * @param path File path.
+         * @param channelCount Expected number of channels per update. Recordings with a different count are rejected before any allocation.
+         */
+        void Load(const std::filesystem::path& path, uint channelCount);
+
+    private:
+        // ========
+        // Helpers
+        // ========
+
+        /** @brief Writes the active run's tick count, flags, and repeat count, closing the run. */
+        void CloseRun();
+    };
+}
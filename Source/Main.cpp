@@ -2,11 +2,11 @@
 
 #include "Application.h"
 
-int main()
+int main(int argc, char* argv[])
 {
     try
     {
-        g_App.Initialize();
+        g_App.Initialize(std::vector<std::string>(argv + 1, argv + argc));
         g_App.Run();
         g_App.Deinitialize();
     }
@@ -0,0 +1,306 @@
+#include "Framework.h"
+#include "Renderer/Backends/Null/DrawTrace.h"
+
+#include "Utils/Stream.h"
+
+using namespace Silent::Utils;
+
+namespace Silent::Renderer
+{
+    constexpr uint   COMMAND_SIZE_MAX = sizeof(DrawTraceCommandType) + (sizeof(uint32) * 3);
+    constexpr uint64 FNV_OFFSET_BASIS = 0xCBF29CE484222325;
+    constexpr uint64 FNV_PRIME        = 0x100000001B3;
+
+    /** @brief Draw command decoded by the mock encoder during replay. */
+    struct ReplayDrawCommand
+    {
+        RenderStage Stage         = RenderStage::Count;
+        BlendMode   BlendM        = BlendMode::Count;
+        int         TextureIdx    = NO_VALUE;
+        uint        VertexCount   = 0;
+        uint        IndexCount    = 0;
+        uint        InstanceCount = 0;
+    };
+
+    /** @brief Reads a trivially copyable value from an encoded stream and advances the offset.
+     *
+     * @param data Encoded stream.
+     * @param offset Read offset.
+     * @return Read value.
+     */
+    template <typename T>
+    static T ReadValue(std::span<const byte> data, uint& offset)
+    {
+        if ((offset + sizeof(T)) > data.size())
+        {
+            throw std::runtime_error("Draw trace command stream is truncated.");
+        }
+
+        auto val = T{};
+        std::memcpy(&val, &data[offset], sizeof(T));
+        offset += sizeof(T);
+        return val;
+    }
+
+    /** @brief Mixes a value into an FNV-1a hash.
+     *
+     * @param hash Hash to update.
+     * @param val Value to mix.
+     */
+    static void HashValue(uint64& hash, uint64 val)
+    {
+        for (int i = 0; i < sizeof(uint64); i++)
+        {
+            hash ^= (val >> (i * 8)) & 0xFF;
+            hash *= FNV_PRIME;
+        }
+    }
+
+    template <typename T>
+    void DrawTrace::Write(const T& val)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        const auto* bytes = (const byte*)&val;
+        _data.insert(_data.end(), bytes, bytes + sizeof(T));
+    }
+
+    std::span<const byte> DrawTrace::GetData() const
+    {
+        return _data;
+    }
+
+    const DrawTraceStats& DrawTrace::GetStats() const
+    {
+        return _stats;
+    }
+
+    bool DrawTrace::IsTruncated() const
+    {
+        return _isTruncated;
+    }
+
+    void DrawTrace::Clear()
+    {
+        _data.clear();
+        _stats       = {};
+        _stage       = RenderStage::Count;
+        _blendMode   = BlendMode::Count;
+        _textureIdx  = NO_VALUE;
+        _isFrameOpen = false;
+        _isTruncated = false;
+    }
+
+    void DrawTrace::BeginFrame(uint64 frameId)
+    {
+        if (!CanRecord())
+        {
+            return;
+        }
+
+        Write(DrawTraceCommandType::BeginFrame);
+        Write(frameId);
+
+        _stage       = RenderStage::Count;
+        _blendMode   = BlendMode::Count;
+        _textureIdx  = NO_VALUE;
+        _isFrameOpen = true;
+        _stats.FrameCount++;
+    }
+
+    void DrawTrace::AddDraw(RenderStage stage, BlendMode blendMode, int texIdx, uint vertCount, uint idxCount, uint instanceCount)
+    {
+        if (!_isFrameOpen || !CanRecord())
+        {
+            return;
+        }
+
+        // Record state change.
+        if (stage != _stage || blendMode != _blendMode || texIdx != _textureIdx)
+        {
+            Write(DrawTraceCommandType::SetState);
+            Write((uint8)stage);
+            Write((uint8)blendMode);
+            Write((int32)texIdx);
+
+            _stage      = stage;
+            _blendMode  = blendMode;
+            _textureIdx = texIdx;
+            _stats.StateChangeCount++;
+        }
+
+        // Record draw.
+        Write(DrawTraceCommandType::Draw);
+        Write((uint32)vertCount);
+        Write((uint32)idxCount);
+        Write((uint32)instanceCount);
+
+        _stats.DrawCount++;
+        _stats.VertexCount   += vertCount;
+        _stats.IndexCount    += idxCount;
+        _stats.InstanceCount += instanceCount;
+    }
+
+    void DrawTrace::EndFrame()
+    {
+        // Always allowed to close an open frame so truncated traces stay well-formed.
+        if (!_isFrameOpen)
+        {
+            return;
+        }
+
+        Write(DrawTraceCommandType::EndFrame);
+        _isFrameOpen = false;
+    }
+
+    bool DrawTrace::Save(const std::filesystem::path& path) const
+    {
+        auto stream = Stream(path, false, true);
+        if (!stream.IsOpen())
+        {
+            return false;
+        }
+
+        stream.WriteUint32(MAGIC);
+        stream.WriteUint16(VERSION);
+        stream.WriteUint32((uint32)_data.size());
+        stream.Write(_data.data(), (uint)_data.size());
+        return true;
+    }
+
+    void DrawTrace::Load(const std::filesystem::path& path)
+    {
+        auto stream = Stream(path, true, false);
+        if (!stream.IsOpen())
+        {
+            throw std::runtime_error(Fmt("Failed to open draw trace file {}.", path.string()));
+        }
+
+        // Read header.
+        if (stream.ReadUint32() != MAGIC)
+        {
+            throw std::runtime_error(Fmt("{} is not a draw trace file.", path.string()));
+        }
+
+        uint16 version = stream.ReadUint16();
+        if (version != VERSION)
+        {
+            throw std::runtime_error(Fmt("Unsupported draw trace version {} in {}.", version, path.string()));
+        }
+
+        // Check command data size against remaining file size before allocating.
+        constexpr uint HEADER_SIZE = sizeof(uint32) + sizeof(uint16) + sizeof(uint32);
+
+        uint fileSize = stream.GetSize();
+        uint dataSize = stream.ReadUint32();
+        if (fileSize < HEADER_SIZE || dataSize > (fileSize - HEADER_SIZE))
+        {
+            throw std::runtime_error(Fmt("Draw trace data size {} exceeds file size in {}.", dataSize, path.string()));
+        }
+
+        // Read commands.
+        Clear();
+        _data.resize(dataSize);
+        stream.Read(_data.data(), dataSize);
+
+        // Validate commands and restore statistics.
+        _stats = Replay(1).Stats;
+    }
+
+    DrawTraceReplayStats DrawTrace::Replay(uint iterationCount) const
+    {
+        auto replayStats = DrawTraceReplayStats{};
+        auto hash        = FNV_OFFSET_BASIS;
+
+        // Mock command encoder. Decoded draws are encoded into a reused command list per frame as a backend would.
+        auto commands = std::vector<ReplayDrawCommand>{};
+        auto state    = ReplayDrawCommand{};
+
+        auto startTime = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterationCount; i++)
+        {
+            uint offset = 0;
+            while (offset < _data.size())
+            {
+                auto type = ReadValue<DrawTraceCommandType>(_data, offset);
+                switch (type)
+                {
+                    case DrawTraceCommandType::BeginFrame:
+                    {
+                        HashValue(hash, ReadValue<uint64>(_data, offset));
+                        commands.clear();
+                        state = {};
+                        replayStats.Stats.FrameCount++;
+                        break;
+                    }
+                    case DrawTraceCommandType::SetState:
+                    {
+                        state.Stage      = (RenderStage)ReadValue<uint8>(_data, offset);
+                        state.BlendM     = (BlendMode)ReadValue<uint8>(_data, offset);
+                        state.TextureIdx = ReadValue<int32>(_data, offset);
+                        if (state.Stage >= RenderStage::Count || state.BlendM >= BlendMode::Count)
+                        {
+                            throw std::runtime_error("Draw trace contains invalid draw state.");
+                        }
+
+                        HashValue(hash, ((uint64)state.Stage << 40) | ((uint64)state.BlendM << 32) | (uint32)state.TextureIdx);
+                        replayStats.Stats.StateChangeCount++;
+                        break;
+                    }
+                    case DrawTraceCommandType::Draw:
+                    {
+                        auto& cmd         = commands.emplace_back(state);
+                        cmd.VertexCount   = ReadValue<uint32>(_data, offset);
+                        cmd.IndexCount    = ReadValue<uint32>(_data, offset);
+                        cmd.InstanceCount = ReadValue<uint32>(_data, offset);
+
+                        HashValue(hash, ((uint64)cmd.VertexCount << 32) | cmd.IndexCount);
+                        HashValue(hash, cmd.InstanceCount);
+                        replayStats.Stats.DrawCount++;
+                        replayStats.Stats.VertexCount   += cmd.VertexCount;
+                        replayStats.Stats.IndexCount    += cmd.IndexCount;
+                        replayStats.Stats.InstanceCount += cmd.InstanceCount;
+                        break;
+                    }
+                    case DrawTraceCommandType::EndFrame:
+                    {
+                        HashValue(hash, commands.size());
+                        break;
+                    }
+                    default:
+                    {
+                        throw std::runtime_error(Fmt("Draw trace contains invalid command type {}.", (int)type));
+                    }
+                }
+            }
+        }
+        auto duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime);
+
+        // Compute throughput.
+        replayStats.DurationSec = duration.count();
+        if (replayStats.DurationSec > 0.0)
+        {
+            replayStats.DrawsPerSec  = replayStats.Stats.DrawCount  / replayStats.DurationSec;
+            replayStats.FramesPerSec = replayStats.Stats.FrameCount / replayStats.DurationSec;
+        }
+        replayStats.Checksum = hash;
+        return replayStats;
+    }
+
+    bool DrawTrace::CanRecord()
+    {
+        if (_isTruncated)
+        {
+            return false;
+        }
+
+        // Keep room to close the current frame.
+        if ((_data.size() + (COMMAND_SIZE_MAX * 2)) > DATA_SIZE_MAX)
+        {
+            _isTruncated = true;
+            return false;
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include "Renderer/Common/Enums.h"
+
+namespace Silent::Renderer
+{
+    constexpr char DRAW_TRACE_FILENAME_BASE[] = "DrawTrace_";
+    constexpr char DRAW_TRACE_FILE_EXT[]      = ".drawtrace";
+
+    /** @brief Draw trace command types. Stored as a single byte preceding each command's payload. */
+    enum class DrawTraceCommandType : uint8
+    {
+        BeginFrame, /** Payload: frame ID (`uint64`). */
+        SetState,   /** Payload: render stage (`uint8`), blend mode (`uint8`), texture index (`int32`). */
+        Draw,       /** Payload: vertex count, index count, instance count (`uint32` each). */
+        EndFrame,   /** No payload. */
+
+        Count
+    };
+
+    /** @brief Aggregate draw stream statistics of a trace. */
+    struct DrawTraceStats
+    {
+        uint   FrameCount       = 0;
+        uint   DrawCount        = 0;
+        uint   StateChangeCount = 0;
+        uint64 VertexCount      = 0;
+        uint64 IndexCount       = 0;
+        uint64 InstanceCount    = 0;
+    };
+
+    /** @brief Throughput of a draw trace replay. */
+    struct DrawTraceReplayStats
+    {
+        DrawTraceStats Stats        = {}; /** Totals over all iterations. */
+        double         DurationSec  = 0.0;
+        double         DrawsPerSec  = 0.0;
+        double         FramesPerSec = 0.0;
+        uint64         Checksum     = 0;  /** Hash of the replayed commands. Equal across replays of identical traces. */
+    };
+
+    /** @brief Compact binary recording of a renderer's draw stream: frames, state changes, and draws with their vertex,
+     * index, and instance counts. Identical submissions produce byte-identical traces, so traces can be diffed across builds
+     * and replayed into throughput benchmarks without a window or GPU.
+     */
+    class DrawTrace
+    {
+    public:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr uint32 MAGIC         = 0x52544453;       // "SDTR" little-endian.
+        static constexpr uint16 VERSION       = 1;
+        static constexpr uint   DATA_SIZE_MAX = 64 * 1024 * 1024; /** Recording stops once the trace reaches this size in bytes. */
+
+    private:
+        // =======
+        // Fields
+        // =======
+
+        std::vector<byte> _data        = {}; /** Encoded commands without file header. */
+        DrawTraceStats    _stats       = {};
+        RenderStage       _stage       = RenderStage::Count;
+        BlendMode         _blendMode   = BlendMode::Count;
+        int               _textureIdx  = NO_VALUE;
+        bool              _isFrameOpen = false;
+        bool              _isTruncated = false; /** Set once `DATA_SIZE_MAX` is reached. */
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs an empty default `DrawTrace`. */
+        DrawTrace() = default;
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the encoded command stream.
+         *
+         * @return Encoded commands.
+         */
+        std::span<const byte> GetData() const;
+
+        /** @brief Gets the aggregate statistics of the recorded commands.
+         *
+         * @return Trace statistics.
+         */
+        const DrawTraceStats& GetStats() const;
+
+        // ==========
+        // Inquirers
+        // ==========
+
+        /** @brief Checks if recording stopped because the trace reached `DATA_SIZE_MAX`.
+         *
+         * @return `true` if truncated, `false` otherwise.
+         */
+        bool IsTruncated() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Clears all recorded commands while retaining allocated memory. */
+        void Clear();
+
+        /** @brief Records the start of a frame. Resets tracked state so each frame's first draw records its state.
+         *
+         * @param frameId Frame ID of the rendered snapshot.
+         */
+        void BeginFrame(uint64 frameId);
+
+        /** @brief Records a draw. A state change command is recorded first if the draw state differs from the previous draw.
+         *
+         * @param stage Render stage.
+         * @param blendMode Blend mode.
+         * @param texIdx Texture asset index, or `NO_VALUE` if untextured.
+         * @param vertCount Vertex count.
+         * @param idxCount Index count, 0 if non-indexed.
+         * @param instanceCount Instance count.
+         */
+        void AddDraw(RenderStage stage, BlendMode blendMode, int texIdx, uint vertCount, uint idxCount, uint instanceCount);
+
+        /** @brief Records the end of a frame. */
+        void EndFrame();
+
+        /** @brief Saves the trace to a binary file.
+         *
+         * @param path File path.
+         * @return `true` if saved, `false` otherwise.
+         */
+        bool Save(const std::filesystem::path& path) const;
+
+        /** @brief Loads a trace from a binary file, replacing recorded commands. Throws if the file is not a valid trace.
+         *
+         * @param path File path.
+         */
+        void Load(const std::filesystem::path& path);
+
+        /** @brief Decodes and replays the trace through a mock command encoder to measure stream throughput.
+         *
+         * @param iterationCount Number of times to replay the full trace.
+         * @return Replay throughput.
+         */
+        DrawTraceReplayStats Replay(uint iterationCount) const;
+
+    private:
+        // ========
+        // Helpers
+        // ========
+
+        /** @brief Appends a trivially copyable value to the encoded stream.
+         *
+         * @param val Value to append.
+         */
+        template <typename T>
+        void Write(const T& val);
+
+        /** @brief Checks if there is room for another command and flags truncation if not.
+         *
+         * @return `true` if a command can be recorded, `false` otherwise.
+         */
+        bool CanRecord();
+    };
+}
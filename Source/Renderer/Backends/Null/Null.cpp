@@ -0,0 +1,207 @@
+#include "Framework.h"
+#include "Renderer/Backends/Null/Null.h"
+
+#include "Application.h"
+#include "Renderer/Backends/Null/DrawTrace.h"
+#include "Renderer/Common/Objects/Graphic/Batch.h"
+#include "Renderer/Common/Objects/Graphic/Bucket.h"
+#include "Renderer/Common/Objects/Graphic/DebugShape.h"
+#include "Renderer/Renderer.h"
+#include "Services/Filesystem.h"
+#include "Services/Options.h"
+#include "Utils/Utils.h"
+
+using namespace Silent::Services;
+using namespace Silent::Utils;
+
+namespace Silent::Renderer
+{
+    const DrawTrace& NullRenderer::GetTrace() const
+    {
+        return _trace;
+    }
+
+    double NullRenderer::GetPrepareTimeAverage() const
+    {
+        return (_frameCount != 0) ? (_prepareTimeSec / _frameCount) : 0.0;
+    }
+
+    double NullRenderer::GetPrepareTimeMax() const
+    {
+        return _prepareTimeMaxSec;
+    }
+
+    void NullRenderer::Initialize(SDL_Window& window)
+    {
+        Debug::Log("Using null renderer.");
+
+        _type   = RendererType::Null;
+        _window = &window;
+
+        // Create ImGui context. Font atlas is built on the CPU since there is no backend to upload it.
+        ImGui::CreateContext();
+        ImGui::GetIO().ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard | ImGuiConfigFlags_NavEnableGamepad;
+        ImGui_ImplSDL3_InitForOther(_window);
+
+        unsigned char* fontPixels = nullptr;
+        int            fontWidth  = 0;
+        int            fontHeight = 0;
+        ImGui::GetIO().Fonts->GetTexDataAsRGBA32(&fontPixels, &fontWidth, &fontHeight);
+    }
+
+    void NullRenderer::Deinitialize()
+    {
+        // Report frame build cost and replay throughput.
+        const auto& stats = _trace.GetStats();
+        Debug::Log(Fmt("Null renderer recorded {} frames, {} draws, {} state changes.", stats.FrameCount, stats.DrawCount, stats.StateChangeCount));
+        Debug::Log(Fmt("    PrepareFrameData: {:.3f} ms average, {:.3f} ms max.", GetPrepareTimeAverage() * 1000.0, _prepareTimeMaxSec * 1000.0));
+        if (_trace.IsTruncated())
+        {
+            Debug::Log("    Draw trace truncated at size limit.", Debug::LogLevel::Warning);
+        }
+
+        auto replayStats = _trace.Replay(REPLAY_ITERATION_COUNT);
+        Debug::Log(Fmt("    Trace replay: {:.0f} draws/s, {:.0f} frames/s, checksum {:016X}.",
+                       replayStats.DrawsPerSec, replayStats.FramesPerSec, replayStats.Checksum));
+
+        SaveTrace();
+        _trace.Clear();
+
+        ImGui_ImplSDL3_Shutdown();
+        ImGui::DestroyContext();
+    }
+
+    void NullRenderer::Update()
+    {
+        // Frame setup.
+        auto startTime = std::chrono::steady_clock::now();
+        PrepareFrameData();
+        double prepareTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+        _frameCount++;
+        _prepareTimeSec    += prepareTime;
+        _prepareTimeMaxSec  = std::max(_prepareTimeMaxSec, prepareTime);
+
+        // Record frame.
+        const auto& snapshot = _snapshots.GetReadBuffer();
+        _trace.BeginFrame(snapshot.FrameId);
+        Draw3dScene();
+        Draw2dScene();
+        DrawPostProcess();
+        DrawDebugGui();
+        _trace.EndFrame();
+
+        // Save trace on screenshot request.
+        if (_isScreenshotRequested.exchange(false, std::memory_order_acq_rel))
+        {
+            SaveTrace();
+        }
+
+        // Measure frame pacing.
+        _framePacing.Record(snapshot.FrameId, snapshot.InputTime);
+
+        // Clear frame setup.
+        ClearFrameData();
+    }
+
+    void NullRenderer::Draw3dScene()
+    {
+        const auto& snapshot = _snapshots.GetReadBuffer();
+
+        // 3D primitive buckets.
+        for (const auto& bucket : _buckets3d)
+        {
+            uint vertCount = 0;
+            for (int i = bucket.Start; i < (bucket.Start + bucket.Count); i++)
+            {
+                const auto& key   = _sortKeys3d[i];
+                const auto& prims = (key.GetLayer() == DrawLayer::Debug3d) ? snapshot.DebugPrimitives3d : snapshot.Primitives3d;
+                vertCount        += (uint)prims[key.GetItemIdx()].Vertices.size();
+            }
+
+            _trace.AddDraw(bucket.Stage, bucket.BlendM, bucket.TextureIdx, vertCount, 0, 1);
+            _drawCallCount++;
+        }
+
+        // Instanced debug shapes.
+        for (const auto& draw : _debugShapeBatcher.GetDraws())
+        {
+            auto stage = draw.IsWireframe ? RenderStage::DebugShape3dWireframe : RenderStage::DebugShape3d;
+            _trace.AddDraw(stage, BlendMode::Add, NO_VALUE, draw.VertexCount, 0, draw.InstanceCount);
+            _drawCallCount++;
+        }
+    }
+
+    void NullRenderer::Draw2dScene()
+    {
+        auto indices = _batcher2d.GetIndices();
+        for (const auto& batch : _batcher2d.GetBatches())
+        {
+            if (batch.IndexCount == 0)
+            {
+                continue;
+            }
+
+            // Batches reference contiguous vertex ranges, so the index range spans the batch's vertices.
+            auto batchIdxs        = indices.subspan(batch.IndexStart, batch.IndexCount);
+            auto [minIdx, maxIdx] = std::minmax_element(batchIdxs.begin(), batchIdxs.end());
+
+            _trace.AddDraw(batch.Stage, batch.BlendM, batch.TextureIdx, (uint)(*maxIdx - *minIdx) + 1, batch.IndexCount, 1);
+            _drawCallCount++;
+        }
+    }
+
+    void NullRenderer::DrawPostProcess()
+    {
+        // No post-process passes are implemented by any backend yet.
+    }
+
+    void NullRenderer::DrawDebugGui()
+    {
+        // If debug GUI is disabled, return early.
+        const auto& options = g_App.GetOptions();
+        if (!options->EnableDebugGui)
+        {
+            return;
+        }
+
+        // Build GUI on the CPU. Draw data is discarded, so only its construction cost is measured.
+        ImGui_ImplSDL3_NewFrame();
+        ImGui::NewFrame();
+
+        const auto& snapshot = _snapshots.GetReadBuffer();
+        for (const auto& drawCall : snapshot.DebugGuiDrawCalls)
+        {
+            drawCall();
+        }
+
+        ImGui::Render();
+    }
+
+    bool NullRenderer::CopyFramePixels(std::unique_ptr<CaptureFrame>& frame)
+    {
+        // No render surface.
+        return false;
+    }
+
+    void NullRenderer::SaveTrace() const
+    {
+        const auto& fs = g_App.GetFilesystem();
+
+        // Ensure directory exists.
+        auto timestamp = GetCurrentDateString() + "_" + GetCurrentTimeString();
+        auto filename  = (DRAW_TRACE_FILENAME_BASE + timestamp) + DRAW_TRACE_FILE_EXT;
+        auto path      = fs.GetScreenshotsDirectory() / filename;
+        std::filesystem::create_directories(path.parent_path());
+
+        // Write trace file.
+        if (_trace.Save(path))
+        {
+            Debug::Log("Saved draw trace.", Debug::LogLevel::Info, Debug::LogMode::All, true);
+        }
+        else
+        {
+            Debug::Log("Failed to save draw trace.", Debug::LogLevel::Warning, Debug::LogMode::All, true);
+        }
+    }
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Renderer/Backends/Null/DrawTrace.h"
+#include "Renderer/Renderer.h"
+
+namespace Silent::Renderer
+{
+    /** @brief Headless renderer backend. Runs the full CPU-side frame build, including sorting, batching, and debug GUI construction,
+     * but records the resulting draw stream into a `DrawTrace` instead of drawing. Requires no GPU and no visible window.
+     */
+    class NullRenderer : public RendererBase
+    {
+    public:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr uint REPLAY_ITERATION_COUNT = 16; /** Trace replays benchmarked on deinitialization. */
+
+    private:
+        // =======
+        // Fields
+        // =======
+
+        DrawTrace _trace             = DrawTrace(); /** Draw stream recorded since initialization. */
+        uint      _frameCount        = 0;
+        double    _prepareTimeSec    = 0.0;         /** Accumulated `PrepareFrameData` time. */
+        double    _prepareTimeMaxSec = 0.0;
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs an uninitialized default `NullRenderer`. */
+        NullRenderer() = default;
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the recorded draw trace.
+         *
+         * @return Draw trace.
+         */
+        const DrawTrace& GetTrace() const;
+
+        /** @brief Gets the average `PrepareFrameData` time of rendered frames.
+         *
+         * @return Average prepare time in seconds.
+         */
+        double GetPrepareTimeAverage() const;
+
+        /** @brief Gets the longest `PrepareFrameData` time of rendered frames.
+         *
+         * @return Maximum prepare time in seconds.
+         */
+        double GetPrepareTimeMax() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        void Initialize(SDL_Window& window) override;
+        void Deinitialize() override;
+        void Update() override;
+
+    private:
+        // ========
+        // Helpers
+        // ========
+
+        void Draw3dScene() override;
+        void Draw2dScene() override;
+        void DrawPostProcess() override;
+        void DrawDebugGui() override;
+        bool CopyFramePixels(std::unique_ptr<CaptureFrame>& frame) override;
+
+        /** @brief Saves the recorded draw trace to the designated `Screenshots` folder. Screenshot requests save the trace instead
+         * since there is no render surface to capture.
+         */
+        void SaveTrace() const;
+    };
+}
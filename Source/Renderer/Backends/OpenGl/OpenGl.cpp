@@ -52,9 +52,6 @@ namespace Silent::Renderer
         glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        // Reserve memory.
-        _primitives2d.reserve(PRIMITIVE_2D_COUNT_MAX);
-
         CreateShaderProgram();
 
         ImGui_ImplSDL3_InitForOpenGL(_window, _context);
@@ -116,8 +113,8 @@ namespace Silent::Renderer
 
     void OpenGlRenderer::Update()
     {
-        // Reset.
-        _drawCallCount = 0;
+        // Frame setup.
+        PrepareFrameData();
         UpdateViewport();
 
         // Draw frame.
@@ -127,56 +124,21 @@ namespace Silent::Renderer
         DrawPostProcess();
         DrawDebugGui();
 
+        // Capture frame.
+        ProcessCaptures();
+
         // Swap buffers.
         if (!SDL_GL_SwapWindow(_window))
         {
             Debug::Log(Fmt("Failed to swap render buffer: {}", SDL_GetError()), Debug::LogLevel::Warning);
         }
 
-        // Clear scene. @todo
-
-        // Clear primitives
-        _primitives2d.clear();
-    }
-
-    void OpenGlRenderer::SaveScreenshot() const
-    {
-        constexpr uint COLOR_CHANNEL_COUNT = 3; // RGB.
-
-        const auto& fs = g_App.GetFilesystem();
-
-        // Get window size.
-        auto res = GetScreenResolution();
-
-        // Ensure directory exists.
-        auto timestamp = GetCurrentDateString() + "_" + GetCurrentTimeString();
-        auto filename  = (SCREENSHOT_FILENAME_BASE + timestamp) + PNG_FILE_EXT;
-        auto path      = fs.GetScreenshotsDirectory() / filename;
-        std::filesystem::create_directories(path.parent_path());
-
-        // Capture screenshot.
-        auto pixels = std::vector<byte>((res.x * res.y) * COLOR_CHANNEL_COUNT);
-        glReadPixels(0, 0, res.x, res.y, GL_RGB, GL_UNSIGNED_BYTE, pixels.data());
-
-        // Flip pixels vertically.
-        int rowSize = res.x * COLOR_CHANNEL_COUNT;
-        for (int y = 0; y < (res.y / 2); y++)
-        {
-            int oppositeY = (res.y - y) - 1;
-            for (int x = 0; x < rowSize; x++)
-            {
-                std::swap(pixels[(y * rowSize) + x], pixels[(oppositeY * rowSize) + x]);
-            }
-        }
-
-        // Write screenshot file.
-        if (stbi_write_png(path.string().c_str(), res.x, res.y, COLOR_CHANNEL_COUNT, pixels.data(), res.x * COLOR_CHANNEL_COUNT))
-        {
-            Debug::Log("Saved screenshot.", Debug::LogLevel::Info, Debug::LogMode::All, true);
-            return;
-        }
+        // Measure frame pacing.
+        const auto& snapshot = _snapshots.GetReadBuffer();
+        _framePacing.Record(snapshot.FrameId, snapshot.InputTime);
 
-        Debug::Log("Failed to save screenshot.", Debug::LogLevel::Warning, Debug::LogMode::All, true);
+        // Clear frame setup.
+        ClearFrameData();
     }
 
     void OpenGlRenderer::RefreshTextureFilter()
@@ -333,7 +295,8 @@ namespace Silent::Renderer
         ImGui::NewFrame();
 
         // Draw GUIs.
-        for (auto& drawCall : _debugGuiDrawCalls)
+        const auto& snapshot = _snapshots.GetReadBuffer();
+        for (const auto& drawCall : snapshot.DebugGuiDrawCalls)
         {
             drawCall();
         }
@@ -342,6 +305,25 @@ namespace Silent::Renderer
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
     }
 
+    bool OpenGlRenderer::CopyFramePixels(std::unique_ptr<CaptureFrame>& frame)
+    {
+        constexpr uint COLOR_CHANNEL_COUNT = 4; // RGBA.
+
+        auto res = GetScreenResolution();
+        if (res.x <= 0 || res.y <= 0)
+        {
+            return false;
+        }
+
+        // Read back buffer. Rows are bottom to top and are flipped by the capture worker.
+        frame->Resolution = res;
+        frame->IsBottomUp = true;
+        frame->Pixels.resize((res.x * res.y) * COLOR_CHANNEL_COUNT);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glReadPixels(0, 0, res.x, res.y, GL_RGBA, GL_UNSIGNED_BYTE, frame->Pixels.data());
+        return glGetError() == GL_NO_ERROR;
+    }
+
     void OpenGlRenderer::CreateShaderProgram()
     {
         // Generate shader program.
@@ -55,7 +55,6 @@ namespace Silent::Renderer
         void Initialize(SDL_Window& window) override;
         void Deinitialize() override;
         void Update() override;
-        void SaveScreenshot() const override;
 
         void RefreshTextureFilter();
 
@@ -69,6 +68,7 @@ namespace Silent::Renderer
         void Draw2dScene() override;
         void DrawPostProcess() override;
         void DrawDebugGui() override;
+        bool CopyFramePixels(std::unique_ptr<CaptureFrame>& frame) override;
 
         void CreateShaderProgram();
 
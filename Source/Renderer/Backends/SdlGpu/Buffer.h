@@ -1,8 +1,10 @@
 #pragma once
 
+#include "Renderer/Backends/SdlGpu/UploadAllocator.h"
+
 namespace Silent::Renderer
 {
-    /** @brief GPU vertex, index, or indirect buffer with data of type `T`. */
+    /** @brief GPU vertex, index, or indirect buffer with data of type `T`. Data is staged through the frame upload allocator. */
     template <typename T>
     class Buffer
     {
@@ -13,8 +15,8 @@ namespace Silent::Renderer
 
         SDL_GPUDevice*          _device     = nullptr;
         SDL_GPUBuffer*          _buffer     = nullptr;
-        SDL_GPUTransferBuffer*  _transfer   = nullptr;
         SDL_GPUBufferUsageFlags _usageFlags = 0;
+        uint                    _capacity   = 0; /** Element capacity. */
 
     public:
         // =============
@@ -28,32 +30,48 @@ namespace Silent::Renderer
          *
          * @param device GPU device.
          * @param usageFlags Buffer usage flags.
-         * @param size Static buffer size.
+         * @param capacity Element capacity.
          * @param name Buffer name.
          */
-        Buffer(SDL_GPUDevice& device, SDL_GPUBufferUsageFlags usageFlags, uint size, const std::string& name);
+        Buffer(SDL_GPUDevice& device, SDL_GPUBufferUsageFlags usageFlags, uint capacity, const std::string& name);
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the element capacity.
+         *
+         * @return Element capacity.
+         */
+        uint GetCapacity() const;
 
         // ==========
         // Utilities
         // ==========
 
-        /** @brief Uploads data to the GPU buffer.
+        /** @brief Stages data in upload memory and records an upload to the GPU buffer. Uploads are encoded when the allocator is flushed.
+         * Data exceeding the capacity is truncated.
          *
+         * @param uploads Frame upload allocator.
          * @param data New data to transfer to the buffer.
          * @param startIdx Start index in the buffer at which to transfer the new data.
          */
-        void Update(SDL_GPUCopyPass& copyPass, std::span<const T> data, uint startIdx);
+        void Update(UploadAllocator& uploads, std::span<const T> data, uint startIdx = 0);
 
         /** @brief Binds the GPU buffer for drawing.
          *
          * @param renderPass Render pass.
+         * @param slot Vertex buffer slot. Ignored for index buffers.
          * @param startIdx Data start index.
          */
-        void Bind(SDL_GPURenderPass& renderPass, uint startIdx);
+        void Bind(SDL_GPURenderPass& renderPass, uint slot = 0, uint startIdx = 0);
+
+        /** @brief Releases GPU resources. */
+        void Release();
     };
 
     template <typename T>
-    Buffer<T>::Buffer(SDL_GPUDevice& device, SDL_GPUBufferUsageFlags usageFlags, uint size, const std::string& name)
+    Buffer<T>::Buffer(SDL_GPUDevice& device, SDL_GPUBufferUsageFlags usageFlags, uint capacity, const std::string& name)
     {
         _usageFlags = usageFlags;
         if (!(_usageFlags & (SDL_GPU_BUFFERUSAGE_VERTEX | SDL_GPU_BUFFERUSAGE_INDEX | SDL_GPU_BUFFERUSAGE_INDIRECT)))
@@ -61,16 +79,17 @@ namespace Silent::Renderer
             throw std::runtime_error("Attempted to create GPU buffer with invalid usage flags.");
         }
 
-        _device = &device;
+        _device   = &device;
+        _capacity = capacity;
 
         auto bufferInfo = SDL_GPUBufferCreateInfo
         {
             .usage = _usageFlags,
-            .size  = size * sizeof(T)
+            .size  = _capacity * sizeof(T)
         };
 
         // Create buffer.
-        _buffer = SDL_CreateGPUBuffer(&device, &bufferInfo);
+        _buffer = SDL_CreateGPUBuffer(_device, &bufferInfo);
         if (_buffer == nullptr)
         {
             Debug::Log(Fmt("Failed to create buffer: {}", SDL_GetError()), Debug::LogLevel::Error);
@@ -78,47 +97,37 @@ namespace Silent::Renderer
 
         // Set buffer name.
         SDL_SetGPUBufferName(_device, _buffer, name.c_str());
-
-        auto transferBufferInfo = SDL_GPUTransferBufferCreateInfo
-        {
-            .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
-            .size  = size * sizeof(T)
-        };
-
-        // Create transfer buffer.
-        _transfer = SDL_CreateGPUTransferBuffer(_device, &transferBufferInfo);
-        if (_transfer == nullptr)
-        {
-            Debug::Log(Fmt("Failed to create transfer buffer: {}", SDL_GetError()), Debug::LogLevel::Error);
-        }
     }
 
     template <typename T>
-    void Buffer<T>::Update(SDL_GPUCopyPass& copyPass, std::span<const T> data, uint startIdx)
+    uint Buffer<T>::GetCapacity() const
     {
-        // Map transfer data.
-        auto* mappedTransferData = (T*)SDL_MapGPUTransferBuffer(_device, _transfer, false);
-        memcpy(mappedTransferData, data.data(), data.size_bytes());
-        SDL_UnmapGPUTransferBuffer(_device, _transfer);
+        return _capacity;
+    }
 
-        // Upload data.
-        auto transferBufferLoc = SDL_GPUTransferBufferLocation
+    template <typename T>
+    void Buffer<T>::Update(UploadAllocator& uploads, std::span<const T> data, uint startIdx)
+    {
+        if (data.empty() || _buffer == nullptr || startIdx >= _capacity)
         {
-            .transfer_buffer = _transfer
-        };
-        auto bufferRegion = SDL_GPUBufferRegion
+            return;
+        }
+
+        if ((startIdx + data.size()) > _capacity)
         {
-            .buffer = _buffer,
-            .offset = startIdx * sizeof(T),
-            .size   = (uint)data.size_bytes()
-        };
-        SDL_UploadToGPUBuffer(&copyPass, &transferBufferLoc, &bufferRegion, true);
+            Debug::Log("Attempted to upload more data than buffer capacity.", Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            data = data.first(_capacity - startIdx);
+        }
+
+        // Record upload. Buffer is cycled if a frame in flight still reads it.
+        auto bytes = std::span<const byte>((const byte*)data.data(), data.size_bytes());
+        uploads.UploadToBuffer(*_buffer, startIdx * sizeof(T), bytes, true);
     }
 
     template <typename T>
-    void Buffer<T>::Bind(SDL_GPURenderPass& renderPass, uint startIdx)
+    void Buffer<T>::Bind(SDL_GPURenderPass& renderPass, uint slot, uint startIdx)
     {
-        auto bufferBindings = SDL_GPUBufferBinding
+        auto bufferBinding = SDL_GPUBufferBinding
         {
             .buffer = _buffer,
             .offset = startIdx * sizeof(T)
@@ -126,13 +135,25 @@ namespace Silent::Renderer
 
         if (_usageFlags & SDL_GPU_BUFFERUSAGE_VERTEX)
         {
-            SDL_BindGPUVertexBuffers(&renderPass, 0, &bufferBindings, 1);
+            SDL_BindGPUVertexBuffers(&renderPass, slot, &bufferBinding, 1);
         }
         else if (_usageFlags & SDL_GPU_BUFFERUSAGE_INDEX)
         {
-            SDL_BindGPUIndexBuffer(&renderPass, &bufferBindings, SDL_GPU_INDEXELEMENTSIZE_16BIT);
+            SDL_BindGPUIndexBuffer(&renderPass, &bufferBinding, (sizeof(T) == sizeof(uint16)) ? SDL_GPU_INDEXELEMENTSIZE_16BIT : SDL_GPU_INDEXELEMENTSIZE_32BIT);
         }
 
         // @todo Can indirect buffer be bound?
     }
+
+    template <typename T>
+    void Buffer<T>::Release()
+    {
+        if (_device == nullptr)
+        {
+            return;
+        }
+
+        SDL_ReleaseGPUBuffer(_device, _buffer);
+        _buffer = nullptr;
+    }
 };
@@ -3,107 +3,243 @@
 
 #include "Application.h"
 #include "Renderer/Backends/SdlGpu/PipelineConfig.h"
+#include "Renderer/Backends/SdlGpu/ShaderPack.h"
 #include "Renderer/Common/Enums.h"
 #include "Services/Filesystem.h"
+#include "Utils/Parallel.h"
+#include "Utils/Utils.h"
 
 using namespace Silent::Services;
+using namespace Silent::Utils;
 
 namespace Silent::Renderer
 {
+    static_assert((int)RenderStage::Count <= 0xFF && (int)BlendMode::Count <= 0xFF && (int)VertexLayout::Count <= 0xFF,
+                  "Pipeline key fields must fit in a byte.");
+
+    size_t PipelineKeyHash::operator()(const PipelineKey& key) const
+    {
+        return ((size_t)key.Layout << 16) | ((size_t)key.Stage << 8) | (size_t)key.BlendM;
+    }
+
     PipelineManager::~PipelineManager()
     {
-        for (auto [keyHash, pipeline] : _pipelines)
+        // Wait for background creation before releasing.
+        if (_createFuture.valid())
         {
-            SDL_ReleaseGPUGraphicsPipeline(_device, pipeline);
+            _createFuture.wait();
         }
-    }
 
-    void PipelineManager::Initialize(SDL_Window& window, SDL_GPUDevice& device)
-    {
-        _device = &device;
+        for (auto& [key, slot] : _pipelines)
+        {
+            if (slot->Pipeline != nullptr)
+            {
+                SDL_ReleaseGPUGraphicsPipeline(_device, slot->Pipeline);
+            }
+        }
 
-        for (const auto& pipelineConfig : PIPELINE_CONFIGS)
+        for (auto [filename, shader] : _shaders)
         {
-            InitializeGraphicsPipeline(window, pipelineConfig);
+            SDL_ReleaseGPUShader(_device, shader);
         }
     }
 
-    void PipelineManager::Bind(SDL_GPURenderPass& renderPass, RenderStage renderStage, BlendMode blendMode)
+    PipelineStats PipelineManager::GetStats() const
     {
-        int pipelineHash = GetPipelineHash(renderStage, Debug::g_Work.EnableWireframeMode ? BlendMode::Wireframe : blendMode);
-        SDL_BindGPUGraphicsPipeline(&renderPass, _pipelines[pipelineHash]);
+        auto stats               = _stats;
+        stats.LazyPipelineCount  = _lazyCount.load(std::memory_order_relaxed);
+        stats.PipelineCreateSec  = _createTimeUs.load(std::memory_order_relaxed) / 1000000.0;
+        stats.PipelineElapsedSec = _elapsedTimeUs.load(std::memory_order_relaxed) / 1000000.0;
+        return stats;
     }
 
-    void PipelineManager::InitializeGraphicsPipeline(SDL_Window& window, const PipelineConfig& config)
+    void PipelineManager::Initialize(SDL_Window& window, SDL_GPUDevice& device)
     {
-        // Load vertex shader.
-        auto* vertShader = LoadShader(config.VertexShaderName,
-                                      config.VertShaderSamplerCount, config.VertShaderStorageTexCount,
-                                      config.VertShaderStorageBufferCount, config.VertShaderUniBufferCount);
-        if (vertShader == nullptr)
+        const auto& fs = g_App.GetFilesystem();
+
+        _device            = &device;
+        _colorTargetFormat = SDL_GetGPUSwapchainTextureFormat(_device, &window);
+
+        // Read shader pack.
+        auto startTime = std::chrono::steady_clock::now();
+        if (_shaderPack.Load(fs.GetShadersDirectory() / SHADER_PACK_FILENAME))
         {
-            throw std::runtime_error(Fmt("Failed to create vertex shader `{}`.", config.VertexShaderName));
+            _stats.ShaderPackSize = _shaderPack.GetSize();
         }
+        else
+        {
+            Debug::Log(Fmt("`{}` not found. Loading loose shader files.", SHADER_PACK_FILENAME), Debug::LogLevel::Warning);
+        }
+        _stats.ShaderIoSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
 
-        // Load fragment shader.
-        auto* fragShader = LoadShader(config.FragmentShaderName,
-                                      config.FragShaderSamplerCount, config.FragShaderStorageTexCount,
-                                      config.FragShaderStorageBufferCount, config.FragShaderUniBufferCount);
-        if (fragShader == nullptr)
+        // Create shaders once per file. Loose file reads are timed separately as I/O.
+        double packIoSec = _stats.ShaderIoSec;
+        startTime        = std::chrono::steady_clock::now();
+        for (const auto& config : PIPELINE_CONFIGS)
         {
-            throw std::runtime_error(Fmt("Failed to create fragment shader `{}`.", config.FragmentShaderName));
+            if (LoadShader(config.VertexShaderName,
+                           config.VertShaderSamplerCount, config.VertShaderStorageTexCount,
+                           config.VertShaderStorageBufferCount, config.VertShaderUniBufferCount) == nullptr)
+            {
+                throw std::runtime_error(Fmt("Failed to create vertex shader `{}`.", config.VertexShaderName));
+            }
+
+            if (LoadShader(config.FragmentShaderName,
+                           config.FragShaderSamplerCount, config.FragShaderStorageTexCount,
+                           config.FragShaderStorageBufferCount, config.FragShaderUniBufferCount) == nullptr)
+            {
+                throw std::runtime_error(Fmt("Failed to create fragment shader `{}`.", config.FragmentShaderName));
+            }
+
+            _configs[(int)config.Stage] = &config;
         }
+        double looseIoSec      = _stats.ShaderIoSec - packIoSec;
+        _stats.ShaderCreateSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count() - looseIoSec;
+        _shaderPack.Clear();
 
+        // Register pipeline variants. Slots are never added after this point, so the map is safe to read from worker threads.
         // @todo Post-process pipelines don't need every variant.
-        // Create pipelines with blend mode variants.
-        for (int i = 0; i < (int)BlendMode::Count; i++)
+        auto keys = std::vector<PipelineKey>{};
+        for (const auto& config : PIPELINE_CONFIGS)
         {
-            auto colorTargetDescs = config.ColorTargetDescs;
-            colorTargetDescs.push_back(SDL_GPUColorTargetDescription
+            for (int i = 0; i < (int)BlendMode::Count; i++)
             {
-                .format      = SDL_GetGPUSwapchainTextureFormat(_device, &window),
-                .blend_state = PIPELINE_BLEND_MODE_COLOR_TARGETS[i]
+                auto key = PipelineKey{ .Stage = config.Stage, .BlendM = (BlendMode)i, .Layout = config.Layout };
+
+                auto slot       = std::make_unique<PipelineSlot>();
+                slot->Config    = &config;
+                _pipelines[key] = std::move(slot);
+                keys.push_back(key);
+            }
+        }
+        _stats.PipelineCount = (uint)keys.size();
+        _pendingCount        = (uint)keys.size();
+
+        // Create pipeline variants in background.
+        _createStartTime = std::chrono::steady_clock::now();
+        auto tasks       = ParallelTasks{};
+        for (const auto& key : keys)
+        {
+            tasks.push_back([this, key]()
+            {
+                GetPipeline(key, false);
             });
+        }
+        _createFuture = g_App.GetExecutor().AddTasks(tasks);
+
+        Debug::Log(Fmt("Loaded shaders in {:.2f} ms (I/O {:.2f} ms, creation {:.2f} ms). Creating {} pipelines in background.",
+                       (_stats.ShaderIoSec + _stats.ShaderCreateSec) * 1000.0, _stats.ShaderIoSec * 1000.0, _stats.ShaderCreateSec * 1000.0, _stats.PipelineCount));
+    }
+
+    void PipelineManager::Bind(SDL_GPURenderPass& renderPass, RenderStage renderStage, BlendMode blendMode)
+    {
+        const auto* config = _configs[(int)renderStage];
+        if (config == nullptr)
+        {
+            return;
+        }
+
+        auto  key      = PipelineKey{ .Stage = renderStage, .BlendM = Debug::g_Work.EnableWireframeMode ? BlendMode::Wireframe : blendMode, .Layout = config->Layout };
+        auto* pipeline = GetPipeline(key, true);
+        if (pipeline == nullptr)
+        {
+            return;
+        }
 
-            auto pipelineInfo = SDL_GPUGraphicsPipelineCreateInfo
+        SDL_BindGPUGraphicsPipeline(&renderPass, pipeline);
+    }
+
+    SDL_GPUGraphicsPipeline* PipelineManager::GetPipeline(const PipelineKey& key, bool isLazy)
+    {
+        auto* slot = Find(_pipelines, key);
+        if (slot == nullptr)
+        {
+            return nullptr;
+        }
+
+        // Create once. Callers racing the creating thread block until it finishes.
+        auto& slotRef = **slot;
+        std::call_once(slotRef.Once, [&]()
+        {
+            auto startTime   = std::chrono::steady_clock::now();
+            slotRef.Pipeline = CreateGraphicsPipeline(*slotRef.Config, key.BlendM);
+            auto endTime     = std::chrono::steady_clock::now();
+
+            _createTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime).count();
+            if (isLazy)
             {
-                .vertex_shader      = vertShader,
-                .fragment_shader    = fragShader,
-                .vertex_input_state =
-                {
-                    .vertex_buffer_descriptions = config.VertBufferDescs.data(),
-                    .num_vertex_buffers         = (uint)config.VertBufferDescs.size(),
-                    .vertex_attributes          = config.VertBufferAttribs.data(),
-                    .num_vertex_attributes      = (uint)config.VertBufferAttribs.size()
-                },
-                .primitive_type   = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
-                .rasterizer_state = SDL_GPURasterizerState
-                {
-                    .fill_mode = ((BlendMode)i == BlendMode::Wireframe) ? SDL_GPU_FILLMODE_LINE : SDL_GPU_FILLMODE_FILL
-                },
-                .target_info = SDL_GPUGraphicsPipelineTargetInfo
-                {
-                    .color_target_descriptions = colorTargetDescs.data(),
-                    .num_color_targets         = (uint)colorTargetDescs.size()
-                }
-            };
-
-            // Create pipeline variant.
-            int piplineHash         = GetPipelineHash(config.Stage, (BlendMode)i);
-            _pipelines[piplineHash] = SDL_CreateGPUGraphicsPipeline(_device, &pipelineInfo);
-            if (_pipelines[piplineHash] == nullptr) 
+                _lazyCount++;
+            }
+
+            // Report startup time once last pipeline is created.
+            if (_pendingCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
             {
-                throw std::runtime_error(Fmt("Failed to create graphics pipeline for render stage {}, blend mode {}: {}", (int)config.Stage, i, SDL_GetError()));
+                _elapsedTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(endTime - _createStartTime).count();
+
+                auto stats = GetStats();
+                Debug::Log(Fmt("Created {} pipelines in {:.2f} ms ({:.2f} ms across threads, {} on demand).",
+                               stats.PipelineCount, stats.PipelineElapsedSec * 1000.0, stats.PipelineCreateSec * 1000.0, stats.LazyPipelineCount));
             }
+        });
+
+        return slotRef.Pipeline;
+    }
+
+    SDL_GPUGraphicsPipeline* PipelineManager::CreateGraphicsPipeline(const PipelineConfig& config, BlendMode blendMode)
+    {
+        auto* vertShader = _shaders.at(config.VertexShaderName);
+        auto* fragShader = _shaders.at(config.FragmentShaderName);
+
+        auto colorTargetDescs = config.ColorTargetDescs;
+        colorTargetDescs.push_back(SDL_GPUColorTargetDescription
+        {
+            .format      = _colorTargetFormat,
+            .blend_state = PIPELINE_BLEND_MODE_COLOR_TARGETS[(int)blendMode]
+        });
+
+        auto pipelineInfo = SDL_GPUGraphicsPipelineCreateInfo
+        {
+            .vertex_shader      = vertShader,
+            .fragment_shader    = fragShader,
+            .vertex_input_state =
+            {
+                .vertex_buffer_descriptions = config.VertBufferDescs.data(),
+                .num_vertex_buffers         = (uint)config.VertBufferDescs.size(),
+                .vertex_attributes          = config.VertBufferAttribs.data(),
+                .num_vertex_attributes      = (uint)config.VertBufferAttribs.size()
+            },
+            .primitive_type   = config.PrimitiveType,
+            .rasterizer_state = SDL_GPURasterizerState
+            {
+                .fill_mode = (blendMode == BlendMode::Wireframe) ? SDL_GPU_FILLMODE_LINE : SDL_GPU_FILLMODE_FILL
+            },
+            .target_info = SDL_GPUGraphicsPipelineTargetInfo
+            {
+                .color_target_descriptions = colorTargetDescs.data(),
+                .num_color_targets         = (uint)colorTargetDescs.size()
+            }
+        };
+
+        // Create pipeline variant.
+        auto* pipeline = SDL_CreateGPUGraphicsPipeline(_device, &pipelineInfo);
+        if (pipeline == nullptr)
+        {
+            Debug::Log(Fmt("Failed to create graphics pipeline for render stage {}, blend mode {}: {}", (int)config.Stage, (int)blendMode, SDL_GetError()),
+                       Debug::LogLevel::Error);
         }
 
-        // Free shaders.
-        SDL_ReleaseGPUShader(_device, vertShader);
-        SDL_ReleaseGPUShader(_device, fragShader);
+        return pipeline;
     }
 
     SDL_GPUShader* PipelineManager::LoadShader(const std::string& filename, uint samplerCount, uint storageTexCount, uint storageBufferCount, uint uniBufferCount)
     {
+        // Get cached shader.
+        auto* cachedShader = Find(_shaders, filename);
+        if (cachedShader != nullptr)
+        {
+            return *cachedShader;
+        }
+
         // Define shader stage.
         auto stage = SDL_GPUShaderStage{};
         if (SDL_strstr(filename.c_str(), ".vert"))
@@ -123,28 +259,28 @@ namespace Silent::Renderer
         const auto& fs = g_App.GetFilesystem();
 
         // Define shader properties.
-        char        fullPath[256];
         auto        formatFlags      = SDL_GetGPUShaderFormats(_device);
         auto        activeFormatFlag = (SDL_GPUShaderFormat)SDL_GPU_SHADERFORMAT_INVALID;
+        auto        blobName         = std::string();
         const char* entryPoint       = nullptr;
 
         if (formatFlags & SDL_GPU_SHADERFORMAT_SPIRV)
         {
-            snprintf(fullPath, sizeof(fullPath), "%s.spv", (fs.GetShadersDirectory() / filename).string().c_str());
+            blobName         = filename + ".spv";
             activeFormatFlag = SDL_GPU_SHADERFORMAT_SPIRV;
-            entryPoint = "main";
+            entryPoint       = "main";
         }
         else if (formatFlags & SDL_GPU_SHADERFORMAT_MSL)
         {
-            snprintf(fullPath, sizeof(fullPath), "%s.msl", (fs.GetShadersDirectory() / filename).string().c_str());
+            blobName         = filename + ".msl";
             activeFormatFlag = SDL_GPU_SHADERFORMAT_MSL;
-            entryPoint = "main0";
+            entryPoint       = "main0";
         }
         else if (formatFlags & SDL_GPU_SHADERFORMAT_DXIL)
         {
-            snprintf(fullPath, sizeof(fullPath), "%s.dxil", (fs.GetShadersDirectory() / filename).string().c_str());
+            blobName         = filename + ".dxil";
             activeFormatFlag = SDL_GPU_SHADERFORMAT_DXIL;
-            entryPoint = "main";
+            entryPoint       = "main";
         }
         else
         {
@@ -152,19 +288,31 @@ namespace Silent::Renderer
             return nullptr;
         }
 
-        // Load shader code.
-        size_t codeSize = 0;
-        void*  code     = SDL_LoadFile(fullPath, &codeSize);
-        if (code == nullptr)
+        // Get shader code from pack.
+        auto  code     = _shaderPack.GetBlob(blobName);
+        void* fileCode = nullptr;
+        if (code.empty())
         {
-            Debug::Log(Fmt("Failed to load shader `{}`: {}", fullPath, SDL_GetError()), Debug::LogLevel::Error);
-            return nullptr;
+            // Load loose shader file.
+            auto   path      = fs.GetShadersDirectory() / blobName;
+            auto   startTime = std::chrono::steady_clock::now();
+            size_t codeSize  = 0;
+            fileCode         = SDL_LoadFile(path.string().c_str(), &codeSize);
+
+            _stats.ShaderIoSec += std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+            if (fileCode == nullptr)
+            {
+                Debug::Log(Fmt("Failed to load shader `{}`: {}", path.string(), SDL_GetError()), Debug::LogLevel::Error);
+                return nullptr;
+            }
+
+            code = std::span<const byte>((const byte*)fileCode, codeSize);
         }
 
         auto shaderInfo = SDL_GPUShaderCreateInfo
         {
-            .code_size            = codeSize,
-            .code                 = (const uint8*)code,
+            .code_size            = code.size(),
+            .code                 = (const uint8*)code.data(),
             .entrypoint           = entryPoint,
             .format               = activeFormatFlag,
             .stage                = stage,
@@ -178,15 +326,14 @@ namespace Silent::Renderer
         auto* shader = SDL_CreateGPUShader(_device, &shaderInfo);
         if (shader == nullptr)
         {
-            Debug::Log(Fmt("Failed to create shader `{}`: {}", fullPath, SDL_GetError()));
+            Debug::Log(Fmt("Failed to create shader `{}`: {}", blobName, SDL_GetError()));
+        }
+        else
+        {
+            _shaders[filename] = shader;
         }
-        SDL_free(code);
+        SDL_free(fileCode);
 
         return shader;
     }
-
-    int PipelineManager::GetPipelineHash(RenderStage renderStage, BlendMode blendMode)
-    {
-        return ((int)renderStage * (int)BlendMode::Count) + (int)blendMode;
-    }
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Renderer/Backends/SdlGpu/ShaderPack.h"
 #include "Renderer/Common/Enums.h"
 
 namespace Silent::Renderer
@@ -7,16 +8,78 @@ namespace Silent::Renderer
     enum class BlendMode;
     struct     PipelineConfig;
 
-    /** @brief Pipeline manager. */
+    /** @brief Pipeline vertex input layouts. */
+    enum class VertexLayout
+    {
+        Batch2d,    /** `BatchVertex` stream. */
+        DebugShape, /** Unit mesh positions plus `DebugShapeInstance` stream. */
+
+        Count
+    };
+
+    /** @brief Structured graphics pipeline key. Fields are compared exactly, so distinct pipelines never share a key. */
+    struct PipelineKey
+    {
+        RenderStage  Stage  = RenderStage::Count;
+        BlendMode    BlendM = BlendMode::Count;
+        VertexLayout Layout = VertexLayout::Count;
+
+        bool operator==(const PipelineKey& key) const = default;
+    };
+
+    /** @brief `PipelineKey` hasher. Packs each field into its own byte, so the hash is unique for every valid key. */
+    struct PipelineKeyHash
+    {
+        size_t operator()(const PipelineKey& key) const;
+    };
+
+    /** @brief Pipeline cache startup statistics. */
+    struct PipelineStats
+    {
+        uint   PipelineCount      = 0;
+        uint   LazyPipelineCount  = 0;   /** Pipelines created on first bind before their background task ran. */
+        uint   ShaderPackSize     = 0;   /** Packed shader file size in bytes, or 0 if loose files were loaded. */
+        double ShaderIoSec        = 0.0; /** Time spent reading shader blobs from disk. */
+        double ShaderCreateSec    = 0.0; /** Time spent creating shader modules from blobs. */
+        double PipelineCreateSec  = 0.0; /** Accumulated pipeline creation time across all threads. */
+        double PipelineElapsedSec = 0.0; /** Wall-clock time from initialization until all pipelines were created. */
+    };
+
+    /** @brief Graphics pipeline cache.
+     * Shader blobs are read from a single packed file, falling back to loose files for development builds without a pack.
+     * Shaders are created once per file and shared between configs. Pipeline variants are created on worker threads in the background,
+     * and any variant bound before its task runs is created on demand.
+     */
     class PipelineManager
     {
     private:
+        /** @brief Lazily created pipeline variant. */
+        struct PipelineSlot
+        {
+            const PipelineConfig*    Config   = nullptr;
+            std::once_flag           Once     = {};
+            SDL_GPUGraphicsPipeline* Pipeline = nullptr; /** Written once under `Once`. */
+        };
+
         // =======
         // Fields
         // =======
 
-        SDL_GPUDevice*                                    _device    = nullptr;
-        std::unordered_map<int, SDL_GPUGraphicsPipeline*> _pipelines = {}; /** Key = pipeline hash, value = pipeline. */
+        SDL_GPUDevice*       _device            = nullptr;
+        SDL_GPUTextureFormat _colorTargetFormat = SDL_GPU_TEXTUREFORMAT_INVALID;
+        ShaderPack           _shaderPack        = ShaderPack();
+
+        std::unordered_map<std::string, SDL_GPUShader*>                                  _shaders   = {}; /** Key = shader filename, value = shader. */
+        std::unordered_map<PipelineKey, std::unique_ptr<PipelineSlot>, PipelineKeyHash> _pipelines = {}; /** Key = pipeline key, value = lazily created pipeline. */
+        std::array<const PipelineConfig*, (int)RenderStage::Count>                       _configs   = {}; /** Index = render stage, value = config. */
+
+        std::future<void>                     _createFuture    = {}; /** Background pipeline creation tasks. */
+        std::atomic<uint>                     _pendingCount    = 0;  /** Pipelines not yet created. */
+        std::atomic<uint>                     _lazyCount       = 0;
+        std::atomic<uint64>                   _createTimeUs    = 0;  /** Accumulated pipeline creation time in microseconds. */
+        std::atomic<uint64>                   _elapsedTimeUs   = 0;  /** Set when the last pipeline is created. */
+        std::chrono::steady_clock::time_point _createStartTime = {};
+        PipelineStats                         _stats           = {}; /** Shader statistics. Pipeline statistics are read from atomics. */
 
     public:
         // =============
@@ -26,24 +89,36 @@ namespace Silent::Renderer
         /** @brief Constructs an uninitialized default `PipelineManager`. */
         PipelineManager() = default;
 
-        /** @brief Gracefull destroys the `PipelineManager` and releases GPU resources. */
+        /** @brief Gracefull destroys the `PipelineManager`, waiting for background creation and releasing GPU resources. */
         ~PipelineManager();
 
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the pipeline cache startup statistics. Pipeline creation times are final once all pipelines are created.
+         *
+         * @return Pipeline statistics.
+         */
+        PipelineStats GetStats() const;
+
         // ==========
         // Utilities
         // ==========
 
-        /** @brief Initializes all pipelines.
+        /** @brief Loads and creates all shaders, then starts creating pipeline variants on worker threads.
          *
          * @param window App window.
          * @param device GPU device.
+         * @exception `std::runtime_error` if a shader can't be created.
          */
         void Initialize(SDL_Window& window, SDL_GPUDevice& device);
 
-        /** @brief Binds the graphics pipeline render stage for use in rendering.
+        /** @brief Binds the graphics pipeline for a render stage and blend mode, creating it first if not yet created.
          *
          * @param renderPass Render pass to bind the pipeline to.
          * @param renderStage Pipeline render stage to bind.
+         * @param blendMode Pipeline blend mode to bind.
          */
         void Bind(SDL_GPURenderPass& renderPass, RenderStage renderStage, BlendMode blendMode);
 
@@ -52,14 +127,23 @@ namespace Silent::Renderer
         // Helpers
         // ========
 
-        /** @brief Initializes the graphics pipeline with vertex and fragment shaders.
+        /** @brief Gets a pipeline variant, creating it on the calling thread if no other thread has.
+         *
+         * @param key Pipeline key.
+         * @param isLazy Whether the pipeline is requested by a bind rather than a background task.
+         * @return Pipeline, `nullptr` if unavailable.
+         */
+        SDL_GPUGraphicsPipeline* GetPipeline(const PipelineKey& key, bool isLazy);
+
+        /** @brief Creates a graphics pipeline variant from its config's shaders.
          *
-         * @param window App window.
          * @param config Pipeline configuration details.
+         * @param blendMode Blend mode variant.
+         * @return New pipeline, `nullptr` if creation failed.
          */
-        void InitializeGraphicsPipeline(SDL_Window& window, const PipelineConfig& config);
+        SDL_GPUGraphicsPipeline* CreateGraphicsPipeline(const PipelineConfig& config, BlendMode blendMode);
 
-        /** @brief Loads a vertex or fragment shader.
+        /** @brief Creates a vertex or fragment shader once and caches it.
          *
          * @param filename Shader filename. Suffix must be `.vert` or `.frag`.
          * @param samplerCount Sampler count.
@@ -69,13 +153,5 @@ namespace Silent::Renderer
          * @return Compiled vertex or fragment shader.
          */
         SDL_GPUShader* LoadShader(const std::string& filename, uint samplerCount, uint storageTexCount, uint storageBufferCount, uint uniBufferCount);
-
-        /** @brief Computes a pipeline hash from a pipeline render stage and blend mode.
-         *
-         * @param renderStage Pipeline render stage.
-         * @param blendMode Blend mode.
-         * @return Pipeline hash.
-         */
-        int GetPipelineHash(RenderStage renderStage, BlendMode blendMode);
     };
 }
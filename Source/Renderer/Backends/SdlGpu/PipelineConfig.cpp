@@ -2,21 +2,11 @@
 #include "Renderer/Backends/SdlGpu/PipelineConfig.h"
 
 #include "Renderer/Backends/SdlGpu/Pipeline.h"
+#include "Renderer/Common/Objects/Graphic/Batch.h"
+#include "Renderer/Common/Objects/Graphic/DebugShape.h"
 
 namespace Silent::Renderer
 {
-    // @todo Temporary placement. Should keep these in a folder as common structs?
-    struct BufferVertex
-    {
-        Vector3 Position = Vector3::Zero;
-        Color   Col      = Color::Clear;
-    };
-    struct BufferPositionTextureVertex
-    {
-        Vector3 Position = Vector3::Zero;
-        Vector2 Uv       = Vector2::Zero;
-    };
-
     const std::vector<SDL_GPUColorTargetBlendState> PIPELINE_BLEND_MODE_COLOR_TARGETS = 
     {
         // Opaque.
@@ -104,6 +94,7 @@ namespace Silent::Renderer
         PipelineConfig
         {
             .Stage                    = RenderStage::Primitive2d,
+            .Layout                   = VertexLayout::Batch2d,
             .VertexShaderName         = "2dPrimitive.vert",
             .FragmentShaderName       = "2dPrimitive.frag",
             .FragShaderUniBufferCount = 1,
@@ -112,7 +103,7 @@ namespace Silent::Renderer
                 SDL_GPUVertexBufferDescription
                 {
                     .slot               = 0,
-                    .pitch              = sizeof(BufferVertex),
+                    .pitch              = sizeof(BatchVertex),
                     .input_rate         = SDL_GPU_VERTEXINPUTRATE_VERTEX,
                     .instance_step_rate = 0
                 }
@@ -131,7 +122,7 @@ namespace Silent::Renderer
                     .location    = 1,
                     .buffer_slot = 0,
                     .format      = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
-                    .offset      = sizeof(float) * 3
+                    .offset      = sizeof(Vector3)
                 }
             }
         },
@@ -139,6 +130,7 @@ namespace Silent::Renderer
         PipelineConfig
         {
             .Stage                  = RenderStage::Primitive2dTextured,
+            .Layout                 = VertexLayout::Batch2d,
             .VertexShaderName       = "TexturedQuad.vert",
             .FragmentShaderName     = "TexturedQuad.frag",
             .FragShaderSamplerCount = 1,
@@ -147,7 +139,7 @@ namespace Silent::Renderer
                 SDL_GPUVertexBufferDescription
                 {
                     .slot               = 0,
-                    .pitch              = sizeof(BufferPositionTextureVertex),
+                    .pitch              = sizeof(BatchVertex),
                     .input_rate         = SDL_GPU_VERTEXINPUTRATE_VERTEX,
                     .instance_step_rate = 0
                 }
@@ -166,7 +158,161 @@ namespace Silent::Renderer
                     .location    = 1,
                     .buffer_slot = 0,
                     .format      = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT2,
-                    .offset      = sizeof(float) * 3
+                    .offset      = sizeof(Vector3) + sizeof(Color)
+                },
+                SDL_GPUVertexAttribute
+                {
+                    .location    = 2,
+                    .buffer_slot = 0,
+                    .format      = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
+                    .offset      = sizeof(Vector3)
+                }
+            }
+        },
+        // 3D debug shape, instanced.
+        PipelineConfig
+        {
+            .Stage                    = RenderStage::DebugShape3d,
+            .Layout                   = VertexLayout::DebugShape,
+            .VertexShaderName         = "DebugShape.vert",
+            .VertShaderUniBufferCount = 1,
+            .FragmentShaderName       = "DebugShape.frag",
+            .VertBufferDescs          =
+            {
+                SDL_GPUVertexBufferDescription
+                {
+                    .slot               = 0,
+                    .pitch              = sizeof(Vector3),
+                    .input_rate         = SDL_GPU_VERTEXINPUTRATE_VERTEX,
+                    .instance_step_rate = 0
+                },
+                SDL_GPUVertexBufferDescription
+                {
+                    .slot               = 1,
+                    .pitch              = sizeof(DebugShapeInstance),
+                    .input_rate         = SDL_GPU_VERTEXINPUTRATE_INSTANCE,
+                    .instance_step_rate = 0
+                }
+            },
+            .VertBufferAttribs =
+            {
+                SDL_GPUVertexAttribute
+                {
+                    .location    = 0,
+                    .buffer_slot = 0,
+                    .format      = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
+                    .offset      = 0
+                },
+                // Transform columns.
+                SDL_GPUVertexAttribute
+                {
+                    .location    = 1,
+                    .buffer_slot = 1,
+                    .format      = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
+                    .offset      = 0
+                },
+                SDL_GPUVertexAttribute
+                {
+                    .location    = 2,
+                    .buffer_slot = 1,
+                    .format      = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
+                    .offset      = sizeof(Vector4)
+                },
+                SDL_GPUVertexAttribute
+                {
+                    .location    = 3,
+                    .buffer_slot = 1,
+                    .format      = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
+                    .offset      = sizeof(Vector4) * 2
+                },
+                SDL_GPUVertexAttribute
+                {
+                    .location    = 4,
+                    .buffer_slot = 1,
+                    .format      = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
+                    .offset      = sizeof(Vector4) * 3
+                },
+                // Color.
+                SDL_GPUVertexAttribute
+                {
+                    .location    = 5,
+                    .buffer_slot = 1,
+                    .format      = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
+                    .offset      = sizeof(Matrix)
+                }
+            }
+        },
+        // 3D wireframe debug shape, instanced.
+        PipelineConfig
+        {
+            .Stage                    = RenderStage::DebugShape3dWireframe,
+            .PrimitiveType            = SDL_GPU_PRIMITIVETYPE_LINELIST,
+            .Layout                   = VertexLayout::DebugShape,
+            .VertexShaderName         = "DebugShape.vert",
+            .VertShaderUniBufferCount = 1,
+            .FragmentShaderName       = "DebugShape.frag",
+            .VertBufferDescs          =
+            {
+                SDL_GPUVertexBufferDescription
+                {
+                    .slot               = 0,
+                    .pitch              = sizeof(Vector3),
+                    .input_rate         = SDL_GPU_VERTEXINPUTRATE_VERTEX,
+                    .instance_step_rate = 0
+                },
+                SDL_GPUVertexBufferDescription
+                {
+                    .slot               = 1,
+                    .pitch              = sizeof(DebugShapeInstance),
+                    .input_rate         = SDL_GPU_VERTEXINPUTRATE_INSTANCE,
+                    .instance_step_rate = 0
+                }
+            },
+            .VertBufferAttribs =
+            {
+                SDL_GPUVertexAttribute
+                {
+                    .location    = 0,
+                    .buffer_slot = 0,
+                    .format      = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
+                    .offset      = 0
+                },
+                // Transform columns.
+                SDL_GPUVertexAttribute
+                {
+                    .location    = 1,
+                    .buffer_slot = 1,
+                    .format      = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
+                    .offset      = 0
+                },
+                SDL_GPUVertexAttribute
+                {
+                    .location    = 2,
+                    .buffer_slot = 1,
+                    .format      = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
+                    .offset      = sizeof(Vector4)
+                },
+                SDL_GPUVertexAttribute
+                {
+                    .location    = 3,
+                    .buffer_slot = 1,
+                    .format      = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
+                    .offset      = sizeof(Vector4) * 2
+                },
+                SDL_GPUVertexAttribute
+                {
+                    .location    = 4,
+                    .buffer_slot = 1,
+                    .format      = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
+                    .offset      = sizeof(Vector4) * 3
+                },
+                // Color.
+                SDL_GPUVertexAttribute
+                {
+                    .location    = 5,
+                    .buffer_slot = 1,
+                    .format      = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
+                    .offset      = sizeof(Matrix)
                 }
             }
         }
@@ -7,7 +7,9 @@ namespace Silent::Renderer
     /** @brief Pipeline configuration data. */
     struct PipelineConfig
     {
-        RenderStage Stage = RenderStage::Primitive2d;
+        RenderStage          Stage         = RenderStage::Primitive2d;
+        SDL_GPUPrimitiveType PrimitiveType = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
+        VertexLayout         Layout        = VertexLayout::Batch2d;
 
         std::string VertexShaderName             = {};
         uint        VertShaderSamplerCount       = 0;
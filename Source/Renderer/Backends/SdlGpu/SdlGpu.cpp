@@ -5,8 +5,12 @@
 #include "Renderer/Backends/SdlGpu/Buffer.h"
 #include "Renderer/Backends/SdlGpu/Pipeline.h"
 #include "Renderer/Backends/SdlGpu/Texture.h"
+#include "Renderer/Backends/SdlGpu/UploadAllocator.h"
+#include "Renderer/Common/Objects/Graphic/Batch.h"
+#include "Renderer/Common/Objects/Graphic/DebugShape.h"
+#include "Renderer/Common/Objects/Graphic/TextureAtlas.h"
 #include "Renderer/Common/Utils.h"
-#include "Renderer/Common/View.h" // @todo Not used yet.
+#include "Renderer/Common/View.h"
 #include "Renderer/Renderer.h"
 #include "Services/Filesystem.h"
 #include "Services/Options.h"
@@ -24,17 +28,6 @@ namespace Silent::Renderer
 
     static auto UniformBuffer = TestUniform{};
 
-    struct PositionTextureVertex
-    {
-        float x, y, z;
-        float u, v;
-    };
-
-    // Texture test.
-    static SDL_GPUBuffer* VertexBuffer = nullptr;
-    static SDL_GPUBuffer* IndexBuffer  = nullptr;
-    static Texture TestTexture = Texture();
-
     void SdlGpuRenderer::Initialize(SDL_Window& window)
     {
         Debug::Log("Using SDL_gpu renderer.");
@@ -109,11 +102,16 @@ namespace Silent::Renderer
         };
         _samplers.push_back(SDL_CreateGPUSampler(_device, &linearSamplerInfo));
 
+        // Initialize upload allocator.
+        _uploads.Initialize(*_device);
+
         // Initialize vertex, index, and indirect buffers.
-        _buffers.Primitives2d = Buffer<BufferVertex>(*_device, SDL_GPU_BUFFERUSAGE_VERTEX, (PRIMITIVE_2D_COUNT_MAX * 2) * TRIANGLE_VERTEX_COUNT, "2d primitive triangle vertices");
+        _buffers.Vertices2d          = Buffer<BatchVertex>(*_device, SDL_GPU_BUFFERUSAGE_VERTEX, (PRIMITIVE_2D_COUNT_MAX + SPRITE_2D_COUNT_MAX) * QUAD_VERTEX_COUNT, "2d batch vertices");
+        _buffers.Indices2d           = Buffer<uint16>(*_device, SDL_GPU_BUFFERUSAGE_INDEX, (PRIMITIVE_2D_COUNT_MAX + SPRITE_2D_COUNT_MAX) * QUAD_TRIANGLE_IDXS.size(), "2d batch indices");
+        _buffers.DebugShapeMesh      = Buffer<Vector3>(*_device, SDL_GPU_BUFFERUSAGE_VERTEX, (uint)DebugShapeBatcher::GetMeshVertices().size(), "Debug shape meshes");
+        _buffers.DebugShapeInstances = Buffer<DebugShapeInstance>(*_device, SDL_GPU_BUFFERUSAGE_VERTEX, DEBUG_SHAPE_COUNT_MAX, "Debug shape instances");
 
-        // Reserve memory.
-        _primitives2d.reserve(PRIMITIVE_2D_COUNT_MAX);
+        _isDebugShapeMeshUploaded = false;
 
         // Create ImGui context.
         ImGui::CreateContext();
@@ -128,85 +126,6 @@ namespace Silent::Renderer
             .MSAASamples       = SDL_GPU_SAMPLECOUNT_1
         };
         ImGui_ImplSDLGPU3_Init(&initInfo);
-
-        // Texture test.
-        // ======================
-
-        // Upload transfer data to GPU resources.
-        auto* uploadCmdBuffer = SDL_AcquireGPUCommandBuffer(_device);
-        auto* copyPass        = SDL_BeginGPUCopyPass(uploadCmdBuffer);
-
-        TestTexture.Initialize(*_device, *copyPass, 1);
-
-        // Create GPU resources.
-        auto vertBufferInfo = SDL_GPUBufferCreateInfo
-        {
-            .usage = SDL_GPU_BUFFERUSAGE_VERTEX,
-            .size  = sizeof(PositionTextureVertex) * 4
-        };
-        VertexBuffer = SDL_CreateGPUBuffer(_device, &vertBufferInfo);
-        SDL_SetGPUBufferName(_device, VertexBuffer, "Derg Vertex Buffer");
-
-        auto idxBufferInfo = SDL_GPUBufferCreateInfo
-        {
-            .usage = SDL_GPU_BUFFERUSAGE_INDEX,
-            .size  = sizeof(uint16) * 6
-        };
-        IndexBuffer = SDL_CreateGPUBuffer(_device, &idxBufferInfo);
-
-        // Set up buffer data.
-        auto transferBufferInfo2 = SDL_GPUTransferBufferCreateInfo
-        {
-            .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
-            .size  = (sizeof(PositionTextureVertex) * 4) + (sizeof(uint16) * 6)
-        };
-        auto* bufferTransferBuffer = SDL_CreateGPUTransferBuffer(_device, &transferBufferInfo2);
-
-        auto* transferData = (PositionTextureVertex*)SDL_MapGPUTransferBuffer(_device, bufferTransferBuffer, false);
-        transferData[0]    = PositionTextureVertex{ -1.0f,  1.0f, 0.0f, 0.0f, 0.0f };
-        transferData[1]    = PositionTextureVertex{  1.0f,  1.0f, 0.0f, 1.0f, 0.0f };
-        transferData[2]    = PositionTextureVertex{  1.0f, -1.0f, 0.0f, 1.0f, 1.0f };
-        transferData[3]    = PositionTextureVertex{ -1.0f, -1.0f, 0.0f, 0.0f, 1.0f };
-
-        uint16* idxData = (uint16*)&transferData[4];
-        idxData[0]      = 0;
-        idxData[1]      = 1;
-        idxData[2]      = 2;
-        idxData[3]      = 0;
-        idxData[4]      = 2;
-        idxData[5]      = 3;
-
-        SDL_UnmapGPUTransferBuffer(_device, bufferTransferBuffer);
-
-        auto transferBufferLoc = SDL_GPUTransferBufferLocation
-        {
-            .transfer_buffer = bufferTransferBuffer,
-            .offset          = 0
-        };
-        auto bufferRegion = SDL_GPUBufferRegion
-        {
-            .buffer = VertexBuffer,
-            .offset = 0,
-            .size   = sizeof(PositionTextureVertex) * 4
-        };
-        SDL_UploadToGPUBuffer(copyPass, &transferBufferLoc, &bufferRegion, false);
-
-        transferBufferLoc = SDL_GPUTransferBufferLocation
-        {
-            .transfer_buffer = bufferTransferBuffer,
-            .offset          = sizeof(PositionTextureVertex) * 4
-        };
-        bufferRegion = SDL_GPUBufferRegion
-        {
-            .buffer = IndexBuffer,
-            .offset = 0,
-            .size   = sizeof(uint16) * 6
-        };
-        SDL_UploadToGPUBuffer(copyPass, &transferBufferLoc, &bufferRegion, false);
-        SDL_ReleaseGPUTransferBuffer(_device, bufferTransferBuffer);
-
-        SDL_EndGPUCopyPass(copyPass);
-        SDL_SubmitGPUCommandBuffer(uploadCmdBuffer);
     }
 
     // @todo Has errors.
@@ -214,6 +133,24 @@ namespace Silent::Renderer
     {
         SDL_WaitForGPUIdle(_device);
 
+        _textureCache.clear();
+        _atlasPageTextures.clear();
+        _textureAtlas.Clear();
+        _uploads.Release();
+        _buffers.Vertices2d.Release();
+        _buffers.Indices2d.Release();
+        _buffers.DebugShapeMesh.Release();
+        _buffers.DebugShapeInstances.Release();
+        CompleteReadbacks(true);
+        for (auto& readback : _readbacks)
+        {
+            if (readback.Buffer != nullptr)
+            {
+                SDL_ReleaseGPUTransferBuffer(_device, readback.Buffer);
+            }
+            readback = FrameReadback{};
+        }
+
         ImGui_ImplSDL3_Shutdown();
         ImGui_ImplSDLGPU3_Shutdown();
         ImGui::DestroyContext();
@@ -236,13 +173,20 @@ namespace Silent::Renderer
             return;
         }
 
+        // Recycle upload memory and collect capture downloads of completed frames.
+        _uploads.BeginFrame();
+        CompleteReadbacks(false);
+
         // Acquire swapchain texture.
         _swapchainTexture = nullptr;
-        if (!SDL_WaitAndAcquireGPUSwapchainTexture(_commandBuffer, _window, &_swapchainTexture, nullptr, nullptr))
+        uint swapchainWidth  = 0;
+        uint swapchainHeight = 0;
+        if (!SDL_WaitAndAcquireGPUSwapchainTexture(_commandBuffer, _window, &_swapchainTexture, &swapchainWidth, &swapchainHeight))
         {
             ClearFrameData();
             return;
         }
+        _swapchainRes = Vector2i(swapchainWidth, swapchainHeight);
 
         // Draw frame.
         if (_swapchainTexture != nullptr)
@@ -251,60 +195,34 @@ namespace Silent::Renderer
             Draw2dScene();
             DrawPostProcess();
             DrawDebugGui();
-        }
-
-        // Submit command buffer to GPU.
-        SDL_SubmitGPUCommandBuffer(_commandBuffer);
-
-        // Clear frame setup.
-        ClearFrameData();
-    }
-
-    void SdlGpuRenderer::SaveScreenshot() const
-    {
-        constexpr uint COLOR_CHANNEL_COUNT = 3; // RGB.
-
-        const auto& fs = g_App.GetFilesystem();
-
-        // Get window size.
-        auto res = GetScreenResolution();
 
-        // Ensure directory exists.
-        auto timestamp = GetCurrentDateString() + "_" + GetCurrentTimeString();
-        auto filename  = (SCREENSHOT_FILENAME_BASE + timestamp) + PNG_FILE_EXT;
-        auto path      = fs.GetScreenshotsDirectory() / filename;
-        std::filesystem::create_directories(path.parent_path());
-
-        // Get window surface.
-        auto* surface = SDL_GetWindowSurface(_window);
-        if (surface == nullptr)
-        {
-            Debug::Log(Fmt("Failed to save screenshot: {}", SDL_GetError()), Debug::LogLevel::Warning, Debug::LogMode::All, true);
-            return;
+            // Capture frame.
+            ProcessCaptures();
         }
 
-        // Lock surface to access pixels.
-        if (!SDL_LockSurface(surface))
+        // Submit command buffer to GPU. Frame captures may have replaced it.
+        // Upload memory is held until the fence signals. Earlier submissions of the frame complete first.
+        if (_commandBuffer != nullptr)
         {
-            Debug::Log(Fmt("Failed to save screenshot: {}", SDL_GetError()), Debug::LogLevel::Warning, Debug::LogMode::All, true);
-            return;
+            auto* fence = SDL_SubmitGPUCommandBufferAndAcquireFence(_commandBuffer);
+            _uploads.EndFrame(fence);
         }
 
-        // Write screenshot file.
-        if (stbi_write_png(path.string().c_str(), res.x, res.y, COLOR_CHANNEL_COUNT, surface->pixels, res.x * COLOR_CHANNEL_COUNT))
-        {
-            Debug::Log("Saved screenshot.", Debug::LogLevel::Info, Debug::LogMode::All, true);
-        }
-        else
-        {
-            Debug::Log("Failed to save screenshot.", Debug::LogLevel::Warning, Debug::LogMode::All, true);
-        }
+        // Measure frame pacing.
+        const auto& snapshot = _snapshots.GetReadBuffer();
+        _framePacing.Record(snapshot.FrameId, snapshot.InputTime);
 
-        SDL_UnlockSurface(surface);
+        // Clear frame setup.
+        ClearFrameData();
     }
 
     void SdlGpuRenderer::Draw3dScene()
     {
+        // Process copy pass.
+        auto* copyPass = SDL_BeginGPUCopyPass(_commandBuffer);
+        CopyDebugShapes(*copyPass);
+        SDL_EndGPUCopyPass(copyPass);
+
         // Begin render pass.
         auto colorTargetInfo = SDL_GPUColorTargetInfo
         {
@@ -316,6 +234,8 @@ namespace Silent::Renderer
         auto& renderPass = *SDL_BeginGPURenderPass(_commandBuffer, &colorTargetInfo, 1, nullptr);
 
         // Process render pass.
+        DrawDebugShapes(renderPass);
+
         SDL_EndGPURenderPass(&renderPass);
     }
 
@@ -325,10 +245,7 @@ namespace Silent::Renderer
 
         // Process copy pass.
         auto* copyPass = SDL_BeginGPUCopyPass(_commandBuffer);
-
-        auto bufferVerts = std::vector<BufferVertex>{};
-        Copy2dPrimitives(*copyPass, bufferVerts);
-
+        Copy2dBatches(*copyPass);
         SDL_EndGPUCopyPass(copyPass);
 
         // Begin render pass.
@@ -340,33 +257,55 @@ namespace Silent::Renderer
         };
         auto& renderPass = *SDL_BeginGPURenderPass(_commandBuffer, &colorTargetInfo, 1, nullptr);
 
-        // Texture test.
-        // ===========================
-
-        _pipelines.Bind(renderPass, RenderStage::Primitive2dTextured, BlendMode::Opaque);
-
-        auto bufferBinding = SDL_GPUBufferBinding{ .buffer = VertexBuffer, .offset = 0 };
-        SDL_BindGPUVertexBuffers(&renderPass, 0, &bufferBinding, 1);
-
-        bufferBinding = SDL_GPUBufferBinding{ .buffer = IndexBuffer, .offset = 0 };
-        SDL_BindGPUIndexBuffer(&renderPass, &bufferBinding, SDL_GPU_INDEXELEMENTSIZE_16BIT);
-
-        TestTexture.Bind(renderPass, *_samplers[(int)options->TextureFilter]);
+        // Bind.
+        _buffers.Vertices2d.Bind(renderPass);
+        _buffers.Indices2d.Bind(renderPass);
+
+        // Process render pass. Each batch is a single indexed draw call, and state is only rebound when it changes.
+        auto prevStage  = RenderStage::Count;
+        auto prevBlend  = BlendMode::Count;
+        int  prevTexIdx = NO_VALUE;
+        for (const auto& batch : _batcher2d.GetBatches())
+        {
+            if (batch.IndexCount == 0)
+            {
+                continue;
+            }
 
-        SDL_DrawGPUIndexedPrimitives(&renderPass, 6, 1, 0, 0, 0);
+            // Bind texture.
+            if (batch.Stage == RenderStage::Primitive2dTextured)
+            {
+                auto* tex = GetTexture(false, batch.TextureIdx);
+                if (tex == nullptr)
+                {
+                    continue;
+                }
 
-        //===============================
+                if (batch.TextureIdx != prevTexIdx)
+                {
+                    tex->Bind(renderPass, *_samplers[(int)options->TextureFilter]);
+                    prevTexIdx = batch.TextureIdx;
+                }
+            }
 
-        // Bind.
-        _pipelines.Bind(renderPass, RenderStage::Primitive2d, BlendMode::FastAlpha);
-        _buffers.Primitives2d.Bind(renderPass, 0);
+            // Bind pipeline.
+            if (batch.Stage != prevStage || batch.BlendM != prevBlend)
+            {
+                _pipelines.Bind(renderPass, batch.Stage, batch.BlendM);
+                prevStage = batch.Stage;
+                prevBlend = batch.BlendM;
 
-        // Upload uniform data.
-        UniformBuffer.IsFastAlpha = false;
-        SDL_PushGPUFragmentUniformData(_commandBuffer, 0, &UniformBuffer, sizeof(UniformBuffer));
+                // Upload uniform data.
+                if (batch.Stage == RenderStage::Primitive2d)
+                {
+                    UniformBuffer.IsFastAlpha = batch.BlendM == BlendMode::FastAlpha;
+                    SDL_PushGPUFragmentUniformData(_commandBuffer, 0, &UniformBuffer, sizeof(UniformBuffer));
+                }
+            }
 
-        // Process render pass.
-        SDL_DrawGPUPrimitives(&renderPass, bufferVerts.size(), sizeof(bufferVerts) / sizeof(BufferVertex), 0, 0);
+            SDL_DrawGPUIndexedPrimitives(&renderPass, batch.IndexCount, 1, batch.IndexStart, 0, 0);
+            _drawCallCount++;
+        }
 
         SDL_EndGPURenderPass(&renderPass);
     }
@@ -422,7 +361,8 @@ namespace Silent::Renderer
         ImGui::NewFrame();
 
         // Draw GUIs.
-        for (auto& drawCall : _debugGuiDrawCalls)
+        const auto& snapshot = _snapshots.GetReadBuffer();
+        for (const auto& drawCall : snapshot.DebugGuiDrawCalls)
         {
             drawCall();
         }
@@ -447,45 +387,241 @@ namespace Silent::Renderer
         SDL_EndGPURenderPass(renderPass);
     }
 
-    void SdlGpuRenderer::Copy2dPrimitives(SDL_GPUCopyPass& copyPass, std::vector<BufferVertex>& bufferVerts)
+    bool SdlGpuRenderer::CopyFramePixels(std::unique_ptr<CaptureFrame>& frame)
+    {
+        constexpr uint COLOR_CHANNEL_COUNT = 4; // RGBA.
+
+        if (_swapchainTexture == nullptr || _swapchainRes.x <= 0 || _swapchainRes.y <= 0)
+        {
+            return false;
+        }
+
+        // Oldest readback still in flight, drop capture.
+        auto& readback = _readbacks[_readbackIdx];
+        if (readback.Fence != nullptr)
+        {
+            return false;
+        }
+
+        // @heapalloc Create or grow readback buffer. Only happens on first captures or resize.
+        uint size = (_swapchainRes.x * _swapchainRes.y) * COLOR_CHANNEL_COUNT;
+        if (readback.BufferSize < size)
+        {
+            if (readback.Buffer != nullptr)
+            {
+                SDL_ReleaseGPUTransferBuffer(_device, readback.Buffer);
+            }
+
+            auto transferBufferInfo = SDL_GPUTransferBufferCreateInfo
+            {
+                .usage = SDL_GPU_TRANSFERBUFFERUSAGE_DOWNLOAD,
+                .size  = size
+            };
+            readback.Buffer     = SDL_CreateGPUTransferBuffer(_device, &transferBufferInfo);
+            readback.BufferSize = (readback.Buffer != nullptr) ? size : 0;
+            if (readback.Buffer == nullptr)
+            {
+                Debug::Log(Fmt("Failed to create capture readback buffer: {}", SDL_GetError()), Debug::LogLevel::Warning);
+                return false;
+            }
+        }
+
+        // Download swapchain texture.
+        auto* copyPass = SDL_BeginGPUCopyPass(_commandBuffer);
+        auto  srcRegion = SDL_GPUTextureRegion
+        {
+            .texture = _swapchainTexture,
+            .w       = (uint)_swapchainRes.x,
+            .h       = (uint)_swapchainRes.y,
+            .d       = 1
+        };
+        auto dstInfo = SDL_GPUTextureTransferInfo
+        {
+            .transfer_buffer = readback.Buffer,
+            .offset          = 0
+        };
+        SDL_DownloadFromGPUTexture(copyPass, &srcRegion, &dstInfo);
+        SDL_EndGPUCopyPass(copyPass);
+
+        // Submit frame with fence and continue without waiting.
+        auto* fence    = SDL_SubmitGPUCommandBufferAndAcquireFence(_commandBuffer);
+        _commandBuffer = SDL_AcquireGPUCommandBuffer(_device);
+        if (fence == nullptr)
+        {
+            Debug::Log(Fmt("Failed to submit capture readback: {}", SDL_GetError()), Debug::LogLevel::Warning);
+            return false;
+        }
+
+        // BGRA swapchain formats are swizzled by the capture worker.
+        auto format       = SDL_GetGPUSwapchainTextureFormat(_device, _window);
+        frame->Resolution = _swapchainRes;
+        frame->IsBgra     = format == SDL_GPU_TEXTUREFORMAT_B8G8R8A8_UNORM || format == SDL_GPU_TEXTUREFORMAT_B8G8R8A8_UNORM_SRGB;
+
+        readback.Fence = fence;
+        readback.Frame = std::move(frame);
+        _readbackIdx   = (_readbackIdx + 1) % READBACK_COUNT;
+        return true;
+    }
+
+    void SdlGpuRenderer::CompleteReadbacks(bool wait)
     {
-        // Create 2D primitive vertex buffer data.
-        bufferVerts.reserve((_primitives2d.size() * 2) * TRIANGLE_VERTEX_COUNT);
-        for (const auto& prim : _primitives2d)
+        constexpr uint COLOR_CHANNEL_COUNT = 4; // RGBA.
+
+        // Collect from oldest readback so continuous capture frames are submitted in order.
+        for (int i = 0; i < READBACK_COUNT; i++)
         {
-            // 2D triangle primitive.
-            if (prim.Vertices.size() == TRIANGLE_VERTEX_COUNT)
+            auto& readback = _readbacks[(_readbackIdx + i) % READBACK_COUNT];
+            if (readback.Fence == nullptr)
             {
-                for (const auto& vert : prim.Vertices)
-                {
-                    //auto pos = GetAspectCorrectScreenPosition(Vector2(vert.Position.x, vert.Position.y), prim.ScaleM);
-                    auto ndc = ConvertScreenPositionToNdc(Vector2(vert.Position.x, vert.Position.y));
-                    bufferVerts.push_back(BufferVertex
-                    {
-                        .Position = Vector3(ndc.x, ndc.y, std::clamp((float)prim.Depth / (float)DEPTH_MAX, 0.0f, 1.0f)),
-                        .Col      = vert.Col
-                    });
-                }
+                continue;
             }
-            // 2D line or quad primitive.
-            else if (prim.Vertices.size() == QUAD_VERTEX_COUNT)
+
+            // Wait for download, or stop at first download in flight.
+            if (wait)
             {
-                for (int i : QUAD_TRIANGLE_IDXS)
-                {
-                    const auto& vert = prim.Vertices[i];
-
-                    //auto pos = GetAspectCorrectScreenPosition(Vector2(vert.Position.x, vert.Position.y), prim.ScaleM);
-                    auto ndc = ConvertScreenPositionToNdc(Vector2(vert.Position.x, vert.Position.y));
-                    bufferVerts.push_back(BufferVertex
-                    {
-                        .Position = Vector3(ndc.x, ndc.y, std::clamp((float)prim.Depth / (float)DEPTH_MAX, 0.0f, 1.0f)),
-                        .Col      = vert.Col
-                    });
-                }
+                SDL_WaitForGPUFences(_device, true, &readback.Fence, 1);
+            }
+            else if (!SDL_QueryGPUFence(_device, readback.Fence))
+            {
+                break;
+            }
+            SDL_ReleaseGPUFence(_device, readback.Fence);
+            readback.Fence = nullptr;
+
+            // Copy pixels into pooled buffer.
+            auto&       frame  = *readback.Frame;
+            uint        size   = (frame.Resolution.x * frame.Resolution.y) * COLOR_CHANNEL_COUNT;
+            const auto* pixels = (const byte*)SDL_MapGPUTransferBuffer(_device, readback.Buffer, false);
+            if (pixels == nullptr)
+            {
+                Debug::Log(Fmt("Failed to map capture readback buffer: {}", SDL_GetError()), Debug::LogLevel::Warning);
+                _captureQueue.Release(std::move(readback.Frame));
+                continue;
+            }
+            frame.Pixels.resize(size);
+            std::memcpy(frame.Pixels.data(), pixels, size);
+            SDL_UnmapGPUTransferBuffer(_device, readback.Buffer);
+
+            _captureQueue.Submit(std::move(readback.Frame));
+        }
+    }
+
+    void SdlGpuRenderer::Copy2dBatches(SDL_GPUCopyPass& copyPass)
+    {
+        // Upload new and modified atlas pages.
+        auto pages = _textureAtlas.GetPages();
+        for (int i = 0; i < pages.size(); i++)
+        {
+            const auto& page = pages[i];
+            if (!page.IsDirty)
+            {
+                continue;
+            }
+
+            if (i < _atlasPageTextures.size())
+            {
+                _atlasPageTextures[i]->Upload(_uploads, page.Pixels);
+            }
+            else
+            {
+                auto& tex = _atlasPageTextures.emplace_back(std::make_unique<Texture>());
+                tex->Initialize(*_device, _uploads, Vector2i(TextureAtlas::PAGE_SIZE), page.Pixels, Fmt("Texture atlas page {}", i));
             }
+            _textureAtlas.ClearDirty(i);
+        }
+
+        // Upload textures used by batches.
+        for (const auto& batch : _batcher2d.GetBatches())
+        {
+            if (batch.Stage == RenderStage::Primitive2dTextured)
+            {
+                GetTexture(true, batch.TextureIdx);
+            }
+        }
+
+        // Update buffers.
+        _buffers.Vertices2d.Update(_uploads, _batcher2d.GetVertices());
+        _buffers.Indices2d.Update(_uploads, _batcher2d.GetIndices());
+
+        // Encode recorded uploads.
+        _uploads.Flush(copyPass);
+    }
+
+    void SdlGpuRenderer::CopyDebugShapes(SDL_GPUCopyPass& copyPass)
+    {
+        // Upload unit meshes once.
+        if (!_isDebugShapeMeshUploaded)
+        {
+            _buffers.DebugShapeMesh.Update(_uploads, DebugShapeBatcher::GetMeshVertices());
+            _isDebugShapeMeshUploaded = true;
+        }
+
+        // Update instance buffer.
+        _buffers.DebugShapeInstances.Update(_uploads, _debugShapeBatcher.GetInstances());
+
+        // Encode recorded uploads.
+        _uploads.Flush(copyPass);
+    }
+
+    void SdlGpuRenderer::DrawDebugShapes(SDL_GPURenderPass& renderPass)
+    {
+        auto draws = _debugShapeBatcher.GetDraws();
+        if (draws.empty())
+        {
+            return;
+        }
+
+        // Upload uniform data.
+        auto  res         = GetScreenResolution();
+        float aspect      = (float)res.x / (float)res.y;
+        auto  viewProjMat = _view.GetMatrix(glm::radians(45.0f), aspect, 0.1f, 100.0f);
+        SDL_PushGPUVertexUniformData(_commandBuffer, 0, &viewProjMat, sizeof(viewProjMat));
+
+        // Bind unit meshes and instance stream.
+        _buffers.DebugShapeMesh.Bind(renderPass, 0);
+        _buffers.DebugShapeInstances.Bind(renderPass, 1);
+
+        // Draw each unit mesh once for all its instances.
+        for (const auto& draw : draws)
+        {
+            _pipelines.Bind(renderPass, draw.IsWireframe ? RenderStage::DebugShape3dWireframe : RenderStage::DebugShape3d, BlendMode::Add);
+            SDL_DrawGPUPrimitives(&renderPass, draw.VertexCount, draw.InstanceCount, draw.VertexStart, draw.InstanceStart);
+            _drawCallCount++;
+        }
+    }
+
+    Texture* SdlGpuRenderer::GetTexture(bool canUpload, int assetIdx)
+    {
+        // Get atlas page texture.
+        if (TextureAtlas::IsPageTextureIdx(assetIdx))
+        {
+            int pageIdx = assetIdx - TextureAtlas::PAGE_TEXTURE_IDX_BASE;
+            return (pageIdx < _atlasPageTextures.size()) ? _atlasPageTextures[pageIdx].get() : nullptr;
+        }
+
+        // Get cached texture.
+        auto* tex = Find(_textureCache, assetIdx);
+        if (tex != nullptr)
+        {
+            return tex->get();
+        }
+
+        if (!canUpload)
+        {
+            return nullptr;
+        }
+
+        // Check if asset is loaded.
+        auto&      assets = g_App.GetAssets();
+        const auto asset  = assets.GetAsset(assetIdx);
+        if (asset == nullptr || asset->State != AssetState::Loaded)
+        {
+            return nullptr;
         }
 
-        // Update buffer.
-        _buffers.Primitives2d.Update(copyPass, ToSpan(bufferVerts), 0);
+        // Create and upload texture.
+        auto newTex = std::make_unique<Texture>();
+        newTex->Initialize(*_device, _uploads, assetIdx);
+        return (_textureCache[assetIdx] = std::move(newTex)).get();
     }
 }
@@ -2,31 +2,42 @@
 
 #include "Renderer/Backends/SdlGpu/Buffer.h"
 #include "Renderer/Backends/SdlGpu/Pipeline.h"
+#include "Renderer/Backends/SdlGpu/Texture.h"
+#include "Renderer/Backends/SdlGpu/UploadAllocator.h"
+#include "Renderer/Common/Objects/Graphic/Batch.h"
+#include "Renderer/Common/Objects/Graphic/DebugShape.h"
 #include "Renderer/Common/Objects/Primitive/Vertex2d.h"
 #include "Renderer/Common/Objects/Primitive/Vertex3d.h"
 #include "Renderer/Renderer.h"
 
 namespace Silent::Renderer
 {
-    struct BufferVertex
-    {
-        Vector3 Position = Vector3::Zero;
-        Color   Col      = Color::Clear;
-    };
-    struct BufferTexVertex
+    struct BufferData
     {
-        Vector3 Position = Vector3::Zero;
-        Vector2 Uv       = Vector2::Zero;
+        Buffer<BatchVertex>        Vertices2d          = Buffer<BatchVertex>();        /** Batched 2D primitive and sprite vertices. */
+        Buffer<uint16>             Indices2d           = Buffer<uint16>();             /** Batched 2D primitive and sprite indices. */
+        Buffer<Vector3>            DebugShapeMesh      = Buffer<Vector3>();            /** Static unit debug shape meshes. */
+        Buffer<DebugShapeInstance> DebugShapeInstances = Buffer<DebugShapeInstance>(); /** Per-instance debug shape transforms and colors. */
     };
 
-    struct BufferData
+    /** @brief Swapchain download in flight for a frame capture. */
+    struct FrameReadback
     {
-        Buffer<BufferVertex> Primitives2d = Buffer<BufferVertex>();
-        Buffer<Vertex2d>     Sprites2d    = Buffer<Vertex2d>();
+        SDL_GPUTransferBuffer*        Buffer     = nullptr; /** Download buffer. Created on first use and grown on resize. */
+        uint                          BufferSize = 0;       /** Download buffer size in bytes. */
+        SDL_GPUFence*                 Fence      = nullptr; /** Signals once the download completes. `nullptr` if no download is in flight. */
+        std::unique_ptr<CaptureFrame> Frame      = nullptr; /** Capture frame to fill once the fence signals. */
     };
 
     class SdlGpuRenderer : public RendererBase
     {
+    public:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr uint READBACK_COUNT = 3; /** Capture downloads in flight. Captures are written up to this many frames late. */
+
     private:
         // =======
         // Fields
@@ -37,9 +48,17 @@ namespace Silent::Renderer
         SDL_GPUCommandBuffer*        _commandBuffer    = nullptr;           /** Active command buffer. */
         std::vector<SDL_GPUSampler*> _samplers         = {};                /** Texture samplers. */
         BufferData                   _buffers          = {};                /** Vertex, index, and indirect buffers. */
+        UploadAllocator              _uploads          = UploadAllocator(); /** Frame-ring upload memory for buffers and textures. */
         PipelineManager              _pipelines        = PipelineManager(); /** Pipeline handler. */
 
-        std::unordered_map<int, SDL_GPUTexture*> _textureCache = {}; /** Key = asset index, value = texture. */
+        std::unordered_map<int, std::unique_ptr<Texture>> _textureCache      = {}; /** Key = asset index, value = texture. */
+        std::vector<std::unique_ptr<Texture>>             _atlasPageTextures = {}; /** Uploaded texture atlas pages. */
+
+        bool _isDebugShapeMeshUploaded = false;
+
+        std::array<FrameReadback, READBACK_COUNT> _readbacks    = {};             /** Frame capture readback ring. */
+        uint                                      _readbackIdx  = 0;              /** Next readback to use. Readbacks complete in ring order. */
+        Vector2i                                  _swapchainRes = Vector2i::Zero; /** Active swapchain texture resolution. */
 
     public:
         // =============
@@ -56,7 +75,6 @@ namespace Silent::Renderer
         void Initialize(SDL_Window& window) override;
         void Deinitialize() override;
         void Update() override;
-        void SaveScreenshot() const override;
 
     private:
         // ========
@@ -68,6 +86,45 @@ namespace Silent::Renderer
         void DrawPostProcess() override;
         void DrawDebugGui() override;
 
-        void Copy2dPrimitives(SDL_GPUCopyPass& copyPass, std::vector<BufferVertex>& bufferVerts);
+        /** @brief Starts downloading the swapchain texture into a capture frame without waiting for it. Submits the active command buffer
+         * with a fence, then continues with a new command buffer. The readback takes ownership of the frame and submits it
+         * to the capture queue from `CompleteReadbacks` on a later frame.
+         *
+         * @param frame Capture frame to fill.
+         * @return `true` if the download was started, `false` if all readbacks are in flight or the download failed.
+         */
+        bool CopyFramePixels(std::unique_ptr<CaptureFrame>& frame) override;
+
+        /** @brief Copies completed swapchain downloads into their capture frames and submits them in capture order.
+         *
+         * @param wait Wait for all downloads in flight instead of only collecting completed ones.
+         */
+        void CompleteReadbacks(bool wait);
+
+        /** @brief Records uploads of 2D batch vertices and indices and ensures batch textures are cached, then flushes all recorded uploads.
+         *
+         * @param copyPass Copy pass.
+         */
+        void Copy2dBatches(SDL_GPUCopyPass& copyPass);
+
+        /** @brief Records uploads of debug shape instances, then flushes all recorded uploads. Unit meshes are uploaded once on first use.
+         *
+         * @param copyPass Copy pass.
+         */
+        void CopyDebugShapes(SDL_GPUCopyPass& copyPass);
+
+        /** @brief Draws debug shapes with one instanced draw call per unit mesh.
+         *
+         * @param renderPass Render pass.
+         */
+        void DrawDebugShapes(SDL_GPURenderPass& renderPass);
+
+        /** @brief Gets a cached texture, creating and uploading it if the asset is loaded.
+         *
+         * @param canUpload Whether to record an upload for a new texture. Pass `false` to only query the cache.
+         * @param assetIdx TIM asset index or texture atlas page texture index.
+         * @return Cached texture, `nullptr` if unavailable.
+         */
+        Texture* GetTexture(bool canUpload, int assetIdx);
     };
 }
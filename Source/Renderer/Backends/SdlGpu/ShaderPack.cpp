@@ -0,0 +1,111 @@
+#include "Framework.h"
+#include "Renderer/Backends/SdlGpu/ShaderPack.h"
+
+#include "Utils/Stream.h"
+#include "Utils/Utils.h"
+
+using namespace Silent::Utils;
+
+namespace Silent::Renderer
+{
+    /** @brief Reads a trivially copyable value from a loaded pack and advances the offset.
+     *
+     * @param data Pack data.
+     * @param offset Read offset.
+     * @return Read value.
+     */
+    template <typename T>
+    static T ReadValue(std::span<const byte> data, uint& offset)
+    {
+        if ((offset + sizeof(T)) > data.size())
+        {
+            throw std::runtime_error("Shader pack is truncated.");
+        }
+
+        auto val = T{};
+        std::memcpy(&val, &data[offset], sizeof(T));
+        offset += sizeof(T);
+        return val;
+    }
+
+    std::span<const byte> ShaderPack::GetBlob(const std::string& filename) const
+    {
+        const auto* blob = Find(_blobs, filename);
+        return (blob != nullptr) ? *blob : std::span<const byte>();
+    }
+
+    uint ShaderPack::GetSize() const
+    {
+        return (uint)_data.size();
+    }
+
+    bool ShaderPack::Load(const std::filesystem::path& path)
+    {
+        Clear();
+
+        if (!std::filesystem::exists(path))
+        {
+            return false;
+        }
+
+        // Read whole file at once.
+        auto stream = Stream(path, true, false);
+        if (!stream.IsOpen())
+        {
+            return false;
+        }
+        _data.resize(stream.GetSize());
+        stream.Read(_data.data(), (uint)_data.size());
+        stream.Close();
+
+        // Read header.
+        uint offset = 0;
+        if (ReadValue<uint32>(_data, offset) != MAGIC)
+        {
+            throw std::runtime_error(Fmt("{} is not a shader pack.", path.string()));
+        }
+
+        auto version = ReadValue<uint16>(_data, offset);
+        if (version != VERSION)
+        {
+            throw std::runtime_error(Fmt("Unsupported shader pack version {} in {}.", version, path.string()));
+        }
+
+        // Index blobs in place.
+        auto entryCount = ReadValue<uint32>(_data, offset);
+        for (int i = 0; i < entryCount; i++)
+        {
+            auto nameSize = ReadValue<int32>(_data, offset);
+            if (nameSize < 0 || (offset + nameSize) > _data.size())
+            {
+                throw std::runtime_error(Fmt("Shader pack {} contains invalid entry name.", path.string()));
+            }
+
+            auto name = std::string(&_data[offset], nameSize);
+            offset   += nameSize;
+
+            auto blobOffset = ReadValue<uint32>(_data, offset);
+            auto blobSize   = ReadValue<uint32>(_data, offset);
+            if (((uint64)blobOffset + blobSize) > _data.size())
+            {
+                throw std::runtime_error(Fmt("Shader pack {} entry `{}` is out of range.", path.string(), name));
+            }
+
+            _blobs[name] = std::span<const byte>(&_data[blobOffset], blobSize);
+        }
+
+        return true;
+    }
+
+    void ShaderPack::Clear()
+    {
+        _blobs.clear();
+        _data.clear();
+        _data.shrink_to_fit();
+    }
+
+    bool ShaderPack::IsLoaded() const
+    {
+        return !_blobs.empty();
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+namespace Silent::Renderer
+{
+    constexpr char SHADER_PACK_FILENAME[] = "Shaders.pack";
+
+    /** @brief Packed shader blob file generated by `Tools/GenerateShaders.py`.
+     * The whole file is read with a single I/O call, and blobs are referenced in place by their compiled shader filename,
+     * e.g. `2dPrimitive.vert.spv`.
+     *
+     * @note File layout, little-endian:
+     * magic (4) | version (2) | entry count (4) | entries | blobs.
+     * Each entry is name length (4) | name | blob offset from file start (4) | blob size (4).
+     */
+    class ShaderPack
+    {
+    public:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr uint32 MAGIC   = 0x50485353; // "SSHP".
+        static constexpr uint16 VERSION = 1;
+
+    private:
+        // =======
+        // Fields
+        // =======
+
+        std::vector<byte>                                      _data  = {};
+        std::unordered_map<std::string, std::span<const byte>> _blobs = {}; /** Key = compiled shader filename, value = blob in `_data`. */
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs an empty default `ShaderPack`. */
+        ShaderPack() = default;
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets a shader blob.
+         *
+         * @param filename Compiled shader filename.
+         * @return Shader blob, empty if not packed.
+         */
+        std::span<const byte> GetBlob(const std::string& filename) const;
+
+        /** @brief Gets the packed file size.
+         *
+         * @return Size in bytes.
+         */
+        uint GetSize() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Loads a shader pack, replacing any loaded blobs.
+         *
+         * @param path Shader pack file path.
+         * @exception `std::runtime_error` if the file is malformed.
+         * @return `true` if loaded, `false` if the file doesn't exist.
+         */
+        bool Load(const std::filesystem::path& path);
+
+        /** @brief Frees all blobs once shaders are created. */
+        void Clear();
+
+        // ==========
+        // Inquirers
+        // ==========
+
+        /** @brief Checks if the shader pack holds any blobs.
+         *
+         * @return `true` if loaded, `false` otherwise.
+         */
+        bool IsLoaded() const;
+    };
+}
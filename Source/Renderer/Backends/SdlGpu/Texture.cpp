@@ -8,7 +8,7 @@ using namespace Silent::Assets;
 
 namespace Silent::Renderer
 {
-    void Texture::Initialize(SDL_GPUDevice& device, SDL_GPUCopyPass& copyPass, int assetIdx)
+    void Texture::Initialize(SDL_GPUDevice& device, UploadAllocator& uploads, int assetIdx)
     {
         auto& assets = g_App.GetAssets();
 
@@ -25,10 +25,15 @@ namespace Silent::Renderer
             throw std::runtime_error(Fmt("Attempted to initialize non-image asset {} as texture.", assetIdx));
         }
 
-        _device = &device;
-
         // Get TIM image asset data.
         auto data = asset->GetData<TimAsset>();
+        Initialize(device, uploads, data->Resolution, data->Pixels, asset->Name);
+    }
+
+    void Texture::Initialize(SDL_GPUDevice& device, UploadAllocator& uploads, const Vector2i& res, std::span<const byte> pixels, const std::string& name)
+    {
+        _device     = &device;
+        _resolution = res;
 
         // Create texture.
         auto texInfo = SDL_GPUTextureCreateInfo
@@ -36,44 +41,27 @@ namespace Silent::Renderer
             .type                 = SDL_GPU_TEXTURETYPE_2D,
             .format               = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
             .usage                = SDL_GPU_TEXTUREUSAGE_SAMPLER,
-            .width                = (uint)data->Resolution.x,
-            .height               = (uint)data->Resolution.y,
+            .width                = (uint)res.x,
+            .height               = (uint)res.y,
             .layer_count_or_depth = 1,
             .num_levels           = 1
         };
         _texture = SDL_CreateGPUTexture(_device, &texInfo);
 
         // Set texture name.
-        SDL_SetGPUTextureName(_device, _texture, asset->Name.c_str());
-
-        // Create transfer buffer.
-        auto transferBufferInfo = SDL_GPUTransferBufferCreateInfo
-        {
-            .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
-            .size  = (uint)((data->Resolution.x * data->Resolution.y) * 4)
-        };
-        auto* transferBuffer = SDL_CreateGPUTransferBuffer(_device, &transferBufferInfo);
+        SDL_SetGPUTextureName(_device, _texture, name.c_str());
 
-        byte* mappedTransferData = (byte*)SDL_MapGPUTransferBuffer(_device, transferBuffer, false);
-        memcpy(mappedTransferData, data->Pixels.data(), (data->Resolution.x * data->Resolution.y) * 4);
-        SDL_UnmapGPUTransferBuffer(_device, transferBuffer);
+        Upload(uploads, pixels);
+    }
 
-        // Upload texture data.
-        auto texTransferInfo = SDL_GPUTextureTransferInfo
-        {
-            .transfer_buffer = transferBuffer,
-            .offset          = 0
-        };
-        auto texRegion = SDL_GPUTextureRegion
+    void Texture::Upload(UploadAllocator& uploads, std::span<const byte> pixels)
+    {
+        if (_texture == nullptr)
         {
-            .texture = _texture,
-            .w       = (uint)data->Resolution.x,
-            .h       = (uint)data->Resolution.y,
-            .d       = 1
-        };
-        SDL_UploadToGPUTexture(&copyPass, &texTransferInfo, &texRegion, false);
+            return;
+        }
 
-	    SDL_ReleaseGPUTransferBuffer(_device, transferBuffer);
+        uploads.UploadToTexture(*_texture, _resolution, pixels);
     }
 
     Texture::~Texture()
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Renderer/Backends/SdlGpu/UploadAllocator.h"
+
 namespace Silent::Renderer
 {
     /** @brief GPU texture. */
@@ -10,8 +12,9 @@ namespace Silent::Renderer
         // Fields
         // =======
 
-        SDL_GPUDevice*  _device  = nullptr;
-        SDL_GPUTexture* _texture = nullptr;
+        SDL_GPUDevice*  _device     = nullptr;
+        SDL_GPUTexture* _texture    = nullptr;
+        Vector2i        _resolution = Vector2i::Zero;
 
     public:
         // =============
@@ -28,15 +31,32 @@ namespace Silent::Renderer
         // Utilities
         // ==========
 
-        /** @brief Initializes the texture and uploads it to the GPU.
+        /** @brief Initializes the texture and records its upload to the GPU.
          * If the TIM asset isn't already loaded, it will be loaded as a preliminary step.
          *
          * @param device GPU device.
-         * @param copyPass Copy pass.
+         * @param uploads Frame upload allocator.
          * @param assetIdx TIM asset index.
          * @exception `std::runtime_error` if the asset is invalid.
          */
-        void Initialize(SDL_GPUDevice& device, SDL_GPUCopyPass& copyPass, int assetIdx);
+        void Initialize(SDL_GPUDevice& device, UploadAllocator& uploads, int assetIdx);
+
+        /** @brief Initializes the texture from RGBA8 pixels and records its upload to the GPU.
+         *
+         * @param device GPU device.
+         * @param uploads Frame upload allocator.
+         * @param res Texture resolution in pixels.
+         * @param pixels RGBA8 pixels.
+         * @param name Debug name.
+         */
+        void Initialize(SDL_GPUDevice& device, UploadAllocator& uploads, const Vector2i& res, std::span<const byte> pixels, const std::string& name);
+
+        /** @brief Records an upload of new RGBA8 pixels to the initialized texture.
+         *
+         * @param uploads Frame upload allocator.
+         * @param pixels RGBA8 pixels matching the texture resolution.
+         */
+        void Upload(UploadAllocator& uploads, std::span<const byte> pixels);
 
         void Bind(SDL_GPURenderPass& renderPass, SDL_GPUSampler& sampler);
     };
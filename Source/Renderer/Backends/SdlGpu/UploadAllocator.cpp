@@ -0,0 +1,338 @@
+#include "Framework.h"
+#include "Renderer/Backends/SdlGpu/UploadAllocator.h"
+
+namespace Silent::Renderer
+{
+    UploadRing::UploadRing(uint pageSize, uint pageCountMax)
+    {
+        _pageSize     = pageSize;
+        _pageCountMax = pageCountMax;
+    }
+
+    uint UploadRing::GetPageSize() const
+    {
+        return _pageSize;
+    }
+
+    uint UploadRing::GetPageCount() const
+    {
+        return _pageCount;
+    }
+
+    uint UploadRing::GetInFlightFrameCount() const
+    {
+        return (uint)_inFlightPages.size();
+    }
+
+    UploadStats UploadRing::GetStats() const
+    {
+        auto stats               = _stats;
+        stats.PageCount          = _pageCount;
+        stats.FreePageCount      = (uint)_freePages.size();
+        stats.InFlightFrameCount = (uint)_inFlightPages.size();
+        return stats;
+    }
+
+    std::optional<UploadAllocation> UploadRing::Allocate(uint size)
+    {
+        if (size == 0)
+        {
+            return std::nullopt;
+        }
+
+        if (size > _pageSize)
+        {
+            _stats.FailCount++;
+            return std::nullopt;
+        }
+
+        // Start new page if active page is full.
+        uint offset = (_pageOffset + (ALIGNMENT - 1)) & ~(ALIGNMENT - 1);
+        if (_framePages.empty() || (offset + size) > _pageSize)
+        {
+            uint pageIdx = 0;
+            if (!_freePages.empty())
+            {
+                pageIdx = _freePages.back();
+                _freePages.pop_back();
+            }
+            else if (_pageCount < _pageCountMax)
+            {
+                pageIdx = _pageCount;
+                _pageCount++;
+            }
+            else
+            {
+                return std::nullopt;
+            }
+
+            _framePages.push_back(pageIdx);
+            offset = 0;
+        }
+
+        // Bump allocate.
+        _pageOffset  = offset + size;
+        _frameSize  += size;
+        return UploadAllocation
+        {
+            .PageIdx = _framePages.back(),
+            .Offset  = offset,
+            .Size    = size
+        };
+    }
+
+    void UploadRing::EndFrame(uint64 frameId)
+    {
+        // Frames without uploads are tracked too so that retirement stays in step with submissions.
+        _inFlightPages.push_back(FramePages
+        {
+            .FrameId = frameId,
+            .Pages   = std::move(_framePages)
+        });
+        _framePages.clear();
+        _pageOffset = 0;
+
+        _stats.FrameSize     = _frameSize;
+        _stats.FrameSizePeak = std::max(_stats.FrameSizePeak, _frameSize);
+        _frameSize           = 0;
+    }
+
+    std::optional<uint64> UploadRing::RetireOldest()
+    {
+        if (_inFlightPages.empty())
+        {
+            return std::nullopt;
+        }
+
+        auto& frame = _inFlightPages.front();
+        _freePages.insert(_freePages.end(), frame.Pages.begin(), frame.Pages.end());
+
+        uint64 frameId = frame.FrameId;
+        _inFlightPages.pop_front();
+        return frameId;
+    }
+
+    void UploadRing::RecordStall()
+    {
+        _stats.StallCount++;
+    }
+
+    UploadStats UploadAllocator::GetStats() const
+    {
+        return _ring.GetStats();
+    }
+
+    void UploadAllocator::Initialize(SDL_GPUDevice& device)
+    {
+        _device  = &device;
+        _ring    = UploadRing(PAGE_SIZE, PAGE_COUNT_MAX);
+        _frameId = 0;
+    }
+
+    void UploadAllocator::BeginFrame()
+    {
+        // Recycle pages of completed frames.
+        while (!_fences.empty() && (_fences.front() == nullptr || SDL_QueryGPUFence(_device, _fences.front())))
+        {
+            RetireOldest(false);
+        }
+    }
+
+    bool UploadAllocator::UploadToBuffer(SDL_GPUBuffer& buffer, uint dstOffset, std::span<const byte> data, bool isCycled)
+    {
+        auto alloc = Write(data);
+        if (!alloc.has_value())
+        {
+            return false;
+        }
+
+        _copies.push_back(UploadCopy
+        {
+            .Allocation = *alloc,
+            .Buffer     = &buffer,
+            .DstOffset  = dstOffset,
+            .IsCycled   = isCycled
+        });
+        return true;
+    }
+
+    bool UploadAllocator::UploadToTexture(SDL_GPUTexture& texture, const Vector2i& res, std::span<const byte> pixels)
+    {
+        constexpr uint COLOR_CHANNEL_COUNT = 4; // RGBA.
+
+        uint size = (res.x * res.y) * COLOR_CHANNEL_COUNT;
+        if (pixels.size() < size)
+        {
+            return false;
+        }
+
+        auto alloc = Write(pixels.first(size));
+        if (!alloc.has_value())
+        {
+            return false;
+        }
+
+        _copies.push_back(UploadCopy
+        {
+            .Allocation = *alloc,
+            .Texture    = &texture,
+            .Resolution = res
+        });
+        return true;
+    }
+
+    void UploadAllocator::Flush(SDL_GPUCopyPass& copyPass)
+    {
+        // Unmap pages before encoding uploads.
+        for (int i = 0; i < _pages.size(); i++)
+        {
+            if (_mappedData[i] != nullptr)
+            {
+                SDL_UnmapGPUTransferBuffer(_device, _pages[i]);
+                _mappedData[i] = nullptr;
+            }
+        }
+
+        // Encode recorded uploads.
+        for (const auto& copy : _copies)
+        {
+            auto transferInfo = SDL_GPUTransferBufferLocation
+            {
+                .transfer_buffer = _pages[copy.Allocation.PageIdx],
+                .offset          = copy.Allocation.Offset
+            };
+
+            if (copy.Buffer != nullptr)
+            {
+                auto bufferRegion = SDL_GPUBufferRegion
+                {
+                    .buffer = copy.Buffer,
+                    .offset = copy.DstOffset,
+                    .size   = copy.Allocation.Size
+                };
+                SDL_UploadToGPUBuffer(&copyPass, &transferInfo, &bufferRegion, copy.IsCycled);
+            }
+            else if (copy.Texture != nullptr)
+            {
+                auto texTransferInfo = SDL_GPUTextureTransferInfo
+                {
+                    .transfer_buffer = transferInfo.transfer_buffer,
+                    .offset          = transferInfo.offset
+                };
+                auto texRegion = SDL_GPUTextureRegion
+                {
+                    .texture = copy.Texture,
+                    .w       = (uint)copy.Resolution.x,
+                    .h       = (uint)copy.Resolution.y,
+                    .d       = 1
+                };
+                SDL_UploadToGPUTexture(&copyPass, &texTransferInfo, &texRegion, false);
+            }
+        }
+        _copies.clear();
+    }
+
+    void UploadAllocator::EndFrame(SDL_GPUFence* fence)
+    {
+        if (!_copies.empty())
+        {
+            Debug::Log("Uploads recorded without flushing were discarded.", Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            _copies.clear();
+        }
+
+        _ring.EndFrame(_frameId);
+        _fences.push_back(fence);
+        _frameId++;
+    }
+
+    void UploadAllocator::Release()
+    {
+        if (_device == nullptr)
+        {
+            return;
+        }
+
+        // Wait for frames in flight.
+        while (RetireOldest(true));
+
+        for (int i = 0; i < _pages.size(); i++)
+        {
+            if (_mappedData[i] != nullptr)
+            {
+                SDL_UnmapGPUTransferBuffer(_device, _pages[i]);
+            }
+            SDL_ReleaseGPUTransferBuffer(_device, _pages[i]);
+        }
+
+        _pages.clear();
+        _mappedData.clear();
+        _copies.clear();
+        _ring   = UploadRing();
+        _device = nullptr;
+    }
+
+    std::optional<UploadAllocation> UploadAllocator::Write(std::span<const byte> data)
+    {
+        // Allocate, waiting for oldest frames in flight to free pages if needed.
+        auto alloc = _ring.Allocate((uint)data.size());
+        while (!alloc.has_value() && data.size() <= PAGE_SIZE && RetireOldest(true))
+        {
+            _ring.RecordStall();
+            alloc = _ring.Allocate((uint)data.size());
+        }
+
+        if (!alloc.has_value())
+        {
+            Debug::Log(Fmt("Failed to allocate {} bytes of upload memory.", data.size()), Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return std::nullopt;
+        }
+
+        // @heapalloc Create page on first use.
+        uint pageIdx = alloc->PageIdx;
+        if (pageIdx >= _pages.size())
+        {
+            auto transferBufferInfo = SDL_GPUTransferBufferCreateInfo
+            {
+                .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+                .size  = PAGE_SIZE
+            };
+            _pages.push_back(SDL_CreateGPUTransferBuffer(_device, &transferBufferInfo));
+            _mappedData.push_back(nullptr);
+        }
+
+        // Map page without cycling. Pages of frames in flight are never handed out.
+        if (_mappedData[pageIdx] == nullptr)
+        {
+            _mappedData[pageIdx] = (byte*)SDL_MapGPUTransferBuffer(_device, _pages[pageIdx], false);
+            if (_mappedData[pageIdx] == nullptr)
+            {
+                Debug::Log(Fmt("Failed to map upload page: {}", SDL_GetError()), Debug::LogLevel::Error);
+                return std::nullopt;
+            }
+        }
+
+        std::memcpy(_mappedData[pageIdx] + alloc->Offset, data.data(), data.size());
+        return alloc;
+    }
+
+    bool UploadAllocator::RetireOldest(bool wait)
+    {
+        if (_fences.empty())
+        {
+            return false;
+        }
+
+        auto* fence = _fences.front();
+        if (fence != nullptr)
+        {
+            if (wait)
+            {
+                SDL_WaitForGPUFences(_device, true, &fence, 1);
+            }
+            SDL_ReleaseGPUFence(_device, fence);
+        }
+        _fences.pop_front();
+        _ring.RetireOldest();
+        return true;
+    }
+}
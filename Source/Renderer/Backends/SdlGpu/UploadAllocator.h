@@ -0,0 +1,256 @@
+#pragma once
+
+namespace Silent::Renderer
+{
+    /** @brief Sub-allocated region of an upload page. */
+    struct UploadAllocation
+    {
+        uint PageIdx = 0;
+        uint Offset  = 0; /** Byte offset in page. */
+        uint Size    = 0; /** Size in bytes. */
+    };
+
+    /** @brief Upload allocator statistics. */
+    struct UploadStats
+    {
+        uint PageCount          = 0;
+        uint FreePageCount      = 0;
+        uint InFlightFrameCount = 0;
+        uint FrameSize          = 0; /** Bytes allocated in the last ended frame. */
+        uint FrameSizePeak      = 0;
+        uint StallCount         = 0; /** Allocations which had to wait for a frame in flight to retire. */
+        uint FailCount          = 0; /** Allocations larger than a page. */
+    };
+
+    /** @brief Frame-ring upload page bookkeeping. Pages are sub-allocated linearly during a frame, then held until the frame retires.
+     * Has no GPU dependencies, so frame-in-flight lifetimes can be simulated on the CPU.
+     */
+    class UploadRing
+    {
+    public:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr uint ALIGNMENT = 16;
+
+    private:
+        /** @brief Pages used by a submitted frame. */
+        struct FramePages
+        {
+            uint64            FrameId = 0;
+            std::vector<uint> Pages   = {};
+        };
+
+        // =======
+        // Fields
+        // =======
+
+        uint                   _pageSize      = 0;
+        uint                   _pageCountMax  = 0;
+        uint                   _pageCount     = 0;
+        std::vector<uint>      _freePages     = {};
+        std::vector<uint>      _framePages    = {}; /** Pages used by active frame. Last page is sub-allocated. */
+        uint                   _pageOffset    = 0;  /** Bump offset in last active frame page. */
+        uint                   _frameSize     = 0;  /** Bytes allocated in active frame. */
+        std::deque<FramePages> _inFlightPages = {}; /** Pages used by submitted frames in submission order. */
+        UploadStats            _stats         = {}; /** Counters. Page counts are filled by `GetStats`. */
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs an empty default `UploadRing`. */
+        UploadRing() = default;
+
+        /** @brief Constructs an `UploadRing`.
+         *
+         * @param pageSize Page size in bytes.
+         * @param pageCountMax Maximum page count.
+         */
+        UploadRing(uint pageSize, uint pageCountMax);
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the page size.
+         *
+         * @return Page size in bytes.
+         */
+        uint GetPageSize() const;
+
+        /** @brief Gets the number of created pages.
+         *
+         * @return Page count.
+         */
+        uint GetPageCount() const;
+
+        /** @brief Gets the number of submitted frames which haven't retired.
+         *
+         * @return In-flight frame count.
+         */
+        uint GetInFlightFrameCount() const;
+
+        /** @brief Gets the upload statistics.
+         *
+         * @return Upload statistics.
+         */
+        UploadStats GetStats() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Bump-allocates an aligned region from the active frame's pages.
+         *
+         * @param size Size in bytes.
+         * @return Allocation, `std::nullopt` if it's larger than a page or no page is free and all pages are created.
+         * The caller must then retire the oldest frame in flight and retry.
+         */
+        std::optional<UploadAllocation> Allocate(uint size);
+
+        /** @brief Ends the active frame, holding its pages until it retires.
+         *
+         * @param frameId Frame identifier returned in submission order by `RetireOldest`.
+         */
+        void EndFrame(uint64 frameId);
+
+        /** @brief Retires the oldest frame in flight, returning its pages to the free list.
+         *
+         * @return Retired frame identifier, `std::nullopt` if no frame is in flight.
+         */
+        std::optional<uint64> RetireOldest();
+
+        /** @brief Records an allocation stall for statistics. */
+        void RecordStall();
+    };
+
+    /** @brief Frame-ring GPU upload allocator.
+     * Uploads are bump-allocated from a few large transfer buffers and recorded as copy regions, then encoded in one batch per copy pass.
+     * Transfer buffers are mapped once per frame on first use and recycled once the fence of the frame that used them signals,
+     * so they're never cycled or recreated.
+     *
+     * @note SDL_gpu requires transfer buffers to be unmapped before upload commands are encoded, so pages stay mapped
+     * only between the first allocation and `Flush`.
+     */
+    class UploadAllocator
+    {
+    public:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr uint PAGE_SIZE      = 8 * 1024 * 1024;
+        static constexpr uint PAGE_COUNT_MAX = 6;
+
+    private:
+        /** @brief Recorded upload into a buffer or texture. */
+        struct UploadCopy
+        {
+            UploadAllocation Allocation = {};
+            SDL_GPUBuffer*   Buffer     = nullptr;
+            uint             DstOffset  = 0;       /** Byte offset in destination buffer. */
+            SDL_GPUTexture*  Texture    = nullptr;
+            Vector2i         Resolution = Vector2i::Zero;
+            bool             IsCycled   = false;
+        };
+
+        // =======
+        // Fields
+        // =======
+
+        SDL_GPUDevice*                      _device     = nullptr;
+        UploadRing                          _ring       = UploadRing();
+        std::vector<SDL_GPUTransferBuffer*> _pages      = {};
+        std::vector<byte*>                  _mappedData = {}; /** Mapped page pointers, `nullptr` if unmapped. */
+        std::vector<UploadCopy>             _copies     = {}; /** Copies recorded since last flush. */
+        std::deque<SDL_GPUFence*>           _fences     = {}; /** Fences of frames in flight in submission order. */
+        uint64                              _frameId    = 0;
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs an uninitialized default `UploadAllocator`. */
+        UploadAllocator() = default;
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the upload statistics.
+         *
+         * @return Upload statistics.
+         */
+        UploadStats GetStats() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Initializes the allocator. Pages are created on demand.
+         *
+         * @param device GPU device.
+         */
+        void Initialize(SDL_GPUDevice& device);
+
+        /** @brief Recycles pages of frames whose fences have signaled. Call before the first upload of a frame. */
+        void BeginFrame();
+
+        /** @brief Copies data into upload memory and records an upload to a GPU buffer.
+         *
+         * @param buffer Destination GPU buffer.
+         * @param dstOffset Byte offset in destination buffer.
+         * @param data Data to upload.
+         * @param isCycled Whether to cycle the destination buffer if it's in use.
+         * @return `true` if recorded, `false` if the data is larger than a page.
+         */
+        bool UploadToBuffer(SDL_GPUBuffer& buffer, uint dstOffset, std::span<const byte> data, bool isCycled);
+
+        /** @brief Copies RGBA8 pixels into upload memory and records an upload to a whole GPU texture.
+         *
+         * @param texture Destination GPU texture.
+         * @param res Texture resolution in pixels.
+         * @param pixels RGBA8 pixels.
+         * @return `true` if recorded, `false` if the pixels are larger than a page.
+         */
+        bool UploadToTexture(SDL_GPUTexture& texture, const Vector2i& res, std::span<const byte> pixels);
+
+        /** @brief Unmaps pages and encodes all recorded uploads into a copy pass.
+         *
+         * @param copyPass Copy pass.
+         */
+        void Flush(SDL_GPUCopyPass& copyPass);
+
+        /** @brief Ends the frame, holding its pages until its fence signals.
+         *
+         * @param fence Fence of the submitted command buffer, or `nullptr` if nothing was submitted. Ownership is taken.
+         */
+        void EndFrame(SDL_GPUFence* fence);
+
+        /** @brief Waits for all frames in flight and releases GPU resources. */
+        void Release();
+
+    private:
+        // ========
+        // Helpers
+        // ========
+
+        /** @brief Allocates upload memory and copies data into it, waiting for the oldest frame in flight if all pages are in use.
+         *
+         * @param data Data to copy.
+         * @return Allocation, `std::nullopt` if the data is larger than a page.
+         */
+        std::optional<UploadAllocation> Write(std::span<const byte> data);
+
+        /** @brief Releases the oldest frame in flight's fence and recycles its pages.
+         *
+         * @param wait Whether to wait for the fence to signal.
+         * @return `true` if a frame was retired, `false` otherwise.
+         */
+        bool RetireOldest(bool wait);
+    };
+}
@@ -0,0 +1,462 @@
+#include "Framework.h"
+#include "Renderer/Backends/Software/Rasterizer.h"
+
+#include "Application.h"
+#include "Utils/Parallel.h"
+
+using namespace Silent::Utils;
+
+namespace Silent::Renderer
+{
+    /** PSX GPU 4x4 ordered dither offsets in 8-bit color units. */
+    static constexpr int DITHER_OFFSETS[4][4] =
+    {
+        { -4,  0, -3,  1 },
+        {  2, -2,  3, -1 },
+        { -3,  1, -4,  0 },
+        {  3, -1,  2, -2 }
+    };
+
+    /** @brief Linear edge function `A * x + B * y + C`. Non-negative on the inner side of an edge once oriented. */
+    struct EdgeFunction
+    {
+        float A         = 0.0f;
+        float B         = 0.0f;
+        float C         = 0.0f;
+        bool  IsTopLeft = false; /** Pixels exactly on a top or left edge are covered, others are not, so shared edges are drawn once. */
+
+        /** @brief Constructs the edge function of the directed edge `from` -> `to`.
+         *
+         * @param from Edge start.
+         * @param to Edge end.
+         * @param sign Orientation sign making the function non-negative inside the triangle.
+         * @return Edge function.
+         */
+        static EdgeFunction Create(const Vector2& from, const Vector2& to, float sign)
+        {
+            auto edge = EdgeFunction{};
+            edge.A         = (from.y - to.y) * sign;
+            edge.B         = (to.x - from.x) * sign;
+            edge.C         = -((edge.A * from.x) + (edge.B * from.y));
+            edge.IsTopLeft = edge.A > 0.0f || (edge.A == 0.0f && edge.B > 0.0f);
+            return edge;
+        }
+
+        /** @brief Evaluates the edge function for 4 horizontally adjacent pixels at once.
+         *
+         * @param xs Pixel center X coordinates.
+         * @param y Pixel center Y coordinate.
+         * @return Edge function values.
+         */
+        glm::vec4 Evaluate(const glm::vec4& xs, float y) const
+        {
+            return (xs * A) + ((B * y) + C);
+        }
+
+        /** @brief Tests which of 4 edge function values are covered, applying the top-left fill rule.
+         *
+         * @param values Edge function values.
+         * @return Coverage mask.
+         */
+        glm::bvec4 Test(const glm::vec4& values) const
+        {
+            return IsTopLeft ? glm::greaterThanEqual(values, glm::vec4(0.0f)) : glm::greaterThan(values, glm::vec4(0.0f));
+        }
+    };
+
+    static glm::vec4 UnpackPixel(uint pixel)
+    {
+        return glm::vec4((float)( pixel        & 0xFF),
+                         (float)((pixel >> 8)  & 0xFF),
+                         (float)((pixel >> 16) & 0xFF),
+                         (float)((pixel >> 24) & 0xFF)) / 255.0f;
+    }
+
+    static uint PackPixel(const glm::vec4& color)
+    {
+        auto bytes = glm::uvec4((glm::clamp(color, 0.0f, 1.0f) * 255.0f) + 0.5f);
+        return bytes.r | (bytes.g << 8) | (bytes.b << 16) | (bytes.a << 24);
+    }
+
+    /** @brief Samples a texel with nearest filtering and wrapping.
+     *
+     * @param tex Texture to sample.
+     * @param uv Texture coordinates.
+     * @return Texel color.
+     */
+    static glm::vec4 SampleTexture(const RasterTexture& tex, const glm::vec2& uv)
+    {
+        int x = (int)glm::floor(uv.x * tex.Resolution.x) % tex.Resolution.x;
+        int y = (int)glm::floor(uv.y * tex.Resolution.y) % tex.Resolution.y;
+        x     = (x < 0) ? (x + tex.Resolution.x) : x;
+        y     = (y < 0) ? (y + tex.Resolution.y) : y;
+
+        uint texel = 0;
+        std::memcpy(&texel, &tex.Pixels[((y * tex.Resolution.x) + x) * sizeof(uint)], sizeof(uint));
+        return UnpackPixel(texel);
+    }
+
+    /** @brief Blends a source color onto a destination pixel.
+     *
+     * @param dst Destination pixel.
+     * @param src Source color.
+     * @param blendMode Blend mode.
+     * @return Blended pixel.
+     */
+    static uint BlendPixel(uint dst, const glm::vec4& src, BlendMode blendMode)
+    {
+        switch (blendMode)
+        {
+            default:
+            case BlendMode::Opaque:
+            case BlendMode::Wireframe:
+            {
+                return PackPixel(glm::vec4(glm::vec3(src), 1.0f));
+            }
+            case BlendMode::Alpha:
+            {
+                auto dstCol = UnpackPixel(dst);
+                return PackPixel(glm::vec4(glm::mix(glm::vec3(dstCol), glm::vec3(src), src.a), dstCol.a));
+            }
+            case BlendMode::FastAlpha:
+            {
+                // Binary alpha test, no blending.
+                return (src.a >= 0.5f) ? PackPixel(glm::vec4(glm::vec3(src), 1.0f)) : dst;
+            }
+            case BlendMode::Multiply:
+            {
+                auto dstCol = UnpackPixel(dst);
+                return PackPixel(glm::vec4(glm::vec3(dstCol) * glm::vec3(src), dstCol.a));
+            }
+            case BlendMode::Add:
+            {
+                auto dstCol = UnpackPixel(dst);
+                return PackPixel(glm::vec4(glm::vec3(dstCol) + (glm::vec3(src) * src.a), dstCol.a));
+            }
+            case BlendMode::Subtract:
+            {
+                auto dstCol = UnpackPixel(dst);
+                return PackPixel(glm::vec4(glm::vec3(dstCol) - (glm::vec3(src) * src.a), dstCol.a));
+            }
+        }
+    }
+
+    /** @brief Gets the pixel bounds of a triangle clipped to its clip rectangle and a resolution.
+     *
+     * @param tri Triangle.
+     * @param res Surface resolution.
+     * @param outMin Inclusive top-left pixel.
+     * @param outMax Exclusive bottom-right pixel.
+     * @return `true` if the bounds are non-empty, `false` otherwise.
+     */
+    static bool GetTriangleBounds(const RasterTriangle& tri, const Vector2i& res, Vector2i& outMin, Vector2i& outMax)
+    {
+        const auto& pos0 = tri.Vertices[0].Position;
+        const auto& pos1 = tri.Vertices[1].Position;
+        const auto& pos2 = tri.Vertices[2].Position;
+
+        float minX = std::max({ std::min({ pos0.x, pos1.x, pos2.x }), tri.ClipRect.x, 0.0f });
+        float minY = std::max({ std::min({ pos0.y, pos1.y, pos2.y }), tri.ClipRect.y, 0.0f });
+        float maxX = std::min({ std::max({ pos0.x, pos1.x, pos2.x }), tri.ClipRect.z, (float)res.x });
+        float maxY = std::min({ std::max({ pos0.y, pos1.y, pos2.y }), tri.ClipRect.w, (float)res.y });
+
+        outMin = Vector2i((int)glm::floor(minX), (int)glm::floor(minY));
+        outMax = Vector2i((int)glm::ceil(maxX),  (int)glm::ceil(maxY));
+        return outMin.x < outMax.x && outMin.y < outMax.y;
+    }
+
+    const Vector2i& TileRasterizer::GetResolution() const
+    {
+        return _resolution;
+    }
+
+    std::span<const uint> TileRasterizer::GetSurface() const
+    {
+        return _surface;
+    }
+
+    uint TileRasterizer::GetTriangleCount() const
+    {
+        return (uint)_triangles.size();
+    }
+
+    void TileRasterizer::Resize(const Vector2i& res)
+    {
+        if (res == _resolution)
+        {
+            return;
+        }
+
+        // @heapalloc Reallocate surface and tile bins. Only happens on resize.
+        _resolution = Vector2i(std::max(res.x, 0), std::max(res.y, 0));
+        _tileCount  = Vector2i((_resolution.x + (TILE_SIZE - 1)) / TILE_SIZE, (_resolution.y + (TILE_SIZE - 1)) / TILE_SIZE);
+        _surface.assign(_resolution.x * _resolution.y, 0);
+        _tileBins.resize(_tileCount.x * _tileCount.y);
+    }
+
+    void TileRasterizer::Clear(const Color& color)
+    {
+        std::fill(_surface.begin(), _surface.end(), PackPixel(color.ToGlmVec4()));
+    }
+
+    void TileRasterizer::AddTriangle(const RasterTriangle& tri)
+    {
+        const auto& pos0 = tri.Vertices[0].Position;
+        const auto& pos1 = tri.Vertices[1].Position;
+        const auto& pos2 = tri.Vertices[2].Position;
+
+        // Discard degenerate triangle.
+        float area = ((pos1.x - pos0.x) * (pos2.y - pos0.y)) - ((pos1.y - pos0.y) * (pos2.x - pos0.x));
+        if (glm::abs(area) <= EPSILON)
+        {
+            return;
+        }
+
+        _triangles.push_back(tri);
+    }
+
+    void TileRasterizer::AddLine(const RasterVertex& from, const RasterVertex& to, BlendMode blendMode)
+    {
+        auto delta = to.Position - from.Position;
+        if (glm::length(glm::vec2(delta)) <= EPSILON)
+        {
+            return;
+        }
+
+        // Expand line into quad 1 pixel wide.
+        auto offset = Vector2(glm::normalize(glm::vec2(-delta.y, delta.x)) * 0.5f);
+        auto vert0  = from;
+        auto vert1  = from;
+        auto vert2  = to;
+        auto vert3  = to;
+        vert0.Position += offset;
+        vert1.Position -= offset;
+        vert2.Position -= offset;
+        vert3.Position += offset;
+
+        AddTriangle(RasterTriangle{ .Vertices = { vert0, vert1, vert2 }, .BlendM = blendMode });
+        AddTriangle(RasterTriangle{ .Vertices = { vert0, vert2, vert3 }, .BlendM = blendMode });
+    }
+
+    void TileRasterizer::Flush()
+    {
+        auto& executor = g_App.GetExecutor();
+
+        if (_triangles.empty() || _surface.empty())
+        {
+            _triangles.clear();
+            return;
+        }
+
+        // Bin triangles into overlapped tiles in submission order.
+        for (auto& bin : _tileBins)
+        {
+            bin.clear();
+        }
+        for (int i = 0; i < _triangles.size(); i++)
+        {
+            auto boundsMin = Vector2i::Zero;
+            auto boundsMax = Vector2i::Zero;
+            if (!GetTriangleBounds(_triangles[i], _resolution, boundsMin, boundsMax))
+            {
+                continue;
+            }
+
+            auto tileMin = boundsMin / TILE_SIZE;
+            auto tileMax = (boundsMax - 1) / TILE_SIZE;
+            for (int y = tileMin.y; y <= tileMax.y; y++)
+            {
+                for (int x = tileMin.x; x <= tileMax.x; x++)
+                {
+                    _tileBins[(y * _tileCount.x) + x].push_back(i);
+                }
+            }
+        }
+
+        // Rasterize occupied tiles in parallel.
+        auto tasks = ParallelTasks{};
+        tasks.reserve(_tileBins.size());
+        for (int i = 0; i < _tileBins.size(); i++)
+        {
+            if (_tileBins[i].empty())
+            {
+                continue;
+            }
+
+            tasks.push_back([this, i]() { RasterizeTile(i); });
+        }
+        executor.AddTasks(tasks).wait();
+
+        _triangles.clear();
+    }
+
+    void TileRasterizer::ApplyPostProcess(const RasterPostProcess& postProcess)
+    {
+        auto& executor = g_App.GetExecutor();
+
+        if (_surface.empty() || (!postProcess.EnableDithering && !postProcess.EnableVignette && !postProcess.EnableCrtFilter))
+        {
+            return;
+        }
+
+        // Process bands of tile rows in parallel.
+        auto tasks = ParallelTasks{};
+        tasks.reserve(_tileCount.y);
+        for (int i = 0; i < _tileCount.y; i++)
+        {
+            int rowStart = i * TILE_SIZE;
+            int rowEnd   = std::min(rowStart + TILE_SIZE, _resolution.y);
+            tasks.push_back([this, &postProcess, rowStart, rowEnd]() { PostProcessRows(postProcess, rowStart, rowEnd); });
+        }
+        executor.AddTasks(tasks).wait();
+    }
+
+    void TileRasterizer::RasterizeTile(uint tileIdx)
+    {
+        auto tilePos = Vector2i(tileIdx % _tileCount.x, tileIdx / _tileCount.x) * TILE_SIZE;
+        auto tileMin = tilePos;
+        auto tileMax = Vector2i(std::min(tilePos.x + TILE_SIZE, _resolution.x), std::min(tilePos.y + TILE_SIZE, _resolution.y));
+
+        for (uint triIdx : _tileBins[tileIdx])
+        {
+            RasterizeTriangle(_triangles[triIdx], tileMin, tileMax);
+        }
+    }
+
+    void TileRasterizer::RasterizeTriangle(const RasterTriangle& tri, const Vector2i& rectMin, const Vector2i& rectMax)
+    {
+        const auto& vert0 = tri.Vertices[0];
+        const auto& vert1 = tri.Vertices[1];
+        const auto& vert2 = tri.Vertices[2];
+
+        // Get bounds inside rectangle.
+        auto boundsMin = Vector2i::Zero;
+        auto boundsMax = Vector2i::Zero;
+        if (!GetTriangleBounds(tri, _resolution, boundsMin, boundsMax))
+        {
+            return;
+        }
+        boundsMin = Vector2i(std::max(boundsMin.x, rectMin.x), std::max(boundsMin.y, rectMin.y));
+        boundsMax = Vector2i(std::min(boundsMax.x, rectMax.x), std::min(boundsMax.y, rectMax.y));
+        if (boundsMin.x >= boundsMax.x || boundsMin.y >= boundsMax.y)
+        {
+            return;
+        }
+
+        // Orient edges so that edge functions are non-negative inside regardless of winding.
+        float area = ((vert1.Position.x - vert0.Position.x) * (vert2.Position.y - vert0.Position.y)) -
+                     ((vert1.Position.y - vert0.Position.y) * (vert2.Position.x - vert0.Position.x));
+        float sign = (area > 0.0f) ? 1.0f : -1.0f;
+        auto edge0 = EdgeFunction::Create(vert1.Position, vert2.Position, sign); // Weight of `vert0`.
+        auto edge1 = EdgeFunction::Create(vert2.Position, vert0.Position, sign); // Weight of `vert1`.
+        auto edge2 = EdgeFunction::Create(vert0.Position, vert1.Position, sign); // Weight of `vert2`.
+        float invArea = 1.0f / glm::abs(area);
+
+        // Clip rectangle is tested per pixel since it may split a pixel row.
+        bool isTextured = tri.Texture.Pixels != nullptr && tri.Texture.Resolution.x > 0 && tri.Texture.Resolution.y > 0;
+        auto laneOffsets = glm::vec4(0.5f, 1.5f, 2.5f, 3.5f);
+        for (int y = boundsMin.y; y < boundsMax.y; y++)
+        {
+            float centerY = (float)y + 0.5f;
+            if (centerY < tri.ClipRect.y || centerY >= tri.ClipRect.w)
+            {
+                continue;
+            }
+
+            uint* row = &_surface[y * _resolution.x];
+            for (int x = boundsMin.x; x < boundsMax.x; x += LANE_COUNT)
+            {
+                // Evaluate edge functions for 4 pixels at once.
+                auto centerXs = glm::vec4((float)x) + laneOffsets;
+                auto weights0 = edge0.Evaluate(centerXs, centerY);
+                auto weights1 = edge1.Evaluate(centerXs, centerY);
+                auto weights2 = edge2.Evaluate(centerXs, centerY);
+                auto mask     = glm::bvec4(edge0.Test(weights0) && edge1.Test(weights1) && edge2.Test(weights2));
+                mask          = mask && glm::lessThan(centerXs, glm::vec4(std::min(tri.ClipRect.z, (float)boundsMax.x)));
+                mask          = mask && glm::greaterThanEqual(centerXs, glm::vec4(tri.ClipRect.x));
+                if (!glm::any(mask))
+                {
+                    continue;
+                }
+
+                // Shade covered pixels with affine interpolation.
+                for (int lane = 0; lane < LANE_COUNT; lane++)
+                {
+                    if (!mask[lane])
+                    {
+                        continue;
+                    }
+
+                    float weight0 = weights0[lane] * invArea;
+                    float weight1 = weights1[lane] * invArea;
+                    float weight2 = weights2[lane] * invArea;
+
+                    auto color = (glm::vec4(vert0.Col) * weight0) + (glm::vec4(vert1.Col) * weight1) + (glm::vec4(vert2.Col) * weight2);
+                    if (isTextured)
+                    {
+                        auto uv    = (glm::vec2(vert0.Uv) * weight0) + (glm::vec2(vert1.Uv) * weight1) + (glm::vec2(vert2.Uv) * weight2);
+                        auto texel = SampleTexture(tri.Texture, uv);
+
+                        // Fully transparent texels are skipped like PSX color 0.
+                        if (texel.a <= 0.0f)
+                        {
+                            continue;
+                        }
+                        color *= texel;
+                    }
+
+                    uint& pixel = row[x + lane];
+                    pixel       = BlendPixel(pixel, color, tri.BlendM);
+                }
+            }
+        }
+    }
+
+    void TileRasterizer::PostProcessRows(const RasterPostProcess& postProcess, int rowStart, int rowEnd)
+    {
+        auto res = Vector2(_resolution.x, _resolution.y);
+
+        for (int y = rowStart; y < rowEnd; y++)
+        {
+            float uvY       = ((float)y + 0.5f) / res.y;
+            float vignetteY = uvY * (1.0f - uvY);
+
+            // Scan line intensity is constant across the row.
+            float scanLineIntensity = std::clamp(0.35f + (0.35f * std::sin(3.5f + (((float)y + 0.5f) * 1.5f))), 0.0f, 1.0f);
+            float scanLineEffect    = (0.4f + (0.7f * std::pow(scanLineIntensity, 1.7f))) * 2.8f;
+
+            for (int x = 0; x < _resolution.x; x++)
+            {
+                auto& pixel = _surface[(y * _resolution.x) + x];
+                auto  color = UnpackPixel(pixel);
+                auto  rgb   = glm::vec3(color);
+
+                // Vignette.
+                if (postProcess.EnableVignette)
+                {
+                    float uvX      = ((float)x + 0.5f) / res.x;
+                    float vignette = 16.0f * uvX * (1.0f - uvX) * vignetteY;
+                    rgb           *= std::pow(vignette, 0.3f);
+                }
+
+                // CRT filter.
+                if (postProcess.EnableCrtFilter)
+                {
+                    rgb  = glm::clamp((rgb * 0.6f) + ((rgb * rgb) * 0.4f), 0.0f, 1.0f);
+                    rgb *= scanLineEffect;
+                    rgb *= ((x % 2) == 0) ? 1.0f : 0.5f;
+                }
+
+                // Dithering.
+                if (postProcess.EnableDithering)
+                {
+                    int  offset = DITHER_OFFSETS[y % 4][x % 4];
+                    auto bytes  = glm::clamp(glm::ivec3((glm::clamp(rgb, 0.0f, 1.0f) * 255.0f) + 0.5f) + offset, 0, 255) & 0xF8;
+                    rgb         = glm::vec3(bytes) / 255.0f;
+                }
+
+                pixel = PackPixel(glm::vec4(rgb, color.a));
+            }
+        }
+    }
+}
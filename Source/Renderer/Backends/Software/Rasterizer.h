@@ -0,0 +1,162 @@
+#pragma once
+
+#include "Renderer/Common/Enums.h"
+
+namespace Silent::Renderer
+{
+    /** @brief Read-only view of RGBA8 texture pixels owned elsewhere. */
+    struct RasterTexture
+    {
+        const byte* Pixels     = nullptr;
+        Vector2i    Resolution = Vector2i::Zero;
+    };
+
+    /** @brief Screen space rasterizer vertex. */
+    struct RasterVertex
+    {
+        Vector2 Position = Vector2::Zero; /** Position in pixels from the top-left corner. */
+        Vector4 Col      = Vector4::One;
+        Vector2 Uv       = Vector2::Zero;
+    };
+
+    /** @brief Screen space triangle with its draw state. */
+    struct RasterTriangle
+    {
+        std::array<RasterVertex, TRIANGLE_VERTEX_COUNT> Vertices = {};
+        BlendMode                                       BlendM   = BlendMode::Opaque;
+        RasterTexture                                   Texture  = {};                                    /** Sampled if `Pixels` is set. */
+        Vector4                                         ClipRect = Vector4(0.0f, 0.0f, FLT_MAX, FLT_MAX); /** Min X, min Y, max X, max Y in pixels. */
+    };
+
+    /** @brief Full-screen effects applied to the surface after the scene is rasterized. */
+    struct RasterPostProcess
+    {
+        bool EnableDithering = false; /** PSX 4x4 ordered dither and quantization to 15-bit color. */
+        bool EnableVignette  = false;
+        bool EnableCrtFilter = false; /** Contrast curve, scan lines, and darkened odd columns. */
+    };
+
+    /** @brief Multithreaded tile-based triangle rasterizer writing to an in-memory RGBA8 surface.
+     * Triangles are binned into screen tiles, and each tile is rasterized in submission order by one parallel task,
+     * so tiles never share pixels and blending stays deterministic. Textures are sampled with affine UVs and
+     * nearest filtering like the PSX GPU.
+     */
+    class TileRasterizer
+    {
+    public:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr int  TILE_SIZE  = 64;
+        static constexpr uint LANE_COUNT = 4; /** Pixels evaluated per edge function step. */
+
+    private:
+        // =======
+        // Fields
+        // =======
+
+        Vector2i                       _resolution = Vector2i::Zero;
+        Vector2i                       _tileCount  = Vector2i::Zero;
+        std::vector<uint>              _surface    = {}; /** RGBA8 pixels, red in the lowest byte. */
+        std::vector<RasterTriangle>    _triangles  = {}; /** Triangles added since the last flush. */
+        std::vector<std::vector<uint>> _tileBins   = {}; /** Triangle indices per tile in submission order. */
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs an empty default `TileRasterizer`. */
+        TileRasterizer() = default;
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the surface resolution in pixels.
+         *
+         * @return Surface resolution.
+         */
+        const Vector2i& GetResolution() const;
+
+        /** @brief Gets the surface pixels in row-major order. Each pixel is RGBA8 in byte order.
+         *
+         * @return Surface pixels.
+         */
+        std::span<const uint> GetSurface() const;
+
+        /** @brief Gets the number of triangles added since the last flush.
+         *
+         * @return Pending triangle count.
+         */
+        uint GetTriangleCount() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Resizes the surface and tile grid. Does nothing if the resolution is unchanged.
+         *
+         * @param res New resolution in pixels.
+         */
+        void Resize(const Vector2i& res);
+
+        /** @brief Fills the surface with a color.
+         *
+         * @param color Clear color.
+         */
+        void Clear(const Color& color);
+
+        /** @brief Adds a triangle for rasterization on the next flush. Degenerate triangles are discarded.
+         *
+         * @param tri Triangle to add.
+         */
+        void AddTriangle(const RasterTriangle& tri);
+
+        /** @brief Adds a 1-pixel-wide line as two triangles for rasterization on the next flush.
+         *
+         * @param from Start vertex.
+         * @param to End vertex.
+         * @param blendMode Blend mode.
+         */
+        void AddLine(const RasterVertex& from, const RasterVertex& to, BlendMode blendMode);
+
+        /** @brief Bins pending triangles into tiles and rasterizes all tiles in parallel. Blocks until done. */
+        void Flush();
+
+        /** @brief Applies full-screen effects to the surface in parallel bands of tile rows. Blocks until done.
+         * Pending triangles are not flushed first.
+         *
+         * @param postProcess Effects to apply.
+         */
+        void ApplyPostProcess(const RasterPostProcess& postProcess);
+
+    private:
+        // ========
+        // Helpers
+        // ========
+
+        /** @brief Rasterizes all triangles binned to a tile.
+         *
+         * @param tileIdx Tile index.
+         */
+        void RasterizeTile(uint tileIdx);
+
+        /** @brief Rasterizes the part of a triangle inside a pixel rectangle.
+         *
+         * @param tri Triangle to rasterize.
+         * @param rectMin Inclusive top-left pixel.
+         * @param rectMax Exclusive bottom-right pixel.
+         */
+        void RasterizeTriangle(const RasterTriangle& tri, const Vector2i& rectMin, const Vector2i& rectMax);
+
+        /** @brief Applies full-screen effects to a band of surface rows.
+         *
+         * @param postProcess Effects to apply.
+         * @param rowStart First row.
+         * @param rowEnd Exclusive last row.
+         */
+        void PostProcessRows(const RasterPostProcess& postProcess, int rowStart, int rowEnd);
+    };
+}
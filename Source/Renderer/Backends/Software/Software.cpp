@@ -0,0 +1,397 @@
+#include "Framework.h"
+#include "Renderer/Backends/Software/Software.h"
+
+#include "Application.h"
+#include "Assets/Assets.h"
+#include "Assets/Parsers/Tim.h"
+#include "Renderer/Backends/Software/Rasterizer.h"
+#include "Renderer/Common/Capture.h"
+#include "Renderer/Common/Objects/Graphic/Batch.h"
+#include "Renderer/Common/Objects/Graphic/Bucket.h"
+#include "Renderer/Common/Objects/Graphic/DebugShape.h"
+#include "Renderer/Common/Objects/Graphic/TextureAtlas.h"
+#include "Renderer/Common/View.h"
+#include "Renderer/Renderer.h"
+#include "Services/Options.h"
+#include "Utils/Utils.h"
+
+using namespace Silent::Assets;
+using namespace Silent::Services;
+using namespace Silent::Utils;
+
+namespace Silent::Renderer
+{
+    /** @brief Projects a world space position to screen pixels.
+     *
+     * @param viewProjMat View-projection matrix.
+     * @param pos World space position.
+     * @param res Screen resolution.
+     * @param outPos Projected position in pixels.
+     * @return `true` if the position is in front of the camera, `false` otherwise.
+     */
+    static bool ProjectPosition(const glm::mat4& viewProjMat, const Vector3& pos, const Vector2i& res, Vector2& outPos)
+    {
+        auto clipPos = viewProjMat * glm::vec4(pos, 1.0f);
+        if (clipPos.w <= EPSILON)
+        {
+            return false;
+        }
+
+        auto ndcPos = glm::vec2(clipPos) / clipPos.w;
+        outPos      = Vector2(((ndcPos.x + 1.0f) * 0.5f) * res.x, ((1.0f - ndcPos.y) * 0.5f) * res.y);
+        return true;
+    }
+
+    /** @brief Adds a projected 3D line or triangle to a rasterizer. Primitives partially behind the camera are discarded.
+     *
+     * @param rasterizer Rasterizer to add to.
+     * @param viewProjMat View-projection matrix.
+     * @param res Screen resolution.
+     * @param positions World space line or triangle vertex positions.
+     * @param colors Vertex colors.
+     * @param blendMode Blend mode.
+     */
+    static void AddPrimitive3d(TileRasterizer& rasterizer, const glm::mat4& viewProjMat, const Vector2i& res,
+                               std::span<const Vector3> positions, std::span<const Vector4> colors, BlendMode blendMode)
+    {
+        auto verts = std::array<RasterVertex, TRIANGLE_VERTEX_COUNT>{};
+        for (int i = 0; i < positions.size(); i++)
+        {
+            if (!ProjectPosition(viewProjMat, positions[i], res, verts[i].Position))
+            {
+                return;
+            }
+            verts[i].Col = colors[i];
+        }
+
+        if (positions.size() == 2)
+        {
+            rasterizer.AddLine(verts[0], verts[1], blendMode);
+        }
+        else
+        {
+            rasterizer.AddTriangle(RasterTriangle{ .Vertices = verts, .BlendM = blendMode });
+        }
+    }
+
+    std::span<const uint> SoftwareRenderer::GetSurface() const
+    {
+        return _rasterizer.GetSurface();
+    }
+
+    const Vector2i& SoftwareRenderer::GetSurfaceResolution() const
+    {
+        return _rasterizer.GetResolution();
+    }
+
+    void SoftwareRenderer::Initialize(SDL_Window& window)
+    {
+        Debug::Log("Using software renderer.");
+
+        _type   = RendererType::Software;
+        _window = &window;
+
+        // Create ImGui context.
+        ImGui::CreateContext();
+        ImGui::GetIO().ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard | ImGuiConfigFlags_NavEnableGamepad;
+        ImGui_ImplSDL3_InitForOther(_window);
+
+        // Build font atlas.
+        unsigned char* fontPixels = nullptr;
+        int            fontWidth  = 0;
+        int            fontHeight = 0;
+        ImGui::GetIO().Fonts->GetTexDataAsRGBA32(&fontPixels, &fontWidth, &fontHeight);
+        _fontTexture = RasterTexture{ .Pixels = (const byte*)fontPixels, .Resolution = Vector2i(fontWidth, fontHeight) };
+    }
+
+    void SoftwareRenderer::Deinitialize()
+    {
+        _textureRefs.clear();
+        _fontTexture = {};
+
+        ImGui_ImplSDL3_Shutdown();
+        ImGui::DestroyContext();
+    }
+
+    void SoftwareRenderer::Update()
+    {
+        // Frame setup.
+        PrepareFrameData();
+        _rasterizer.Resize(GetScreenResolution());
+        _rasterizer.Clear(_clearColor);
+
+        // Collect frame triangles.
+        Draw3dScene();
+        Draw2dScene();
+        DrawPostProcess();
+        DrawDebugGui();
+
+        // Rasterize tiles in parallel, capture, and present.
+        _rasterizer.Flush();
+        _textureRefs.clear();
+        ProcessCaptures();
+        Present();
+
+        // Measure frame pacing.
+        const auto& snapshot = _snapshots.GetReadBuffer();
+        _framePacing.Record(snapshot.FrameId, snapshot.InputTime);
+
+        // Clear frame setup.
+        ClearFrameData();
+    }
+
+    void SoftwareRenderer::Draw3dScene()
+    {
+        const auto& snapshot = _snapshots.GetReadBuffer();
+
+        auto  res         = _rasterizer.GetResolution();
+        float aspect      = (float)res.x / (float)std::max(res.y, 1);
+        auto  viewProjMat = glm::mat4(_view.GetMatrix(glm::radians(45.0f), aspect, 0.1f, 100.0f));
+
+        // 3D primitives in sorted order.
+        auto positions = std::array<Vector3, TRIANGLE_VERTEX_COUNT>{};
+        auto colors    = std::array<Vector4, TRIANGLE_VERTEX_COUNT>{};
+        for (const auto& key : _sortKeys3d)
+        {
+            const auto& prims = (key.GetLayer() == DrawLayer::Debug3d) ? snapshot.DebugPrimitives3d : snapshot.Primitives3d;
+            const auto& prim  = prims[key.GetItemIdx()];
+            if (prim.Vertices.size() < 2 || prim.Vertices.size() > TRIANGLE_VERTEX_COUNT)
+            {
+                continue;
+            }
+
+            for (int i = 0; i < prim.Vertices.size(); i++)
+            {
+                positions[i] = prim.Vertices[i].Position;
+                colors[i]    = prim.Vertices[i].Col.ToVector4();
+            }
+            AddPrimitive3d(_rasterizer, viewProjMat, res, std::span(positions.data(), prim.Vertices.size()), std::span(colors.data(), prim.Vertices.size()), prim.BlendM);
+        }
+        if (!_sortKeys3d.empty())
+        {
+            _drawCallCount++;
+        }
+
+        // Debug shapes expanded from unit meshes per instance.
+        auto meshVerts = DebugShapeBatcher::GetMeshVertices();
+        auto instances = _debugShapeBatcher.GetInstances();
+        for (const auto& draw : _debugShapeBatcher.GetDraws())
+        {
+            uint vertStride = draw.IsWireframe ? 2 : TRIANGLE_VERTEX_COUNT;
+            for (int i = draw.InstanceStart; i < (draw.InstanceStart + draw.InstanceCount); i++)
+            {
+                const auto& instance = instances[i];
+                auto        mat      = viewProjMat * glm::mat4(instance.Transform);
+                colors.fill(instance.Col.ToVector4());
+
+                for (int j = draw.VertexStart; (j + vertStride) <= (draw.VertexStart + draw.VertexCount); j += vertStride)
+                {
+                    AddPrimitive3d(_rasterizer, mat, res, meshVerts.subspan(j, vertStride), std::span(colors.data(), vertStride), BlendMode::Add);
+                }
+            }
+            _drawCallCount++;
+        }
+    }
+
+    void SoftwareRenderer::Draw2dScene()
+    {
+        auto res      = _rasterizer.GetResolution();
+        auto vertices = _batcher2d.GetVertices();
+        auto indices  = _batcher2d.GetIndices();
+
+        // Convert batched NDC vertices to pixels.
+        auto toRasterVertex = [&](uint16 idx)
+        {
+            const auto& vert = vertices[idx];
+            return RasterVertex
+            {
+                .Position = Vector2(((vert.Position.x + 1.0f) * 0.5f) * res.x, ((1.0f - vert.Position.y) * 0.5f) * res.y),
+                .Col      = vert.Col.ToVector4(),
+                .Uv       = vert.Uv
+            };
+        };
+
+        for (const auto& batch : _batcher2d.GetBatches())
+        {
+            if (batch.IndexCount == 0)
+            {
+                continue;
+            }
+
+            // Get texture.
+            auto tex = RasterTexture{};
+            if (batch.Stage == RenderStage::Primitive2dTextured)
+            {
+                tex = GetTexture(batch.TextureIdx);
+                if (tex.Pixels == nullptr)
+                {
+                    continue;
+                }
+            }
+
+            for (int i = batch.IndexStart; (i + TRIANGLE_VERTEX_COUNT) <= (batch.IndexStart + batch.IndexCount); i += TRIANGLE_VERTEX_COUNT)
+            {
+                _rasterizer.AddTriangle(RasterTriangle
+                {
+                    .Vertices = { toRasterVertex(indices[i]), toRasterVertex(indices[i + 1]), toRasterVertex(indices[i + 2]) },
+                    .BlendM   = batch.BlendM,
+                    .Texture  = tex
+                });
+            }
+            _drawCallCount++;
+        }
+    }
+
+    void SoftwareRenderer::DrawPostProcess()
+    {
+        const auto& options = g_App.GetOptions();
+
+        // Rasterize the scene so effects apply to it but not to the debug GUI added after.
+        _rasterizer.Flush();
+        _rasterizer.ApplyPostProcess(RasterPostProcess
+        {
+            .EnableDithering = options->EnableDithering,
+            .EnableVignette  = options->EnableVignette,
+            .EnableCrtFilter = options->EnableCrtFilter
+        });
+    }
+
+    void SoftwareRenderer::DrawDebugGui()
+    {
+        // If debug GUI is disabled, return early.
+        const auto& options = g_App.GetOptions();
+        if (!options->EnableDebugGui)
+        {
+            return;
+        }
+
+        // Start new frame.
+        ImGui_ImplSDL3_NewFrame();
+        ImGui::NewFrame();
+
+        // Draw GUIs.
+        const auto& snapshot = _snapshots.GetReadBuffer();
+        for (const auto& drawCall : snapshot.DebugGuiDrawCalls)
+        {
+            drawCall();
+        }
+
+        // Prepare render data.
+        ImGui::Render();
+        const auto* drawData = ImGui::GetDrawData();
+
+        // Convert draw lists to clipped triangles. Debug GUIs only sample the font atlas.
+        for (int i = 0; i < drawData->CmdListsCount; i++)
+        {
+            const auto* drawList = drawData->CmdLists[i];
+            for (const auto& cmd : drawList->CmdBuffer)
+            {
+                if (cmd.UserCallback != nullptr)
+                {
+                    continue;
+                }
+
+                auto clipRect = Vector4(cmd.ClipRect.x - drawData->DisplayPos.x, cmd.ClipRect.y - drawData->DisplayPos.y,
+                                        cmd.ClipRect.z - drawData->DisplayPos.x, cmd.ClipRect.w - drawData->DisplayPos.y);
+                for (int j = 0; (j + TRIANGLE_VERTEX_COUNT) <= cmd.ElemCount; j += TRIANGLE_VERTEX_COUNT)
+                {
+                    auto tri = RasterTriangle{ .BlendM = BlendMode::Alpha, .Texture = _fontTexture, .ClipRect = clipRect };
+                    for (int k = 0; k < TRIANGLE_VERTEX_COUNT; k++)
+                    {
+                        const auto& vert = drawList->VtxBuffer[drawList->IdxBuffer[cmd.IdxOffset + j + k] + cmd.VtxOffset];
+                        auto        col  = ImGui::ColorConvertU32ToFloat4(vert.col);
+                        tri.Vertices[k]  = RasterVertex
+                        {
+                            .Position = Vector2(vert.pos.x - drawData->DisplayPos.x, vert.pos.y - drawData->DisplayPos.y),
+                            .Col      = Vector4(col.x, col.y, col.z, col.w),
+                            .Uv       = Vector2(vert.uv.x, vert.uv.y)
+                        };
+                    }
+                    _rasterizer.AddTriangle(tri);
+                }
+                _drawCallCount++;
+            }
+        }
+    }
+
+    bool SoftwareRenderer::CopyFramePixels(std::unique_ptr<CaptureFrame>& frame)
+    {
+        auto pixels = _rasterizer.GetSurface();
+        if (pixels.empty())
+        {
+            return false;
+        }
+
+        frame->Resolution = _rasterizer.GetResolution();
+        frame->Pixels.resize(pixels.size_bytes());
+        std::memcpy(frame->Pixels.data(), pixels.data(), pixels.size_bytes());
+        return true;
+    }
+
+    void SoftwareRenderer::Present()
+    {
+        const auto& res = _rasterizer.GetResolution();
+        if (_window == nullptr || res.x <= 0 || res.y <= 0)
+        {
+            return;
+        }
+
+        // Get window surface.
+        auto* windowSurface = SDL_GetWindowSurface(_window);
+        if (windowSurface == nullptr)
+        {
+            Debug::Log(Fmt("Failed to get window surface: {}", SDL_GetError()), Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return;
+        }
+
+        // Wrap frame surface without copying and blit it.
+        auto* frameSurface = SDL_CreateSurfaceFrom(res.x, res.y, SDL_PIXELFORMAT_RGBA32, (void*)_rasterizer.GetSurface().data(), res.x * sizeof(uint));
+        if (frameSurface == nullptr)
+        {
+            Debug::Log(Fmt("Failed to create frame surface: {}", SDL_GetError()), Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return;
+        }
+
+        if (!SDL_BlitSurfaceScaled(frameSurface, nullptr, windowSurface, nullptr, SDL_SCALEMODE_NEAREST))
+        {
+            Debug::Log(Fmt("Failed to blit frame surface: {}", SDL_GetError()), Debug::LogLevel::Warning, Debug::LogMode::Debug);
+        }
+        SDL_DestroySurface(frameSurface);
+
+        SDL_UpdateWindowSurface(_window);
+    }
+
+    RasterTexture SoftwareRenderer::GetTexture(int assetIdx)
+    {
+        // Get atlas page.
+        if (TextureAtlas::IsPageTextureIdx(assetIdx))
+        {
+            auto pages   = _textureAtlas.GetPages();
+            int  pageIdx = assetIdx - TextureAtlas::PAGE_TEXTURE_IDX_BASE;
+            if (pageIdx >= pages.size())
+            {
+                return RasterTexture{};
+            }
+
+            return RasterTexture{ .Pixels = pages[pageIdx].Pixels.data(), .Resolution = Vector2i(TextureAtlas::PAGE_SIZE) };
+        }
+
+        // Get referenced texture.
+        auto* data = Find(_textureRefs, assetIdx);
+        if (data == nullptr)
+        {
+            // Check if asset is loaded.
+            auto&      assets = g_App.GetAssets();
+            const auto asset  = assets.GetAsset(assetIdx);
+            if (asset == nullptr || asset->State != AssetState::Loaded || asset->Type != AssetType::Tim)
+            {
+                return RasterTexture{};
+            }
+
+            // Keep asset data alive until the frame is rasterized.
+            data = &(_textureRefs[assetIdx] = asset->GetData<TimAsset>());
+        }
+
+        return RasterTexture{ .Pixels = (*data)->Pixels.data(), .Resolution = (*data)->Resolution };
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Assets/Parsers/Tim.h"
+#include "Renderer/Backends/Software/Rasterizer.h"
+#include "Renderer/Renderer.h"
+
+namespace Silent::Renderer
+{
+    /** @brief CPU renderer backend. Rasterizes the frame into an in-memory RGBA8 surface with a parallel tile rasterizer,
+     * then blits it to the window surface. Requires no GPU, and the surface can be inspected directly for benchmarks and golden image comparisons.
+     */
+    class SoftwareRenderer : public RendererBase
+    {
+    private:
+        // =======
+        // Fields
+        // =======
+
+        TileRasterizer _rasterizer  = TileRasterizer(); /** Tile rasterizer owning the frame surface. */
+        RasterTexture  _fontTexture = {};               /** ImGui font atlas. Pixels owned by ImGui. */
+
+        std::unordered_map<int, std::shared_ptr<const Assets::TimAsset>> _textureRefs = {}; /** Key = asset index, value = TIM data kept alive until the frame is rasterized. */
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs an uninitialized default `SoftwareRenderer`. */
+        SoftwareRenderer() = default;
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the last rendered frame. Each pixel is RGBA8 in byte order, rows are top to bottom.
+         *
+         * @return Frame surface pixels with the resolution of `GetSurfaceResolution`.
+         */
+        std::span<const uint> GetSurface() const;
+
+        /** @brief Gets the resolution of the last rendered frame.
+         *
+         * @return Frame surface resolution.
+         */
+        const Vector2i& GetSurfaceResolution() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        void Initialize(SDL_Window& window) override;
+        void Deinitialize() override;
+        void Update() override;
+
+    private:
+        // ========
+        // Helpers
+        // ========
+
+        void Draw3dScene() override;
+        void Draw2dScene() override;
+        void DrawPostProcess() override;
+        void DrawDebugGui() override;
+        bool CopyFramePixels(std::unique_ptr<CaptureFrame>& frame) override;
+
+        /** @brief Blits the frame surface to the window surface. */
+        void Present();
+
+        /** @brief Gets a TIM asset or texture atlas page as a rasterizer texture.
+         *
+         * @param assetIdx TIM asset index or texture atlas page texture index.
+         * @return Texture view, with null pixels if the asset is not loaded.
+         */
+        RasterTexture GetTexture(int assetIdx);
+    };
+}
@@ -0,0 +1,217 @@
+#include "Framework.h"
+#include "Renderer/Common/Capture.h"
+
+#include "Services/Filesystem.h"
+
+using namespace Silent::Services;
+
+namespace Silent::Renderer
+{
+    CaptureQueue::CaptureQueue()
+    {
+        _isStopping = false;
+        _thread     = std::jthread(&CaptureQueue::Worker, this);
+    }
+
+    CaptureQueue::~CaptureQueue()
+    {
+        // @lock Restrict shutdown flag access.
+        {
+            auto lock = std::lock_guard(_mutex);
+
+            _isStopping = true;
+        }
+
+        // Let worker drain pending frames, then join.
+        _cond.notify_all();
+        if (_thread.joinable())
+        {
+            _thread.join();
+        }
+    }
+
+    CaptureStats CaptureQueue::GetStats()
+    {
+        // @lock Restrict statistics access.
+        {
+            auto lock = std::lock_guard(_mutex);
+
+            auto stats         = _stats;
+            stats.PendingCount = (uint)_pendingFrames.size();
+            return stats;
+        }
+    }
+
+    std::unique_ptr<CaptureFrame> CaptureQueue::AcquireFrame()
+    {
+        // @lock Restrict pool access.
+        {
+            auto lock = std::lock_guard(_mutex);
+
+            // Reuse free buffer.
+            if (!_freeFrames.empty())
+            {
+                auto frame = std::move(_freeFrames.back());
+                _freeFrames.pop_back();
+                return frame;
+            }
+
+            // @heapalloc Grow pool up to its limit. Pixel capacity is retained across reuse.
+            if (_allocatedCount < POOL_SIZE_MAX)
+            {
+                _allocatedCount++;
+                return std::make_unique<CaptureFrame>();
+            }
+
+            // Coalesce by recycling oldest pending continuous frame.
+            auto it = std::find_if(_pendingFrames.begin(), _pendingFrames.end(), [](const auto& frame) { return frame->IsContinuous; });
+            if (it != _pendingFrames.end())
+            {
+                auto frame = std::move(*it);
+                _pendingFrames.erase(it);
+                _stats.CoalescedCount++;
+                return frame;
+            }
+
+            // Drop capture.
+            _stats.DroppedCount++;
+            return nullptr;
+        }
+    }
+
+    void CaptureQueue::Submit(std::unique_ptr<CaptureFrame> frame)
+    {
+        if (frame == nullptr)
+        {
+            return;
+        }
+
+        // @lock Restrict queue access.
+        {
+            auto lock = std::lock_guard(_mutex);
+
+            _pendingFrames.push_back(std::move(frame));
+        }
+
+        _cond.notify_one();
+    }
+
+    void CaptureQueue::Release(std::unique_ptr<CaptureFrame> frame)
+    {
+        if (frame == nullptr)
+        {
+            return;
+        }
+
+        // @lock Restrict pool access.
+        {
+            auto lock = std::lock_guard(_mutex);
+
+            _freeFrames.push_back(std::move(frame));
+        }
+    }
+
+    void CaptureQueue::Worker()
+    {
+        while (true)
+        {
+            auto frame = std::unique_ptr<CaptureFrame>();
+
+            // @lock Restrict queue access.
+            {
+                auto lock = std::unique_lock(_mutex);
+                _cond.wait(lock, [this]
+                {
+                    return _isStopping || !_pendingFrames.empty();
+                });
+
+                // Stopping and drained; return early.
+                if (_isStopping && _pendingFrames.empty())
+                {
+                    return;
+                }
+
+                frame = std::move(_pendingFrames.front());
+                _pendingFrames.pop_front();
+            }
+
+            // Encode outside lock.
+            bool isWritten = Write(*frame);
+
+            // @lock Restrict pool access.
+            {
+                auto lock = std::lock_guard(_mutex);
+
+                if (isWritten)
+                {
+                    _stats.SavedCount++;
+                }
+                else
+                {
+                    _stats.FailedCount++;
+                }
+                _freeFrames.push_back(std::move(frame));
+            }
+        }
+    }
+
+    bool CaptureQueue::Write(CaptureFrame& frame) const
+    {
+        constexpr uint COLOR_CHANNEL_COUNT = 4; // RGBA.
+
+        const auto& res = frame.Resolution;
+        if (res.x <= 0 || res.y <= 0 || frame.Pixels.size() < ((res.x * res.y) * COLOR_CHANNEL_COUNT))
+        {
+            return false;
+        }
+
+        // Flip rows vertically.
+        int rowSize = res.x * COLOR_CHANNEL_COUNT;
+        if (frame.IsBottomUp)
+        {
+            for (int y = 0; y < (res.y / 2); y++)
+            {
+                int oppositeY = (res.y - y) - 1;
+                std::swap_ranges(&frame.Pixels[y * rowSize], &frame.Pixels[(y * rowSize) + rowSize], &frame.Pixels[oppositeY * rowSize]);
+            }
+            frame.IsBottomUp = false;
+        }
+
+        // Swizzle to RGBA and force opaque alpha since backbuffer alpha is undefined.
+        for (int i = 0; i < (res.x * res.y) * COLOR_CHANNEL_COUNT; i += COLOR_CHANNEL_COUNT)
+        {
+            if (frame.IsBgra)
+            {
+                std::swap(frame.Pixels[i], frame.Pixels[i + 2]);
+            }
+            frame.Pixels[i + 3] = (byte)0xFF;
+        }
+        frame.IsBgra = false;
+
+        std::filesystem::create_directories(frame.Path.parent_path());
+
+        switch (frame.Format)
+        {
+            case CaptureFormat::Png:
+            {
+                auto path = frame.Path;
+                path     += PNG_FILE_EXT;
+                return stbi_write_png(path.string().c_str(), res.x, res.y, COLOR_CHANNEL_COUNT, frame.Pixels.data(), rowSize) != 0;
+            }
+            case CaptureFormat::Raw:
+            {
+                // Resolution is encoded in the filename since raw dumps have no header.
+                auto path = frame.Path;
+                path     += Fmt("_{}x{}{}", res.x, res.y, RAW_FILE_EXT);
+
+                auto file = std::ofstream(path, std::ios::binary | std::ios::trunc);
+                file.write(frame.Pixels.data(), (res.x * res.y) * COLOR_CHANNEL_COUNT);
+                return file.good();
+            }
+            default:
+            {
+                return false;
+            }
+        }
+    }
+}
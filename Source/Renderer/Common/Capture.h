@@ -0,0 +1,129 @@
+#pragma once
+
+namespace Silent::Renderer
+{
+    constexpr char CAPTURE_DIR_NAME_BASE[]   = "Capture_";
+    constexpr char CAPTURE_FRAME_NAME_BASE[] = "Frame_";
+    constexpr char RAW_FILE_EXT[]            = ".rgba";
+
+    /** @brief Capture file encodings. */
+    enum class CaptureFormat
+    {
+        Png, /** Compressed. Slow to encode. */
+        Raw  /** Uncompressed RGBA8 pixel dump. Fast to write, used to record gameplay. */
+    };
+
+    /** @brief Pooled frame capture buffer with its destination. */
+    struct CaptureFrame
+    {
+        std::vector<byte>     Pixels       = {};                 /** RGBA8 pixels. */
+        Vector2i              Resolution   = Vector2i::Zero;
+        std::filesystem::path Path         = {};                 /** Destination file path without extension. */
+        CaptureFormat         Format       = CaptureFormat::Png;
+        bool                  IsBottomUp   = false;              /** Rows are stored bottom to top and are flipped by the worker. */
+        bool                  IsBgra       = false;              /** Pixels are BGRA8 and are swizzled by the worker. */
+        bool                  IsContinuous = false;              /** Part of a continuous capture sequence and may be coalesced under pressure. */
+    };
+
+    /** @brief Capture pipeline statistics. */
+    struct CaptureStats
+    {
+        uint SavedCount     = 0;
+        uint FailedCount    = 0;
+        uint DroppedCount   = 0; /** Frames skipped because all buffers were in use. */
+        uint CoalescedCount = 0; /** Pending continuous frames replaced by newer frames. */
+        uint PendingCount   = 0;
+    };
+
+    /** @brief Bounded asynchronous frame capture queue.
+     * Renderers copy frame pixels into a pooled `CaptureFrame` on the render thread and submit it, then a dedicated worker thread
+     * encodes and writes it. A dedicated thread is used instead of the `ParallelExecutor` so that slow PNG encoding never
+     * occupies the workers that frame preparation waits on.
+     *
+     * Under pressure, the oldest pending continuous frame is recycled for the newest capture. If only screenshots are pending,
+     * the capture is dropped.
+     */
+    class CaptureQueue
+    {
+    public:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr uint QUEUE_SIZE_MAX = 4;
+        static constexpr uint POOL_SIZE_MAX  = QUEUE_SIZE_MAX + 1; // Pending frames plus the frame being encoded.
+
+    private:
+        // =======
+        // Fields
+        // =======
+
+        std::vector<std::unique_ptr<CaptureFrame>> _freeFrames     = {}; /** Recycled buffers. */
+        std::deque<std::unique_ptr<CaptureFrame>>  _pendingFrames  = {}; /** Frames waiting to be encoded in submission order. */
+        uint                                       _allocatedCount = 0;
+        CaptureStats                               _stats          = {};
+
+        std::jthread            _thread     = {};
+        std::mutex              _mutex      = {};
+        std::condition_variable _cond       = {};
+        bool                    _isStopping = false;
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs a `CaptureQueue` and starts its worker thread. */
+        CaptureQueue();
+
+        /** @brief Gracefully destroys the `CaptureQueue`, writing all pending frames before joining the worker thread. */
+        ~CaptureQueue();
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the capture pipeline statistics.
+         *
+         * @return Capture statistics.
+         */
+        CaptureStats GetStats();
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Acquires a frame buffer from the pool, recycling the oldest pending continuous frame if none are free.
+         *
+         * @return Frame buffer with retained pixel capacity, `nullptr` if the capture must be dropped.
+         */
+        std::unique_ptr<CaptureFrame> AcquireFrame();
+
+        /** @brief Queues a filled frame for encoding on the worker thread.
+         *
+         * @param frame Frame acquired with `AcquireFrame`.
+         */
+        void Submit(std::unique_ptr<CaptureFrame> frame);
+
+        /** @brief Returns an unused frame to the pool, e.g. if copying pixels failed.
+         *
+         * @param frame Frame acquired with `AcquireFrame`.
+         */
+        void Release(std::unique_ptr<CaptureFrame> frame);
+
+    private:
+        // ========
+        // Helpers
+        // ========
+
+        /** @brief Worker thread. Encodes and writes pending frames until stopped and drained. */
+        void Worker();
+
+        /** @brief Converts a frame to opaque top-to-bottom RGBA8 pixels, then encodes and writes it to disk.
+         *
+         * @param frame Frame to write.
+         * @return `true` if written, `false` otherwise.
+         */
+        bool Write(CaptureFrame& frame) const;
+    };
+}
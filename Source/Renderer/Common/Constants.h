@@ -6,7 +6,11 @@ namespace Silent::Renderer
     constexpr auto RETRO_SCREEN_SPACE_RES     = Vector2(320.0f, 240.0f);
     constexpr char SCREENSHOT_FILENAME_BASE[] = "Screenshot_";
 
-    constexpr uint PRIMITIVE_2D_COUNT_MAX = 256;
-    constexpr uint SPRITE_2D_COUNT_MAX    = 256;
-    constexpr uint PRIMITIVE_3D_COUNT_MAX = 256;
+    constexpr uint PRIMITIVE_2D_COUNT_MAX        = 256;
+    constexpr uint SPRITE_2D_COUNT_MAX           = 256;
+    constexpr uint PRIMITIVE_3D_COUNT_MAX        = 256;
+    constexpr uint DEBUG_PRIMITIVE_3D_COUNT_MAX  = 4096;
+    constexpr uint DEBUG_SHAPE_COUNT_MAX         = 1024;
+    constexpr uint DEBUG_GUI_DRAW_CALL_COUNT_MAX = 16;
+    constexpr uint FRAME_ARENA_SIZE              = 1024 * 1024; // 1 MiB per buffer.
 }
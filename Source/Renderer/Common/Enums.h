@@ -2,6 +2,15 @@
 
 namespace Silent::Renderer
 {
+    /** @brief Renderer backend types. */
+    enum class RendererType
+    {
+        OpenGl,
+        SdlGpu,
+        Software, /** CPU tile rasterizer. Requires no GPU. */
+        Null      /** Records a draw trace without drawing. Requires no GPU or visible window. */
+    };
+
     /** @brief Render stages representing pipelines or shader programs depending on the renderer backend. */
     enum class RenderStage
     {
@@ -9,6 +18,9 @@ namespace Silent::Renderer
 
         Primitive2d,
         Primitive2dTextured,
+        Primitive3d,
+        DebugShape3d,
+        DebugShape3dWireframe,
 
         /** Post-process */
 
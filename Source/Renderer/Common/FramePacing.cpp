@@ -0,0 +1,47 @@
+#include "Framework.h"
+#include "Renderer/Common/FramePacing.h"
+
+namespace Silent::Renderer
+{
+    const FramePacingStats& FramePacingMonitor::GetStats() const
+    {
+        return _stats;
+    }
+
+    void FramePacingMonitor::Record(uint64 frameId, TimeType inputTime)
+    {
+        auto now = std::chrono::steady_clock::now();
+
+        // Start first window.
+        if (_windowStart == TimeType{})
+        {
+            _windowStart = now;
+            _prevPresent = now;
+            _prevFrameId = frameId;
+            return;
+        }
+
+        // Accumulate interval, latency, and skipped snapshots.
+        auto interval = (uint)std::chrono::duration_cast<std::chrono::microseconds>(now - _prevPresent).count();
+        auto latency  = (inputTime != TimeType{}) ? (uint)std::chrono::duration_cast<std::chrono::microseconds>(now - inputTime).count() : 0;
+        _windowStats.FrameIntervalAvg += interval;
+        _windowStats.FrameIntervalMax  = std::max(_windowStats.FrameIntervalMax, interval);
+        _windowStats.LatencyAvg       += latency;
+        _windowStats.LatencyMax        = std::max(_windowStats.LatencyMax, latency);
+        _windowStats.DroppedCount     += (frameId > (_prevFrameId + 1)) ? (uint)(frameId - (_prevFrameId + 1)) : 0;
+        _windowStats.FrameCount++;
+        _prevPresent = now;
+        _prevFrameId = frameId;
+
+        // Close window.
+        if (std::chrono::duration_cast<std::chrono::microseconds>(now - _windowStart).count() >= WINDOW_DURATION)
+        {
+            _stats                   = _windowStats;
+            _stats.FrameIntervalAvg /= _windowStats.FrameCount;
+            _stats.LatencyAvg       /= _windowStats.FrameCount;
+
+            _windowStats = {};
+            _windowStart = now;
+        }
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+namespace Silent::Renderer
+{
+    /** @brief Frame pacing and latency statistics in microseconds, aggregated over a sampling window. */
+    struct FramePacingStats
+    {
+        uint FrameIntervalAvg = 0; /** Average interval between submitted frames. */
+        uint FrameIntervalMax = 0; /** Longest interval between submitted frames. */
+        uint LatencyAvg       = 0; /** Average latency from input poll to frame submission. */
+        uint LatencyMax       = 0; /** Longest latency from input poll to frame submission. */
+        uint DroppedCount     = 0; /** Published snapshots overwritten before being rendered. */
+        uint FrameCount       = 0; /** Frames submitted. */
+    };
+
+    /** @brief Measures frame pacing and input-to-submission latency on the render worker.
+     *
+     * @note Frames are timed when the backend hands them to the driver, after the buffer swap or command buffer submission.
+     * GPU execution, compositor queuing, and scanout are not included, so this is a lower bound of input-to-photon latency.
+     */
+    class FramePacingMonitor
+    {
+    public:
+        using TimeType = std::chrono::steady_clock::time_point;
+
+    private:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr uint WINDOW_DURATION = 1000000; /** Sampling window in microseconds. */
+
+        // =======
+        // Fields
+        // =======
+
+        FramePacingStats _stats       = {}; /** Statistics of the previous complete window. */
+        FramePacingStats _windowStats = {}; /** Running statistics of the active window. Averages hold sums. */
+        TimeType         _windowStart = {};
+        TimeType         _prevPresent = {};
+        uint64           _prevFrameId = 0;
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs an empty default `FramePacingMonitor`. */
+        FramePacingMonitor() = default;
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the statistics of the previous complete sampling window.
+         *
+         * @return Frame pacing statistics.
+         */
+        const FramePacingStats& GetStats() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Records a submitted frame.
+         *
+         * @param frameId Publish counter of the rendered snapshot.
+         * @param inputTime Input poll time of the rendered snapshot.
+         */
+        void Record(uint64 frameId, TimeType inputTime);
+    };
+}
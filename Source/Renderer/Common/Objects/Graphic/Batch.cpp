@@ -0,0 +1,222 @@
+#include "Framework.h"
+#include "Renderer/Common/Objects/Graphic/Batch.h"
+
+#include "Assets/Parsers/Tim.h"
+#include "Renderer/Common/Constants.h"
+#include "Renderer/Common/Enums.h"
+#include "Renderer/Common/Objects/Graphic/Bucket.h"
+#include "Renderer/Common/Objects/Graphic/TextureAtlas.h"
+#include "Renderer/Common/Objects/Primitive2d.h"
+#include "Renderer/Common/Objects/Scene/Sprite2d.h"
+#include "Renderer/Common/Utils.h"
+
+namespace Silent::Renderer
+{
+    /** @brief Gets the sprite pivot in normalized sprite space for an align mode.
+     *
+     * @param alignMode Align mode.
+     * @return Pivot with components in the range `[0.0f, 1.0f]`.
+     */
+    static Vector2 GetAlignPivot(AlignMode alignMode)
+    {
+        switch (alignMode)
+        {
+            default:
+            case AlignMode::Center:       return Vector2(0.5f, 0.5f);
+            case AlignMode::CenterTop:    return Vector2(0.5f, 0.0f);
+            case AlignMode::CenterBottom: return Vector2(0.5f, 1.0f);
+            case AlignMode::CenterLeft:   return Vector2(0.0f, 0.5f);
+            case AlignMode::CenterRight:  return Vector2(1.0f, 0.5f);
+            case AlignMode::TopLeft:      return Vector2(0.0f, 0.0f);
+            case AlignMode::TopRight:     return Vector2(1.0f, 0.0f);
+            case AlignMode::BottomLeft:   return Vector2(0.0f, 1.0f);
+            case AlignMode::BottomRight:  return Vector2(1.0f, 1.0f);
+        }
+    }
+
+    std::span<const BatchVertex> Batcher::GetVertices() const
+    {
+        return _vertices;
+    }
+
+    std::span<const uint16> Batcher::GetIndices() const
+    {
+        return _indices;
+    }
+
+    std::span<const Batch> Batcher::GetBatches() const
+    {
+        return _batches;
+    }
+
+    void Batcher::Clear()
+    {
+        _vertices.clear();
+        _indices.clear();
+        _batches.clear();
+    }
+
+    void Batcher::Build(std::span<const SortKey> keys, std::span<const Primitive2dRecord> prims, std::span<const Sprite2d> sprites, const TextureAtlas& atlas)
+    {
+        Clear();
+
+        for (const auto& key : keys)
+        {
+            uint itemIdx = key.GetItemIdx();
+            switch (key.GetStage())
+            {
+                case RenderStage::Primitive2d:
+                {
+                    Debug::Assert(itemIdx < prims.size(), "Batch key references invalid 2D primitive.");
+                    AddPrimitive(prims[itemIdx]);
+                    break;
+                }
+                case RenderStage::Primitive2dTextured:
+                {
+                    Debug::Assert(itemIdx < sprites.size(), "Batch key references invalid 2D sprite.");
+                    AddSprite(sprites[itemIdx], atlas);
+                    break;
+                }
+                default:
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    Batch& Batcher::GetCompatibleBatch(RenderStage stage, BlendMode blendMode, ScaleMode scaleMode, int texIdx)
+    {
+        // Continue active batch if state matches.
+        if (!_batches.empty())
+        {
+            auto& batch = _batches.back();
+            if (batch.Stage == stage && batch.BlendM == blendMode && batch.ScaleM == scaleMode && batch.TextureIdx == texIdx)
+            {
+                return batch;
+            }
+        }
+
+        // Start new batch.
+        _batches.push_back(Batch
+        {
+            .Stage      = stage,
+            .BlendM     = blendMode,
+            .ScaleM     = scaleMode,
+            .TextureIdx = texIdx,
+            .IndexStart = (uint)_indices.size()
+        });
+        return _batches.back();
+    }
+
+    void Batcher::AddPrimitive(const Primitive2dRecord& prim)
+    {
+        if (prim.Vertices.size() != TRIANGLE_VERTEX_COUNT && prim.Vertices.size() != QUAD_VERTEX_COUNT)
+        {
+            return;
+        }
+
+        if ((_vertices.size() + prim.Vertices.size()) > VERTEX_COUNT_MAX)
+        {
+            Debug::Log("Attempted to batch 2D primitive into full vertex buffer.", Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return;
+        }
+
+        auto& batch = GetCompatibleBatch(RenderStage::Primitive2d, prim.BlendM, prim.ScaleM, NO_VALUE);
+
+        // Add vertices.
+        auto  baseIdx = (uint16)_vertices.size();
+        float depth   = std::clamp((float)prim.Depth / (float)DEPTH_MAX, 0.0f, 1.0f);
+        for (const auto& vert : prim.Vertices)
+        {
+            auto ndc = ConvertScreenPositionToNdc(vert.Position);
+            _vertices.push_back(BatchVertex
+            {
+                .Position = Vector3(ndc.x, ndc.y, depth),
+                .Col      = vert.Col,
+                .Uv       = vert.Uv
+            });
+        }
+
+        // Add indices.
+        // 2D triangle primitive.
+        if (prim.Vertices.size() == TRIANGLE_VERTEX_COUNT)
+        {
+            for (int i = 0; i < TRIANGLE_VERTEX_COUNT; i++)
+            {
+                _indices.push_back(baseIdx + i);
+            }
+            batch.IndexCount += TRIANGLE_VERTEX_COUNT;
+        }
+        // 2D line or quad primitive.
+        else
+        {
+            for (int i : QUAD_TRIANGLE_IDXS)
+            {
+                _indices.push_back(baseIdx + i);
+            }
+            batch.IndexCount += (uint)QUAD_TRIANGLE_IDXS.size();
+        }
+
+        batch.ItemCount++;
+    }
+
+    void Batcher::AddSprite(const Sprite2d& sprite, const TextureAtlas& atlas)
+    {
+        if ((_vertices.size() + QUAD_VERTEX_COUNT) > VERTEX_COUNT_MAX)
+        {
+            Debug::Log("Attempted to batch 2D sprite into full vertex buffer.", Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return;
+        }
+
+        // Get atlas page region if texture is atlased.
+        int         texIdx = atlas.GetTextureIdx(sprite.AssetIdx, sprite.UvMin, sprite.UvMax);
+        const auto* region = TextureAtlas::IsPageTextureIdx(texIdx) ? atlas.GetRegion(sprite.AssetIdx) : nullptr;
+
+        auto& batch = GetCompatibleBatch(RenderStage::Primitive2dTextured, sprite.BlendM, sprite.ScaleM, texIdx);
+
+        // Compute sprite size in screen percent from the UV region at retro resolution pixel scale.
+        auto texRes = (sprite.Texture != nullptr) ? sprite.Texture->Resolution : Vector2i::Zero;
+        auto uvRes  = (sprite.UvMax - sprite.UvMin) * texRes.ToVector2();
+        auto size   = ((uvRes / RETRO_SCREEN_SPACE_RES) * SCREEN_SPACE_RES) * sprite.Scale;
+        auto pivot  = GetAlignPivot(sprite.AlignM);
+
+        // Define corners in cyclic order: top-left, top-right, bottom-right, bottom-left.
+        const auto corners = std::array<Vector2, QUAD_VERTEX_COUNT>
+        {
+            Vector2(0.0f, 0.0f),
+            Vector2(1.0f, 0.0f),
+            Vector2(1.0f, 1.0f),
+            Vector2(0.0f, 1.0f)
+        };
+
+        // Add vertices.
+        auto  baseIdx = (uint16)_vertices.size();
+        float depth   = std::clamp((float)sprite.Depth / (float)DEPTH_MAX, 0.0f, 1.0f);
+        float sinRot  = glm::sin(sprite.Rotation);
+        float cosRot  = glm::cos(sprite.Rotation);
+        for (const auto& corner : corners)
+        {
+            auto offset = (corner - pivot) * size;
+            auto pos    = sprite.Position + Vector2((offset.x * cosRot) - (offset.y * sinRot),
+                                                    (offset.x * sinRot) + (offset.y * cosRot));
+            auto ndc    = ConvertScreenPositionToNdc(pos);
+            auto uv     = Vector2(std::lerp(sprite.UvMin.x, sprite.UvMax.x, corner.x),
+                                  std::lerp(sprite.UvMin.y, sprite.UvMax.y, corner.y));
+            _vertices.push_back(BatchVertex
+            {
+                .Position = Vector3(ndc.x, ndc.y, depth),
+                .Col      = sprite.Col,
+                .Uv       = (region != nullptr) ? TextureAtlas::RemapUv(*region, uv) : uv
+            });
+        }
+
+        // Add indices.
+        for (int i : QUAD_TRIANGLE_IDXS)
+        {
+            _indices.push_back(baseIdx + i);
+        }
+        batch.IndexCount += (uint)QUAD_TRIANGLE_IDXS.size();
+        batch.ItemCount++;
+    }
+}
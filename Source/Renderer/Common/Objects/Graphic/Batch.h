@@ -0,0 +1,127 @@
+#pragma once
+
+#include "Renderer/Common/Enums.h"
+#include "Renderer/Common/Objects/Graphic/Bucket.h"
+
+namespace Silent::Renderer
+{
+    struct Primitive2dRecord;
+    struct Sprite2d;
+    class TextureAtlas;
+
+    /** @brief Batched 2D vertex in normalized device coordinates. Shared by untextured and textured 2D pipelines. */
+    struct BatchVertex
+    {
+        Vector3 Position = Vector3::Zero;
+        Color   Col      = Color::Clear;
+        Vector2 Uv       = Vector2::Zero;
+    };
+
+    /** @brief Range of batched 2D vertices and indices drawable with a single indexed draw call. */
+    struct Batch
+    {
+        RenderStage Stage      = RenderStage::Primitive2d;
+        BlendMode   BlendM     = BlendMode::Opaque;
+        ScaleMode   ScaleM     = ScaleMode::Fit;
+        int         TextureIdx = NO_VALUE;
+        uint        IndexStart = 0;
+        uint        IndexCount = 0;
+        uint        ItemCount  = 0; /** Number of primitives and sprites merged into the batch. */
+    };
+
+    /** @brief Merges consecutive sorted 2D primitives and sprites with compatible state into shared vertex and index ranges.
+     * Has no GPU dependencies, so the emitted batch list can be inspected headlessly.
+     */
+    class Batcher
+    {
+    public:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr uint VERTEX_COUNT_MAX = std::numeric_limits<uint16>::max();
+
+    private:
+        // =======
+        // Fields
+        // =======
+
+        std::vector<BatchVertex> _vertices = {};
+        std::vector<uint16>      _indices  = {};
+        std::vector<Batch>       _batches  = {};
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs an empty default `Batcher`. */
+        Batcher() = default;
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the batched vertices.
+         *
+         * @return Batched vertices.
+         */
+        std::span<const BatchVertex> GetVertices() const;
+
+        /** @brief Gets the batched 16-bit vertex indices.
+         *
+         * @return Batched indices.
+         */
+        std::span<const uint16> GetIndices() const;
+
+        /** @brief Gets the emitted batches in draw order.
+         *
+         * @return Batches.
+         */
+        std::span<const Batch> GetBatches() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Clears all batches while retaining allocated memory. */
+        void Clear();
+
+        /** @brief Builds batches from sorted 2D keys. Previous batches are cleared.
+         *
+         * @param keys Sorted 2D keys referencing `prims` and `sprites`.
+         * @param prims 2D primitives.
+         * @param sprites 2D sprites.
+         * @param atlas Texture atlas. Sprites of atlased textures are batched by atlas page with remapped UVs.
+         */
+        void Build(std::span<const SortKey> keys, std::span<const Primitive2dRecord> prims, std::span<const Sprite2d> sprites, const TextureAtlas& atlas);
+
+    private:
+        // ========
+        // Helpers
+        // ========
+
+        /** @brief Gets the active batch if compatible with the given state, otherwise starts a new one.
+         *
+         * @param stage Render stage.
+         * @param blendMode Blend mode.
+         * @param scaleMode Scale mode.
+         * @param texIdx Texture asset index, atlas page texture index, or `NO_VALUE` if untextured.
+         * @return Compatible batch.
+         */
+        Batch& GetCompatibleBatch(RenderStage stage, BlendMode blendMode, ScaleMode scaleMode, int texIdx);
+
+        /** @brief Appends a 2D primitive's vertices and indices to the active batch.
+         *
+         * @param prim 2D primitive record.
+         */
+        void AddPrimitive(const Primitive2dRecord& prim);
+
+        /** @brief Appends a 2D sprite quad's vertices and indices to the active batch.
+         *
+         * @param sprite 2D sprite. Sized by its resolved texture resolution.
+         * @param atlas Texture atlas used to remap UVs of atlased textures.
+         */
+        void AddSprite(const Sprite2d& sprite, const TextureAtlas& atlas);
+    };
+}
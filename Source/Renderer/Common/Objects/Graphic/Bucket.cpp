@@ -0,0 +1,179 @@
+#include "Framework.h"
+#include "Renderer/Common/Objects/Graphic/Bucket.h"
+
+#include "Renderer/Common/Enums.h"
+#include "Renderer/Common/Objects/Primitive2d.h"
+
+namespace Silent::Renderer
+{
+    template <uint TBitCount>
+    static constexpr uint64 GetBitMask()
+    {
+        return ((uint64)1 << TBitCount) - 1;
+    }
+
+    SortKey SortKey::Create(DrawLayer layer, uint depth, RenderStage stage, BlendMode blendMode, int texIdx, uint itemIdx)
+    {
+        // Invert depth so that higher values are drawn first.
+        uint invDepth = DEPTH_MAX - std::min(depth, DEPTH_MAX);
+
+        // Reserve 0 for untextured items.
+        uint tex = (texIdx == NO_VALUE) ? 0 : ((uint)texIdx + 1);
+
+        Debug::Assert(itemIdx <= GetBitMask<ITEM_IDX_BIT_COUNT>(), "Sort key item index out of range.");
+        Debug::Assert(tex     <= GetBitMask<TEXTURE_BIT_COUNT>(),  "Sort key texture index out of range.");
+
+        auto key  = SortKey{};
+        key.Value = (((uint64)layer     & GetBitMask<LAYER_BIT_COUNT>())    << LAYER_SHIFT)   |
+                    (((uint64)invDepth  & GetBitMask<DEPTH_BIT_COUNT>())    << DEPTH_SHIFT)   |
+                    (((uint64)stage     & GetBitMask<STAGE_BIT_COUNT>())    << STAGE_SHIFT)   |
+                    (((uint64)blendMode & GetBitMask<BLEND_BIT_COUNT>())    << BLEND_SHIFT)   |
+                    (((uint64)tex       & GetBitMask<TEXTURE_BIT_COUNT>())  << TEXTURE_SHIFT) |
+                    (((uint64)itemIdx   & GetBitMask<ITEM_IDX_BIT_COUNT>()) << ITEM_IDX_SHIFT);
+        return key;
+    }
+
+    DrawLayer SortKey::GetLayer() const
+    {
+        return (DrawLayer)((Value >> LAYER_SHIFT) & GetBitMask<LAYER_BIT_COUNT>());
+    }
+
+    uint SortKey::GetDepth() const
+    {
+        return DEPTH_MAX - (uint)((Value >> DEPTH_SHIFT) & GetBitMask<DEPTH_BIT_COUNT>());
+    }
+
+    RenderStage SortKey::GetStage() const
+    {
+        return (RenderStage)((Value >> STAGE_SHIFT) & GetBitMask<STAGE_BIT_COUNT>());
+    }
+
+    BlendMode SortKey::GetBlendMode() const
+    {
+        return (BlendMode)((Value >> BLEND_SHIFT) & GetBitMask<BLEND_BIT_COUNT>());
+    }
+
+    int SortKey::GetTextureIdx() const
+    {
+        uint tex = (uint)((Value >> TEXTURE_SHIFT) & GetBitMask<TEXTURE_BIT_COUNT>());
+        return (tex == 0) ? NO_VALUE : ((int)tex - 1);
+    }
+
+    uint SortKey::GetItemIdx() const
+    {
+        return (uint)((Value >> ITEM_IDX_SHIFT) & GetBitMask<ITEM_IDX_BIT_COUNT>());
+    }
+
+    uint64 SortKey::GetStateBits() const
+    {
+        return Value & STATE_MASK;
+    }
+
+    int BucketStats::GetSavedStateChangeCount() const
+    {
+        return (int)UnsortedStateChangeCount - (int)StateChangeCount;
+    }
+
+    void RadixSort(std::vector<SortKey>& keys, std::vector<SortKey>& scratch)
+    {
+        constexpr uint RADIX_BIT_COUNT = 8;
+        constexpr uint RADIX_COUNT     = 1 << RADIX_BIT_COUNT;
+        constexpr uint PASS_COUNT      = (sizeof(uint64) * 8) / RADIX_BIT_COUNT;
+
+        // Item index bits below the first full byte already increase with submission order, so the stable sort preserves it.
+        constexpr uint PASS_START = SortKey::ITEM_IDX_BIT_COUNT / RADIX_BIT_COUNT;
+
+        if (keys.size() <= 1)
+        {
+            return;
+        }
+
+        scratch.resize(keys.size());
+
+        auto* src = &keys;
+        auto* dst = &scratch;
+        for (int pass = PASS_START; pass < PASS_COUNT; pass++)
+        {
+            uint shift = pass * RADIX_BIT_COUNT;
+
+            // Build histogram.
+            auto counts = std::array<uint, RADIX_COUNT>{};
+            for (const auto& key : *src)
+            {
+                counts[(key.Value >> shift) & (RADIX_COUNT - 1)]++;
+            }
+
+            // Skip pass if all keys share the same byte.
+            uint firstRadix = (src->front().Value >> shift) & (RADIX_COUNT - 1);
+            if (counts[firstRadix] == src->size())
+            {
+                continue;
+            }
+
+            // Compute prefix offsets.
+            uint offset = 0;
+            for (auto& count : counts)
+            {
+                uint prevCount = count;
+                count          = offset;
+                offset        += prevCount;
+            }
+
+            // Scatter.
+            for (const auto& key : *src)
+            {
+                (*dst)[counts[(key.Value >> shift) & (RADIX_COUNT - 1)]++] = key;
+            }
+
+            std::swap(src, dst);
+        }
+
+        // Ensure sorted result resides in output container.
+        if (src != &keys)
+        {
+            keys.swap(scratch);
+        }
+    }
+
+    void BuildBuckets(std::span<const SortKey> keys, std::vector<Bucket>& buckets)
+    {
+        buckets.clear();
+
+        for (int i = 0; i < keys.size(); i++)
+        {
+            const auto& key = keys[i];
+
+            // Extend current bucket if state matches.
+            if (!buckets.empty() && keys[i - 1].GetStateBits() == key.GetStateBits())
+            {
+                buckets.back().Count++;
+                continue;
+            }
+
+            // Start new bucket.
+            buckets.push_back(Bucket
+            {
+                .Layer      = key.GetLayer(),
+                .Stage      = key.GetStage(),
+                .BlendM     = key.GetBlendMode(),
+                .TextureIdx = key.GetTextureIdx(),
+                .Start      = (uint)i,
+                .Count      = 1
+            });
+        }
+    }
+
+    uint GetStateChangeCount(std::span<const SortKey> keys)
+    {
+        uint count = 0;
+        for (int i = 0; i < keys.size(); i++)
+        {
+            if (i == 0 || keys[i - 1].GetStateBits() != keys[i].GetStateBits())
+            {
+                count++;
+            }
+        }
+
+        return count;
+    }
+}
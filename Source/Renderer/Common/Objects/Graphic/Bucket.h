@@ -1,9 +1,118 @@
 #pragma once
 
+#include "Renderer/Common/Enums.h"
+
 namespace Silent::Renderer
 {
+    /** @brief Draw layers. Lower layers are drawn first. */
+    enum class DrawLayer
+    {
+        Scene3d,
+        Debug3d,
+        Scene2d,
+        Debug2d,
+
+        Count
+    };
+
+    /** @brief Packed 64-bit draw item sort key.
+     *
+     * @note Bit layout from most to least significant:
+     * layer (4) | inverted depth (11) | render stage (8) | blend mode (4) | texture (16) | item index (21).
+     * Depth is inverted so that lower depth values sort last and take precedence.
+     */
+    struct SortKey
+    {
+        static constexpr uint LAYER_BIT_COUNT    = 4;
+        static constexpr uint DEPTH_BIT_COUNT    = 11;
+        static constexpr uint STAGE_BIT_COUNT    = 8;
+        static constexpr uint BLEND_BIT_COUNT    = 4;
+        static constexpr uint TEXTURE_BIT_COUNT  = 16;
+        static constexpr uint ITEM_IDX_BIT_COUNT = 21;
+
+        static constexpr uint ITEM_IDX_SHIFT = 0;
+        static constexpr uint TEXTURE_SHIFT  = ITEM_IDX_SHIFT + ITEM_IDX_BIT_COUNT;
+        static constexpr uint BLEND_SHIFT    = TEXTURE_SHIFT  + TEXTURE_BIT_COUNT;
+        static constexpr uint STAGE_SHIFT    = BLEND_SHIFT    + BLEND_BIT_COUNT;
+        static constexpr uint DEPTH_SHIFT    = STAGE_SHIFT    + STAGE_BIT_COUNT;
+        static constexpr uint LAYER_SHIFT    = DEPTH_SHIFT    + DEPTH_BIT_COUNT;
+
+        /** Mask of the bits representing GPU state (layer, render stage, blend mode, texture). */
+        static constexpr uint64 STATE_MASK = ((((uint64)1 << LAYER_BIT_COUNT) - 1) << LAYER_SHIFT) |
+                                             ((((uint64)1 << (STAGE_BIT_COUNT + BLEND_BIT_COUNT + TEXTURE_BIT_COUNT)) - 1) << TEXTURE_SHIFT);
+
+        uint64 Value = 0;
+
+        /** @brief Constructs a packed sort key.
+         *
+         * @param layer Draw layer.
+         * @param depth Draw priority clamped to `DEPTH_MAX`. Lower values take precedence.
+         * @param stage Render stage.
+         * @param blendMode Blend mode.
+         * @param texIdx Texture asset index, or `NO_VALUE` if untextured.
+         * @param itemIdx Index of the draw item in its submission container.
+         * @return Packed sort key.
+         */
+        static SortKey Create(DrawLayer layer, uint depth, RenderStage stage, BlendMode blendMode, int texIdx, uint itemIdx);
+
+        DrawLayer   GetLayer() const;
+        uint        GetDepth() const;
+        RenderStage GetStage() const;
+        BlendMode   GetBlendMode() const;
+        int         GetTextureIdx() const;
+        uint        GetItemIdx() const;
+
+        /** @brief Gets the key bits representing GPU state. Keys with equal state bits can share a draw call.
+         *
+         * @return Masked state bits.
+         */
+        uint64 GetStateBits() const;
+    };
+
+    /** @brief Contiguous run of sorted draw items sharing the same GPU state. */
     struct Bucket
     {
-        
+        DrawLayer   Layer      = DrawLayer::Scene2d;
+        RenderStage Stage      = RenderStage::Primitive2d;
+        BlendMode   BlendM     = BlendMode::Opaque;
+        int         TextureIdx = NO_VALUE;
+        uint        Start      = 0; /** Start index in the sorted key container. */
+        uint        Count      = 0; /** Sorted key count. */
+    };
+
+    /** @brief Per-frame bucketing statistics. */
+    struct BucketStats
+    {
+        uint ItemCount                = 0;
+        uint BucketCount              = 0;
+        uint StateChangeCount         = 0; /** State changes required in sorted order. */
+        uint UnsortedStateChangeCount = 0; /** State changes that would be required in submission order. */
+
+        /** @brief Gets the number of state changes saved by sorting.
+         *
+         * @return Saved state change count.
+         */
+        int GetSavedStateChangeCount() const;
     };
+
+    /** @brief Sorts keys in ascending order with a stable LSD radix sort. Passes over bytes shared by all keys are skipped.
+     *
+     * @param keys Keys to sort.
+     * @param scratch Scratch buffer reused across calls to avoid allocations.
+     */
+    void RadixSort(std::vector<SortKey>& keys, std::vector<SortKey>& scratch);
+
+    /** @brief Collects sorted keys into buckets of matching GPU state.
+     *
+     * @param keys Sorted keys.
+     * @param buckets Output buckets. Cleared before use.
+     */
+    void BuildBuckets(std::span<const SortKey> keys, std::vector<Bucket>& buckets);
+
+    /** @brief Counts GPU state changes required to draw keys in their current order.
+     *
+     * @param keys Keys to check.
+     * @return State change count.
+     */
+    uint GetStateChangeCount(std::span<const SortKey> keys);
 }
@@ -0,0 +1,339 @@
+#include "Framework.h"
+#include "Renderer/Common/Objects/Graphic/DebugShape.h"
+
+namespace Silent::Renderer
+{
+    constexpr uint CIRCLE_SEGMENT_COUNT = 24;
+    constexpr uint SPHERE_RING_COUNT    = 12;
+
+    /** @brief Unit mesh vertices of all debug shapes with per-mesh vertex ranges. */
+    struct DebugShapeMeshData
+    {
+        std::vector<Vector3>                                             Vertices = {};
+        std::array<std::pair<uint, uint>, DebugShapeBatcher::MESH_COUNT> Ranges   = {}; /** Vertex start and count per mesh. */
+    };
+
+    /** @brief Gets the unit mesh index of a debug shape variant.
+     *
+     * @param type Debug shape type.
+     * @param isWireframe Wireframe or solid variant.
+     * @return Unit mesh index.
+     */
+    static uint GetMeshIdx(DebugShapeType type, bool isWireframe)
+    {
+        return ((uint)type * 2) + (isWireframe ? 0 : 1);
+    }
+
+    /** @brief Gets a point on a unit circle in the XZ plane.
+     *
+     * @param segmentIdx Circle segment index.
+     * @param y Height of the circle.
+     * @return Circle point.
+     */
+    static Vector3 GetCirclePoint(uint segmentIdx, float y)
+    {
+        float theta = (((float)segmentIdx / CIRCLE_SEGMENT_COUNT) * 2.0f) * PI;
+        return Vector3(glm::cos(theta), y, glm::sin(theta));
+    }
+
+    static void AddLine(std::vector<Vector3>& verts, const Vector3& from, const Vector3& to)
+    {
+        verts.push_back(from);
+        verts.push_back(to);
+    }
+
+    static void AddTriangle(std::vector<Vector3>& verts, const Vector3& vert0, const Vector3& vert1, const Vector3& vert2)
+    {
+        verts.push_back(vert0);
+        verts.push_back(vert1);
+        verts.push_back(vert2);
+    }
+
+    static void AddQuad(std::vector<Vector3>& verts, const Vector3& vert0, const Vector3& vert1, const Vector3& vert2, const Vector3& vert3)
+    {
+        AddTriangle(verts, vert0, vert1, vert2);
+        AddTriangle(verts, vert0, vert2, vert3);
+    }
+
+    /** @brief Generates a unit debug shape mesh. Shapes span `[-1.0f, 1.0f]` on the X and Z axes. Cylinders, cones, and diamonds span
+     * `[-0.5f, 0.5f]` on the Y axis so that a Y scale equals their length.
+     *
+     * @param verts Vertices to append to.
+     * @param type Debug shape type.
+     * @param isWireframe Generate a line list if `true`, a triangle list otherwise.
+     */
+    static void GenerateMesh(std::vector<Vector3>& verts, DebugShapeType type, bool isWireframe)
+    {
+        switch (type)
+        {
+            case DebugShapeType::Target:
+            {
+                // Always lines.
+                AddLine(verts, Vector3(1.0f, 0.0f, 0.0f), Vector3(-1.0f, 0.0f, 0.0f));
+                AddLine(verts, Vector3(0.0f, 1.0f, 0.0f), Vector3(0.0f, -1.0f, 0.0f));
+                AddLine(verts, Vector3(0.0f, 0.0f, 1.0f), Vector3(0.0f, 0.0f, -1.0f));
+                break;
+            }
+            case DebugShapeType::Box:
+            {
+                // Corner bits select the positive extent on the X, Y, and Z axes.
+                auto corners = std::array<Vector3, 8>{};
+                for (int i = 0; i < corners.size(); i++)
+                {
+                    corners[i] = Vector3((i & (1 << 0)) ? 1.0f : -1.0f,
+                                         (i & (1 << 1)) ? 1.0f : -1.0f,
+                                         (i & (1 << 2)) ? 1.0f : -1.0f);
+                }
+
+                // Wireframe.
+                if (isWireframe)
+                {
+                    constexpr int EDGE_IDXS[][2] =
+                    {
+                        { 0, 1 }, { 2, 3 }, { 4, 5 }, { 6, 7 },
+                        { 0, 2 }, { 1, 3 }, { 4, 6 }, { 5, 7 },
+                        { 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 }
+                    };
+                    for (const auto& edge : EDGE_IDXS)
+                    {
+                        AddLine(verts, corners[edge[0]], corners[edge[1]]);
+                    }
+                }
+                // Solid.
+                else
+                {
+                    constexpr int FACE_IDXS[][4] =
+                    {
+                        { 0, 1, 3, 2 }, { 4, 5, 7, 6 },
+                        { 0, 1, 5, 4 }, { 2, 3, 7, 6 },
+                        { 0, 2, 6, 4 }, { 1, 3, 7, 5 }
+                    };
+                    for (const auto& face : FACE_IDXS)
+                    {
+                        AddQuad(verts, corners[face[0]], corners[face[1]], corners[face[2]], corners[face[3]]);
+                    }
+                }
+                break;
+            }
+            case DebugShapeType::Sphere:
+            {
+                // Wireframe.
+                if (isWireframe)
+                {
+                    // Draw circles in XZ, XY, and YZ planes.
+                    for (int i = 0; i < CIRCLE_SEGMENT_COUNT; i++)
+                    {
+                        auto point0 = GetCirclePoint(i,     0.0f);
+                        auto point1 = GetCirclePoint(i + 1, 0.0f);
+                        AddLine(verts, point0, point1);
+                        AddLine(verts, Vector3(point0.x, point0.z, 0.0f), Vector3(point1.x, point1.z, 0.0f));
+                        AddLine(verts, Vector3(0.0f, point0.x, point0.z), Vector3(0.0f, point1.x, point1.z));
+                    }
+                }
+                // Solid.
+                else
+                {
+                    auto getPoint = [](int ringIdx, int segmentIdx)
+                    {
+                        float phi   = ((float)ringIdx / SPHERE_RING_COUNT) * PI;
+                        auto  point = GetCirclePoint(segmentIdx, 0.0f);
+                        return Vector3(point.x * glm::sin(phi), glm::cos(phi), point.z * glm::sin(phi));
+                    };
+
+                    for (int ring = 0; ring < SPHERE_RING_COUNT; ring++)
+                    {
+                        for (int i = 0; i < CIRCLE_SEGMENT_COUNT; i++)
+                        {
+                            AddQuad(verts, getPoint(ring, i), getPoint(ring, i + 1), getPoint(ring + 1, i + 1), getPoint(ring + 1, i));
+                        }
+                    }
+                }
+                break;
+            }
+            case DebugShapeType::Cylinder:
+            {
+                for (int i = 0; i < CIRCLE_SEGMENT_COUNT; i++)
+                {
+                    auto bottom0 = GetCirclePoint(i,     -0.5f);
+                    auto bottom1 = GetCirclePoint(i + 1, -0.5f);
+                    auto top0    = GetCirclePoint(i,      0.5f);
+                    auto top1    = GetCirclePoint(i + 1,  0.5f);
+
+                    // Wireframe.
+                    if (isWireframe)
+                    {
+                        AddLine(verts, bottom0, bottom1);
+                        AddLine(verts, top0, top1);
+                        if ((i % (CIRCLE_SEGMENT_COUNT / 4)) == 0)
+                        {
+                            AddLine(verts, bottom0, top0);
+                        }
+                    }
+                    // Solid.
+                    else
+                    {
+                        AddQuad(verts, bottom0, bottom1, top1, top0);
+                        AddTriangle(verts, Vector3(0.0f, -0.5f, 0.0f), bottom0, bottom1);
+                        AddTriangle(verts, Vector3(0.0f,  0.5f, 0.0f), top0, top1);
+                    }
+                }
+                break;
+            }
+            case DebugShapeType::Cone:
+            {
+                auto apex = Vector3(0.0f, 0.5f, 0.0f);
+                for (int i = 0; i < CIRCLE_SEGMENT_COUNT; i++)
+                {
+                    auto base0 = GetCirclePoint(i,     -0.5f);
+                    auto base1 = GetCirclePoint(i + 1, -0.5f);
+
+                    // Wireframe.
+                    if (isWireframe)
+                    {
+                        AddLine(verts, base0, base1);
+                        if ((i % (CIRCLE_SEGMENT_COUNT / 4)) == 0)
+                        {
+                            AddLine(verts, base0, apex);
+                        }
+                    }
+                    // Solid.
+                    else
+                    {
+                        AddTriangle(verts, apex, base0, base1);
+                        AddTriangle(verts, Vector3(0.0f, -0.5f, 0.0f), base0, base1);
+                    }
+                }
+                break;
+            }
+            case DebugShapeType::Diamond:
+            {
+                constexpr uint EQUATOR_POINT_COUNT = 4;
+
+                auto top    = Vector3(0.0f,  0.5f, 0.0f);
+                auto bottom = Vector3(0.0f, -0.5f, 0.0f);
+                for (int i = 0; i < EQUATOR_POINT_COUNT; i++)
+                {
+                    auto point0 = GetCirclePoint(i       * (CIRCLE_SEGMENT_COUNT / EQUATOR_POINT_COUNT), 0.0f);
+                    auto point1 = GetCirclePoint((i + 1) * (CIRCLE_SEGMENT_COUNT / EQUATOR_POINT_COUNT), 0.0f);
+
+                    // Wireframe.
+                    if (isWireframe)
+                    {
+                        AddLine(verts, point0, point1);
+                        AddLine(verts, point0, top);
+                        AddLine(verts, point0, bottom);
+                    }
+                    // Solid.
+                    else
+                    {
+                        AddTriangle(verts, top,    point0, point1);
+                        AddTriangle(verts, bottom, point0, point1);
+                    }
+                }
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+    }
+
+    /** @brief Gets the unit meshes of all debug shapes, generating them on first use.
+     *
+     * @return Unit mesh data.
+     */
+    static const DebugShapeMeshData& GetMeshData()
+    {
+        static const auto meshData = []()
+        {
+            auto data = DebugShapeMeshData{};
+            for (int i = 0; i < (int)DebugShapeType::Count; i++)
+            {
+                for (bool isWireframe : { true, false })
+                {
+                    uint start = (uint)data.Vertices.size();
+                    GenerateMesh(data.Vertices, (DebugShapeType)i, isWireframe);
+                    data.Ranges[GetMeshIdx((DebugShapeType)i, isWireframe)] = { start, (uint)data.Vertices.size() - start };
+                }
+            }
+
+            return data;
+        }();
+
+        return meshData;
+    }
+
+    Matrix DebugShapeInstance::CreateTransform(const Vector3& center, const Quaternion& rot, const Vector3& scale)
+    {
+        return Matrix::CreateTranslation(center) * rot.ToRotationMatrix() * Matrix::CreateScale(scale);
+    }
+
+    std::span<const Vector3> DebugShapeBatcher::GetMeshVertices()
+    {
+        return GetMeshData().Vertices;
+    }
+
+    std::span<const DebugShapeInstance> DebugShapeBatcher::GetInstances() const
+    {
+        return _instances;
+    }
+
+    std::span<const DebugShapeDraw> DebugShapeBatcher::GetDraws() const
+    {
+        return _draws;
+    }
+
+    void DebugShapeBatcher::Clear()
+    {
+        _instances.clear();
+        _draws.clear();
+    }
+
+    void DebugShapeBatcher::Build(std::span<const DebugShapeRecord> shapes)
+    {
+        const auto& meshData = GetMeshData();
+
+        Clear();
+
+        // Count instances per mesh.
+        auto counts = std::array<uint, MESH_COUNT>{};
+        for (const auto& shape : shapes)
+        {
+            counts[GetMeshIdx(shape.Type, shape.IsWireframe)]++;
+        }
+
+        // Compute instance offsets and emit one draw per used mesh.
+        auto offsets = std::array<uint, MESH_COUNT>{};
+        uint offset  = 0;
+        for (int i = 0; i < MESH_COUNT; i++)
+        {
+            offsets[i] = offset;
+            if (counts[i] == 0)
+            {
+                continue;
+            }
+
+            const auto& [vertStart, vertCount] = meshData.Ranges[i];
+            _draws.push_back(DebugShapeDraw
+            {
+                .Type          = (DebugShapeType)(i / 2),
+                .IsWireframe   = (i % 2) == 0,
+                .VertexStart   = vertStart,
+                .VertexCount   = vertCount,
+                .InstanceStart = offset,
+                .InstanceCount = counts[i]
+            });
+            offset += counts[i];
+        }
+
+        // Scatter instances in submission order.
+        _instances.resize(shapes.size());
+        for (const auto& shape : shapes)
+        {
+            uint& instanceIdx       = offsets[GetMeshIdx(shape.Type, shape.IsWireframe)];
+            _instances[instanceIdx] = shape.Instance;
+            instanceIdx++;
+        }
+    }
+}
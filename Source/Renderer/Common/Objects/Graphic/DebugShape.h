@@ -0,0 +1,117 @@
+#pragma once
+
+namespace Silent::Renderer
+{
+    /** @brief Debug shapes with shared unit meshes, drawn instanced. */
+    enum class DebugShapeType
+    {
+        Target,
+        Box,
+        Sphere,
+        Cylinder,
+        Cone,
+        Diamond,
+
+        Count
+    };
+
+    /** @brief Per-instance debug shape data. Transforms a unit mesh into world space. */
+    struct DebugShapeInstance
+    {
+        Matrix Transform = Matrix::Identity;
+        Color  Col       = Color::White;
+
+        /** @brief Creates a transform from unit mesh space into world space. Scale is applied first, then rotation and translation.
+         *
+         * @param center World-space center.
+         * @param rot Rotation in space.
+         * @param scale Unit mesh scale. Box extents, or radius on the X and Z axes and length on the Y axis.
+         * @return Instance transform.
+         */
+        static Matrix CreateTransform(const Vector3& center, const Quaternion& rot, const Vector3& scale);
+    };
+
+    /** @brief Renderer-side debug shape submission record. */
+    struct DebugShapeRecord
+    {
+        DebugShapeType     Type        = DebugShapeType::Box;
+        bool               IsWireframe = true;
+        DebugShapeInstance Instance    = {};
+    };
+
+    /** @brief Range of unit mesh vertices and shape instances drawable with a single instanced draw call. */
+    struct DebugShapeDraw
+    {
+        DebugShapeType Type          = DebugShapeType::Box;
+        bool           IsWireframe   = true;
+        uint           VertexStart   = 0;
+        uint           VertexCount   = 0;
+        uint           InstanceStart = 0;
+        uint           InstanceCount = 0;
+    };
+
+    /** @brief Groups debug shape submissions by unit mesh into a contiguous instance stream.
+     * Has no GPU dependencies, so the emitted instance stream and draw list can be inspected headlessly.
+     */
+    class DebugShapeBatcher
+    {
+    public:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr uint MESH_COUNT = (uint)DebugShapeType::Count * 2; // Wireframe and solid variants.
+
+    private:
+        // =======
+        // Fields
+        // =======
+
+        std::vector<DebugShapeInstance> _instances = {};
+        std::vector<DebugShapeDraw>     _draws     = {};
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs an empty default `DebugShapeBatcher`. */
+        DebugShapeBatcher() = default;
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the vertices of all unit meshes. Wireframe meshes are line lists, solid meshes are triangle lists.
+         * Generated once on first use.
+         *
+         * @return Unit mesh vertices referenced by draw vertex ranges.
+         */
+        static std::span<const Vector3> GetMeshVertices();
+
+        /** @brief Gets the instance stream grouped by unit mesh.
+         *
+         * @return Instances referenced by draw instance ranges.
+         */
+        std::span<const DebugShapeInstance> GetInstances() const;
+
+        /** @brief Gets the emitted instanced draws in unit mesh order.
+         *
+         * @return Instanced draws.
+         */
+        std::span<const DebugShapeDraw> GetDraws() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Clears all instances and draws while retaining allocated memory. */
+        void Clear();
+
+        /** @brief Builds the instance stream and draws from debug shape records with a stable counting sort. Previous data is cleared.
+         *
+         * @param shapes Debug shape records.
+         */
+        void Build(std::span<const DebugShapeRecord> shapes);
+    };
+}
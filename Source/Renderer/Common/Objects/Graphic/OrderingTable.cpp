@@ -0,0 +1,64 @@
+#include "Framework.h"
+#include "Renderer/Common/Objects/Graphic/OrderingTable.h"
+
+namespace Silent::Renderer
+{
+    OrderingTable::OrderingTable(uint length, uint packetCountMax)
+    {
+        // @heapalloc Allocate buckets and packet arena once.
+        _heads           = std::vector<uint>(length, NO_LINK);
+        _headGenerations = std::vector<uint>(length, 0);
+        _packetCountMax  = packetCountMax;
+        _packets.reserve(_packetCountMax);
+    }
+
+    uint OrderingTable::GetLength() const
+    {
+        return (uint)_heads.size();
+    }
+
+    uint OrderingTable::GetPacketCount() const
+    {
+        return (uint)_packets.size();
+    }
+
+    void OrderingTable::Clear()
+    {
+        _packets.clear();
+        _generation++;
+
+        // Reset stamps on wraparound so that stale buckets can't match.
+        if (_generation == 0)
+        {
+            std::fill(_headGenerations.begin(), _headGenerations.end(), 0);
+            _generation = 1;
+        }
+    }
+
+    bool OrderingTable::Insert(uint z, OtPacketType type, uint itemIdx)
+    {
+        if (_heads.empty() || _packets.size() >= _packetCountMax)
+        {
+            return false;
+        }
+
+        z = std::min(z, (uint)_heads.size() - 1);
+
+        // Start bucket if first written this generation.
+        if (_headGenerations[z] != _generation)
+        {
+            _heads[z]           = NO_LINK;
+            _headGenerations[z] = _generation;
+        }
+
+        // Prepend packet.
+        _packets.push_back(OtPacket
+        {
+            .Next    = _heads[z],
+            .Type    = type,
+            .ItemIdx = itemIdx
+        });
+        _heads[z] = (uint)_packets.size() - 1;
+        return true;
+    }
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+namespace Silent::Renderer
+{
+    /** @brief Ordering table packet types. */
+    enum class OtPacketType
+    {
+        Primitive2d,
+        Sprite2d,
+
+        Count
+    };
+
+    /** @brief Ordering table packet linking a submitted draw item into a Z bucket. */
+    struct OtPacket
+    {
+        uint         Next    = 0;                   /** Arena index of the next packet in the same bucket, or `OrderingTable::NO_LINK`. */
+        OtPacketType Type    = OtPacketType::Count;
+        uint         ItemIdx = 0;                   /** Index of the draw item in its submission container. */
+    };
+
+    /** @brief PSX-style ordering table. Fixed Z buckets hold singly linked lists of packets allocated from a fixed packet arena.
+     * Insertion prepends to a bucket in O(1) like `AddPrim`, and traversal walks buckets from the highest Z to the lowest,
+     * so items are emitted in the same order the original hardware draws them without sorting.
+     *
+     * @note Within a bucket, the last inserted packet is emitted first.
+     */
+    class OrderingTable
+    {
+    public:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr uint NO_LINK = std::numeric_limits<uint>::max();
+
+    private:
+        // =======
+        // Fields
+        // =======
+
+        std::vector<uint>     _heads           = {}; /** Index = Z, value = arena index of the first packet. Valid only if stamped with `_generation`. */
+        std::vector<uint>     _headGenerations = {}; /** Index = Z, value = generation in which the bucket was last written. */
+        std::vector<OtPacket> _packets         = {}; /** Packet arena. */
+        uint                  _packetCountMax  = 0;
+        uint                  _generation      = 1;  /** Advanced on clear so that stale buckets are skipped without touching them. */
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs an empty default `OrderingTable`. */
+        OrderingTable() = default;
+
+        /** @brief Constructs an `OrderingTable` and allocates its buckets and packet arena up front.
+         *
+         * @param length Z bucket count. Insertions beyond the last bucket are clamped into it.
+         * @param packetCountMax Packet arena capacity.
+         */
+        OrderingTable(uint length, uint packetCountMax);
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the Z bucket count.
+         *
+         * @return Ordering table length.
+         */
+        uint GetLength() const;
+
+        /** @brief Gets the number of packets inserted since the last clear.
+         *
+         * @return Packet count.
+         */
+        uint GetPacketCount() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Clears all buckets in O(1) like `GsClearOt`, retaining allocated memory. */
+        void Clear();
+
+        /** @brief Links a packet into a Z bucket in O(1).
+         *
+         * @param z Z bucket index. Higher values are drawn first.
+         * @param type Packet type.
+         * @param itemIdx Index of the draw item in its submission container.
+         * @return `true` if inserted, `false` if the packet arena is full.
+         */
+        bool Insert(uint z, OtPacketType type, uint itemIdx);
+
+        /** @brief Walks the table in draw order, from the highest Z bucket to the lowest.
+         *
+         * @param func Function called with each packet.
+         */
+        template <typename TFunc>
+        void Traverse(TFunc func) const;
+    };
+
+    template <typename TFunc>
+    void OrderingTable::Traverse(TFunc func) const
+    {
+        for (int z = (int)_heads.size() - 1; z >= 0; z--)
+        {
+            if (_headGenerations[z] != _generation)
+            {
+                continue;
+            }
+
+            for (uint packetIdx = _heads[z]; packetIdx != NO_LINK; packetIdx = _packets[packetIdx].Next)
+            {
+                func(_packets[packetIdx]);
+            }
+        }
+    }
+}
@@ -0,0 +1,199 @@
+#include "Framework.h"
+#include "Renderer/Common/Objects/Graphic/TextureAtlas.h"
+
+#include "Utils/Utils.h"
+
+using namespace Silent::Utils;
+
+namespace Silent::Renderer
+{
+    constexpr int COLOR_CHANNEL_COUNT = 4; // RGBA.
+
+    /** @brief Copies image pixels into a page, extruding edge texels into the padding border.
+     *
+     * @param page Destination page.
+     * @param pos Top-left position of the padded rectangle in pixels.
+     * @param res Image resolution in pixels.
+     * @param pixels RGBA8 image pixels.
+     */
+    static void BlitImage(AtlasPage& page, const Vector2i& pos, const Vector2i& res, std::span<const byte> pixels)
+    {
+        constexpr int PADDING = TextureAtlas::IMAGE_PADDING;
+
+        for (int y = -PADDING; y < (res.y + PADDING); y++)
+        {
+            int srcY = std::clamp(y, 0, res.y - 1);
+            int dstY = (pos.y + PADDING) + y;
+            for (int x = -PADDING; x < (res.x + PADDING); x++)
+            {
+                int srcX = std::clamp(x, 0, res.x - 1);
+                int dstX = (pos.x + PADDING) + x;
+
+                const auto* src = &pixels[((srcY * res.x) + srcX) * COLOR_CHANNEL_COUNT];
+                auto*       dst = &page.Pixels[((dstY * TextureAtlas::PAGE_SIZE) + dstX) * COLOR_CHANNEL_COUNT];
+                std::memcpy(dst, src, COLOR_CHANNEL_COUNT);
+            }
+        }
+    }
+
+    TextureAtlas::~TextureAtlas()
+    {
+        Clear();
+    }
+
+    std::span<const AtlasPage> TextureAtlas::GetPages() const
+    {
+        return _pages;
+    }
+
+    const AtlasRegion* TextureAtlas::GetRegion(int assetIdx) const
+    {
+        return Find(_regions, assetIdx);
+    }
+
+    int TextureAtlas::GetTextureIdx(int assetIdx, const Vector2& uvMin, const Vector2& uvMax) const
+    {
+        // Wrapping UV regions can't be remapped into a page.
+        auto uvLow  = glm::min(uvMin, uvMax);
+        auto uvHigh = glm::max(uvMin, uvMax);
+        if (uvLow.x < 0.0f || uvLow.y < 0.0f || uvHigh.x > 1.0f || uvHigh.y > 1.0f)
+        {
+            return assetIdx;
+        }
+
+        const auto* region = GetRegion(assetIdx);
+        if (region == nullptr)
+        {
+            return assetIdx;
+        }
+
+        return PAGE_TEXTURE_IDX_BASE + region->PageIdx;
+    }
+
+    TextureAtlasStats TextureAtlas::GetStats() const
+    {
+        auto stats = TextureAtlasStats
+        {
+            .PageCount     = (uint)_pages.size(),
+            .ImageCount    = (uint)_regions.size(),
+            .RejectedCount = (uint)_rejectedIdxs.size()
+        };
+
+        // Compute occupancy.
+        if (!_pages.empty())
+        {
+            uint64 usedArea = 0;
+            for (const auto& page : _pages)
+            {
+                usedArea += page.UsedArea;
+            }
+            stats.Occupancy = (float)usedArea / (float)((uint64)(PAGE_SIZE * PAGE_SIZE) * _pages.size());
+        }
+
+        return stats;
+    }
+
+    void TextureAtlas::Clear()
+    {
+        for (auto& page : _pages)
+        {
+            sma_atlas_destroy(page.Packer);
+        }
+
+        _pages.clear();
+        _regions.clear();
+        _rejectedIdxs.clear();
+    }
+
+    const AtlasRegion* TextureAtlas::Add(int assetIdx, const Vector2i& res, std::span<const byte> pixels)
+    {
+        // Already packed or rejected.
+        if (IsKnown(assetIdx))
+        {
+            return GetRegion(assetIdx);
+        }
+
+        // Reject invalid and large images.
+        if (res.x <= 0 || res.y <= 0 || res.x > IMAGE_SIZE_MAX || res.y > IMAGE_SIZE_MAX ||
+            pixels.size() < ((res.x * res.y) * COLOR_CHANNEL_COUNT))
+        {
+            _rejectedIdxs.insert(assetIdx);
+            return nullptr;
+        }
+
+        // Find page with room.
+        auto  paddedRes = res + Vector2i(IMAGE_PADDING * 2);
+        auto* item      = (smol_atlas_item_t*)nullptr;
+        int   pageIdx   = 0;
+        for (; pageIdx < _pages.size(); pageIdx++)
+        {
+            item = sma_item_add(_pages[pageIdx].Packer, paddedRes.x, paddedRes.y);
+            if (item != nullptr)
+            {
+                break;
+            }
+        }
+
+        // @heapalloc Start new page.
+        if (item == nullptr)
+        {
+            if (_pages.size() >= PAGE_COUNT_MAX)
+            {
+                Debug::Log(Fmt("Texture atlas is full. Asset {} will use a standalone texture.", assetIdx), Debug::LogLevel::Warning, Debug::LogMode::Debug);
+
+                _rejectedIdxs.insert(assetIdx);
+                return nullptr;
+            }
+
+            _pages.push_back(AtlasPage
+            {
+                .Packer = sma_atlas_create(PAGE_SIZE, PAGE_SIZE),
+                .Pixels = std::vector<byte>((PAGE_SIZE * PAGE_SIZE) * COLOR_CHANNEL_COUNT)
+            });
+            pageIdx = (int)_pages.size() - 1;
+            item    = sma_item_add(_pages[pageIdx].Packer, paddedRes.x, paddedRes.y);
+        }
+
+        // Copy pixels.
+        auto& page = _pages[pageIdx];
+        auto  pos  = Vector2i(sma_item_x(item), sma_item_y(item));
+        BlitImage(page, pos, res, pixels);
+        page.UsedArea += (uint)(paddedRes.x * paddedRes.y);
+        page.IsDirty   = true;
+
+        // Register region.
+        auto imagePos = (pos + Vector2i(IMAGE_PADDING)).ToVector2();
+        return &(_regions[assetIdx] = AtlasRegion
+        {
+            .PageIdx = pageIdx,
+            .UvMin   = imagePos / (float)PAGE_SIZE,
+            .UvMax   = (imagePos + res.ToVector2()) / (float)PAGE_SIZE
+        });
+    }
+
+    Vector2 TextureAtlas::RemapUv(const AtlasRegion& region, const Vector2& uv)
+    {
+        return Vector2(std::lerp(region.UvMin.x, region.UvMax.x, uv.x),
+                       std::lerp(region.UvMin.y, region.UvMax.y, uv.y));
+    }
+
+    void TextureAtlas::ClearDirty(int pageIdx)
+    {
+        if (pageIdx < 0 || pageIdx >= _pages.size())
+        {
+            return;
+        }
+
+        _pages[pageIdx].IsDirty = false;
+    }
+
+    bool TextureAtlas::IsPageTextureIdx(int texIdx)
+    {
+        return texIdx >= PAGE_TEXTURE_IDX_BASE && texIdx < (PAGE_TEXTURE_IDX_BASE + (int)PAGE_COUNT_MAX);
+    }
+
+    bool TextureAtlas::IsKnown(int assetIdx) const
+    {
+        return _regions.contains(assetIdx) || _rejectedIdxs.contains(assetIdx);
+    }
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+namespace Silent::Renderer
+{
+    /** @brief Packed location of an atlased image. */
+    struct AtlasRegion
+    {
+        int     PageIdx = 0;
+        Vector2 UvMin   = Vector2::Zero; /** Normalized top-left corner of the image in its page. */
+        Vector2 UvMax   = Vector2::Zero; /** Normalized bottom-right corner of the image in its page. */
+    };
+
+    /** @brief CPU-side atlas page. */
+    struct AtlasPage
+    {
+        smol_atlas_t*     Packer   = nullptr;
+        std::vector<byte> Pixels   = {};    /** RGBA8 pixels. */
+        uint              UsedArea = 0;     /** Packed area in pixels, including padding. */
+        bool              IsDirty  = false; /** Pixels changed since last upload. */
+    };
+
+    /** @brief Texture atlas statistics. */
+    struct TextureAtlasStats
+    {
+        uint  PageCount     = 0;
+        uint  ImageCount    = 0;
+        uint  RejectedCount = 0;    /** Images too large for the atlas or added while all pages were full. */
+        float Occupancy     = 0.0f; /** Packed area of all pages in the range `[0.0f, 1.0f]`. */
+    };
+
+    /** @brief Packs small TIM images into shared RGBA8 pages so that sprites using different images can share a texture bind.
+     * Pages are packed with `smol-atlas` and held on the CPU. Backends upload dirty pages and bind them in place of the original textures.
+     * Has no GPU dependencies, so packing and UV remapping can be inspected headlessly.
+     *
+     * @note Atlased textures are referenced with texture indices starting at `PAGE_TEXTURE_IDX_BASE`, which never collide with asset indices.
+     */
+    class TextureAtlas
+    {
+    public:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr int  PAGE_SIZE             = 1024;
+        static constexpr int  IMAGE_SIZE_MAX        = 256;    /** Larger images keep a standalone texture. */
+        static constexpr int  IMAGE_PADDING         = 1;      /** Border of clamped edge texels preventing filtering bleed between images. */
+        static constexpr uint PAGE_COUNT_MAX        = 8;
+        static constexpr int  PAGE_TEXTURE_IDX_BASE = 0x8000; /** Texture index of first page. Fits in `SortKey` texture bits. */
+
+    private:
+        // =======
+        // Fields
+        // =======
+
+        std::vector<AtlasPage>               _pages        = {};
+        std::unordered_map<int, AtlasRegion> _regions      = {}; /** Key = asset index, value = packed region. */
+        std::unordered_set<int>              _rejectedIdxs = {}; /** Asset indices which can't be atlased. */
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs an empty default `TextureAtlas`. */
+        TextureAtlas() = default;
+
+        /** @brief Gracefully destroys the `TextureAtlas`, freeing page packers. */
+        ~TextureAtlas();
+
+        TextureAtlas(const TextureAtlas&)            = delete;
+        TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the atlas pages.
+         *
+         * @return Pages.
+         */
+        std::span<const AtlasPage> GetPages() const;
+
+        /** @brief Gets the packed region of an asset.
+         *
+         * @param assetIdx Asset index.
+         * @return Packed region, `nullptr` if the asset isn't atlased.
+         */
+        const AtlasRegion* GetRegion(int assetIdx) const;
+
+        /** @brief Gets the texture index to bind for a sprite UV region of an asset.
+         *
+         * @param assetIdx Asset index.
+         * @param uvMin Normalized sprite UV minimum.
+         * @param uvMax Normalized sprite UV maximum.
+         * @return Page texture index if the asset is atlased and the UV region doesn't wrap, otherwise `assetIdx`.
+         */
+        int GetTextureIdx(int assetIdx, const Vector2& uvMin, const Vector2& uvMax) const;
+
+        /** @brief Gets the atlas statistics.
+         *
+         * @return Atlas statistics.
+         */
+        TextureAtlasStats GetStats() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Removes all images and pages. */
+        void Clear();
+
+        /** @brief Packs an image into the first page with room, creating a new page if needed.
+         * Images which are too large or don't fit are remembered and rejected without repacking.
+         *
+         * @param assetIdx Asset index used to reference the image.
+         * @param res Image resolution in pixels.
+         * @param pixels RGBA8 image pixels.
+         * @return Packed region, `nullptr` if the image was rejected.
+         */
+        const AtlasRegion* Add(int assetIdx, const Vector2i& res, std::span<const byte> pixels);
+
+        /** @brief Remaps a normalized image UV into its packed page region.
+         *
+         * @param region Packed region.
+         * @param uv Normalized image UV in the range `[0.0f, 1.0f]`.
+         * @return Normalized page UV.
+         */
+        static Vector2 RemapUv(const AtlasRegion& region, const Vector2& uv);
+
+        /** @brief Clears the dirty flag of a page after its pixels were uploaded.
+         *
+         * @param pageIdx Page index.
+         */
+        void ClearDirty(int pageIdx);
+
+        // ==========
+        // Inquirers
+        // ==========
+
+        /** @brief Checks if a texture index references an atlas page.
+         *
+         * @param texIdx Texture index.
+         * @return `true` if the index references a page, `false` otherwise.
+         */
+        static bool IsPageTextureIdx(int texIdx);
+
+        /** @brief Checks if an asset is known to the atlas, either packed or rejected.
+         *
+         * @param assetIdx Asset index.
+         * @return `true` if known, `false` otherwise.
+         */
+        bool IsKnown(int assetIdx) const;
+    };
+}
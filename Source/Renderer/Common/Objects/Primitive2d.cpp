@@ -8,6 +8,11 @@
 
 namespace Silent::Renderer
 {
+    std::span<const Vertex2d> Primitive2d::GetVertices() const
+    {
+        return std::span<const Vertex2d>(Vertices.data(), VertexCount);
+    }
+
     Primitive2d Primitive2d::CreateLine(const Vector2& from, const Vector2& to,
                                         const Color& colorFrom, const Color& colorTo,
                                         uint depth, ScaleMode scaleMode, BlendMode blendMode)
@@ -20,16 +25,17 @@ namespace Silent::Renderer
 
         return Primitive2d
         {
-            .Vertices =
+            .Vertices    =
             {
                 Vertex2d{ from,          colorFrom },
                 Vertex2d{ to,            colorTo   },
                 Vertex2d{ to   + offset, colorTo   },
                 Vertex2d{ from + offset, colorFrom }
             },
-            .Depth  = depth,
-            .ScaleM = scaleMode,
-            .BlendM = blendMode
+            .VertexCount = QUAD_VERTEX_COUNT,
+            .Depth       = depth,
+            .ScaleM      = scaleMode,
+            .BlendM      = blendMode
         };
     }
 
@@ -49,15 +55,16 @@ namespace Silent::Renderer
     {
         return Primitive2d
         {
-            .Vertices =
+            .Vertices    =
             {
                 Vertex2d{ vert0, color0 },
                 Vertex2d{ vert1, color1 },
                 Vertex2d{ vert2, color2 }
             },
-            .Depth  = depth,
-            .ScaleM = scaleMode,
-            .BlendM = blendMode
+            .VertexCount = TRIANGLE_VERTEX_COUNT,
+            .Depth       = depth,
+            .ScaleM      = scaleMode,
+            .BlendM      = blendMode
         };
     }
 
@@ -78,16 +85,17 @@ namespace Silent::Renderer
     {
         return Primitive2d
         {
-            .Vertices =
+            .Vertices    =
             {
                 Vertex2d{ vert0, color0 },
                 Vertex2d{ vert1, color1 },
                 Vertex2d{ vert2, color2 },
                 Vertex2d{ vert3, color3 }
             },
-            .Depth  = depth,
-            .ScaleM = scaleMode,
-            .BlendM = blendMode
+            .VertexCount = QUAD_VERTEX_COUNT,
+            .Depth       = depth,
+            .ScaleM      = scaleMode,
+            .BlendM      = blendMode
         };
     }
 
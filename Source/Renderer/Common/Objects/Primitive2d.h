@@ -8,13 +8,23 @@ namespace Silent::Renderer
     constexpr uint                                       DEPTH_MAX          = 1024;
     constexpr std::array<int, TRIANGLE_VERTEX_COUNT * 2> QUAD_TRIANGLE_IDXS = { 0, 1, 2, 0, 2, 3 };
 
-    /** @brief 2D screen space primitive representing a line, triangle, or quad. */
+    /** @brief 2D screen space primitive representing a line, triangle, or quad.
+     *
+     * @note Vertices are stored inline so that constructing and submitting a primitive doesn't allocate.
+     */
     struct Primitive2d
     {
-        std::vector<Vertex2d> Vertices = {};
-        uint                  Depth    = 0;
-        ScaleMode             ScaleM   = ScaleMode::Fit;
-        BlendMode             BlendM   = BlendMode::Alpha;
+        std::array<Vertex2d, QUAD_VERTEX_COUNT> Vertices    = {};
+        uint                                    VertexCount = 0;
+        uint                                    Depth       = 0;
+        ScaleMode                               ScaleM      = ScaleMode::Fit;
+        BlendMode                               BlendM      = BlendMode::Alpha;
+
+        /** @brief Gets the used vertices.
+         *
+         * @return Used vertices.
+         */
+        std::span<const Vertex2d> GetVertices() const;
 
         /** @brief Constructs a 2D line primitive with a width at the retro resolution pixel scale (320x240) using screen positions in percent.
          *
@@ -108,4 +118,13 @@ namespace Silent::Renderer
                                       const Color& color0, const Color& color1, const Color& color2, const Color& color3,
                                       uint depth = 0, ScaleMode scaleMode = ScaleMode::Fit, BlendMode blendMode = BlendMode::Alpha);
     };
+
+    /** @brief Renderer-side 2D primitive submission record with vertices stored in the frame arena. */
+    struct Primitive2dRecord
+    {
+        std::span<const Vertex2d> Vertices = {};
+        uint                      Depth    = 0;
+        ScaleMode                 ScaleM   = ScaleMode::Fit;
+        BlendMode                 BlendM   = BlendMode::Alpha;
+    };
 }
@@ -30,4 +30,11 @@ namespace Silent::Renderer
          */
         static Primitive3d CreateDebugTriangle(const Vector3& vert0, const Vector3& vert1, const Vector3& vert2, const Color& color);
     };
+
+    /** @brief Renderer-side 3D primitive submission record with vertices stored in the frame arena. */
+    struct Primitive3dRecord
+    {
+        std::span<const Vertex3d> Vertices = {};
+        BlendMode                 BlendM   = BlendMode::Alpha;
+    };
 }
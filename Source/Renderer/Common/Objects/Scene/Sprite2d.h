@@ -2,6 +2,11 @@
 
 #include "Renderer/Common/Enums.h"
 
+namespace Silent::Assets
+{
+    struct TimAsset;
+}
+
 namespace Silent::Renderer
 {
     /** @brief 2D screen sprite. */
@@ -19,6 +24,8 @@ namespace Silent::Renderer
         ScaleMode ScaleM   = ScaleMode::Fit;
         BlendMode BlendM   = BlendMode::Opaque;
 
+        std::shared_ptr<const Assets::TimAsset> Texture = nullptr; /** Texture data resolved on the game thread at submission. */
+
         static Sprite2d CreateSprite2d(int assetIdx, const Vector2& uvMin, const Vector2& uvMax,
                                        const Vector2& pos, float rot, const Vector2& scale, const Color& color,
                                        uint depth = 0, AlignMode alignMode = AlignMode::Center, ScaleMode scaleMode = ScaleMode::Fit, BlendMode blendMode = BlendMode::Alpha);
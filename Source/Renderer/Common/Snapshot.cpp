@@ -0,0 +1,41 @@
+#include "Framework.h"
+#include "Renderer/Common/Snapshot.h"
+
+#include "Renderer/Common/Constants.h"
+#include "Renderer/Common/Objects/Graphic/OrderingTable.h"
+#include "Renderer/Common/Objects/Primitive2d.h"
+#include "Utils/FrameArena.h"
+
+using namespace Silent::Utils;
+
+namespace Silent::Renderer
+{
+    RenderSnapshot::RenderSnapshot()
+    {
+        // @heapalloc Allocate storage once. Each snapshot is exclusively owned by one side, so a single arena buffer suffices.
+        Arena = FrameArena(FRAME_ARENA_SIZE, 1);
+        Primitives3d.reserve(PRIMITIVE_3D_COUNT_MAX);
+        Primitives2d.reserve(PRIMITIVE_2D_COUNT_MAX);
+        Sprites2d.reserve(SPRITE_2D_COUNT_MAX);
+        Ot2d = OrderingTable(DEPTH_MAX + 1, PRIMITIVE_2D_COUNT_MAX + SPRITE_2D_COUNT_MAX);
+        DebugPrimitives3d.reserve(DEBUG_PRIMITIVE_3D_COUNT_MAX);
+        DebugShapes.reserve(DEBUG_SHAPE_COUNT_MAX);
+        DebugGuiDrawCalls.reserve(DEBUG_GUI_DRAW_CALL_COUNT_MAX);
+    }
+
+    void RenderSnapshot::Clear()
+    {
+        FrameId             = 0;
+        InputTime           = {};
+        EnableOrderingTable = false;
+
+        Arena.Swap();
+        Primitives3d.clear();
+        Primitives2d.clear();
+        Sprites2d.clear();
+        Ot2d.Clear();
+        DebugPrimitives3d.clear();
+        DebugShapes.clear();
+        DebugGuiDrawCalls.clear();
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Renderer/Common/Objects/Graphic/DebugShape.h"
+#include "Renderer/Common/Objects/Graphic/OrderingTable.h"
+#include "Renderer/Common/Objects/Primitive2d.h"
+#include "Renderer/Common/Objects/Primitive3d.h"
+#include "Renderer/Common/Objects/Scene/Sprite2d.h"
+#include "Utils/FrameArena.h"
+
+namespace Silent::Renderer
+{
+    /** @brief Self-contained render submissions of one game tick.
+     * Written by the game thread and consumed by the render worker through a triple buffer, so submission records
+     * and the vertex data they reference in `Arena` are never shared between threads while in use.
+     */
+    struct RenderSnapshot
+    {
+        using TimeType = std::chrono::steady_clock::time_point;
+
+        uint64   FrameId             = 0;     /** Publish counter. Gaps between rendered snapshots indicate dropped ticks. */
+        TimeType InputTime           = {};    /** Time of the input poll preceding the tick's submissions. */
+        bool     EnableOrderingTable = false; /** Order 2D draws by `Ot2d` traversal instead of sorting. Latched at publish. */
+
+        Utils::FrameArena              Arena             = {}; /** Vertex storage referenced by submission records. */
+        std::vector<Primitive3dRecord> Primitives3d      = {};
+        std::vector<Primitive2dRecord> Primitives2d      = {};
+        std::vector<Sprite2d>          Sprites2d         = {};
+        OrderingTable                  Ot2d              = {}; /** 2D primitives and sprites linked by depth at submission. */
+        std::vector<Primitive3dRecord> DebugPrimitives3d = {};
+        std::vector<DebugShapeRecord>  DebugShapes       = {};
+        std::vector<void (*)()>        DebugGuiDrawCalls = {}; /** Captureless GUI functions, so submission doesn't allocate. */
+
+        /** @brief Constructs an empty `RenderSnapshot` and reserves its storage up front. */
+        RenderSnapshot();
+
+        /** @brief Clears all submissions in O(1) while retaining allocated memory. */
+        void Clear();
+    };
+}
@@ -2,15 +2,28 @@
 #include "Renderer/Renderer.h"
 
 #include "Application.h"
+#include "Renderer/Common/Capture.h"
+#include "Renderer/Common/FramePacing.h"
+#include "Renderer/Common/Objects/Graphic/Batch.h"
+#include "Renderer/Common/Objects/Graphic/Bucket.h"
+#include "Renderer/Common/Objects/Graphic/DebugShape.h"
+#include "Renderer/Common/Objects/Graphic/OrderingTable.h"
+#include "Renderer/Common/Objects/Graphic/TextureAtlas.h"
 #include "Renderer/Common/Objects/Primitive/Vertex2d.h"
 #include "Renderer/Common/Objects/Primitive/Vertex3d.h"
 #include "Renderer/Common/Objects/Primitive2d.h"
 #include "Renderer/Common/Objects/Primitive3d.h"
 #include "Renderer/Common/Objects/Scene/Sprite2d.h"
 #include "Renderer/Common/Objects/Scene/Text.h"
+#include "Renderer/Common/Snapshot.h"
+#include "Renderer/Backends/Null/Null.h"
 #include "Renderer/Backends/OpenGl/OpenGl.h"
 #include "Renderer/Backends/SdlGpu/SdlGpu.h"
+#include "Renderer/Backends/Software/Software.h"
+#include "Services/Filesystem.h"
+#include "Utils/FrameArena.h"
 #include "Utils/Parallel.h"
+#include "Utils/TripleBuffer.h"
 #include "Utils/Utils.h"
 
 using namespace Silent::Utils;
@@ -27,6 +40,37 @@ namespace Silent::Renderer
         return _drawCallCount;
     }
 
+    BucketStats RendererBase::GetBucketStats() const
+    {
+        return BucketStats
+        {
+            .ItemCount                = _bucketStats2d.ItemCount                + _bucketStats3d.ItemCount,
+            .BucketCount              = _bucketStats2d.BucketCount              + _bucketStats3d.BucketCount,
+            .StateChangeCount         = _bucketStats2d.StateChangeCount         + _bucketStats3d.StateChangeCount,
+            .UnsortedStateChangeCount = _bucketStats2d.UnsortedStateChangeCount + _bucketStats3d.UnsortedStateChangeCount
+        };
+    }
+
+    TextureAtlasStats RendererBase::GetTextureAtlasStats() const
+    {
+        return _textureAtlas.GetStats();
+    }
+
+    const FrameArena& RendererBase::GetFrameArena() const
+    {
+        return _snapshots.GetReadBuffer().Arena;
+    }
+
+    const FramePacingStats& RendererBase::GetFramePacingStats() const
+    {
+        return _framePacing.GetStats();
+    }
+
+    CaptureStats RendererBase::GetCaptureStats()
+    {
+        return _captureQueue.GetStats();
+    }
+
     void RendererBase::SetClearColor(const Color& color)
     {
         _clearColor = color;
@@ -63,15 +107,62 @@ namespace Silent::Renderer
         _isResized = true;
     }
 
+    void RendererBase::ToggleContinuousCapture()
+    {
+        bool isEnabled = !_isContinuousCapture.load(std::memory_order_relaxed);
+        _isContinuousCapture.store(isEnabled, std::memory_order_release);
+        Debug::Log(isEnabled ? "Started continuous capture." : "Stopped continuous capture.", Debug::LogLevel::Info, Debug::LogMode::All, true);
+    }
+
+    void RendererBase::SaveScreenshot()
+    {
+        _isScreenshotRequested.store(true, std::memory_order_release);
+    }
+
+    void RendererBase::PublishSnapshot(RenderSnapshot::TimeType inputTime)
+    {
+        _snapshotCount++;
+
+        auto& snapshot     = _snapshots.GetWriteBuffer();
+        snapshot.FrameId             = _snapshotCount;
+        snapshot.InputTime           = inputTime;
+        snapshot.EnableOrderingTable = Debug::g_Work.EnableOrderingTable;
+
+        // Hand off snapshot and reclaim stale one for the next tick.
+        _snapshots.Publish();
+        _snapshots.GetWriteBuffer().Clear();
+    }
+
     void RendererBase::Submit2dPrimitive(const Primitive2d& prim)
     {
-        if (_primitives2d.size() >= PRIMITIVE_2D_COUNT_MAX)
+        auto& snapshot = _snapshots.GetWriteBuffer();
+        if (snapshot.Primitives2d.size() >= PRIMITIVE_2D_COUNT_MAX)
         {
             Debug::Log("Attampted to add 2D primitive to full container.", Debug::LogLevel::Warning, Debug::LogMode::Debug);
             return;
         }
 
-        _primitives2d.push_back(prim);
+        // Copy vertices into frame arena.
+        auto verts = snapshot.Arena.Copy(prim.GetVertices());
+        if (verts.empty())
+        {
+            return;
+        }
+
+        // Link into ordering table. Reject if not linked so that traversal covers every submission.
+        if (!snapshot.Ot2d.Insert(prim.Depth, OtPacketType::Primitive2d, (uint)snapshot.Primitives2d.size()))
+        {
+            Debug::Log("Attempted to add 2D primitive to full ordering table.", Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return;
+        }
+
+        snapshot.Primitives2d.push_back(Primitive2dRecord
+        {
+            .Vertices = verts,
+            .Depth    = prim.Depth,
+            .ScaleM   = prim.ScaleM,
+            .BlendM   = prim.BlendM
+        });
     }
 
     void RendererBase::SubmitScreenSprite(int assetIdx, const Vector2& uvMin, const Vector2& uvMax, const Vector2& pos, short rot, const Vector2& scale,
@@ -80,13 +171,34 @@ namespace Silent::Renderer
         auto& assets = g_App.GetAssets();
 
         const auto asset = assets.GetAsset(assetIdx);
-        if (asset->Type != AssetType::Tim)
+        if (asset == nullptr || asset->Type != AssetType::Tim)
         {
             Debug::Log("Attempted to submit non-image asset as screen sprite.", Debug::LogLevel::Warning, Debug::LogMode::Debug);
             return;
         }
 
-        // @todo
+        // Skip until loaded. Texture data is resolved here so that the render worker never reads the asset manager.
+        if (asset->State != AssetState::Loaded)
+        {
+            return;
+        }
+
+        auto& snapshot = _snapshots.GetWriteBuffer();
+        if (snapshot.Sprites2d.size() >= SPRITE_2D_COUNT_MAX)
+        {
+            Debug::Log("Attempted to add 2D sprite to full container.", Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return;
+        }
+
+        auto sprite = Sprite2d::CreateSprite2d(assetIdx, uvMin, uvMax, pos, FP_ANGLE_TO_RAD(rot), scale, color, std::max(depth, 0), alignMode, scaleMode, blendMode);
+        sprite.Texture = asset->GetData<TimAsset>();
+        if (!snapshot.Ot2d.Insert(sprite.Depth, OtPacketType::Sprite2d, (uint)snapshot.Sprites2d.size()))
+        {
+            Debug::Log("Attempted to add 2D sprite to full ordering table.", Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return;
+        }
+
+        snapshot.Sprites2d.push_back(sprite);
     }
 
     void RendererBase::SubmitDebugText(const std::string& msg, const Vector2& pos, const Color& color, TextAlignMode alignMode)
@@ -94,7 +206,7 @@ namespace Silent::Renderer
         // @todo
     }
 
-    void RendererBase::SubmitDebugGui(std::function<void()> drawFunc)
+    void RendererBase::SubmitDebugGui(void (*drawFunc)())
     {
         const auto& options = g_App.GetOptions();
         if (!options->EnableDebugMode)
@@ -102,7 +214,14 @@ namespace Silent::Renderer
             return;
         }
 
-        _debugGuiDrawCalls.push_back(drawFunc);
+        auto& snapshot = _snapshots.GetWriteBuffer();
+        if (snapshot.DebugGuiDrawCalls.size() >= DEBUG_GUI_DRAW_CALL_COUNT_MAX)
+        {
+            Debug::Log("Attempted to add debug GUI to full container.", Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return;
+        }
+
+        snapshot.DebugGuiDrawCalls.push_back(drawFunc);
     }
 
     void RendererBase::SubmitDebugLine(const Vector3& from, const Vector3& to, const Color& color, Debug::Page page)
@@ -112,235 +231,306 @@ namespace Silent::Renderer
             return;
         }
 
-        auto line = Primitive3d::CreateDebugLine(from, to, color);
-        _debugPrimitives3d.push_back(line);
-    }
+        auto& snapshot = _snapshots.GetWriteBuffer();
+        if (snapshot.DebugPrimitives3d.size() >= DEBUG_PRIMITIVE_3D_COUNT_MAX)
+        {
+            Debug::Log("Attempted to add debug 3D primitive to full container.", Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return;
+        }
 
-    void RendererBase::SubmitDebugTriangle(const Vector3& vert0, const Vector3& vert1, const Vector3& vert2, const Color& color, Debug::Page page)
-    {
-        if (!CheckDebugPage(page))
+        // Allocate vertices in frame arena.
+        auto verts = snapshot.Arena.Allocate<Vertex3d>(2);
+        if (verts.empty())
         {
             return;
         }
 
-        auto tri = Primitive3d::CreateDebugTriangle(vert0, vert1, vert2, color);
-        _debugPrimitives3d.push_back(tri);
+        verts[0] = Vertex3d{ .Position = from, .Col = color };
+        verts[1] = Vertex3d{ .Position = to,   .Col = color };
+        snapshot.DebugPrimitives3d.push_back(Primitive3dRecord{ .Vertices = verts, .BlendM = BlendMode::Add });
     }
 
-    void RendererBase::SubmitDebugTarget(const Vector3& center, const Quaternion& rot, float radius, const Color& color, Debug::Page page)
+    void RendererBase::SubmitDebugTriangle(const Vector3& vert0, const Vector3& vert1, const Vector3& vert2, const Color& color, Debug::Page page)
     {
         if (!CheckDebugPage(page))
         {
             return;
         }
 
-        auto rotMatrix = rot.ToRotationMatrix();
+        auto& snapshot = _snapshots.GetWriteBuffer();
+        if (snapshot.DebugPrimitives3d.size() >= DEBUG_PRIMITIVE_3D_COUNT_MAX)
+        {
+            Debug::Log("Attempted to add debug 3D primitive to full container.", Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return;
+        }
 
-        auto from0 = center + Vector3::Transform(Vector3(radius,  0.0f, 0.0f), rotMatrix);
-        auto to0   = center + Vector3::Transform(Vector3(-radius, 0.0f, 0.0f), rotMatrix);
-        SubmitDebugLine(from0, to0, color, page);
+        // Allocate vertices in frame arena.
+        auto verts = snapshot.Arena.Allocate<Vertex3d>(TRIANGLE_VERTEX_COUNT);
+        if (verts.empty())
+        {
+            return;
+        }
 
-        auto from1 = center + Vector3::Transform(Vector3(0.0f,  radius, 0.0f), rotMatrix);
-        auto to1   = center + Vector3::Transform(Vector3(0.0f, -radius, 0.0f), rotMatrix);
-        SubmitDebugLine(from1, to1, color, page);
+        verts[0] = Vertex3d{ .Position = vert0, .Col = color };
+        verts[1] = Vertex3d{ .Position = vert1, .Col = color };
+        verts[2] = Vertex3d{ .Position = vert2, .Col = color };
+        snapshot.DebugPrimitives3d.push_back(Primitive3dRecord{ .Vertices = verts, .BlendM = BlendMode::Add });
+    }
 
-        auto from2 = center + Vector3::Transform(Vector3(0.0f, 0.0f,  radius), rotMatrix);
-        auto to2   = center + Vector3::Transform(Vector3(0.0f, 0.0f, -radius), rotMatrix);
-        SubmitDebugLine(from2, to2, color, page);
+    void RendererBase::SubmitDebugTarget(const Vector3& center, const Quaternion& rot, float radius, const Color& color, Debug::Page page)
+    {
+        auto transform = DebugShapeInstance::CreateTransform(center, rot, Vector3(radius));
+        SubmitDebugShape(DebugShapeType::Target, transform, color, true, page);
     }
 
     void RendererBase::SubmitDebugBox(const OrientedBoundingBox& box, const Color& color, bool isWireframe, Debug::Page page)
     {
-        if (!CheckDebugPage(page))
-        {
-            return;
-        }
-
-        auto corners = box.GetCorners();
+        auto transform = DebugShapeInstance::CreateTransform(box.Center, box.Rotation, box.Extents);
+        SubmitDebugShape(DebugShapeType::Box, transform, color, isWireframe, page);
+    }
 
-        // Wireframe.
-        if (isWireframe)
-        {
-            SubmitDebugLine(corners[0], corners[1], color, page);
-            SubmitDebugLine(corners[1], corners[2], color, page);
-            SubmitDebugLine(corners[2], corners[3], color, page);
-            SubmitDebugLine(corners[3], corners[0], color, page);
+    void RendererBase::SubmitDebugSphere(const BoundingSphere& sphere, const Color& color, bool isWireframe, Debug::Page page)
+    {
+        auto transform = DebugShapeInstance::CreateTransform(sphere.Center, Quaternion::Identity, Vector3(sphere.Radius));
+        SubmitDebugShape(DebugShapeType::Sphere, transform, color, isWireframe, page);
+    }
 
-            SubmitDebugLine(corners[4], corners[5], color, page);
-            SubmitDebugLine(corners[5], corners[6], color, page);
-            SubmitDebugLine(corners[6], corners[7], color, page);
-            SubmitDebugLine(corners[7], corners[4], color, page);
+    void RendererBase::SubmitDebugCylinder(const Vector3& center, const Quaternion& rot, float radius, float length, const Color& color, bool isWireframe, Debug::Page page)
+    {
+        auto transform = DebugShapeInstance::CreateTransform(center, rot, Vector3(radius, length, radius));
+        SubmitDebugShape(DebugShapeType::Cylinder, transform, color, isWireframe, page);
+    }
 
-            SubmitDebugLine(corners[0], corners[4], color, page);
-            SubmitDebugLine(corners[1], corners[5], color, page);
-            SubmitDebugLine(corners[2], corners[6], color, page);
-            SubmitDebugLine(corners[3], corners[7], color, page);
-        }
-        // Solid.
-        else
-        {
-            SubmitDebugTriangle(corners[0], corners[1], corners[2], color, page);
-            SubmitDebugTriangle(corners[0], corners[2], corners[3], color, page);
+    void RendererBase::SubmitDebugCone(const Vector3& center, const Quaternion& rot, float radius, float length, const Color& color, bool isWireframe, Debug::Page page)
+    {
+        auto transform = DebugShapeInstance::CreateTransform(center, rot, Vector3(radius, length, radius));
+        SubmitDebugShape(DebugShapeType::Cone, transform, color, isWireframe, page);
+    }
 
-            SubmitDebugTriangle(corners[4], corners[5], corners[6], color, page);
-            SubmitDebugTriangle(corners[4], corners[6], corners[7], color, page);
+    void RendererBase::SubmitDebugDiamond(const Vector3& center, const Quaternion& rot, float radius, float length, const Color& color, bool isWireframe, Debug::Page page)
+    {
+        auto transform = DebugShapeInstance::CreateTransform(center, rot, Vector3(radius, length, radius));
+        SubmitDebugShape(DebugShapeType::Diamond, transform, color, isWireframe, page);
+    }
 
-            SubmitDebugTriangle(corners[0], corners[1], corners[4], color, page);
-            SubmitDebugTriangle(corners[1], corners[4], corners[5], color, page);
+    void RendererBase::PrepareFrameData()
+    {
+        auto& executor = g_App.GetExecutor();
 
-            SubmitDebugTriangle(corners[1], corners[2], corners[5], color, page);
-            SubmitDebugTriangle(corners[2], corners[5], corners[6], color, page);
+        // Acquire latest snapshot. If none was published since the previous frame, the previous one is redrawn.
+        _snapshots.Acquire();
 
-            SubmitDebugTriangle(corners[2], corners[3], corners[6], color, page);
-            SubmitDebugTriangle(corners[3], corners[6], corners[7], color, page);
+        // Sort 2D and 3D submissions into buckets.
+        auto sortTasks = ParallelTasks
+        {
+            TASK(Prepare2dBuckets()),
+            TASK(Prepare3dBuckets()),
+            TASK(PrepareDebugShapes())
+        };
+        executor.AddTasks(sortTasks).wait();
 
-            SubmitDebugTriangle(corners[0], corners[3], corners[4], color, page);
-            SubmitDebugTriangle(corners[3], corners[4], corners[7], color, page);
-        }
+        // @todo Intermediate data -> renderer-ready data. At later stages, outside this method, renderer-ready data -> GPU copy-ready data.
     }
 
-    void RendererBase::SubmitDebugSphere(const BoundingSphere& sphere, const Color& color, bool isWireframe, Debug::Page page)
+    void RendererBase::Prepare2dBuckets()
     {
-        constexpr uint WIREFRAME_SEGMENT_COUNT = 24;
+        const auto& snapshot = _snapshots.GetReadBuffer();
 
-        if (!CheckDebugPage(page))
+        // Generate keys in submission order.
+        _sortKeys2d.clear();
+        for (int i = 0; i < snapshot.Primitives2d.size(); i++)
         {
-            return;
+            const auto& prim = snapshot.Primitives2d[i];
+            _sortKeys2d.push_back(SortKey::Create(DrawLayer::Scene2d, prim.Depth, RenderStage::Primitive2d, prim.BlendM, NO_VALUE, i));
         }
-
-        // Wireframe.
-        if (isWireframe)
+        for (int i = 0; i < snapshot.Sprites2d.size(); i++)
         {
-            // Draw circles in XY, YZ, and XZ planes.
-            for (int plane = 0; plane < Vector3::AXIS_COUNT; plane++)
-            {
-                for (int i = 0; i < WIREFRAME_SEGMENT_COUNT; i++)
-                {
-                    float theta0 = (((float)i       / WIREFRAME_SEGMENT_COUNT) * 2.0f) * PI;
-                    float theta1 = (((float)(i + 1) / WIREFRAME_SEGMENT_COUNT) * 2.0f) * PI;
+            const auto& sprite = snapshot.Sprites2d[i];
 
-                    auto point0 = Vector3::Zero;
-                    auto point1 = Vector3::Zero;
-                    switch (plane)
-                    {
-                        // XY plane.
-                        case 0:
-                        {
-                            point0 = sphere.Center + Vector3(sphere.Radius * glm::cos(theta0), sphere.Radius * glm::sin(theta0), 0.0f);
-                            point1 = sphere.Center + Vector3(sphere.Radius * glm::cos(theta1), sphere.Radius * glm::sin(theta1), 0.0f);
-                            break;
-                        }
-                        // YZ plane.
-                        case 1:
-                        {
-                            point0 = sphere.Center + Vector3(0.0f, sphere.Radius * glm::cos(theta0), sphere.Radius * glm::sin(theta0));
-                            point1 = sphere.Center + Vector3(0.0f, sphere.Radius * glm::cos(theta1), sphere.Radius * glm::sin(theta1));
-                            break;
-                        }
-                        // ZX plane.
-                        case 2:
-                        {
-                            point0 = sphere.Center + Vector3(sphere.Radius * glm::cos(theta0), 0.0f, sphere.Radius * glm::sin(theta0));
-                            point1 = sphere.Center + Vector3(sphere.Radius * glm::cos(theta1), 0.0f, sphere.Radius * glm::sin(theta1));
-                            break;
-                        }
-                    }
-                    SubmitDebugLine(point0, point1, color, page);
-                }
+            // Pack newly loaded sprite textures into atlas.
+            if (!_textureAtlas.IsKnown(sprite.AssetIdx) && sprite.Texture != nullptr)
+            {
+                _textureAtlas.Add(sprite.AssetIdx, sprite.Texture->Resolution, sprite.Texture->Pixels);
             }
-        }
-        // Solid.
-        else
-        {
-            // TOO
-        }
-    }
 
-    void RendererBase::SubmitDebugCylinder(const Vector3& center, const Quaternion& rot, float radius, float length, const Color& color, bool isWireframe, Debug::Page page)
-    {
-        if (!CheckDebugPage(page))
-        {
-            return;
+            int texIdx = _textureAtlas.GetTextureIdx(sprite.AssetIdx, sprite.UvMin, sprite.UvMax);
+            _sortKeys2d.push_back(SortKey::Create(DrawLayer::Scene2d, sprite.Depth, RenderStage::Primitive2dTextured, sprite.BlendM, texIdx, i));
         }
 
-        // Wireframe.
-        if (isWireframe)
+        _bucketStats2d.ItemCount                = (uint)_sortKeys2d.size();
+        _bucketStats2d.UnsortedStateChangeCount = GetStateChangeCount(_sortKeys2d);
+
+        // Order keys by ordering table traversal, or sort.
+        if (snapshot.EnableOrderingTable)
         {
-            // @todo
+            uint primCount = (uint)snapshot.Primitives2d.size();
+
+            _sortScratch2d.clear();
+            snapshot.Ot2d.Traverse([&](const OtPacket& packet)
+            {
+                uint keyIdx = (packet.Type == OtPacketType::Sprite2d) ? (primCount + packet.ItemIdx) : packet.ItemIdx;
+                _sortScratch2d.push_back(_sortKeys2d[keyIdx]);
+            });
+            _sortKeys2d.swap(_sortScratch2d);
         }
-        // Solid.
         else
         {
-            // @todo
+            RadixSort(_sortKeys2d, _sortScratch2d);
         }
+
+        // Bucket.
+        BuildBuckets(_sortKeys2d, _buckets2d);
+        _bucketStats2d.BucketCount      = (uint)_buckets2d.size();
+        _bucketStats2d.StateChangeCount = (uint)_buckets2d.size();
+
+        // Merge compatible neighbors into batches.
+        _batcher2d.Build(_sortKeys2d, snapshot.Primitives2d, snapshot.Sprites2d, _textureAtlas);
     }
 
-    void RendererBase::SubmitDebugCone(const Vector3& center, const Quaternion& rot, float radius, float length, const Color& color, bool isWireframe, Debug::Page page)
+    void RendererBase::Prepare3dBuckets()
     {
-        if (!CheckDebugPage(page))
-        {
-            return;
-        }
+        const auto& snapshot = _snapshots.GetReadBuffer();
 
-        // Wireframe.
-        if (isWireframe)
+        // Generate keys in submission order.
+        _sortKeys3d.clear();
+        for (int i = 0; i < snapshot.Primitives3d.size(); i++)
         {
-            // @todo
+            const auto& prim = snapshot.Primitives3d[i];
+            _sortKeys3d.push_back(SortKey::Create(DrawLayer::Scene3d, 0, RenderStage::Primitive3d, prim.BlendM, NO_VALUE, i));
         }
-        // Solid.
-        else
+        for (int i = 0; i < snapshot.DebugPrimitives3d.size(); i++)
         {
-            // @todo
+            const auto& prim = snapshot.DebugPrimitives3d[i];
+            _sortKeys3d.push_back(SortKey::Create(DrawLayer::Debug3d, 0, RenderStage::Primitive3d, prim.BlendM, NO_VALUE, i));
         }
+
+        // Sort and bucket.
+        _bucketStats3d.ItemCount                = (uint)_sortKeys3d.size();
+        _bucketStats3d.UnsortedStateChangeCount = GetStateChangeCount(_sortKeys3d);
+        RadixSort(_sortKeys3d, _sortScratch3d);
+        BuildBuckets(_sortKeys3d, _buckets3d);
+        _bucketStats3d.BucketCount      = (uint)_buckets3d.size();
+        _bucketStats3d.StateChangeCount = (uint)_buckets3d.size();
     }
 
-    void RendererBase::SubmitDebugDiamond(const Vector3& center, const Quaternion& rot, float radius, float length, const Color& color, bool isWireframe, Debug::Page page)
+    void RendererBase::PrepareDebugShapes()
+    {
+        const auto& snapshot = _snapshots.GetReadBuffer();
+        _debugShapeBatcher.Build(snapshot.DebugShapes);
+    }
+
+    void RendererBase::SubmitDebugShape(DebugShapeType type, const Matrix& transform, const Color& color, bool isWireframe, Debug::Page page)
     {
         if (!CheckDebugPage(page))
         {
             return;
         }
 
-        // Wireframe.
-        if (isWireframe)
+        auto& snapshot = _snapshots.GetWriteBuffer();
+        if (snapshot.DebugShapes.size() >= DEBUG_SHAPE_COUNT_MAX)
         {
-            // @todo
+            Debug::Log("Attempted to add debug shape to full container.", Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return;
         }
-        // Solid.
-        else
+
+        snapshot.DebugShapes.push_back(DebugShapeRecord
         {
-            // @todo
-        }
+            .Type        = type,
+            .IsWireframe = isWireframe,
+            .Instance    = DebugShapeInstance{ .Transform = transform, .Col = color }
+        });
     }
 
-    void RendererBase::PrepareFrameData()
+    void RendererBase::ClearFrameData()
     {
-        auto& executor = g_App.GetExecutor();
-
-        auto sortTasks = ParallelTasks
-        {
-            //[&]()
-            //{
-            //    // Sort 2D primitives by depth.
-            //    Sort(_primitives2d, [](const Primitive2d& prim0, const Primitive2d& prim1)
-            //    {
-            //        return prim0.Depth > prim1.Depth; // @todo Weird reverse order necessary here.
-            //    });
-            //}
-        };
-        executor.AddTasks(sortTasks).wait();
+        _drawCallCount = 0;
 
-        // @todo Intermediate data -> renderer-ready data. At later stages, outside this method, renderer-ready data -> GPU copy-ready data.
+        // Clear render-side data. Containers retain their capacity.
+        _sortKeys2d.clear();
+        _sortKeys3d.clear();
+        _buckets2d.clear();
+        _buckets3d.clear();
+        _batcher2d.Clear();
+        _debugShapeBatcher.Clear();
     }
 
-    void RendererBase::ClearFrameData()
+    void RendererBase::ProcessCaptures()
     {
-        _drawCallCount = 0;
+        const auto& fs = g_App.GetFilesystem();
 
-        _primitives2d.clear();
-        _sprites2d.clear();
-        _debugPrimitives3d.clear();
-        _debugGuiDrawCalls.clear();
+        // Screenshot.
+        if (_isScreenshotRequested.exchange(false, std::memory_order_acq_rel))
+        {
+            auto frame = _captureQueue.AcquireFrame();
+            if (frame != nullptr)
+            {
+                auto timestamp      = GetCurrentDateString() + "_" + GetCurrentTimeString();
+                frame->Path         = fs.GetScreenshotsDirectory() / (SCREENSHOT_FILENAME_BASE + timestamp);
+                frame->Format       = CaptureFormat::Png;
+                frame->IsBottomUp   = false;
+                frame->IsBgra       = false;
+                frame->IsContinuous = false;
+                if (CopyFramePixels(frame))
+                {
+                    if (frame != nullptr)
+                    {
+                        _captureQueue.Submit(std::move(frame));
+                    }
+                    Debug::Log("Saving screenshot.", Debug::LogLevel::Info, Debug::LogMode::All, true);
+                }
+                else
+                {
+                    _captureQueue.Release(std::move(frame));
+                    Debug::Log("Failed to capture screenshot.", Debug::LogLevel::Warning, Debug::LogMode::All, true);
+                }
+            }
+            else
+            {
+                Debug::Log("Failed to capture screenshot: capture queue is full.", Debug::LogLevel::Warning, Debug::LogMode::All, true);
+            }
+        }
+
+        // Continuous capture.
+        bool isContinuousCapture = _isContinuousCapture.load(std::memory_order_acquire);
+        if (isContinuousCapture != _isCaptureActive)
+        {
+            // Start new numbered sequence.
+            if (isContinuousCapture)
+            {
+                auto timestamp   = GetCurrentDateString() + "_" + GetCurrentTimeString();
+                _captureDir      = fs.GetScreenshotsDirectory() / (CAPTURE_DIR_NAME_BASE + timestamp);
+                _captureFrameIdx = 0;
+            }
+
+            _isCaptureActive = isContinuousCapture;
+        }
+
+        if (_isCaptureActive)
+        {
+            // Frame numbers advance even if a frame is dropped, so gaps in the sequence reveal drops.
+            uint frameIdx = _captureFrameIdx++;
+
+            auto frame = _captureQueue.AcquireFrame();
+            if (frame != nullptr)
+            {
+                frame->Path         = _captureDir / Fmt("{}{:06}", CAPTURE_FRAME_NAME_BASE, frameIdx);
+                frame->Format       = CaptureFormat::Raw;
+                frame->IsBottomUp   = false;
+                frame->IsBgra       = false;
+                frame->IsContinuous = true;
+                if (CopyFramePixels(frame))
+                {
+                    if (frame != nullptr)
+                    {
+                        _captureQueue.Submit(std::move(frame));
+                    }
+                }
+                else
+                {
+                    _captureQueue.Release(std::move(frame));
+                }
+            }
+        }
     }
 
     bool RendererBase::CheckDebugPage(Debug::Page page) const
@@ -361,6 +551,14 @@ namespace Silent::Renderer
             {
                 return std::make_unique<SdlGpuRenderer>();
             }
+            case RendererType::Software:
+            {
+                return std::make_unique<SoftwareRenderer>();
+            }
+            case RendererType::Null:
+            {
+                return std::make_unique<NullRenderer>();
+            }
         }
 
         return nullptr;
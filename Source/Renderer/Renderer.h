@@ -1,22 +1,24 @@
 #pragma once
 
+#include "Renderer/Common/Capture.h"
 #include "Renderer/Common/Constants.h"
 #include "Renderer/Common/Enums.h"
+#include "Renderer/Common/FramePacing.h"
+#include "Renderer/Common/Objects/Graphic/Batch.h"
+#include "Renderer/Common/Objects/Graphic/Bucket.h"
+#include "Renderer/Common/Objects/Graphic/DebugShape.h"
+#include "Renderer/Common/Objects/Graphic/TextureAtlas.h"
 #include "Renderer/Common/Objects/Primitive2d.h"
 #include "Renderer/Common/Objects/Primitive3d.h"
 #include "Renderer/Common/Objects/Scene/Sprite2d.h"
 #include "Renderer/Common/Objects/Scene/Text.h"
+#include "Renderer/Common/Snapshot.h"
 #include "Renderer/Common/View.h"
+#include "Utils/FrameArena.h"
+#include "Utils/TripleBuffer.h"
 
 namespace Silent::Renderer
 {
-    /** @brief Renderer backend types. */
-    enum class RendererType
-    {
-        OpenGl,
-        SdlGpu
-    };
-
     class RendererBase
     {
     protected:
@@ -31,11 +33,29 @@ namespace Silent::Renderer
         uint         _drawCallCount = 0;
         bool         _isResized     = false;
         
-        std::vector<Primitive3d>           _primitives3d      = {};
-        std::vector<Primitive2d>           _primitives2d      = {};
-        std::vector<Sprite2d>              _sprites2d         = {};
-        std::vector<Primitive3d>           _debugPrimitives3d = {};
-        std::vector<std::function<void()>> _debugGuiDrawCalls = {};
+        Utils::TripleBuffer<RenderSnapshot> _snapshots     = {};                   /** Game thread writes, render worker reads. */
+        uint64                              _snapshotCount = 0;                    /** Published snapshots. Accessed by game thread only. */
+        FramePacingMonitor                  _framePacing   = FramePacingMonitor(); /** Accessed by render worker only. */
+
+        std::vector<SortKey> _sortKeys2d    = {}; /** Sorted 2D primitive and sprite keys. */
+        std::vector<SortKey> _sortKeys3d    = {}; /** Sorted 3D primitive and debug primitive keys. */
+        std::vector<SortKey> _sortScratch2d = {};
+        std::vector<SortKey> _sortScratch3d = {};
+        std::vector<Bucket>  _buckets2d     = {}; /** Buckets referencing `_sortKeys2d`. */
+        std::vector<Bucket>  _buckets3d     = {}; /** Buckets referencing `_sortKeys3d`. */
+        BucketStats          _bucketStats2d = {};
+        BucketStats          _bucketStats3d = {};
+        Batcher              _batcher2d     = Batcher(); /** 2D batches built from `_sortKeys2d`. */
+        TextureAtlas         _textureAtlas  = {};        /** Shared pages of small sprite textures. Accessed by render worker only. */
+
+        DebugShapeBatcher _debugShapeBatcher = DebugShapeBatcher(); /** Debug shape instance stream. */
+
+        CaptureQueue          _captureQueue          = {};    /** Background PNG and raw frame writer. */
+        std::atomic<bool>     _isScreenshotRequested = false; /** Set by game thread, consumed by render worker. */
+        std::atomic<bool>     _isContinuousCapture   = false; /** Set by game thread, read by render worker. */
+        bool                  _isCaptureActive       = false; /** Continuous capture sequence in progress. Accessed by render worker only. */
+        uint                  _captureFrameIdx       = 0;     /** Next continuous capture frame number. Accessed by render worker only. */
+        std::filesystem::path _captureDir            = {};    /** Continuous capture sequence folder. Accessed by render worker only. */
 
     public:
         // =============
@@ -67,6 +87,36 @@ namespace Silent::Renderer
          */
         uint GetDrawCallCount() const;
 
+        /** @brief Gets the combined 2D and 3D bucketing statistics for the current render tick.
+         *
+         * @return Bucketing statistics.
+         */
+        BucketStats GetBucketStats() const;
+
+        /** @brief Gets the sprite texture atlas statistics.
+         *
+         * @return Texture atlas statistics.
+         */
+        TextureAtlasStats GetTextureAtlasStats() const;
+
+        /** @brief Gets the frame arena holding the vertex data of the snapshot being rendered.
+         *
+         * @return Frame arena.
+         */
+        const Utils::FrameArena& GetFrameArena() const;
+
+        /** @brief Gets the frame pacing and input-to-submission latency statistics of the render worker.
+         *
+         * @return Frame pacing statistics.
+         */
+        const FramePacingStats& GetFramePacingStats() const;
+
+        /** @brief Gets the screenshot and frame capture statistics.
+         *
+         * @return Capture statistics.
+         */
+        CaptureStats GetCaptureStats();
+
         // ========
         // Setters
         // ========
@@ -84,6 +134,15 @@ namespace Silent::Renderer
         /** @brief Signals a viewport resize. */
         void SignalResize();
 
+        /** @brief Starts or stops continuous capture of every rendered frame as numbered raw files in a new `Screenshots` subfolder. */
+        void ToggleContinuousCapture();
+
+        /** @brief Publishes the submissions of the current game tick to the render worker and starts a new snapshot. Never blocks.
+         *
+         * @param inputTime Time of the input poll preceding the tick's submissions.
+         */
+        void PublishSnapshot(RenderSnapshot::TimeType inputTime);
+
         /** @brief Submits a 2D primitive for drawing.
          *
          * @param prim 2D primitive to draw.
@@ -119,8 +178,10 @@ namespace Silent::Renderer
         /** @brief Prepares all GPU data and draws to the render surface. */
         virtual void Update() = 0;
 
-        /** @brief Saves a screenshot of the active render surface to the designated `Screenshots` folder on the system. */
-        virtual void SaveScreenshot() const = 0;
+        /** @brief Requests a screenshot of the next rendered frame, saved to the designated `Screenshots` folder on the system.
+         * Never blocks. Pixels are copied into a pooled buffer by the render worker, and PNG encoding happens on a background thread.
+         */
+        virtual void SaveScreenshot();
 
         // ======
         // Debug
@@ -137,9 +198,9 @@ namespace Silent::Renderer
 
         /** @brief Submits a function used to construct an ImGui debug GUI for drawing.
          *
-         * @param drawFunc Function defining a debug GUI.
+         * @param drawFunc Captureless function defining a debug GUI.
          */
-        void SubmitDebugGui(std::function<void()> drawFunc);
+        void SubmitDebugGui(void (*drawFunc)());
 
         /** @brief Submits a 3D line with additive blending for drawing.
          * Used to construct more complex geometry.
@@ -231,12 +292,48 @@ namespace Silent::Renderer
         // Helpers
         // ========
 
-        /** @brief Prepares renderer data used for the current frame. Called at the start of `Update`. */
+        /** @brief Prepares renderer data used for the current frame. Called at the start of `Update`.
+         * Acquires the latest published snapshot, then radix-sorts its 2D and 3D submissions into buckets in parallel.
+         */
         void PrepareFrameData();
 
-        /** @brief Clears renderer data used for the previous frame. Called at the end of `Update`. */
+        /** @brief Generates and sorts 2D primitive and sprite keys, then collects them into buckets and batches. */
+        void Prepare2dBuckets();
+
+        /** @brief Generates and sorts 3D primitive and debug primitive keys, then collects them into buckets. */
+        void Prepare3dBuckets();
+
+        /** @brief Groups debug shape submissions by unit mesh into an instance stream. */
+        void PrepareDebugShapes();
+
+        /** @brief Submits a debug shape instance for drawing.
+         *
+         * @param type Debug shape type.
+         * @param transform Transform from unit mesh space to world space.
+         * @param color Shape color.
+         * @param isWireframe If the shape should be wireframe or solid.
+         * @param page Debug page in which the shape will be visible.
+         */
+        void SubmitDebugShape(DebugShapeType type, const Matrix& transform, const Color& color, bool isWireframe, Debug::Page page);
+
+        /** @brief Clears render-side data used for the current frame. Called at the end of `Update`.
+         * Snapshot submissions are left intact and cleared by the game thread when it reclaims the snapshot.
+         */
         void ClearFrameData();
 
+        /** @brief Copies the rendered frame of pending screenshot and continuous capture requests into pooled buffers
+         * and queues them for writing. Called by backends after drawing and before presenting.
+         */
+        void ProcessCaptures();
+
+        /** @brief Copies the pixels of the rendered frame into a capture frame.
+         * Backends with asynchronous readback may take ownership of the frame and submit it to `_captureQueue` once the copy completes.
+         *
+         * @param frame Capture frame to fill. Its pixel buffer should be resized rather than reallocated. Null on return if ownership was taken.
+         * @return `true` if pixels were copied or the copy was started, `false` otherwise.
+         */
+        virtual bool CopyFramePixels(std::unique_ptr<CaptureFrame>& frame) = 0;
+
         /** @brief Checks if a debug page is open in the debug menu.
          *
          * @return `true` if the debug page is open, `false` otherwise.
@@ -0,0 +1,35 @@
+struct Input
+{
+    float3 Position   : TEXCOORD0;
+    float4 Transform0 : TEXCOORD1;
+    float4 Transform1 : TEXCOORD2;
+    float4 Transform2 : TEXCOORD3;
+    float4 Transform3 : TEXCOORD4;
+    float4 Color      : TEXCOORD5;
+};
+
+struct Output
+{
+    float4 Position : SV_Position;
+    float4 Color    : TEXCOORD0;
+};
+
+cbuffer UniformBlock : register(b0, space1)
+{
+    float4x4 ViewProjection;
+};
+
+Output main(Input input)
+{
+    Output output;
+
+    // Transform unit mesh vertex by per-instance column-major matrix.
+    float4 worldPos = (input.Transform0 * input.Position.x) +
+                      (input.Transform1 * input.Position.y) +
+                      (input.Transform2 * input.Position.z) +
+                      input.Transform3;
+
+    output.Position = mul(ViewProjection, worldPos);
+    output.Color    = input.Color;
+    return output;
+}
@@ -2,11 +2,13 @@ struct Input
 {
     float3 Position : TEXCOORD0;
     float2 TexCoord : TEXCOORD1;
+    float4 Color    : TEXCOORD2;
 };
 
 struct Output
 {
     float2 TexCoord : TEXCOORD0;
+    float4 Color    : TEXCOORD1;
     float4 Position : SV_Position;
 };
 
@@ -15,6 +17,7 @@ Output main(Input input)
     Output output;
 
     output.TexCoord = input.TexCoord;
+    output.Color    = input.Color;
     output.Position = float4(input.Position, 1.0f);
     return output;
 }
@@ -16,149 +16,336 @@ static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
 namespace Silent {
 namespace Buffers {
 
-struct Stuff;
-struct StuffBuilder;
+struct Vector3;
 
-struct Things;
-struct ThingsBuilder;
+struct InventoryItem;
+
+struct Bitfield;
+struct BitfieldBuilder;
+
+struct SavegameMetadata;
+struct SavegameMetadataBuilder;
+
+struct Player;
+struct PlayerBuilder;
 
 struct Savegame;
 struct SavegameBuilder;
 
-struct Stuff FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
-  typedef StuffBuilder Builder;
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Vector3 FLATBUFFERS_FINAL_CLASS {
+ private:
+  float x_;
+  float y_;
+  float z_;
+
+ public:
+  Vector3()
+      : x_(0),
+        y_(0),
+        z_(0) {
+  }
+  Vector3(float _x, float _y, float _z)
+      : x_(::flatbuffers::EndianScalar(_x)),
+        y_(::flatbuffers::EndianScalar(_y)),
+        z_(::flatbuffers::EndianScalar(_z)) {
+  }
+  float x() const {
+    return ::flatbuffers::EndianScalar(x_);
+  }
+  float y() const {
+    return ::flatbuffers::EndianScalar(y_);
+  }
+  float z() const {
+    return ::flatbuffers::EndianScalar(z_);
+  }
+};
+FLATBUFFERS_STRUCT_END(Vector3, 12);
+
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) InventoryItem FLATBUFFERS_FINAL_CLASS {
+ private:
+  int32_t id_;
+  int32_t count_;
+
+ public:
+  InventoryItem()
+      : id_(0),
+        count_(0) {
+  }
+  InventoryItem(int32_t _id, int32_t _count)
+      : id_(::flatbuffers::EndianScalar(_id)),
+        count_(::flatbuffers::EndianScalar(_count)) {
+  }
+  int32_t id() const {
+    return ::flatbuffers::EndianScalar(id_);
+  }
+  int32_t count() const {
+    return ::flatbuffers::EndianScalar(count_);
+  }
+};
+FLATBUFFERS_STRUCT_END(InventoryItem, 8);
+
+struct Bitfield FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef BitfieldBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_MY_INT = 4,
-    VT_MY_BOOL = 6
+    VT_SIZE = 4,
+    VT_CHUNKS = 6
   };
-  int32_t my_int() const {
-    return GetField<int32_t>(VT_MY_INT, 0);
+  uint32_t size() const {
+    return GetField<uint32_t>(VT_SIZE, 0);
   }
-  bool my_bool() const {
-    return GetField<uint8_t>(VT_MY_BOOL, 0) != 0;
+  const ::flatbuffers::Vector<uint32_t> *chunks() const {
+    return GetPointer<const ::flatbuffers::Vector<uint32_t> *>(VT_CHUNKS);
   }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
-           VerifyField<int32_t>(verifier, VT_MY_INT, 4) &&
-           VerifyField<uint8_t>(verifier, VT_MY_BOOL, 1) &&
+           VerifyField<uint32_t>(verifier, VT_SIZE, 4) &&
+           VerifyOffset(verifier, VT_CHUNKS) &&
+           verifier.VerifyVector(chunks()) &&
            verifier.EndTable();
   }
 };
 
-struct StuffBuilder {
-  typedef Stuff Table;
+struct BitfieldBuilder {
+  typedef Bitfield Table;
   ::flatbuffers::FlatBufferBuilder &fbb_;
   ::flatbuffers::uoffset_t start_;
-  void add_my_int(int32_t my_int) {
-    fbb_.AddElement<int32_t>(Stuff::VT_MY_INT, my_int, 0);
+  void add_size(uint32_t size) {
+    fbb_.AddElement<uint32_t>(Bitfield::VT_SIZE, size, 0);
   }
-  void add_my_bool(bool my_bool) {
-    fbb_.AddElement<uint8_t>(Stuff::VT_MY_BOOL, static_cast<uint8_t>(my_bool), 0);
+  void add_chunks(::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> chunks) {
+    fbb_.AddOffset(Bitfield::VT_CHUNKS, chunks);
   }
-  explicit StuffBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+  explicit BitfieldBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
   }
-  ::flatbuffers::Offset<Stuff> Finish() {
+  ::flatbuffers::Offset<Bitfield> Finish() {
     const auto end = fbb_.EndTable(start_);
-    auto o = ::flatbuffers::Offset<Stuff>(end);
+    auto o = ::flatbuffers::Offset<Bitfield>(end);
     return o;
   }
 };
 
-inline ::flatbuffers::Offset<Stuff> CreateStuff(
+inline ::flatbuffers::Offset<Bitfield> CreateBitfield(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    int32_t my_int = 0,
-    bool my_bool = false) {
-  StuffBuilder builder_(_fbb);
-  builder_.add_my_int(my_int);
-  builder_.add_my_bool(my_bool);
+    uint32_t size = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> chunks = 0) {
+  BitfieldBuilder builder_(_fbb);
+  builder_.add_chunks(chunks);
+  builder_.add_size(size);
   return builder_.Finish();
 }
 
-struct Things FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
-  typedef ThingsBuilder Builder;
+inline ::flatbuffers::Offset<Bitfield> CreateBitfieldDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t size = 0,
+    const std::vector<uint32_t> *chunks = nullptr) {
+  auto chunks__ = chunks ? _fbb.CreateVector<uint32_t>(*chunks) : 0;
+  return Silent::Buffers::CreateBitfield(
+      _fbb,
+      size,
+      chunks__);
+}
+
+struct SavegameMetadata FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef SavegameMetadataBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_MY_INT = 4,
-    VT_MY_BOOLS = 6
+    VT_SAVE_COUNT = 4,
+    VT_LOCATION_ID = 6,
+    VT_GAMEPLAY_TIMER = 8,
+    VT_IS_NEXT_FEAR_MODE = 10,
+    VT_FLAGS = 12
   };
-  int32_t my_int() const {
-    return GetField<int32_t>(VT_MY_INT, 0);
+  int32_t save_count() const {
+    return GetField<int32_t>(VT_SAVE_COUNT, 0);
+  }
+  int32_t location_id() const {
+    return GetField<int32_t>(VT_LOCATION_ID, 0);
+  }
+  uint32_t gameplay_timer() const {
+    return GetField<uint32_t>(VT_GAMEPLAY_TIMER, 0);
   }
-  const ::flatbuffers::Vector<uint8_t> *my_bools() const {
-    return GetPointer<const ::flatbuffers::Vector<uint8_t> *>(VT_MY_BOOLS);
+  bool is_next_fear_mode() const {
+    return GetField<uint8_t>(VT_IS_NEXT_FEAR_MODE, 0) != 0;
+  }
+  int32_t flags() const {
+    return GetField<int32_t>(VT_FLAGS, 0);
   }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
-           VerifyField<int32_t>(verifier, VT_MY_INT, 4) &&
-           VerifyOffset(verifier, VT_MY_BOOLS) &&
-           verifier.VerifyVector(my_bools()) &&
+           VerifyField<int32_t>(verifier, VT_SAVE_COUNT, 4) &&
+           VerifyField<int32_t>(verifier, VT_LOCATION_ID, 4) &&
+           VerifyField<uint32_t>(verifier, VT_GAMEPLAY_TIMER, 4) &&
+           VerifyField<uint8_t>(verifier, VT_IS_NEXT_FEAR_MODE, 1) &&
+           VerifyField<int32_t>(verifier, VT_FLAGS, 4) &&
            verifier.EndTable();
   }
 };
 
-struct ThingsBuilder {
-  typedef Things Table;
+struct SavegameMetadataBuilder {
+  typedef SavegameMetadata Table;
   ::flatbuffers::FlatBufferBuilder &fbb_;
   ::flatbuffers::uoffset_t start_;
-  void add_my_int(int32_t my_int) {
-    fbb_.AddElement<int32_t>(Things::VT_MY_INT, my_int, 0);
+  void add_save_count(int32_t save_count) {
+    fbb_.AddElement<int32_t>(SavegameMetadata::VT_SAVE_COUNT, save_count, 0);
+  }
+  void add_location_id(int32_t location_id) {
+    fbb_.AddElement<int32_t>(SavegameMetadata::VT_LOCATION_ID, location_id, 0);
+  }
+  void add_gameplay_timer(uint32_t gameplay_timer) {
+    fbb_.AddElement<uint32_t>(SavegameMetadata::VT_GAMEPLAY_TIMER, gameplay_timer, 0);
+  }
+  void add_is_next_fear_mode(bool is_next_fear_mode) {
+    fbb_.AddElement<uint8_t>(SavegameMetadata::VT_IS_NEXT_FEAR_MODE, static_cast<uint8_t>(is_next_fear_mode), 0);
   }
-  void add_my_bools(::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> my_bools) {
-    fbb_.AddOffset(Things::VT_MY_BOOLS, my_bools);
+  void add_flags(int32_t flags) {
+    fbb_.AddElement<int32_t>(SavegameMetadata::VT_FLAGS, flags, 0);
   }
-  explicit ThingsBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+  explicit SavegameMetadataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
   }
-  ::flatbuffers::Offset<Things> Finish() {
+  ::flatbuffers::Offset<SavegameMetadata> Finish() {
     const auto end = fbb_.EndTable(start_);
-    auto o = ::flatbuffers::Offset<Things>(end);
+    auto o = ::flatbuffers::Offset<SavegameMetadata>(end);
     return o;
   }
 };
 
-inline ::flatbuffers::Offset<Things> CreateThings(
+inline ::flatbuffers::Offset<SavegameMetadata> CreateSavegameMetadata(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    int32_t my_int = 0,
-    ::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> my_bools = 0) {
-  ThingsBuilder builder_(_fbb);
-  builder_.add_my_bools(my_bools);
-  builder_.add_my_int(my_int);
+    int32_t save_count = 0,
+    int32_t location_id = 0,
+    uint32_t gameplay_timer = 0,
+    bool is_next_fear_mode = false,
+    int32_t flags = 0) {
+  SavegameMetadataBuilder builder_(_fbb);
+  builder_.add_flags(flags);
+  builder_.add_gameplay_timer(gameplay_timer);
+  builder_.add_location_id(location_id);
+  builder_.add_save_count(save_count);
+  builder_.add_is_next_fear_mode(is_next_fear_mode);
   return builder_.Finish();
 }
 
-inline ::flatbuffers::Offset<Things> CreateThingsDirect(
+struct Player FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef PlayerBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_POSITION = 4,
+    VT_ROTATION = 6,
+    VT_HEALTH = 8
+  };
+  const Silent::Buffers::Vector3 *position() const {
+    return GetStruct<const Silent::Buffers::Vector3 *>(VT_POSITION);
+  }
+  float rotation() const {
+    return GetField<float>(VT_ROTATION, 0.0f);
+  }
+  float health() const {
+    return GetField<float>(VT_HEALTH, 0.0f);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<Silent::Buffers::Vector3>(verifier, VT_POSITION, 4) &&
+           VerifyField<float>(verifier, VT_ROTATION, 4) &&
+           VerifyField<float>(verifier, VT_HEALTH, 4) &&
+           verifier.EndTable();
+  }
+};
+
+struct PlayerBuilder {
+  typedef Player Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_position(const Silent::Buffers::Vector3 *position) {
+    fbb_.AddStruct(Player::VT_POSITION, position);
+  }
+  void add_rotation(float rotation) {
+    fbb_.AddElement<float>(Player::VT_ROTATION, rotation, 0.0f);
+  }
+  void add_health(float health) {
+    fbb_.AddElement<float>(Player::VT_HEALTH, health, 0.0f);
+  }
+  explicit PlayerBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<Player> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<Player>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<Player> CreatePlayer(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    int32_t my_int = 0,
-    const std::vector<uint8_t> *my_bools = nullptr) {
-  auto my_bools__ = my_bools ? _fbb.CreateVector<uint8_t>(*my_bools) : 0;
-  return Silent::Buffers::CreateThings(
-      _fbb,
-      my_int,
-      my_bools__);
+    const Silent::Buffers::Vector3 *position = nullptr,
+    float rotation = 0.0f,
+    float health = 0.0f) {
+  PlayerBuilder builder_(_fbb);
+  builder_.add_health(health);
+  builder_.add_rotation(rotation);
+  builder_.add_position(position);
+  return builder_.Finish();
 }
 
 struct Savegame FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   typedef SavegameBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_STUFF = 4,
-    VT_THINGS = 6
+    VT_METADATA = 4,
+    VT_MAP_ID = 6,
+    VT_DIFFICULTY = 8,
+    VT_PLAYER = 10,
+    VT_INVENTORY = 12,
+    VT_EVENT_FLAGS = 14,
+    VT_PICKUP_FLAGS = 16,
+    VT_DELTA = 18,
+    VT_DELTA_BASE_HASH = 20
   };
-  const ::flatbuffers::Vector<::flatbuffers::Offset<Silent::Buffers::Stuff>> *stuff() const {
-    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<Silent::Buffers::Stuff>> *>(VT_STUFF);
+  const Silent::Buffers::SavegameMetadata *metadata() const {
+    return GetPointer<const Silent::Buffers::SavegameMetadata *>(VT_METADATA);
+  }
+  int32_t map_id() const {
+    return GetField<int32_t>(VT_MAP_ID, 0);
+  }
+  int32_t difficulty() const {
+    return GetField<int32_t>(VT_DIFFICULTY, 0);
   }
-  const ::flatbuffers::Vector<::flatbuffers::Offset<Silent::Buffers::Things>> *things() const {
-    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<Silent::Buffers::Things>> *>(VT_THINGS);
+  const Silent::Buffers::Player *player() const {
+    return GetPointer<const Silent::Buffers::Player *>(VT_PLAYER);
+  }
+  const ::flatbuffers::Vector<const Silent::Buffers::InventoryItem *> *inventory() const {
+    return GetPointer<const ::flatbuffers::Vector<const Silent::Buffers::InventoryItem *> *>(VT_INVENTORY);
+  }
+  const Silent::Buffers::Bitfield *event_flags() const {
+    return GetPointer<const Silent::Buffers::Bitfield *>(VT_EVENT_FLAGS);
+  }
+  const Silent::Buffers::Bitfield *pickup_flags() const {
+    return GetPointer<const Silent::Buffers::Bitfield *>(VT_PICKUP_FLAGS);
+  }
+  const ::flatbuffers::Vector<uint8_t> *delta() const {
+    return GetPointer<const ::flatbuffers::Vector<uint8_t> *>(VT_DELTA);
+  }
+  uint32_t delta_base_hash() const {
+    return GetField<uint32_t>(VT_DELTA_BASE_HASH, 0);
   }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
-           VerifyOffset(verifier, VT_STUFF) &&
-           verifier.VerifyVector(stuff()) &&
-           verifier.VerifyVectorOfTables(stuff()) &&
-           VerifyOffset(verifier, VT_THINGS) &&
-           verifier.VerifyVector(things()) &&
-           verifier.VerifyVectorOfTables(things()) &&
+           VerifyOffset(verifier, VT_METADATA) &&
+           verifier.VerifyTable(metadata()) &&
+           VerifyField<int32_t>(verifier, VT_MAP_ID, 4) &&
+           VerifyField<int32_t>(verifier, VT_DIFFICULTY, 4) &&
+           VerifyOffset(verifier, VT_PLAYER) &&
+           verifier.VerifyTable(player()) &&
+           VerifyOffset(verifier, VT_INVENTORY) &&
+           verifier.VerifyVector(inventory()) &&
+           VerifyOffset(verifier, VT_EVENT_FLAGS) &&
+           verifier.VerifyTable(event_flags()) &&
+           VerifyOffset(verifier, VT_PICKUP_FLAGS) &&
+           verifier.VerifyTable(pickup_flags()) &&
+           VerifyOffset(verifier, VT_DELTA) &&
+           verifier.VerifyVector(delta()) &&
+           VerifyField<uint32_t>(verifier, VT_DELTA_BASE_HASH, 4) &&
            verifier.EndTable();
   }
 };
@@ -167,11 +354,32 @@ struct SavegameBuilder {
   typedef Savegame Table;
   ::flatbuffers::FlatBufferBuilder &fbb_;
   ::flatbuffers::uoffset_t start_;
-  void add_stuff(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<Silent::Buffers::Stuff>>> stuff) {
-    fbb_.AddOffset(Savegame::VT_STUFF, stuff);
+  void add_metadata(::flatbuffers::Offset<Silent::Buffers::SavegameMetadata> metadata) {
+    fbb_.AddOffset(Savegame::VT_METADATA, metadata);
+  }
+  void add_map_id(int32_t map_id) {
+    fbb_.AddElement<int32_t>(Savegame::VT_MAP_ID, map_id, 0);
+  }
+  void add_difficulty(int32_t difficulty) {
+    fbb_.AddElement<int32_t>(Savegame::VT_DIFFICULTY, difficulty, 0);
+  }
+  void add_player(::flatbuffers::Offset<Silent::Buffers::Player> player) {
+    fbb_.AddOffset(Savegame::VT_PLAYER, player);
+  }
+  void add_inventory(::flatbuffers::Offset<::flatbuffers::Vector<const Silent::Buffers::InventoryItem *>> inventory) {
+    fbb_.AddOffset(Savegame::VT_INVENTORY, inventory);
   }
-  void add_things(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<Silent::Buffers::Things>>> things) {
-    fbb_.AddOffset(Savegame::VT_THINGS, things);
+  void add_event_flags(::flatbuffers::Offset<Silent::Buffers::Bitfield> event_flags) {
+    fbb_.AddOffset(Savegame::VT_EVENT_FLAGS, event_flags);
+  }
+  void add_pickup_flags(::flatbuffers::Offset<Silent::Buffers::Bitfield> pickup_flags) {
+    fbb_.AddOffset(Savegame::VT_PICKUP_FLAGS, pickup_flags);
+  }
+  void add_delta(::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> delta) {
+    fbb_.AddOffset(Savegame::VT_DELTA, delta);
+  }
+  void add_delta_base_hash(uint32_t delta_base_hash) {
+    fbb_.AddElement<uint32_t>(Savegame::VT_DELTA_BASE_HASH, delta_base_hash, 0);
   }
   explicit SavegameBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
@@ -186,24 +394,52 @@ struct SavegameBuilder {
 
 inline ::flatbuffers::Offset<Savegame> CreateSavegame(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<Silent::Buffers::Stuff>>> stuff = 0,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<Silent::Buffers::Things>>> things = 0) {
+    ::flatbuffers::Offset<Silent::Buffers::SavegameMetadata> metadata = 0,
+    int32_t map_id = 0,
+    int32_t difficulty = 0,
+    ::flatbuffers::Offset<Silent::Buffers::Player> player = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const Silent::Buffers::InventoryItem *>> inventory = 0,
+    ::flatbuffers::Offset<Silent::Buffers::Bitfield> event_flags = 0,
+    ::flatbuffers::Offset<Silent::Buffers::Bitfield> pickup_flags = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> delta = 0,
+    uint32_t delta_base_hash = 0) {
   SavegameBuilder builder_(_fbb);
-  builder_.add_things(things);
-  builder_.add_stuff(stuff);
+  builder_.add_delta_base_hash(delta_base_hash);
+  builder_.add_delta(delta);
+  builder_.add_pickup_flags(pickup_flags);
+  builder_.add_event_flags(event_flags);
+  builder_.add_inventory(inventory);
+  builder_.add_player(player);
+  builder_.add_difficulty(difficulty);
+  builder_.add_map_id(map_id);
+  builder_.add_metadata(metadata);
   return builder_.Finish();
 }
 
 inline ::flatbuffers::Offset<Savegame> CreateSavegameDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    const std::vector<::flatbuffers::Offset<Silent::Buffers::Stuff>> *stuff = nullptr,
-    const std::vector<::flatbuffers::Offset<Silent::Buffers::Things>> *things = nullptr) {
-  auto stuff__ = stuff ? _fbb.CreateVector<::flatbuffers::Offset<Silent::Buffers::Stuff>>(*stuff) : 0;
-  auto things__ = things ? _fbb.CreateVector<::flatbuffers::Offset<Silent::Buffers::Things>>(*things) : 0;
+    ::flatbuffers::Offset<Silent::Buffers::SavegameMetadata> metadata = 0,
+    int32_t map_id = 0,
+    int32_t difficulty = 0,
+    ::flatbuffers::Offset<Silent::Buffers::Player> player = 0,
+    const std::vector<Silent::Buffers::InventoryItem> *inventory = nullptr,
+    ::flatbuffers::Offset<Silent::Buffers::Bitfield> event_flags = 0,
+    ::flatbuffers::Offset<Silent::Buffers::Bitfield> pickup_flags = 0,
+    const std::vector<uint8_t> *delta = nullptr,
+    uint32_t delta_base_hash = 0) {
+  auto inventory__ = inventory ? _fbb.CreateVectorOfStructs<Silent::Buffers::InventoryItem>(*inventory) : 0;
+  auto delta__ = delta ? _fbb.CreateVector<uint8_t>(*delta) : 0;
   return Silent::Buffers::CreateSavegame(
       _fbb,
-      stuff__,
-      things__);
+      metadata,
+      map_id,
+      difficulty,
+      player,
+      inventory__,
+      event_flags,
+      pickup_flags,
+      delta__,
+      delta_base_hash);
 }
 
 inline const Silent::Buffers::Savegame *GetSavegame(const void *buf) {
@@ -214,26 +450,40 @@ inline const Silent::Buffers::Savegame *GetSizePrefixedSavegame(const void *buf)
   return ::flatbuffers::GetSizePrefixedRoot<Silent::Buffers::Savegame>(buf);
 }
 
+inline const char *SavegameIdentifier() {
+  return "SSAV";
+}
+
+inline bool SavegameBufferHasIdentifier(const void *buf) {
+  return ::flatbuffers::BufferHasIdentifier(
+      buf, SavegameIdentifier());
+}
+
+inline bool SizePrefixedSavegameBufferHasIdentifier(const void *buf) {
+  return ::flatbuffers::BufferHasIdentifier(
+      buf, SavegameIdentifier(), true);
+}
+
 inline bool VerifySavegameBuffer(
     ::flatbuffers::Verifier &verifier) {
-  return verifier.VerifyBuffer<Silent::Buffers::Savegame>(nullptr);
+  return verifier.VerifyBuffer<Silent::Buffers::Savegame>(SavegameIdentifier());
 }
 
 inline bool VerifySizePrefixedSavegameBuffer(
     ::flatbuffers::Verifier &verifier) {
-  return verifier.VerifySizePrefixedBuffer<Silent::Buffers::Savegame>(nullptr);
+  return verifier.VerifySizePrefixedBuffer<Silent::Buffers::Savegame>(SavegameIdentifier());
 }
 
 inline void FinishSavegameBuffer(
     ::flatbuffers::FlatBufferBuilder &fbb,
     ::flatbuffers::Offset<Silent::Buffers::Savegame> root) {
-  fbb.Finish(root);
+  fbb.Finish(root, SavegameIdentifier());
 }
 
 inline void FinishSizePrefixedSavegameBuffer(
     ::flatbuffers::FlatBufferBuilder &fbb,
     ::flatbuffers::Offset<Silent::Buffers::Savegame> root) {
-  fbb.FinishSizePrefixed(root);
+  fbb.FinishSizePrefixed(root, SavegameIdentifier());
 }
 
 }  // namespace Buffers
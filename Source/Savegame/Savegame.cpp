@@ -3,8 +3,12 @@
 
 #include "Application.h"
 #include "Assets/TranslationKeys.h"
-#include "Savegame/Generated/savegame_generated.h"
+#include "Savegame/Generated/Savegame_generated.h"
+#include "Services/Clock.h"
 #include "Services/Filesystem.h"
+#include "Utils/Compression.h"
+#include "Utils/MappedFile.h"
+#include "Utils/Parallel.h"
 #include "Utils/Utils.h"
 
 using namespace Silent::Utils;
@@ -13,6 +17,47 @@ namespace Silent::Savegame
 {
     constexpr char SAVEGAME_SLOT_FILE_DIR_NAME_BASE[] = "File ";
     constexpr char SAVEGAME_SLOT_DIR_NAME_BASE[]      = "Slot ";
+    constexpr char SAVEGAME_INDEX_FILENAME[]          = "Index";
+    constexpr char SAVEGAME_INDEX_FILE_EXT[]          = ".index";
+    constexpr char SAVEGAME_BASE_FILENAME[]           = "Base";
+
+    constexpr float SNAPSHOT_DELTA_SIZE_RATIO_MAX = 0.5f; // Max delta size relative to full savegame size before full savegame is written instead.
+
+    constexpr uint32 SAVEGAME_INDEX_FILE_MAGIC   = 0x58444953; // "SIDX".
+    constexpr uint16 SAVEGAME_INDEX_FILE_VERSION = 1;
+
+    /** @brief Binary slot index file header. Followed by entries sorted by file and savegame index. */
+    struct SavegameIndexHeader
+    {
+        uint32 Magic      = 0;
+        uint16 Version    = 0;
+        uint16 Flags      = 0;
+        uint32 EntryCount = 0;
+    };
+    static_assert(sizeof(SavegameIndexHeader) == 12);
+
+    /** @brief Binary slot index file entry. */
+    struct SavegameIndexEntry
+    {
+        int64  WriteTime      = 0;  /** Savegame file write time in file clock ticks. */
+        int32  FileIdx        = 0;
+        int32  DataIdx        = 0;
+        int32  SaveCount      = 0;
+        int32  LocationId     = 0;
+        uint32 GameplayTimer  = 0;
+        int32  Flags          = 0;
+        uint8  IsNextFearMode = 0;
+        uint8  Padding[7]     = {};
+    };
+    static_assert(sizeof(SavegameIndexEntry) == 40);
+
+    /** @brief Savegame file found during a slot scan. */
+    struct SavegameFile
+    {
+        int                   FileIdx = 0;
+        int                   DataIdx = 0;
+        std::filesystem::path Path    = {};
+    };
 
     static const std::vector<std::string> SAVE_LOCATION_NAME_KEYS =
     {
@@ -43,6 +88,196 @@ namespace Silent::Savegame
         KEY_SAVE_LOC_NEXT_FEAR
     };
 
+    /** @brief Extracts the number from a savegame folder or file name.
+     *
+     * @param name Name such as "File 12" or "34".
+     * @return Number, or `NO_VALUE` if the name contains no digits.
+     */
+    static int ExtractNumber(const std::string& name)
+    {
+        auto numericStr = std::string();
+        for (char curChar : name)
+        {
+            if (std::isdigit(curChar))
+            {
+                numericStr += curChar;
+            }
+        }
+
+        return !numericStr.empty() ? std::stoi(numericStr) : NO_VALUE;
+    }
+
+    /** @brief Gets the metadata table of a savegame buffer in place.
+     * Only the root table and metadata table are verified, so the rest of the buffer is never touched.
+     *
+     * @param buffer Savegame buffer.
+     * @return Metadata table, or `nullptr` if the buffer is invalid.
+     */
+    static const Buffers::SavegameMetadata* GetMetadataBuffer(std::span<const byte> buffer)
+    {
+        if (buffer.size() < (sizeof(flatbuffers::uoffset_t) + flatbuffers::kFileIdentifierLength) ||
+            !Buffers::SavegameBufferHasIdentifier(buffer.data()))
+        {
+            return nullptr;
+        }
+
+        auto verifier = flatbuffers::Verifier((const uint8*)buffer.data(), buffer.size());
+        if (verifier.VerifyOffset(0) == 0)
+        {
+            return nullptr;
+        }
+
+        // Generated tables inherit `flatbuffers::Table` privately, so verify root table fields through base.
+        const auto* saveBuffer = Buffers::GetSavegame(buffer.data());
+        const auto* rootTable  = reinterpret_cast<const flatbuffers::Table*>(saveBuffer);
+        if (!rootTable->VerifyTableStart(verifier) || !rootTable->VerifyOffset(verifier, Buffers::Savegame::VT_METADATA) ||
+            saveBuffer->metadata() == nullptr || !verifier.VerifyTable(saveBuffer->metadata()) || !verifier.EndTable())
+        {
+            return nullptr;
+        }
+
+        return saveBuffer->metadata();
+    }
+
+    /** @brief Converts a bitfield buffer.
+     *
+     * @param bitfieldBuffer Bitfield buffer, or `nullptr` if absent.
+     * @return Bitfield.
+     */
+    static Bitfield FromBitfieldBuffer(const Buffers::Bitfield* bitfieldBuffer)
+    {
+        if (bitfieldBuffer == nullptr || bitfieldBuffer->chunks() == nullptr)
+        {
+            return Bitfield();
+        }
+
+        const auto& chunks = *bitfieldBuffer->chunks();
+        return Bitfield(std::vector<Bitfield::ChunkType>(chunks.begin(), chunks.end()), bitfieldBuffer->size());
+    }
+
+    /** @brief Converts slot metadata to a slot index buffer.
+     *
+     * @param slotMetadata Slot metadata.
+     * @return Slot index buffer.
+     */
+    static std::vector<byte> ToSlotIndexBuffer(std::span<const SavegameMetadata> slotMetadata)
+    {
+        auto header = SavegameIndexHeader
+        {
+            .Magic      = SAVEGAME_INDEX_FILE_MAGIC,
+            .Version    = SAVEGAME_INDEX_FILE_VERSION,
+            .EntryCount = (uint32)slotMetadata.size()
+        };
+
+        auto buffer = std::vector<byte>(sizeof(header) + (slotMetadata.size() * sizeof(SavegameIndexEntry)));
+        std::memcpy(buffer.data(), &header, sizeof(header));
+        for (int i = 0; i < slotMetadata.size(); i++)
+        {
+            const auto& metadata = slotMetadata[i];
+            auto        entry    = SavegameIndexEntry
+            {
+                .WriteTime      = metadata.WriteTime,
+                .FileIdx        = metadata.FileIdx,
+                .DataIdx        = metadata.DataIdx,
+                .SaveCount      = metadata.SaveCount,
+                .LocationId     = metadata.LocationId,
+                .GameplayTimer  = metadata.GameplayTimer,
+                .Flags          = metadata.Flags,
+                .IsNextFearMode = (uint8)metadata.IsNextFearMode
+            };
+            std::memcpy(&buffer[sizeof(header) + (i * sizeof(entry))], &entry, sizeof(entry));
+        }
+
+        return buffer;
+    }
+
+    /** @brief Writes a file atomically via a temporary file. Safe to call from a worker thread.
+     *
+     * @param filename File path.
+     * @param buffer File data.
+     * @param writeTime Optional write time to stamp the file with.
+     * @return `true` if written, `false` otherwise.
+     */
+    static bool WriteFileAtomically(const std::filesystem::path& filename, std::span<const byte> buffer, std::optional<std::filesystem::file_time_type> writeTime)
+    {
+        auto tempFile  = filename;
+        tempFile      += TEMP_FILE_EXT;
+
+        // Ensure directory exists.
+        auto error = std::error_code();
+        std::filesystem::create_directories(filename.parent_path(), error);
+
+        // Write temporary file.
+        {
+            auto file = std::ofstream(tempFile, std::ios::binary | std::ios::trunc);
+            file.write(buffer.data(), buffer.size());
+            if (!file)
+            {
+                Debug::Log(Fmt("Failed to write `{}`.", tempFile.string()), Debug::LogLevel::Error);
+                return false;
+            }
+        }
+
+        // Stamp write time before replacing so it's never observed unstamped.
+        if (writeTime.has_value())
+        {
+            std::filesystem::last_write_time(tempFile, *writeTime, error);
+            if (error)
+            {
+                Debug::Log(Fmt("Failed to set write time of `{}`: {}", tempFile.string(), error.message()), Debug::LogLevel::Warning);
+            }
+        }
+
+        // Replace previous file. Readers see either the old or new file, never a partial one.
+        std::filesystem::rename(tempFile, filename, error);
+        if (error)
+        {
+            Debug::Log(Fmt("Failed to replace `{}`: {}", filename.string(), error.message()), Debug::LogLevel::Error);
+            return false;
+        }
+
+        return true;
+    }
+
+    /** @brief Hashes a buffer with 32-bit FNV-1a.
+     *
+     * @param buffer Buffer.
+     * @return Hash.
+     */
+    static uint32 HashBuffer(std::span<const byte> buffer)
+    {
+        constexpr uint32 FNV_OFFSET_BASIS = 2166136261u;
+        constexpr uint32 FNV_PRIME        = 16777619u;
+
+        uint32 hash = FNV_OFFSET_BASIS;
+        for (byte curByte : buffer)
+        {
+            hash = (hash ^ (uint8)curByte) * FNV_PRIME;
+        }
+
+        return hash;
+    }
+
+    /** @brief Gets the total size of all files in a directory tree.
+     *
+     * @param dir Directory path.
+     * @return Size in bytes, or 0 if the directory is missing.
+     */
+    static uint64 GetDirectorySize(const std::filesystem::path& dir)
+    {
+        auto   error = std::error_code();
+        uint64 size  = 0;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(dir, error))
+        {
+            if (entry.is_regular_file(error))
+            {
+                size += entry.file_size(error);
+            }
+        }
+
+        return size;
+    }
+
     const std::vector<SavegameMetadata>& SavegameManager::GetSlotMetadata(int slotIdx)
     {
         Debug::Assert(slotIdx < _slotMetadata.size(), "Attempted to get metadata for invalid save slot.");
@@ -50,62 +285,381 @@ namespace Silent::Savegame
         return _slotMetadata[slotIdx];
     }
 
+    SavegameStats SavegameManager::GetStats() const
+    {
+        // @lock Restrict stats access, which the worker thread writes after each save.
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        return _stats;
+    }
+
+    uint SavegameManager::GetQuicksaveCount() const
+    {
+        return _quicksaveCount;
+    }
+
+    bool SavegameManager::IsSnapshotMode() const
+    {
+        return _isSnapshotMode;
+    }
+
+    void SavegameManager::SetSnapshotMode(bool isSnapshotMode)
+    {
+        _isSnapshotMode = isSnapshotMode;
+    }
+
     void SavegameManager::Initialize()
     {
         PopulateSlotMetadata();
+
+        // Measure slot disk footprints in background.
+        auto slotDirs = std::vector<std::filesystem::path>{};
+        for (int slotIdx = 0; slotIdx < _slotMetadata.size(); slotIdx++)
+        {
+            slotDirs.push_back(GetSlotPath(slotIdx));
+        }
+
+        _saveFuture = g_App.GetExecutor().AddTask([this, slotDirs]()
+        {
+            for (int slotIdx = 0; slotIdx < slotDirs.size(); slotIdx++)
+            {
+                uint64 slotDiskSize = GetDirectorySize(slotDirs[slotIdx]);
+
+                // @lock Restrict stats access.
+                std::lock_guard<std::mutex> lock(_statsMutex);
+                _stats.SlotDiskSizes[slotIdx] = slotDiskSize;
+            }
+        });
     }
 
     void SavegameManager::Save(int slotIdx, int fileIdx, int saveIdx)
     {
-        // Create savegame buffer.
-        auto saveBuffer = ToSavegameBuffer(_savegame);
+        // Wait for previous write so writes to the same file land in order.
+        Flush();
 
-        // @todo Fill metadata.
+        // Create savegame buffer on game thread as snapshot.
+        _savegame.SaveCount++;
+        auto saveBuffer = std::shared_ptr<flatbuffers::FlatBufferBuilder>(ToSavegameBuffer(_savegame));
 
-        // Ensure directory exists.
-        auto saveFile = GetSavegamePath(slotIdx, fileIdx, saveIdx);
-        std::filesystem::create_directories(saveFile.parent_path());
+        // Choose write time up front so slot index can reference it. Whole seconds survive coarse filesystem timestamps.
+        auto writeTime = std::filesystem::file_time_type(std::chrono::floor<std::chrono::seconds>(std::filesystem::file_time_type::clock::now()));
 
-        // Write savegame buffer.
-        auto outputFile = std::ofstream(saveFile);
-        if (outputFile.is_open())
+        // Update slot metadata now so load screen reflects save without rescanning.
+        auto metadata = SavegameMetadata
+        {
+            .SlotIdx        = slotIdx,
+            .FileIdx        = fileIdx,
+            .DataIdx        = saveIdx,
+            .SaveCount      = _savegame.SaveCount,
+            .LocationId     = _savegame.LocationId,
+            .GameplayTimer  = _savegame.GameplayTimer,
+            .IsNextFearMode = _savegame.IsNextFearMode,
+            .Flags          = _savegame.Flags,
+            .WriteTime      = writeTime.time_since_epoch().count()
+        };
+        auto& slotMetadata = _slotMetadata[slotIdx];
+        auto  metadataIt   = std::lower_bound(slotMetadata.begin(), slotMetadata.end(), metadata, [](const SavegameMetadata& metadata0, const SavegameMetadata& metadata1)
+        {
+            return std::tie(metadata0.FileIdx, metadata0.DataIdx) < std::tie(metadata1.FileIdx, metadata1.DataIdx);
+        });
+        if (metadataIt != slotMetadata.end() && metadataIt->FileIdx == fileIdx && metadataIt->DataIdx == saveIdx)
         {
-            outputFile.write((const char*)saveBuffer->GetBufferPointer(), saveBuffer->GetSize());
-            outputFile.close();
+            *metadataIt = metadata;
         }
+        else
+        {
+            slotMetadata.insert(metadataIt, metadata);
+        }
+
+        // Write savegame and slot index files on worker thread.
+        auto saveFile  = GetSavegamePath(slotIdx, fileIdx, saveIdx);
+        auto baseFile  = GetSavegameBasePath(slotIdx, fileIdx);
+        auto indexFile = GetSlotIndexPath(slotIdx);
+        auto slotDir   = GetSlotPath(slotIdx);
+        _saveFuture    = g_App.GetExecutor().AddTask([this, saveFile, baseFile, indexFile, slotDir, saveBuffer, writeTime, indexBuffer = ToSlotIndexBuffer(slotMetadata),
+                                                      isSnapshotMode = _isSnapshotMode, slotIdx, fileIdx, saveIdx]()
+        {
+            auto startTime = std::chrono::steady_clock::now();
+
+            // Remove index first, so an interrupted write leaves no index rather than one missing this savegame.
+            auto error = std::error_code();
+            std::filesystem::remove(indexFile, error);
 
-        Debug::Log(Fmt("Saved game to slot {}, file {}, savegame {}.", slotIdx + 1, fileIdx + 1, saveIdx + 1), Debug::LogLevel::Info);
+            // Compress snapshot savegame against base.
+            auto fullBuffer     = std::span<const byte>((const byte*)saveBuffer->GetBufferPointer(), saveBuffer->GetSize());
+            auto snapshotBuffer = isSnapshotMode ? ToSnapshotSavegameBuffer(fullBuffer, baseFile) : nullptr;
+            auto buffer         = (snapshotBuffer != nullptr) ? std::span<const byte>((const byte*)snapshotBuffer->GetBufferPointer(), snapshotBuffer->GetSize()) : fullBuffer;
+            if (!WriteFileAtomically(saveFile, buffer, writeTime))
+            {
+                return;
+            }
+            WriteFileAtomically(indexFile, indexBuffer, std::nullopt);
+
+            double saveSec      = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+            uint64 slotDiskSize = GetDirectorySize(slotDir);
+            {
+                // @lock Restrict stats access.
+                std::lock_guard<std::mutex> lock(_statsMutex);
+                _stats.SaveSec                = saveSec;
+                _stats.SaveSize               = (uint)fullBuffer.size();
+                _stats.SaveDiskSize           = (uint)buffer.size();
+                _stats.SlotDiskSizes[slotIdx] = slotDiskSize;
+            }
+
+            Debug::Log(Fmt("Saved game to slot {}, file {}, savegame {}.", slotIdx + 1, fileIdx + 1, saveIdx + 1), Debug::LogLevel::Info);
+            Debug::Log(Fmt("Savegame write took {:.2f} ms for {} of {} bytes. Slot {} footprint is {} bytes.",
+                           saveSec * 1000.0, buffer.size(), fullBuffer.size(), slotIdx + 1, slotDiskSize),
+                       Debug::LogLevel::Info, Debug::LogMode::Debug);
+        });
     }
 
     void SavegameManager::Load(int slotIdx, int fileIdx, int saveIdx)
     {
-        auto saveFile = GetSavegamePath(slotIdx, fileIdx, saveIdx);
+        // Wait for in-flight write in case it targets this savegame.
+        Flush();
+
+        auto startTime = std::chrono::steady_clock::now();
 
-        // Open savegame buffer file.
-        auto inputFile = std::ifstream(saveFile, std::ios::binary);
-        if (!inputFile.is_open())
+        // Map savegame buffer file.
+        auto saveFile   = GetSavegamePath(slotIdx, fileIdx, saveIdx);
+        auto mappedFile = MappedFile(saveFile);
+        if (!mappedFile.IsOpen())
         {
             Debug::Log(Fmt("Attempted to load missing savegame for slot {}, file {}, savegame {}.", slotIdx + 1, fileIdx + 1, saveIdx + 1),
                        Debug::LogLevel::Warning, Debug::LogMode::Debug);
             return;
         }
 
-        // Get file size.
-        inputFile.seekg(0, std::ios::end);
-        auto fileSize = inputFile.tellg();
-        inputFile.seekg(0, std::ios::beg);
+        // Verify whole savegame buffer.
+        auto data     = mappedFile.GetData();
+        auto verifier = flatbuffers::Verifier((const uint8*)data.data(), data.size());
+        if (!Buffers::VerifySavegameBuffer(verifier))
+        {
+            Debug::Log(Fmt("Attempted to load invalid savegame for slot {}, file {}, savegame {}.", slotIdx + 1, fileIdx + 1, saveIdx + 1),
+                       Debug::LogLevel::Warning);
+            return;
+        }
+        const auto* saveBuffer = Buffers::GetSavegame(data.data());
+
+        // Decompress snapshot savegame against base.
+        auto fullBuffer = std::vector<byte>{};
+        if (saveBuffer->delta() != nullptr)
+        {
+            auto baseFile = MappedFile(GetSavegameBasePath(slotIdx, fileIdx));
+            auto delta    = std::span<const byte>((const byte*)saveBuffer->delta()->data(), saveBuffer->delta()->size());
+            if (!baseFile.IsOpen() || HashBuffer(baseFile.GetData()) != saveBuffer->delta_base_hash() ||
+                !Decompress(delta, baseFile.GetData(), fullBuffer))
+            {
+                Debug::Log(Fmt("Attempted to load snapshot savegame with missing or mismatched base for slot {}, file {}, savegame {}.", slotIdx + 1, fileIdx + 1, saveIdx + 1),
+                           Debug::LogLevel::Warning);
+                return;
+            }
 
-        // Read file into buffer object.
-        auto fileBuffer = std::vector<char>(fileSize);
-        inputFile.read(fileBuffer.data(), fileSize);
-        auto* saveBuffer = flatbuffers::GetRoot<Silent::Buffers::Savegame>(fileBuffer.data());
+            auto fullVerifier = flatbuffers::Verifier((const uint8*)fullBuffer.data(), fullBuffer.size());
+            if (!Buffers::VerifySavegameBuffer(fullVerifier))
+            {
+                Debug::Log(Fmt("Attempted to load invalid snapshot savegame for slot {}, file {}, savegame {}.", slotIdx + 1, fileIdx + 1, saveIdx + 1),
+                           Debug::LogLevel::Warning);
+                return;
+            }
+            saveBuffer = Buffers::GetSavegame(fullBuffer.data());
+        }
 
         // Read savegame buffer.
         _savegame = std::move(*FromSavegameBuffer(*saveBuffer));
 
+        double loadSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        {
+            // @lock Restrict stats access.
+            std::lock_guard<std::mutex> lock(_statsMutex);
+            _stats.LoadSec = loadSec;
+        }
+
         Debug::Log(Fmt("Loaded game from slot {}, file {}, savegame {}.", slotIdx + 1, fileIdx + 1, saveIdx + 1), Debug::LogLevel::Info);
     }
 
+    void SavegameManager::Flush()
+    {
+        if (_saveFuture.valid())
+        {
+            _saveFuture.get();
+        }
+    }
+
+    void SavegameManager::QuickSave()
+    {
+        auto startTime = std::chrono::steady_clock::now();
+
+        // Copy into ring slot, reusing its capacity.
+        auto  saveBuffer = ToSavegameBuffer(_savegame);
+        auto& quicksave  = _quicksaves[_quicksaveIdx];
+        quicksave.assign((const byte*)saveBuffer->GetBufferPointer(), (const byte*)saveBuffer->GetBufferPointer() + saveBuffer->GetSize());
+
+        _quicksaveIdx   = (_quicksaveIdx + 1) % QUICKSAVE_COUNT_MAX;
+        _quicksaveCount = std::min(_quicksaveCount + 1, QUICKSAVE_COUNT_MAX);
+
+        double quicksaveSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        {
+            // @lock Restrict stats access.
+            std::lock_guard<std::mutex> lock(_statsMutex);
+            _stats.QuicksaveSec = quicksaveSec;
+        }
+    }
+
+    bool SavegameManager::QuickLoad(uint age)
+    {
+        if (age >= _quicksaveCount)
+        {
+            Debug::Log(Fmt("Attempted to quickload missing quicksave {}.", age), Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return false;
+        }
+
+        auto startTime = std::chrono::steady_clock::now();
+
+        // Quicksaves never leave memory, so skip verification.
+        uint        ringIdx    = ((_quicksaveIdx + QUICKSAVE_COUNT_MAX) - 1 - age) % QUICKSAVE_COUNT_MAX;
+        const auto* saveBuffer = Buffers::GetSavegame(_quicksaves[ringIdx].data());
+        _savegame              = std::move(*FromSavegameBuffer(*saveBuffer));
+
+        double quickloadSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        {
+            // @lock Restrict stats access.
+            std::lock_guard<std::mutex> lock(_statsMutex);
+            _stats.QuickloadSec = quickloadSec;
+        }
+
+        return true;
+    }
+
+    void SavegameManager::BenchmarkMetadata(uint iterationCount)
+    {
+        if (iterationCount == 0)
+        {
+            return;
+        }
+
+        // Fill slots.
+        for (int slotIdx = 0; slotIdx < _slotMetadata.size(); slotIdx++)
+        {
+            for (int saveIdx = 0; saveIdx < SAVEGAME_COUNT_MAX; saveIdx++)
+            {
+                Save(slotIdx, 0, saveIdx);
+            }
+        }
+        Flush();
+
+        // Time index loads.
+        auto startTime = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterationCount; i++)
+        {
+            for (int slotIdx = 0; slotIdx < _slotMetadata.size(); slotIdx++)
+            {
+                LoadSlotIndex(slotIdx);
+            }
+        }
+        double indexMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count() / iterationCount;
+
+        // Time rescans.
+        startTime = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterationCount; i++)
+        {
+            for (int slotIdx = 0; slotIdx < _slotMetadata.size(); slotIdx++)
+            {
+                ScanSlotMetadata(slotIdx);
+            }
+        }
+        double scanMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count() / iterationCount;
+
+        uint saveCount = 0;
+        for (const auto& slotMetadata : _slotMetadata)
+        {
+            saveCount += (uint)slotMetadata.size();
+        }
+
+        Debug::Log(Fmt("Savegame metadata benchmark: {} savegames in {} slots, {:.3f} ms per index load, {:.3f} ms per rescan.",
+                       saveCount, _slotMetadata.size(), indexMs, scanMs));
+    }
+
+    void SavegameManager::BenchmarkSaves()
+    {
+        constexpr uint EVENT_FLAG_COUNT     = 1024;
+        constexpr uint PICKUP_FLAG_COUNT    = 512;
+        constexpr uint INVENTORY_ITEM_COUNT = 32;
+        constexpr uint SAVE_INTERVAL_TICKS  = TICKS_PER_SECOND * 60;
+
+        bool isSnapshotMode = _isSnapshotMode;
+        for (bool isBenchSnapshotMode : { false, true })
+        {
+            // Clear slot so snapshot mode writes a new base savegame.
+            Flush();
+            std::filesystem::remove_all(GetSlotPath(0));
+            _slotMetadata[0].clear();
+            _isSnapshotMode = isBenchSnapshotMode;
+
+            // Start session.
+            _savegame             = Savegame{};
+            _savegame.EventFlags  = Bitfield(EVENT_FLAG_COUNT);
+            _savegame.PickupFlags = Bitfield(PICKUP_FLAG_COUNT);
+            for (int i = 0; i < INVENTORY_ITEM_COUNT; i++)
+            {
+                _savegame.Inventory.push_back(InventoryItem{ .Id = i, .Count = 1 });
+            }
+
+            // Save progression.
+            double saveSec    = 0.0;
+            double saveSecMax = 0.0;
+            for (int saveIdx = 0; saveIdx < SAVEGAME_COUNT_MAX; saveIdx++)
+            {
+                _savegame.GameplayTimer  += SAVE_INTERVAL_TICKS;
+                _savegame.LocationId      = saveIdx % 16;
+                _savegame.PlayerPosition += Vector3(1.0f, 0.0f, 2.0f);
+                _savegame.Inventory[saveIdx % INVENTORY_ITEM_COUNT].Count++;
+                _savegame.EventFlags.Set((saveIdx * 7) % EVENT_FLAG_COUNT);
+                _savegame.PickupFlags.Set((saveIdx * 3) % PICKUP_FLAG_COUNT);
+
+                Save(0, 0, saveIdx);
+                Flush();
+
+                double curSaveSec = GetStats().SaveSec;
+                saveSec          += curSaveSec;
+                saveSecMax        = std::max(saveSecMax, curSaveSec);
+            }
+
+            // Load savegames.
+            double loadSec    = 0.0;
+            double loadSecMax = 0.0;
+            for (int saveIdx = 0; saveIdx < SAVEGAME_COUNT_MAX; saveIdx++)
+            {
+                Load(0, 0, saveIdx);
+
+                double curLoadSec = GetStats().LoadSec;
+                loadSec          += curLoadSec;
+                loadSecMax        = std::max(loadSecMax, curLoadSec);
+            }
+
+            Debug::Log(Fmt("Savegame benchmark ({}): {} savegames, {} bytes on disk.",
+                           isBenchSnapshotMode ? "snapshot" : "full", SAVEGAME_COUNT_MAX, GetDirectorySize(GetSlotPath(0))));
+            Debug::Log(Fmt("    Save (ms): avg {:.3f}, max {:.3f}. Load (ms): avg {:.3f}, max {:.3f}.",
+                           (saveSec * 1000.0) / SAVEGAME_COUNT_MAX, saveSecMax * 1000.0, (loadSec * 1000.0) / SAVEGAME_COUNT_MAX, loadSecMax * 1000.0));
+        }
+        _isSnapshotMode = isSnapshotMode;
+
+        // Time quicksave ring.
+        double quicksaveSec = 0.0;
+        double quickloadSec = 0.0;
+        for (int i = 0; i < SAVEGAME_COUNT_MAX; i++)
+        {
+            QuickSave();
+            QuickLoad();
+
+            auto stats    = GetStats();
+            quicksaveSec += stats.QuicksaveSec;
+            quickloadSec += stats.QuickloadSec;
+        }
+
+        Debug::Log(Fmt("    Quicksave (ms): avg {:.4f}. Quickload (ms): avg {:.4f}.",
+                       (quicksaveSec * 1000.0) / SAVEGAME_COUNT_MAX, (quickloadSec * 1000.0) / SAVEGAME_COUNT_MAX));
+    }
+
     const Savegame* SavegameManager::operator->() const
     {
         return &_savegame;
@@ -116,162 +670,382 @@ namespace Silent::Savegame
         return &_savegame;
     }
 
-    std::filesystem::path SavegameManager::GetSavegamePath(int slotIdx, int fileIdx, int saveIdx) const
+    std::filesystem::path SavegameManager::GetSlotPath(int slotIdx) const
     {
-        Debug::Assert(slotIdx < _slotMetadata.size(), "Attempted to get savegame path for invalid slot.");
+        Debug::Assert(slotIdx < _slotMetadata.size(), "Attempted to get path for invalid slot.");
 
         const auto& fs = g_App.GetFilesystem();
 
-        auto slotDirName  = SAVEGAME_SLOT_DIR_NAME_BASE      + std::to_string(slotIdx + 1);
+        auto slotDirName = SAVEGAME_SLOT_DIR_NAME_BASE + std::to_string(slotIdx + 1);
+        return fs.GetSavegameDirectory() / slotDirName;
+    }
+
+    std::filesystem::path SavegameManager::GetSlotIndexPath(int slotIdx) const
+    {
+        return GetSlotPath(slotIdx) / (std::string(SAVEGAME_INDEX_FILENAME) + SAVEGAME_INDEX_FILE_EXT);
+    }
+
+    std::filesystem::path SavegameManager::GetSavegamePath(int slotIdx, int fileIdx, int saveIdx) const
+    {
         auto fileDirName  = SAVEGAME_SLOT_FILE_DIR_NAME_BASE + std::to_string(fileIdx + 1);
         auto saveFilename = std::to_string(saveIdx + 1)      + SAVEGAME_FILE_EXT;
-        return fs.GetSavegameDirectory() / slotDirName / fileDirName / saveFilename;
+        return GetSlotPath(slotIdx) / fileDirName / saveFilename;
+    }
+
+    std::filesystem::path SavegameManager::GetSavegameBasePath(int slotIdx, int fileIdx) const
+    {
+        auto fileDirName = SAVEGAME_SLOT_FILE_DIR_NAME_BASE + std::to_string(fileIdx + 1);
+        return GetSlotPath(slotIdx) / fileDirName / (std::string(SAVEGAME_BASE_FILENAME) + SAVEGAME_FILE_EXT);
     }
 
     SavegameMetadata SavegameManager::GetMetadata(const std::filesystem::path& saveFile) const
     {
-        // Open savegame buffer file.
-        auto inputFile = std::ifstream(saveFile, std::ios::binary);
-        if (!inputFile.is_open())
+        auto invalidMetadata = SavegameMetadata
+        {
+            .SlotIdx        = NO_VALUE,
+            .FileIdx        = NO_VALUE,
+            .DataIdx        = NO_VALUE,
+            .SaveCount      = NO_VALUE,
+            .LocationId     = NO_VALUE,
+            .GameplayTimer  = 0,
+            .IsNextFearMode = false,
+            .Flags          = NO_VALUE
+        };
+
+        // Get write time first, so a concurrent rewrite is caught by index validation.
+        auto error     = std::error_code();
+        auto writeTime = std::filesystem::last_write_time(saveFile, error);
+
+        // Map savegame buffer file.
+        auto mappedFile = MappedFile(saveFile);
+        if (error || !mappedFile.IsOpen())
         {
             Debug::Log(Fmt("Attempted to get metadata for missing savegame file `{}`.", saveFile.string()), Debug::LogLevel::Warning, Debug::LogMode::Debug);
-            return SavegameMetadata
-            {
-                .SlotIdx        = NO_VALUE,
-                .FileIdx        = NO_VALUE,
-                .DataIdx        = NO_VALUE,
-                .SaveCount      = NO_VALUE,
-                .LocationId     = NO_VALUE,
-                .GameplayTimer  = 0,
-                .IsNextFearMode = false,
-                .Flags          = NO_VALUE
-            };
+            return invalidMetadata;
         }
 
-        // Get file size.
-        inputFile.seekg(0, std::ios::end);
-        auto fileSize = inputFile.tellg();
-        inputFile.seekg(0, std::ios::beg);
-
-        // Read file into buffer object.
-        auto fileBuffer = std::vector<char>(fileSize);
-        inputFile.read(fileBuffer.data(), fileSize);
-        auto* saveBuffer = flatbuffers::GetRoot<Silent::Buffers::Savegame>(fileBuffer.data());
-        
-        // @todo Read metadata from savegame buffer.
-        auto metadata = SavegameMetadata{};
+        // Read metadata table in place.
+        const auto* metadataBuffer = GetMetadataBuffer(mappedFile.GetData());
+        if (metadataBuffer == nullptr)
+        {
+            Debug::Log(Fmt("Attempted to get metadata for invalid savegame file `{}`.", saveFile.string()), Debug::LogLevel::Warning);
+            return invalidMetadata;
+        }
 
-        return metadata;
+        return SavegameMetadata
+        {
+            .SlotIdx        = NO_VALUE,
+            .FileIdx        = ExtractNumber(saveFile.parent_path().filename().string()) - 1,
+            .DataIdx        = ExtractNumber(saveFile.stem().string()) - 1,
+            .SaveCount      = metadataBuffer->save_count(),
+            .LocationId     = metadataBuffer->location_id(),
+            .GameplayTimer  = metadataBuffer->gameplay_timer(),
+            .IsNextFearMode = metadataBuffer->is_next_fear_mode(),
+            .Flags          = metadataBuffer->flags(),
+            .WriteTime      = writeTime.time_since_epoch().count()
+        };
     }
 
     void SavegameManager::PopulateSlotMetadata()
     {
-        const auto& fs = g_App.GetFilesystem();
+        auto startTime = std::chrono::steady_clock::now();
+        uint saveCount = 0;
+        uint scanCount = 0;
 
-        // Run through slots.
         for (int slotIdx = 0; slotIdx < _slotMetadata.size(); slotIdx++)
         {
-            // Get slot folder path.
-            auto slotDirName = SAVEGAME_SLOT_DIR_NAME_BASE + std::to_string(slotIdx + 1);
-            auto slotDir     = fs.GetWorkDirectory() / slotDirName;
-            if (!std::filesystem::exists(slotDir) || !std::filesystem::is_directory(slotDir))
+            if (!LoadSlotIndex(slotIdx))
+            {
+                ScanSlotMetadata(slotIdx);
+                scanCount++;
+            }
+
+            saveCount += (uint)_slotMetadata[slotIdx].size();
+        }
+
+        double populateMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+        Debug::Log(Fmt("Populated metadata of {} savegames in {:.2f} ms ({} of {} slots rescanned).", saveCount, populateMs, scanCount, _slotMetadata.size()),
+                   Debug::LogLevel::Info, Debug::LogMode::Debug);
+    }
+
+    bool SavegameManager::LoadSlotIndex(int slotIdx)
+    {
+        auto& slotMetadata = _slotMetadata[slotIdx];
+        slotMetadata.clear();
+
+        // Map slot index file.
+        auto mappedFile = MappedFile(GetSlotIndexPath(slotIdx));
+        if (!mappedFile.IsOpen())
+        {
+            return false;
+        }
+
+        // Read and validate header.
+        auto data   = mappedFile.GetData();
+        auto header = SavegameIndexHeader{};
+        if (data.size() < sizeof(header))
+        {
+            return false;
+        }
+        std::memcpy(&header, data.data(), sizeof(header));
+
+        if (header.Magic != SAVEGAME_INDEX_FILE_MAGIC || header.Version != SAVEGAME_INDEX_FILE_VERSION ||
+            data.size() != (sizeof(header) + ((uint64)header.EntryCount * sizeof(SavegameIndexEntry))))
+        {
+            Debug::Log(Fmt("Slot {} index is invalid.", slotIdx + 1), Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            return false;
+        }
+
+        // Read entries, validating each against its savegame file.
+        slotMetadata.reserve(header.EntryCount);
+        for (int i = 0; i < header.EntryCount; i++)
+        {
+            auto entry = SavegameIndexEntry{};
+            std::memcpy(&entry, &data[sizeof(header) + (i * sizeof(entry))], sizeof(entry));
+
+            auto error     = std::error_code();
+            auto writeTime = std::filesystem::file_time_type();
+            if (entry.FileIdx >= 0 && entry.DataIdx >= 0)
+            {
+                writeTime = std::filesystem::last_write_time(GetSavegamePath(slotIdx, entry.FileIdx, entry.DataIdx), error);
+            }
+
+            if (entry.FileIdx < 0 || entry.DataIdx < 0 || error || writeTime.time_since_epoch().count() != entry.WriteTime)
+            {
+                Debug::Log(Fmt("Slot {} index is stale.", slotIdx + 1), Debug::LogLevel::Info, Debug::LogMode::Debug);
+                slotMetadata.clear();
+                return false;
+            }
+
+            slotMetadata.push_back(SavegameMetadata
+            {
+                .SlotIdx        = slotIdx,
+                .FileIdx        = entry.FileIdx,
+                .DataIdx        = entry.DataIdx,
+                .SaveCount      = entry.SaveCount,
+                .LocationId     = entry.LocationId,
+                .GameplayTimer  = entry.GameplayTimer,
+                .IsNextFearMode = entry.IsNextFearMode != 0,
+                .Flags          = entry.Flags,
+                .WriteTime      = entry.WriteTime
+            });
+        }
+
+        // Count savegame files in "File [ID]/[ID].savegame" folders. Every indexed file exists, so a matching count means no files were added.
+        uint saveFileCount = 0;
+        for (const auto& fileDir : std::filesystem::directory_iterator(GetSlotPath(slotIdx)))
+        {
+            if (!fileDir.is_directory() || ExtractNumber(fileDir.path().filename().string()) == NO_VALUE)
             {
                 continue;
             }
 
-            // Collect file folders.
-            auto fileDirs = std::vector<std::filesystem::path>{};
-            for (const auto& fileDir : std::filesystem::directory_iterator(slotDir))
+            for (const auto& saveFile : std::filesystem::directory_iterator(fileDir.path()))
             {
-                if (fileDir.is_directory())
+                if (saveFile.is_regular_file() && saveFile.path().extension() == SAVEGAME_FILE_EXT && ExtractNumber(saveFile.path().stem().string()) != NO_VALUE)
                 {
-                    fileDirs.push_back(fileDir.path());
+                    saveFileCount++;
                 }
             }
+        }
+
+        if (saveFileCount != slotMetadata.size())
+        {
+            Debug::Log(Fmt("Slot {} index is stale: {} savegame files, {} indexed.", slotIdx + 1, saveFileCount, slotMetadata.size()),
+                       Debug::LogLevel::Info, Debug::LogMode::Debug);
+            slotMetadata.clear();
+            return false;
+        }
+
+        return true;
+    }
+
+    void SavegameManager::ScanSlotMetadata(int slotIdx)
+    {
+        auto& slotMetadata = _slotMetadata[slotIdx];
+        slotMetadata.clear();
 
-            // Sort file folders.
-            Sort(fileDirs, [](const std::filesystem::path& file0, const std::filesystem::path& file1)
+        auto slotDir = GetSlotPath(slotIdx);
+        if (!std::filesystem::is_directory(slotDir))
+        {
+            return;
+        }
+
+        // Collect savegame files in "File [ID]/[ID].savegame" folders, parsing indices once.
+        auto saveFiles = std::vector<SavegameFile>{};
+        for (const auto& fileDir : std::filesystem::directory_iterator(slotDir))
+        {
+            int fileNumber = ExtractNumber(fileDir.path().filename().string());
+            if (!fileDir.is_directory() || fileNumber == NO_VALUE)
             {
-                auto extractNumber = [](const std::filesystem::path& file)
-                {
-                    auto filename   = file.string(); // "File [ID]".
-                    auto numericStr = std::string();
-                    for (char curChar : filename)
-                    {
-                        if (std::isdigit(curChar))
-                        {
-                            numericStr += curChar;
-                        }
-                    }
-
-                    return std::stoi(numericStr);
-                };
-
-                return extractNumber(file0) < extractNumber(file1);
-            });
+                continue;
+            }
 
-            // Collect savegame files.
-            auto saveFiles = std::vector<std::filesystem::path>{};
-            for (const auto& fileDir : fileDirs)
+            for (const auto& saveFile : std::filesystem::directory_iterator(fileDir.path()))
             {
-                for (const auto& saveFile : std::filesystem::directory_iterator(fileDir))
+                int saveNumber = ExtractNumber(saveFile.path().stem().string());
+                if (saveFile.is_regular_file() && saveFile.path().extension() == SAVEGAME_FILE_EXT && saveNumber != NO_VALUE)
                 {
-                    if (saveFile.is_regular_file() && saveFile.path().extension() == SAVEGAME_FILE_EXT)
-                    {
-                        saveFiles.push_back(saveFile.path());
-                    }
+                    saveFiles.push_back(SavegameFile{ .FileIdx = fileNumber - 1, .DataIdx = saveNumber - 1, .Path = saveFile.path() });
                 }
             }
+        }
 
-            // Sort savegame files.
-            Sort(saveFiles, [](const std::filesystem::path& file0, const std::filesystem::path& file1)
+        // Sort savegame files.
+        Sort(saveFiles, [](const SavegameFile& file0, const SavegameFile& file1)
+        {
+            return std::tie(file0.FileIdx, file0.DataIdx) < std::tie(file1.FileIdx, file1.DataIdx);
+        });
+
+        // Read metadata in parallel. Each worker takes every Nth file.
+        auto& executor  = g_App.GetExecutor();
+        auto  metadata  = std::vector<SavegameMetadata>(saveFiles.size());
+        uint  taskCount = std::clamp<uint>(executor.GetThreadCount(), 1, std::max<uint>((uint)saveFiles.size(), 1));
+        auto  tasks     = ParallelTasks{};
+        tasks.reserve(taskCount);
+        for (int i = 0; i < taskCount; i++)
+        {
+            tasks.push_back([this, &saveFiles, &metadata, taskCount, i]()
             {
-                auto extractNumber = [](const std::filesystem::path& file)
+                for (int j = i; j < saveFiles.size(); j += taskCount)
                 {
-                    auto filename   = file.stem().string(); // "[idx]".
-                    auto numericStr = std::string();
-                    for (char curChar : filename)
-                    {
-                        if (std::isdigit(curChar))
-                        {
-                            numericStr += curChar;
-                        }
-                    }
-
-                    return std::stoi(numericStr);
-                };
-
-                return extractNumber(file0) < extractNumber(file1);
+                    metadata[j] = GetMetadata(saveFiles[j].Path);
+                }
             });
+        }
+        executor.AddTasks(tasks).get();
 
-            // Clear previous metadata.
-            auto& slotMetadata = _slotMetadata[slotIdx];
-            slotMetadata.clear();
-
-            // Populate savegame metadata.
-            for (const auto& saveFile : saveFiles)
+        // Collect valid metadata.
+        slotMetadata.reserve(metadata.size());
+        for (auto& curMetadata : metadata)
+        {
+            if (curMetadata.SaveCount == NO_VALUE)
             {
-                auto metadata = GetMetadata(saveFile);
-                slotMetadata.push_back(metadata);
+                continue;
             }
+
+            curMetadata.SlotIdx = slotIdx;
+            slotMetadata.push_back(curMetadata);
         }
+
+        // Rewrite slot index.
+        WriteFileAtomically(GetSlotIndexPath(slotIdx), ToSlotIndexBuffer(slotMetadata), std::nullopt);
     }
 
     std::unique_ptr<Savegame> SavegameManager::FromSavegameBuffer(const Buffers::Savegame& saveBuffer) const
     {
         auto save = std::make_unique<Savegame>();
 
-        // @todo
+        // Metadata.
+        const auto* metadataBuffer = saveBuffer.metadata();
+        if (metadataBuffer != nullptr)
+        {
+            save->SaveCount      = metadataBuffer->save_count();
+            save->LocationId     = metadataBuffer->location_id();
+            save->GameplayTimer  = metadataBuffer->gameplay_timer();
+            save->IsNextFearMode = metadataBuffer->is_next_fear_mode();
+            save->Flags          = metadataBuffer->flags();
+        }
+
+        // Progress.
+        save->MapId      = saveBuffer.map_id();
+        save->Difficulty = saveBuffer.difficulty();
+
+        // Player.
+        const auto* playerBuffer = saveBuffer.player();
+        if (playerBuffer != nullptr)
+        {
+            const auto* posBuffer = playerBuffer->position();
+            if (posBuffer != nullptr)
+            {
+                save->PlayerPosition = Vector3(posBuffer->x(), posBuffer->y(), posBuffer->z());
+            }
+
+            save->PlayerRotation = playerBuffer->rotation();
+            save->PlayerHealth   = playerBuffer->health();
+        }
+
+        // Inventory.
+        const auto* inventoryBuffer = saveBuffer.inventory();
+        if (inventoryBuffer != nullptr)
+        {
+            save->Inventory.reserve(inventoryBuffer->size());
+            for (const auto* itemBuffer : *inventoryBuffer)
+            {
+                save->Inventory.push_back(InventoryItem{ .Id = itemBuffer->id(), .Count = itemBuffer->count() });
+            }
+        }
+
+        // Flags.
+        save->EventFlags  = FromBitfieldBuffer(saveBuffer.event_flags());
+        save->PickupFlags = FromBitfieldBuffer(saveBuffer.pickup_flags());
 
         return save;
     }
 
     std::unique_ptr<flatbuffers::FlatBufferBuilder> SavegameManager::ToSavegameBuffer(const Savegame& save) const
     {
-        auto saveBuffer = std::make_unique<flatbuffers::FlatBufferBuilder>();
+        auto  saveBuffer = std::make_unique<flatbuffers::FlatBufferBuilder>();
+        auto& builder    = *saveBuffer;
+
+        // Metadata.
+        auto metadataOffset = Buffers::CreateSavegameMetadata(builder, save.SaveCount, save.LocationId, save.GameplayTimer, save.IsNextFearMode, save.Flags);
+
+        // Player.
+        auto posBuffer    = Buffers::Vector3(save.PlayerPosition.x, save.PlayerPosition.y, save.PlayerPosition.z);
+        auto playerOffset = Buffers::CreatePlayer(builder, &posBuffer, save.PlayerRotation, save.PlayerHealth);
+
+        // Inventory.
+        auto inventory = std::vector<Buffers::InventoryItem>{};
+        inventory.reserve(save.Inventory.size());
+        for (const auto& item : save.Inventory)
+        {
+            inventory.push_back(Buffers::InventoryItem(item.Id, item.Count));
+        }
+        auto inventoryOffset = builder.CreateVectorOfStructs(inventory);
 
-        // @todo
+        // Flags.
+        auto eventFlagsOffset  = Buffers::CreateBitfieldDirect(builder, save.EventFlags.GetSize(), &save.EventFlags.GetChunks());
+        auto pickupFlagsOffset = Buffers::CreateBitfieldDirect(builder, save.PickupFlags.GetSize(), &save.PickupFlags.GetChunks());
 
+        // Finish.
+        auto saveOffset = Buffers::CreateSavegame(builder, metadataOffset, save.MapId, save.Difficulty, playerOffset, inventoryOffset, eventFlagsOffset, pickupFlagsOffset);
+        Buffers::FinishSavegameBuffer(builder, saveOffset);
         return saveBuffer;
     }
+
+    std::unique_ptr<flatbuffers::FlatBufferBuilder> SavegameManager::ToSnapshotSavegameBuffer(std::span<const byte> saveBuffer, const std::filesystem::path& baseFile) const
+    {
+        // Write base if file has none. Base is never rewritten, so deltas against it stay valid.
+        auto error = std::error_code();
+        if (!std::filesystem::exists(baseFile, error) && !WriteFileAtomically(baseFile, saveBuffer, std::nullopt))
+        {
+            return nullptr;
+        }
+
+        auto base = MappedFile(baseFile);
+        if (!base.IsOpen())
+        {
+            return nullptr;
+        }
+
+        // Compress against base.
+        auto delta = Compress(saveBuffer, base.GetData());
+        if (delta.size() > (uint)((float)saveBuffer.size() * SNAPSHOT_DELTA_SIZE_RATIO_MAX))
+        {
+            return nullptr;
+        }
+
+        // Keep metadata uncompressed so it can still be read in place.
+        const auto* metadataBuffer = Buffers::GetSavegame(saveBuffer.data())->metadata();
+        auto        snapshotBuffer = std::make_unique<flatbuffers::FlatBufferBuilder>();
+        auto&       builder        = *snapshotBuffer;
+
+        auto metadataOffset = Buffers::CreateSavegameMetadata(builder, metadataBuffer->save_count(), metadataBuffer->location_id(), metadataBuffer->gameplay_timer(),
+                                                              metadataBuffer->is_next_fear_mode(), metadataBuffer->flags());
+        auto deltaOffset    = builder.CreateVector((const uint8*)delta.data(), delta.size());
+        auto saveOffset     = Buffers::CreateSavegame(builder, metadataOffset, 0, 0, 0, 0, 0, 0, deltaOffset, HashBuffer(base.GetData()));
+        Buffers::FinishSavegameBuffer(builder, saveOffset);
+        return snapshotBuffer;
+    }
 }
@@ -1,15 +1,37 @@
 #pragma once
 
+#include "Utils/Bitfield.h"
+
 namespace Silent::Buffers { struct Savegame; }
 
 namespace Silent::Savegame
 {
     constexpr uint SAVEGAME_SLOT_COUNT = 2;   // Number of savegame slots, simulating original design around PSX memory cards.
     constexpr uint SAVEGAME_COUNT_MAX  = 165; // Max savegames per file.
+    constexpr uint QUICKSAVE_COUNT_MAX = 8;   // Quicksaves kept in memory.
+
+    struct InventoryItem
+    {
+        int Id    = 0;
+        int Count = 0;
+    };
 
     struct Savegame
     {
-        int Dummy = 0;
+        int  SaveCount      = 0;
+        int  LocationId     = 0;
+        uint GameplayTimer  = 0; // Gameplay time in ticks.
+        bool IsNextFearMode = false;
+        int  Flags          = 0;
+
+        int                        MapId          = 0;
+        int                        Difficulty     = 0;
+        Vector3                    PlayerPosition = Vector3::Zero;
+        float                      PlayerRotation = 0.0f;
+        float                      PlayerHealth   = 0.0f;
+        std::vector<InventoryItem> Inventory      = {};
+        Utils::Bitfield            EventFlags     = {};
+        Utils::Bitfield            PickupFlags    = {};
     };
 
     struct SavegameMetadata
@@ -21,8 +43,20 @@ namespace Silent::Savegame
         int  LocationId    = 0;
         uint GameplayTimer = 0;
 
-        bool IsNextFearMode = false;
-        int  Flags          = 0;
+        bool  IsNextFearMode = false;
+        int   Flags          = 0;
+        int64 WriteTime      = 0; // Savegame file write time, used to validate slot index.
+    };
+
+    struct SavegameStats
+    {
+        double                                  SaveSec       = 0.0; // Last savegame encode, compression, and write time on worker thread.
+        double                                  LoadSec       = 0.0; // Last savegame read, decompression, and decode time.
+        double                                  QuicksaveSec  = 0.0;
+        double                                  QuickloadSec  = 0.0;
+        uint                                    SaveSize      = 0;   // Last savegame buffer size in bytes.
+        uint                                    SaveDiskSize  = 0;   // Last savegame file size in bytes. Smaller than buffer size for snapshot savegames.
+        std::array<uint64, SAVEGAME_SLOT_COUNT> SlotDiskSizes = {};  // Size of all files per slot in bytes.
     };
 
     class SavegameManager
@@ -30,8 +64,17 @@ namespace Silent::Savegame
     private:
         // Fields
 
-        Savegame                                                       _savegame     = {};
-        std::array<std::vector<SavegameMetadata>, SAVEGAME_SLOT_COUNT> _slotMetadata = {};
+        Savegame                                                       _savegame       = {};
+        std::array<std::vector<SavegameMetadata>, SAVEGAME_SLOT_COUNT> _slotMetadata   = {};
+        std::future<void>                                              _saveFuture     = {};    // In-flight savegame file write.
+        bool                                                           _isSnapshotMode = true;  // Write savegames as deltas against the base savegame of their file.
+
+        std::array<std::vector<byte>, QUICKSAVE_COUNT_MAX> _quicksaves     = {}; // Ring of savegame buffers.
+        uint                                               _quicksaveIdx   = 0;  // Next ring slot to write.
+        uint                                               _quicksaveCount = 0;
+
+        SavegameStats      _stats      = {};
+        mutable std::mutex _statsMutex = {};
 
     public:
         // Constructors
@@ -41,13 +84,62 @@ namespace Silent::Savegame
         // Getters
 
         const std::vector<SavegameMetadata>& GetSlotMetadata(int slotIdx);
+        SavegameStats                        GetStats() const;
+        uint                                 GetQuicksaveCount() const;
+
+        // Inquirers
+
+        bool IsSnapshotMode() const;
+
+        // Setters
+
+        /** @brief Sets snapshot mode. Snapshot savegames store only metadata and a compressed delta against the immutable base savegame
+         * written on the first save to each file, with a full savegame written instead if the delta isn't compact.
+         *
+         * @param isSnapshotMode Snapshot mode.
+         */
+        void SetSnapshotMode(bool isSnapshotMode);
 
         // Utilities
 
         void Initialize();
+
+        /** @brief Saves the game. The savegame is snapshotted immediately and written to disk on a worker thread,
+         * followed by the slot index.
+         *
+         * @param slotIdx Slot index.
+         * @param fileIdx File index.
+         * @param saveIdx Savegame index.
+         */
         void Save(int slotIdx, int fileIdx, int saveIdx);
         void Load(int slotIdx, int fileIdx, int saveIdx);
 
+        /** @brief Waits for the in-flight savegame write to finish. */
+        void Flush();
+
+        /** @brief Quicksaves the game to memory, overwriting the oldest quicksave if the ring is full. */
+        void QuickSave();
+
+        /** @brief Restores the game from a quicksave in memory.
+         *
+         * @param age Quicksave age. 0 = most recent.
+         * @return `true` if restored, `false` if no quicksave of that age exists.
+         */
+        bool QuickLoad(uint age = 0);
+
+        /** @brief Benchmarks metadata population. Fills the first file of every slot with savegames,
+         * then times loading all slot indices and rescanning all slots, and logs the results.
+         *
+         * @param iterationCount Number of timed index loads and rescans.
+         */
+        void BenchmarkMetadata(uint iterationCount);
+
+        /** @brief Benchmarks savegame writes and reads. Writes a simulated play session of `SAVEGAME_COUNT_MAX` savegames to the first file of the first slot,
+         * once with full savegames and once in snapshot mode, then loads each savegame and logs save latency, load latency, and slot disk footprint.
+         * Also times quicksaves and quickloads of the same savegames.
+         */
+        void BenchmarkSaves();
+
         // Operators
 
         const Savegame* operator->() const;
@@ -56,11 +148,45 @@ namespace Silent::Savegame
     private:
         // Helpers
 
+        std::filesystem::path GetSlotPath(int slotIdx) const;
+        std::filesystem::path GetSlotIndexPath(int slotIdx) const;
         std::filesystem::path GetSavegamePath(int slotIdx, int fileIdx, int saveIdx) const;
-        SavegameMetadata      GetMetadata(const std::filesystem::path& saveFile) const;
-        
-        void                                            PopulateSlotMetadata();
+        std::filesystem::path GetSavegameBasePath(int slotIdx, int fileIdx) const;
+
+        /** @brief Gets savegame metadata by memory-mapping the file and reading only the verified metadata table in place.
+         *
+         * @param saveFile Savegame file path.
+         * @return Savegame metadata, with `NO_VALUE` fields if the file is missing or invalid.
+         */
+        SavegameMetadata GetMetadata(const std::filesystem::path& saveFile) const;
+
+        /** @brief Populates the metadata of all slots from their index files, rescanning slots whose index is missing or stale. */
+        void PopulateSlotMetadata();
+
+        /** @brief Loads slot metadata from the slot index file. The index is stale if any indexed savegame file is missing or has a different write time,
+         * or if the slot's file folders hold a different number of savegame files than the index, as when savegames are added outside the game.
+         *
+         * @note Folders are listed but savegame files aren't opened. A slot containing an unreadable savegame file is rescanned on every load.
+         * @param slotIdx Slot index.
+         * @return `true` if the index is valid and was loaded, `false` otherwise.
+         */
+        bool LoadSlotIndex(int slotIdx);
+
+        /** @brief Rescans slot metadata from the savegame files, reading files in parallel on the executor, and rewrites the slot index.
+         *
+         * @param slotIdx Slot index.
+         */
+        void ScanSlotMetadata(int slotIdx);
+
         std::unique_ptr<Savegame>                       FromSavegameBuffer(const Buffers::Savegame& saveBuffer) const;
         std::unique_ptr<flatbuffers::FlatBufferBuilder> ToSavegameBuffer(const Savegame& save) const;
+
+        /** @brief Converts a savegame buffer to a snapshot savegame buffer, writing the base savegame first if missing. Safe to call from a worker thread.
+         *
+         * @param saveBuffer Full savegame buffer.
+         * @param baseFile Base savegame file path.
+         * @return Snapshot savegame buffer, or `nullptr` if the full savegame should be written instead.
+         */
+        std::unique_ptr<flatbuffers::FlatBufferBuilder> ToSnapshotSavegameBuffer(std::span<const byte> saveBuffer, const std::filesystem::path& baseFile) const;
     };
 }
@@ -19,6 +19,11 @@ namespace Silent::Services
         return std::min(_ticks, TICKS_PER_SECOND / 6);
     }
 
+    void ClockManager::SetTicks(uint ticks)
+    {
+        _ticks = ticks;
+    }
+
     bool ClockManager::TestInterval(uint intervalTicks, uint offsetTicks) const
     {
         if (offsetTicks >= intervalTicks)
@@ -47,6 +47,16 @@ namespace Silent::Services
          */
         uint GetTicks() const;
 
+        // ========
+        // Setters
+        // ========
+
+        /** @brief Overrides the accumulated ticks of the current update. Used by input replay to reproduce a recorded timestep.
+         *
+         * @param ticks Accumulated ticks.
+         */
+        void SetTicks(uint ticks);
+
         // ==========
         // Inquirers
         // ==========
@@ -25,6 +25,11 @@ namespace Silent::Services
         return _savegameDir;
     }
 
+    const std::filesystem::path& FilesystemManager::GetRecordingsDirectory() const
+    {
+        return _recordingsDir;
+    }
+
     const std::filesystem::path& FilesystemManager::GetScreenshotsDirectory() const
     {
         return _screenshotsDir;
@@ -35,9 +40,11 @@ namespace Silent::Services
         return _shadersDir;
     }
 
-    void FilesystemManager::Initialize()
+    void FilesystemManager::Initialize(bool isBenchmark)
     {
         constexpr char ASSETS_DIR_NAME[]      = "Assets";
+        constexpr char BENCHMARK_DIR_NAME[]   = "Benchmark";
+        constexpr char RECORDINGS_DIR_NAME[]  = "Recordings";
         constexpr char SAVEGAME_DIR_NAME[]    = "Savegame";
         constexpr char SCREENSHOTS_DIR_NAME[] = "Screenshots";
         constexpr char SHADERS_DIR_NAME[]     = "Shaders";
@@ -89,9 +96,10 @@ namespace Silent::Services
         }
 
         // Set workspace paths.
-        _assetsDir   = _appDir  / ASSETS_DIR_NAME;
-        _savegameDir = _workDir / SAVEGAME_DIR_NAME;
-        _shadersDir  = _appDir  / SHADERS_DIR_NAME;
+        _assetsDir     = _appDir  / ASSETS_DIR_NAME;
+        _savegameDir   = isBenchmark ? (_workDir / BENCHMARK_DIR_NAME / SAVEGAME_DIR_NAME) : (_workDir / SAVEGAME_DIR_NAME);
+        _recordingsDir = _workDir / RECORDINGS_DIR_NAME;
+        _shadersDir    = _appDir  / SHADERS_DIR_NAME;
 
         // Check for assets directory.
         if (!std::filesystem::exists(_assetsDir))
@@ -5,6 +5,7 @@ namespace Silent::Services
     constexpr char JSON_FILE_EXT[]     = ".json";
     constexpr char PNG_FILE_EXT[]      = ".png";
     constexpr char SAVEGAME_FILE_EXT[] = ".savegame";
+    constexpr char TEMP_FILE_EXT[]     = ".tmp";
     
     constexpr uint JSON_INDENT_SIZE = 4;
 
@@ -20,6 +21,7 @@ namespace Silent::Services
         std::filesystem::path _assetsDir      = {}; /** Game assets folder. */
         std::filesystem::path _workDir        = {}; /** Workspace folder. */
         std::filesystem::path _savegameDir    = {}; /** Savegame folder. */
+        std::filesystem::path _recordingsDir  = {}; /** Input recordings and replay benchmark results folder. */
         std::filesystem::path _screenshotsDir = {}; /** Screenshots folder. */
         std::filesystem::path _shadersDir     = {}; /** Shaders folder. */
 
@@ -38,6 +40,7 @@ namespace Silent::Services
         const std::filesystem::path& GetAssetsDirectory() const;
         const std::filesystem::path& GetWorkDirectory() const;
         const std::filesystem::path& GetSavegameDirectory() const;
+        const std::filesystem::path& GetRecordingsDirectory() const;
         const std::filesystem::path& GetScreenshotsDirectory() const;
         const std::filesystem::path& GetShadersDirectory() const;
 
@@ -45,7 +48,10 @@ namespace Silent::Services
         // Utilities
         // ==========
 
-        /** @brief Initializes the filesystem. */
-        void Initialize();
+        /** @brief Initializes the filesystem.
+         *
+         * @param isBenchmark Benchmark run state. Benchmark runs use a separate savegame folder so they never touch player savegames.
+         */
+        void Initialize(bool isBenchmark = false);
     };
 }
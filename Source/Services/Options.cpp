@@ -3,6 +3,7 @@
 
 #include "Application.h"
 #include "Input/Input.h"
+#include "Renderer/Common/Enums.h"
 #include "Services/Filesystem.h"
 #include "Utils/Parallel.h"
 #include "Utils/Stream.h"
@@ -13,6 +14,144 @@ using namespace Silent::Utils;
 namespace Silent::Services
 {
     constexpr char OPTIONS_FILENAME[] = "Options";
+    constexpr char OPTIONS_FILE_EXT[] = ".options";
+
+    constexpr uint32 OPTIONS_FILE_MAGIC   = 0x54504F53; // "SOPT".
+    constexpr uint16 OPTIONS_FILE_VERSION = 1;
+    constexpr auto   SAVE_COALESCE_DELAY  = std::chrono::milliseconds(500);
+
+    /** @brief Binary options file record keys. Values are stored in files and must never change. */
+    enum class OptionsRecordKey : uint16
+    {
+        WindowedSizeX                = 0,
+        WindowedSizeY                = 1,
+        EnableMaximized              = 2,
+        RenderBackend                = 3,
+        EnableFullscreen             = 4,
+        BrightnessLevel              = 5,
+        FrameRate                    = 6,
+        RenderScale                  = 7,
+        AspectRatio                  = 8,
+        TextureFilter                = 9,
+        TextQuality                  = 10,
+        Lighting                     = 11,
+        EnableVertexJitter           = 12,
+        EnableDithering              = 13,
+        EnableVignette               = 14,
+        EnableCrtFilter              = 15,
+        EnableAutoLoad               = 16,
+        EnableSubtitles              = 17,
+        Language                     = 18,
+        Sound                        = 19,
+        BgmVolume                    = 20,
+        SeVolume                     = 21,
+        BloodColor                   = 22,
+        BulletAdjust                 = 23,
+        KeyboardMouseBinding         = 24, /** One record per action: action ID followed by event IDs, all 16-bit. */
+        ActiveKeyboardMouseProfileId = 25,
+        GamepadBinding               = 26, /** One record per action: action ID followed by event IDs, all 16-bit. */
+        ActiveGamepadProfileId       = 27,
+        EnableVibration              = 28,
+        MouseSensitivity             = 29,
+        WeaponControl                = 30,
+        ViewControl                  = 31,
+        RetreatTurnControl           = 32,
+        WalkRunControl               = 33,
+        DisableAutoAiming            = 34,
+        ViewMode                     = 35,
+        DialogPause                  = 36,
+        EnableToasts                 = 37,
+        EnableParallelism            = 38
+    };
+
+    /** @brief Binary options file header. Followed by records of a 16-bit key, a 16-bit payload size, and the payload. */
+    struct OptionsFileHeader
+    {
+        uint32 Magic   = 0;
+        uint16 Version = 0;
+        uint16 Flags   = 0;
+    };
+    static_assert(sizeof(OptionsFileHeader) == 8);
+
+    using OptionsValueGetter = int32 (*)(const Options& options);
+    using OptionsValueSetter = void (*)(Options& options, int32 value);
+
+    /** @brief Binary options file value record accessors. */
+    struct OptionsValueRecord
+    {
+        OptionsRecordKey   Key = OptionsRecordKey::WindowedSizeX;
+        OptionsValueGetter Get = nullptr;
+        OptionsValueSetter Set = nullptr;
+    };
+
+    /** @brief Creates accessors for a value record stored directly in an `Options` field.
+     *
+     * @tparam FIELD `Options` field pointer.
+     * @param key Record key.
+     * @return Value record accessors.
+     */
+    template <auto FIELD>
+    constexpr OptionsValueRecord CreateValueRecord(OptionsRecordKey key)
+    {
+        return OptionsValueRecord
+        {
+            .Key = key,
+            .Get = [](const Options& options) { return (int32)(options.*FIELD); },
+            .Set = [](Options& options, int32 value) { options.*FIELD = (std::remove_cvref_t<decltype(options.*FIELD)>)value; }
+        };
+    }
+
+    /** @brief Value records in file order. Bindings are stored as separate records per action. */
+    static const auto OPTIONS_VALUE_RECORDS = std::array
+    {
+        OptionsValueRecord
+        {
+            .Key = OptionsRecordKey::WindowedSizeX,
+            .Get = [](const Options& options) { return (int32)options.WindowedSize.x; },
+            .Set = [](Options& options, int32 value) { options.WindowedSize.x = value; }
+        },
+        OptionsValueRecord
+        {
+            .Key = OptionsRecordKey::WindowedSizeY,
+            .Get = [](const Options& options) { return (int32)options.WindowedSize.y; },
+            .Set = [](Options& options, int32 value) { options.WindowedSize.y = value; }
+        },
+        CreateValueRecord<&Options::EnableMaximized>(             OptionsRecordKey::EnableMaximized),
+        CreateValueRecord<&Options::RenderBackend>(               OptionsRecordKey::RenderBackend),
+        CreateValueRecord<&Options::EnableFullscreen>(            OptionsRecordKey::EnableFullscreen),
+        CreateValueRecord<&Options::BrightnessLevel>(             OptionsRecordKey::BrightnessLevel),
+        CreateValueRecord<&Options::FrameRate>(                   OptionsRecordKey::FrameRate),
+        CreateValueRecord<&Options::RenderScale>(                 OptionsRecordKey::RenderScale),
+        CreateValueRecord<&Options::AspectRatio>(                 OptionsRecordKey::AspectRatio),
+        CreateValueRecord<&Options::TextureFilter>(               OptionsRecordKey::TextureFilter),
+        CreateValueRecord<&Options::TextQuality>(                 OptionsRecordKey::TextQuality),
+        CreateValueRecord<&Options::Lighting>(                    OptionsRecordKey::Lighting),
+        CreateValueRecord<&Options::EnableVertexJitter>(          OptionsRecordKey::EnableVertexJitter),
+        CreateValueRecord<&Options::EnableDithering>(             OptionsRecordKey::EnableDithering),
+        CreateValueRecord<&Options::EnableVignette>(              OptionsRecordKey::EnableVignette),
+        CreateValueRecord<&Options::EnableCrtFilter>(             OptionsRecordKey::EnableCrtFilter),
+        CreateValueRecord<&Options::EnableAutoLoad>(              OptionsRecordKey::EnableAutoLoad),
+        CreateValueRecord<&Options::EnableSubtitles>(             OptionsRecordKey::EnableSubtitles),
+        CreateValueRecord<&Options::Language>(                    OptionsRecordKey::Language),
+        CreateValueRecord<&Options::Sound>(                       OptionsRecordKey::Sound),
+        CreateValueRecord<&Options::BgmVolume>(                   OptionsRecordKey::BgmVolume),
+        CreateValueRecord<&Options::SeVolume>(                    OptionsRecordKey::SeVolume),
+        CreateValueRecord<&Options::BloodColor>(                  OptionsRecordKey::BloodColor),
+        CreateValueRecord<&Options::BulletAdjust>(                OptionsRecordKey::BulletAdjust),
+        CreateValueRecord<&Options::ActiveKeyboardMouseProfileId>(OptionsRecordKey::ActiveKeyboardMouseProfileId),
+        CreateValueRecord<&Options::ActiveGamepadProfileId>(      OptionsRecordKey::ActiveGamepadProfileId),
+        CreateValueRecord<&Options::EnableVibration>(             OptionsRecordKey::EnableVibration),
+        CreateValueRecord<&Options::MouseSensitivity>(            OptionsRecordKey::MouseSensitivity),
+        CreateValueRecord<&Options::WeaponControl>(               OptionsRecordKey::WeaponControl),
+        CreateValueRecord<&Options::ViewControl>(                 OptionsRecordKey::ViewControl),
+        CreateValueRecord<&Options::RetreatTurnControl>(          OptionsRecordKey::RetreatTurnControl),
+        CreateValueRecord<&Options::WalkRunControl>(              OptionsRecordKey::WalkRunControl),
+        CreateValueRecord<&Options::DisableAutoAiming>(           OptionsRecordKey::DisableAutoAiming),
+        CreateValueRecord<&Options::ViewMode>(                    OptionsRecordKey::ViewMode),
+        CreateValueRecord<&Options::DialogPause>(                 OptionsRecordKey::DialogPause),
+        CreateValueRecord<&Options::EnableToasts>(                OptionsRecordKey::EnableToasts),
+        CreateValueRecord<&Options::EnableParallelism>(           OptionsRecordKey::EnableParallelism)
+    };
 
     constexpr char KEY_GRAPHICS[]     = "graphics";
     constexpr char KEY_GAMEPLAY[]     = "gameplay";
@@ -24,6 +163,7 @@ namespace Silent::Services
     constexpr char KEY_WINDOWED_SIZE_Y[]                          = "windowedSizeY";
     constexpr char KEY_ENABLE_FULLSCREEN[]                        = "enableFullscreen";
     constexpr char KEY_ENABLE_MAXIMIZED[]                         = "enableMaximized";
+    constexpr char KEY_RENDER_BACKEND[]                           = "renderBackend";
     constexpr char KEY_BRIGHTNESS_LEVEL[]                         = "brightnessLevel";
     constexpr char KEY_FRAME_RATE[]                               = "frameRate";
     constexpr char KEY_RENDER_SCALE[]                             = "renderScale";
@@ -61,6 +201,7 @@ namespace Silent::Services
 
     constexpr auto DEFAULT_WINDOWED_SIZE                            = Vector2i(800, 600);
     constexpr bool DEFAULT_ENABLE_MAXIMIZED                         = false;
+    constexpr auto DEFAULT_RENDER_BACKEND                           = Renderer::RendererType::SdlGpu;
     constexpr bool DEFAULT_ENABLE_FULLSCREEN                        = false;
     constexpr int  DEFAULT_BRIGHTNESS_LEVEL                         = 3;
     constexpr auto DEFAULT_FRAME_RATE                               = FrameRateType::Fps60;
@@ -98,6 +239,7 @@ namespace Silent::Services
     {
         _options.WindowedSize       = DEFAULT_WINDOWED_SIZE;
         _options.EnableMaximized    = DEFAULT_ENABLE_MAXIMIZED;
+        _options.RenderBackend      = DEFAULT_RENDER_BACKEND;
         _options.EnableFullscreen   = DEFAULT_ENABLE_FULLSCREEN;
         _options.BrightnessLevel    = DEFAULT_BRIGHTNESS_LEVEL;
         _options.FrameRate          = DEFAULT_FRAME_RATE;
@@ -166,37 +308,144 @@ namespace Silent::Services
 
     void OptionsManager::Save()
     {
-        const auto& fs = g_App.GetFilesystem();
-
-        // Create options JSON.
-        auto optionsJson = ToOptionsJson(_options);
-
-        // Write options JSON file.
-        auto stream = Stream(fs.GetWorkDirectory() / (std::string(OPTIONS_FILENAME) + JSON_FILE_EXT), false, true);
-        stream.WriteJson(optionsJson);
-        stream.Close();
+        // Serialize on calling thread, which edited the options, so the game thread never reads them mid-edit.
+        auto buffer = ToOptionsBuffer(_options);
+
+        // @lock Restrict pending buffer access, which any thread writes and the game thread consumes.
+        std::lock_guard<std::mutex> lock(_saveMutex);
+        _pendingBuffer = std::move(buffer);
+        _saveRequestTime.store(std::chrono::steady_clock::now(), std::memory_order_release);
+        _isSavePending.store(true, std::memory_order_release);
     }
 
     void OptionsManager::Load()
     {
         const auto& fs = g_App.GetFilesystem();
 
-        // Open options JSON file.
-        auto stream = Stream(fs.GetWorkDirectory() / (std::string(OPTIONS_FILENAME) + JSON_FILE_EXT), true, false);
-        if (!stream.IsOpen())
+        SetDefaultOptions();
+
+        // Open options file.
+        auto file = std::ifstream(fs.GetWorkDirectory() / (std::string(OPTIONS_FILENAME) + OPTIONS_FILE_EXT), std::ios::binary | std::ios::ate);
+        if (!file.is_open())
+        {
+            // Import legacy JSON file.
+            if (ImportJson(fs.GetWorkDirectory() / (std::string(OPTIONS_FILENAME) + JSON_FILE_EXT)))
+            {
+                Debug::Log(Fmt("Imported `{}{}` file.", OPTIONS_FILENAME, JSON_FILE_EXT), Debug::LogLevel::Info);
+            }
+            else
+            {
+                Debug::Log(Fmt("Creating new `{}{}` file.", OPTIONS_FILENAME, OPTIONS_FILE_EXT), Debug::LogLevel::Info);
+            }
+
+            Save();
+            return;
+        }
+
+        // Read file.
+        auto buffer = std::vector<byte>((size_t)file.tellg());
+        file.seekg(0);
+        file.read(buffer.data(), buffer.size());
+
+        // Parse options buffer, falling back to defaults if corrupt.
+        try
+        {
+            FromOptionsBuffer(buffer, _options);
+        }
+        catch (const std::exception& ex)
         {
-            Debug::Log(Fmt("Creating new `{}{}` file.", OPTIONS_FILENAME, JSON_FILE_EXT), Debug::LogLevel::Info);
+            Debug::Log(Fmt("Failed to load `{}{}` file, resetting to defaults: {}", OPTIONS_FILENAME, OPTIONS_FILE_EXT, ex.what()), Debug::LogLevel::Warning);
 
             SetDefaultOptions();
             Save();
+        }
+    }
+
+    void OptionsManager::Update()
+    {
+        if (!_isSavePending.load(std::memory_order_acquire) ||
+            (std::chrono::steady_clock::now() - _saveRequestTime.load(std::memory_order_acquire)) < SAVE_COALESCE_DELAY)
+        {
             return;
         }
 
+        // Keep coalescing while previous write is in flight.
+        if (_saveFuture.valid())
+        {
+            if (_saveFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                return;
+            }
+
+            _saveFuture.get();
+        }
+
+        // Take latest buffer and write it on I/O task.
+        auto buffer = std::vector<byte>{};
+        {
+            // @lock Restrict pending buffer access, which any thread writes and the game thread consumes.
+            std::lock_guard<std::mutex> lock(_saveMutex);
+            buffer.swap(_pendingBuffer);
+            _isSavePending.store(false, std::memory_order_release);
+        }
+
+        _saveFuture = g_App.GetExecutor().AddTask([this, buffer = std::move(buffer)]()
+        {
+            WriteOptionsFile(buffer);
+        });
+    }
+
+    void OptionsManager::Flush()
+    {
+        if (_saveFuture.valid())
+        {
+            _saveFuture.get();
+        }
+
+        auto buffer = std::vector<byte>{};
+        {
+            // @lock Restrict pending buffer access, which any thread writes and the game thread consumes.
+            std::lock_guard<std::mutex> lock(_saveMutex);
+            if (!_isSavePending.exchange(false, std::memory_order_acq_rel))
+            {
+                return;
+            }
+
+            buffer.swap(_pendingBuffer);
+        }
+
+        WriteOptionsFile(buffer);
+    }
+
+    bool OptionsManager::ImportJson(const std::filesystem::path& filename)
+    {
+        // Open options JSON file.
+        auto stream = Stream(filename, true, false);
+        if (!stream.IsOpen())
+        {
+            return false;
+        }
+
         // Parse file into JSON object.
         auto optionsJson = stream.ReadJson();
 
-        // Read options JSON.
-        _options = FromOptionsJson(optionsJson);
+        // Read options JSON, keeping debug options.
+        auto options            = FromOptionsJson(optionsJson);
+        options.EnableDebugMode = _options.EnableDebugMode;
+        options.EnableDebugGui  = _options.EnableDebugGui;
+        _options                = std::move(options);
+        return true;
+    }
+
+    void OptionsManager::ExportJson(const std::filesystem::path& filename) const
+    {
+        // Create options JSON.
+        auto optionsJson = ToOptionsJson(_options);
+
+        // Write options JSON file.
+        auto stream = Stream(filename, false, true);
+        stream.WriteJson(optionsJson);
+        stream.Close();
     }
 
     void OptionsManager::SetDefaultOptions()
@@ -224,6 +473,7 @@ namespace Silent::Services
         options.WindowedSize.x     = graphicsJson.value(KEY_WINDOWED_SIZE_X,      DEFAULT_WINDOWED_SIZE.x);
         options.WindowedSize.y     = graphicsJson.value(KEY_WINDOWED_SIZE_Y,      DEFAULT_WINDOWED_SIZE.y);
         options.EnableMaximized    = graphicsJson.value(KEY_ENABLE_MAXIMIZED,     DEFAULT_ENABLE_MAXIMIZED);
+        options.RenderBackend      = graphicsJson.value(KEY_RENDER_BACKEND,       DEFAULT_RENDER_BACKEND);
         options.EnableFullscreen   = graphicsJson.value(KEY_ENABLE_FULLSCREEN,    DEFAULT_ENABLE_FULLSCREEN);
         options.BrightnessLevel    = graphicsJson.value(KEY_BRIGHTNESS_LEVEL,     DEFAULT_BRIGHTNESS_LEVEL);
         options.FrameRate          = graphicsJson.value(KEY_FRAME_RATE,           DEFAULT_FRAME_RATE);
@@ -370,6 +620,7 @@ namespace Silent::Services
                     { KEY_WINDOWED_SIZE_X,      options.WindowedSize.x     },
                     { KEY_WINDOWED_SIZE_Y,      options.WindowedSize.y     },
                     { KEY_ENABLE_MAXIMIZED,     options.EnableMaximized    },
+                    { KEY_RENDER_BACKEND,       options.RenderBackend      },
                     { KEY_ENABLE_FULLSCREEN,    options.EnableFullscreen   },
                     { KEY_BRIGHTNESS_LEVEL,     options.BrightnessLevel    },
                     { KEY_FRAME_RATE,           options.FrameRate          },
@@ -428,4 +679,173 @@ namespace Silent::Services
             }
         };
     }
+
+    void OptionsManager::FromOptionsBuffer(std::span<const byte> buffer, Options& options) const
+    {
+        // Read and validate header.
+        auto header = OptionsFileHeader{};
+        if (buffer.size() < sizeof(header))
+        {
+            throw std::runtime_error("Options buffer is truncated.");
+        }
+        std::memcpy(&header, buffer.data(), sizeof(header));
+
+        if (header.Magic != OPTIONS_FILE_MAGIC)
+        {
+            throw std::runtime_error("Options buffer has invalid magic.");
+        }
+
+        if (header.Version > OPTIONS_FILE_VERSION)
+        {
+            Debug::Log(Fmt("Options buffer version {} is newer than supported version {}. Unknown options are ignored.", header.Version, OPTIONS_FILE_VERSION),
+                       Debug::LogLevel::Warning);
+        }
+
+        // Read records.
+        uint offset = sizeof(header);
+        while (offset < buffer.size())
+        {
+            uint16 key  = 0;
+            uint16 size = 0;
+            if ((offset + (sizeof(uint16) * 2)) > buffer.size())
+            {
+                throw std::runtime_error(Fmt("Options buffer record at offset {} is truncated.", offset));
+            }
+            std::memcpy(&key,  &buffer[offset],                  sizeof(uint16));
+            std::memcpy(&size, &buffer[offset + sizeof(uint16)], sizeof(uint16));
+            offset += sizeof(uint16) * 2;
+
+            if ((offset + size) > buffer.size())
+            {
+                throw std::runtime_error(Fmt("Options buffer record {} is truncated.", key));
+            }
+            const auto* payload = &buffer[offset];
+            offset             += size;
+
+            // Read binding record.
+            if (key == (uint16)OptionsRecordKey::KeyboardMouseBinding || key == (uint16)OptionsRecordKey::GamepadBinding)
+            {
+                if (size < sizeof(uint16) || (size % sizeof(uint16)) != 0)
+                {
+                    continue;
+                }
+
+                auto ids = std::vector<uint16>(size / sizeof(uint16));
+                std::memcpy(ids.data(), payload, size);
+
+                auto  actionId = (ActionId)ids.front();
+                auto& bindings = (key == (uint16)OptionsRecordKey::KeyboardMouseBinding) ? options.KeyboardMouseBindings : options.GamepadBindings;
+                if (!bindings.contains(actionId))
+                {
+                    continue;
+                }
+
+                // Action ID alone means the action was unbound.
+                auto& events = bindings[actionId];
+                events.clear();
+                for (int i = 1; i < ids.size(); i++)
+                {
+                    events.push_back((EventId)ids[i]);
+                }
+                continue;
+            }
+
+            // Read value record. Values are stored as little-endian signed integers of 1, 2, or 4 bytes.
+            if (size == 0 || size > sizeof(int32))
+            {
+                continue;
+            }
+
+            int32 value = 0;
+            std::memcpy(&value, payload, size);
+            value = (value << ((sizeof(int32) - size) * 8)) >> ((sizeof(int32) - size) * 8);
+
+            for (const auto& record : OPTIONS_VALUE_RECORDS)
+            {
+                if ((uint16)record.Key == key)
+                {
+                    record.Set(options, value);
+                    break;
+                }
+            }
+        }
+    }
+
+    std::vector<byte> OptionsManager::ToOptionsBuffer(const Options& options) const
+    {
+        auto buffer = std::vector<byte>(sizeof(OptionsFileHeader));
+        auto header = OptionsFileHeader{ .Magic = OPTIONS_FILE_MAGIC, .Version = OPTIONS_FILE_VERSION };
+        std::memcpy(buffer.data(), &header, sizeof(header));
+
+        auto writeRecord = [&](OptionsRecordKey key, const void* payload, uint16 size)
+        {
+            uint offset = (uint)buffer.size();
+            buffer.resize(offset + (sizeof(uint16) * 2) + size);
+            std::memcpy(&buffer[offset],                        &key,    sizeof(uint16));
+            std::memcpy(&buffer[offset + sizeof(uint16)],       &size,   sizeof(uint16));
+            std::memcpy(&buffer[offset + (sizeof(uint16) * 2)], payload, size);
+        };
+
+        // Write value with fewest bytes that hold it.
+        auto writeValue = [&](OptionsRecordKey key, int32 value)
+        {
+            uint16 size = (value == (int8)value) ? sizeof(int8) : ((value == (int16)value) ? sizeof(int16) : sizeof(int32));
+            writeRecord(key, &value, size);
+        };
+
+        // Write bindings as action ID followed by event IDs.
+        auto ids           = std::vector<uint16>{};
+        auto writeBindings = [&](OptionsRecordKey key, const BindingProfile& bindings)
+        {
+            for (const auto& [actionId, eventIds] : bindings)
+            {
+                ids.clear();
+                ids.push_back((uint16)actionId);
+                for (auto eventId : eventIds)
+                {
+                    ids.push_back((uint16)eventId);
+                }
+
+                writeRecord(key, ids.data(), (uint16)(ids.size() * sizeof(uint16)));
+            }
+        };
+
+        // Write values and bindings.
+        for (const auto& record : OPTIONS_VALUE_RECORDS)
+        {
+            writeValue(record.Key, record.Get(options));
+        }
+        writeBindings(OptionsRecordKey::KeyboardMouseBinding, options.KeyboardMouseBindings);
+        writeBindings(OptionsRecordKey::GamepadBinding,       options.GamepadBindings);
+
+        return buffer;
+    }
+
+    void OptionsManager::WriteOptionsFile(std::span<const byte> buffer) const
+    {
+        const auto& fs = g_App.GetFilesystem();
+
+        auto filename = fs.GetWorkDirectory() / (std::string(OPTIONS_FILENAME) + OPTIONS_FILE_EXT);
+        auto tempFile = filename;
+        tempFile     += TEMP_FILE_EXT;
+
+        // Write temporary file.
+        {
+            auto file = std::ofstream(tempFile, std::ios::binary | std::ios::trunc);
+            file.write(buffer.data(), buffer.size());
+            if (!file)
+            {
+                Debug::Log(Fmt("Failed to write `{}`.", tempFile.string()), Debug::LogLevel::Error);
+                return;
+            }
+        }
+
+        // Replace previous file. Readers see either the old or new file, never a partial one.
+        auto error = std::error_code();
+        std::filesystem::rename(tempFile, filename, error);
+        if (error)
+        {
+            Debug::Log(Fmt("Failed to replace `{}`: {}", filename.string(), error.message()), Debug::LogLevel::Error);
+        }
+    }
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Input/Input.h"
+#include "Renderer/Common/Enums.h"
 
 using namespace Silent::Input;
 
@@ -102,8 +103,9 @@ namespace Silent::Services
         // Graphics (internal)
         // ====================
 
-        Vector2i WindowedSize    = Vector2i::Zero;
-        bool     EnableMaximized = false;
+        Vector2i               WindowedSize    = Vector2i::Zero;
+        bool                   EnableMaximized = false;
+        Renderer::RendererType RenderBackend   = Renderer::RendererType::SdlGpu;
 
         // ================
         // Graphics (user)
@@ -183,7 +185,9 @@ namespace Silent::Services
         bool EnableParallelism = false;
     };
 
-    /** @brief User options configuration manager. */
+    /** @brief User options configuration manager. Options are stored in a compact versioned binary file.
+     * Saves are coalesced over a short window and written atomically on a background task, and JSON remains available for import and export.
+     */
     class OptionsManager
     {
     private:
@@ -191,7 +195,12 @@ namespace Silent::Services
         // Fields
         // =======
 
-        Options _options = {}; /** Options configuration data. */
+        Options                                            _options         = {};    /** Options configuration data. */
+        std::atomic<bool>                                  _isSavePending   = false; /** Changes waiting for the coalescing window to pass. Set by any thread, consumed by game thread. */
+        std::atomic<std::chrono::steady_clock::time_point> _saveRequestTime = {};    /** Time of the latest save request. Published before `_isSavePending`. */
+        std::vector<byte>                                  _pendingBuffer   = {};    /** Options buffer of the latest save request, serialized by the requesting thread. */
+        std::mutex                                         _saveMutex       = {};
+        std::future<void>                                  _saveFuture      = {};    /** In-flight background write. */
 
     public:
         // =============
@@ -233,12 +242,36 @@ namespace Silent::Services
         /** @brief Initializes the options configurations to startup defaults, taking the build mode into account. */
         void Initialize();
 
-        /** @brief Saves the current options configuration to a JSON file on the platforms's workspace folder. */
+        /** @brief Requests a save of the current options configuration to the binary file on the platform's workspace folder.
+         * The options are serialized immediately on the calling thread, so it must be the thread that edited them, such as the render worker's debug GUI.
+         * Requests arriving within a short window are coalesced into one background write of the latest buffer, dispatched by `Update`.
+         */
         void Save();
 
-        /** @brief Loads the options configuration from a JSON file on the platforms's workspace folder. */
+        /** @brief Loads the options configuration from the binary file on the platform's workspace folder.
+         * Imports a legacy JSON file if no binary file exists yet.
+         */
         void Load();
 
+        /** @brief Dispatches a pending save on a background task once the coalescing window has passed and no write is in flight. */
+        void Update();
+
+        /** @brief Waits for the in-flight write and writes any pending save immediately. Used on shutdown. */
+        void Flush();
+
+        /** @brief Imports the options configuration from a JSON file. Debug options are kept.
+         *
+         * @param filename JSON file path.
+         * @return `true` if imported, `false` if the file couldn't be opened.
+         */
+        bool ImportJson(const std::filesystem::path& filename);
+
+        /** @brief Exports the current options configuration to a JSON file.
+         *
+         * @param filename JSON file path.
+         */
+        void ExportJson(const std::filesystem::path& filename) const;
+
         // ==========
         // Operators
         // ==========
@@ -270,5 +303,27 @@ namespace Silent::Services
          * @return Options JSON.
          */
         json ToOptionsJson(const Options& options) const;
+
+        /** @brief Applies a binary buffer containing the options configuration to an internal options object.
+         * Options missing from the buffer are left unchanged, and unknown records are skipped so older and newer files stay readable.
+         *
+         * @param buffer Options buffer to parse.
+         * @param[out] options Internal `Options` object to update.
+         * @exception std::runtime_error if the buffer has an invalid header or truncated records.
+         */
+        void FromOptionsBuffer(std::span<const byte> buffer, Options& options) const;
+
+        /** @brief Parses an internal options object to a binary buffer containing the options configuration.
+         *
+         * @param options Internal `Options` object to parse.
+         * @return Options buffer.
+         */
+        std::vector<byte> ToOptionsBuffer(const Options& options) const;
+
+        /** @brief Writes the options file atomically by writing a temporary file and renaming it over the previous one.
+         *
+         * @param buffer Options buffer to write.
+         */
+        void WriteOptionsFile(std::span<const byte> buffer) const;
     };
 }
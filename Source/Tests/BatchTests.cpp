@@ -0,0 +1,127 @@
+#include "Framework.h"
+#include "Tests/Tests.h"
+
+#include "Assets/Parsers/Tim.h"
+#include "Renderer/Common/Enums.h"
+#include "Renderer/Common/Objects/Graphic/Batch.h"
+#include "Renderer/Common/Objects/Graphic/Bucket.h"
+#include "Renderer/Common/Objects/Graphic/TextureAtlas.h"
+#include "Renderer/Common/Objects/Primitive2d.h"
+#include "Renderer/Common/Objects/Scene/Sprite2d.h"
+
+using namespace Silent::Assets;
+using namespace Silent::Renderer;
+
+namespace Silent::Tests
+{
+    /** @brief Checks a batch against its expected state and merge counts.
+     *
+     * @param batch Batch to check.
+     * @param stage Expected render stage.
+     * @param blendMode Expected blend mode.
+     * @param scaleMode Expected scale mode.
+     * @param texIdx Expected texture index.
+     * @param indexStart Expected start index.
+     * @param itemCount Expected merged item count.
+     * @param indexCount Expected index count.
+     * @param name Batch name used in failure messages.
+     */
+    static void CheckBatch(const Batch& batch, RenderStage stage, BlendMode blendMode, ScaleMode scaleMode, int texIdx,
+                           uint indexStart, uint itemCount, uint indexCount, const std::string& name)
+    {
+        Check(batch.Stage == stage,           Fmt("{} has wrong render stage.", name));
+        Check(batch.BlendM == blendMode,      Fmt("{} has wrong blend mode.", name));
+        Check(batch.ScaleM == scaleMode,      Fmt("{} has wrong scale mode.", name));
+        Check(batch.TextureIdx == texIdx,     Fmt("{} has texture {}, expected {}.", name, batch.TextureIdx, texIdx));
+        Check(batch.IndexStart == indexStart, Fmt("{} starts at index {}, expected {}.", name, batch.IndexStart, indexStart));
+        Check(batch.ItemCount == itemCount,   Fmt("{} merged {} items, expected {}.", name, batch.ItemCount, itemCount));
+        Check(batch.IndexCount == indexCount, Fmt("{} has {} indices, expected {}.", name, batch.IndexCount, indexCount));
+    }
+
+    void TestBatcher()
+    {
+        constexpr int  ASSET_IDX_0 = 5;
+        constexpr int  ASSET_IDX_1 = 6;
+        constexpr auto TEX_RES     = Vector2i(16);
+
+        // Build primitives. Vertex storage must outlive records.
+        auto quad        = Primitive2d::CreateQuad(Vector2(10.0f, 10.0f), Vector2(20.0f, 10.0f), Vector2(20.0f, 20.0f), Vector2(10.0f, 20.0f),
+                                                   Color::White, Color::White, Color::White, Color::White);
+        auto tri         = Primitive2d::CreateTriangle(Vector2(30.0f, 10.0f), Vector2(40.0f, 10.0f), Vector2(35.0f, 20.0f),
+                                                       Color::White, Color::White, Color::White);
+        auto toRecord    = [](const Primitive2d& prim, BlendMode blendMode, ScaleMode scaleMode)
+        {
+            return Primitive2dRecord
+            {
+                .Vertices = prim.GetVertices(),
+                .Depth    = prim.Depth,
+                .ScaleM   = scaleMode,
+                .BlendM   = blendMode
+            };
+        };
+        auto prims = std::vector<Primitive2dRecord>
+        {
+            toRecord(quad, BlendMode::Alpha, ScaleMode::Fit),     // 0: Starts alpha batch.
+            toRecord(quad, BlendMode::Alpha, ScaleMode::Fit),     // 1: Merges.
+            toRecord(tri,  BlendMode::Alpha, ScaleMode::Fit),     // 2: Merges.
+            toRecord(quad, BlendMode::Add,   ScaleMode::Fit),     // 3: Blend mode change.
+            toRecord(quad, BlendMode::Alpha, ScaleMode::Stretch), // 4: Scale mode change.
+            Primitive2dRecord{}                                   // 5: Invalid vertex count, skipped.
+        };
+
+        // Build sprites with resolved textures.
+        auto tex = std::make_shared<const TimAsset>(TimAsset{ .Resolution = TEX_RES });
+        auto createSprite = [&](int assetIdx)
+        {
+            auto sprite    = Sprite2d::CreateSprite2d(assetIdx, Vector2::Zero, Vector2::One, Vector2(50.0f), 0.0f, Vector2::One, Color::White);
+            sprite.Texture = tex;
+            return sprite;
+        };
+        auto sprites = std::vector<Sprite2d>
+        {
+            createSprite(ASSET_IDX_0), // 0: Starts textured batch.
+            createSprite(ASSET_IDX_0), // 1: Merges.
+            createSprite(ASSET_IDX_1)  // 2: Texture change.
+        };
+
+        // Keys are consumed in order, so neighbors merge only if compatible.
+        auto primKey   = [](uint idx) { return SortKey::Create(DrawLayer::Scene2d, 0, RenderStage::Primitive2d, BlendMode::Alpha, NO_VALUE, idx); };
+        auto spriteKey = [](uint idx) { return SortKey::Create(DrawLayer::Scene2d, 0, RenderStage::Primitive2dTextured, BlendMode::Alpha, 0, idx); };
+        auto keys      = std::vector<SortKey>
+        {
+            primKey(0), primKey(1), primKey(2), primKey(3),
+            spriteKey(0), spriteKey(1), spriteKey(2),
+            primKey(4), primKey(5)
+        };
+
+        auto atlas   = TextureAtlas();
+        auto batcher = Batcher();
+        batcher.Build(keys, prims, sprites, atlas);
+
+        // Check merge counts.
+        auto batches = batcher.GetBatches();
+        Check(batches.size() == 5, Fmt("Built {} batches, expected 5.", batches.size()));
+        CheckBatch(batches[0], RenderStage::Primitive2d,         BlendMode::Alpha, ScaleMode::Fit,     NO_VALUE,    0,  3, 15, "Alpha primitive batch");
+        CheckBatch(batches[1], RenderStage::Primitive2d,         BlendMode::Add,   ScaleMode::Fit,     NO_VALUE,    15, 1, 6,  "Additive primitive batch");
+        CheckBatch(batches[2], RenderStage::Primitive2dTextured, BlendMode::Alpha, ScaleMode::Fit,     ASSET_IDX_0, 21, 2, 12, "First sprite batch");
+        CheckBatch(batches[3], RenderStage::Primitive2dTextured, BlendMode::Alpha, ScaleMode::Fit,     ASSET_IDX_1, 33, 1, 6,  "Second sprite batch");
+        CheckBatch(batches[4], RenderStage::Primitive2d,         BlendMode::Alpha, ScaleMode::Stretch, NO_VALUE,    39, 1, 6,  "Stretched primitive batch");
+        Check(batcher.GetIndices().size() == 45,  Fmt("Built {} indices, expected 45.", batcher.GetIndices().size()));
+        Check(batcher.GetVertices().size() == 31, Fmt("Built {} vertices, expected 31.", batcher.GetVertices().size()));
+
+        // Check indices of merged items are rebased onto their own vertices.
+        auto indices = batcher.GetIndices();
+        Check(indices[6] == 4 && indices[12] == 8 && indices[14] == 10, "Merged primitive indices aren't rebased.");
+
+        // Check sprite quad placement. A 16x16 texel sprite at retro resolution spans 5% by 6.67% of the screen around its center pivot.
+        const auto& spriteVert = batcher.GetVertices()[15];
+        CheckNear(spriteVert.Position.x, -0.05f,        0.0001f, "Sprite top-left NDC X");
+        CheckNear(spriteVert.Position.y, 1.0f / 15.0f,  0.0001f, "Sprite top-left NDC Y");
+        CheckNear(spriteVert.Uv.x,       0.0f,          0.0001f, "Sprite top-left U");
+        CheckNear(batcher.GetVertices()[17].Uv.y, 1.0f, 0.0001f, "Sprite bottom-right V");
+
+        // Check rebuilding clears previous batches.
+        batcher.Build(std::span<const SortKey>(keys).first(2), prims, sprites, atlas);
+        Check(batcher.GetBatches().size() == 1 && batcher.GetBatches()[0].ItemCount == 2, "Rebuild didn't clear previous batches.");
+    }
+}
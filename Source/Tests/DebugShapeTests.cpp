@@ -0,0 +1,106 @@
+#include "Framework.h"
+#include "Tests/Tests.h"
+
+#include "Renderer/Common/Objects/Graphic/DebugShape.h"
+
+using namespace Silent::Renderer;
+
+namespace Silent::Tests
+{
+    constexpr float DEBUG_SHAPE_TOLERANCE = 0.0001f;
+
+    /** @brief Gets the draw of a debug shape variant.
+     *
+     * @param batcher Built batcher.
+     * @param type Debug shape type.
+     * @param isWireframe Wireframe or solid variant.
+     * @return Draw, `nullptr` if the variant has no instances.
+     */
+    static const DebugShapeDraw* FindDraw(const DebugShapeBatcher& batcher, DebugShapeType type, bool isWireframe)
+    {
+        for (const auto& draw : batcher.GetDraws())
+        {
+            if (draw.Type == type && draw.IsWireframe == isWireframe)
+            {
+                return &draw;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void TestDebugShapeBatcher()
+    {
+        constexpr float SPHERE_RADIUS = 2.0f;
+        constexpr float CYL_RADIUS    = 0.5f;
+        constexpr float CYL_LENGTH    = 4.0f;
+
+        const auto sphereCenter = Vector3(1.0f, 2.0f, 3.0f);
+        const auto cylCenter    = Vector3(-4.0f, 0.0f, 2.0f);
+        const auto cylRot       = AxisAngle(Vector3::UnitZ, PI / 2.0f).ToQuaternion();
+
+        // Submit shapes out of mesh order.
+        auto createRecord = [](DebugShapeType type, bool isWireframe, const Matrix& transform, const Color& color)
+        {
+            return DebugShapeRecord{ .Type = type, .IsWireframe = isWireframe, .Instance = DebugShapeInstance{ .Transform = transform, .Col = color } };
+        };
+        auto sphereTransform = DebugShapeInstance::CreateTransform(sphereCenter, Quaternion::Identity, Vector3(SPHERE_RADIUS));
+        auto cylTransform    = DebugShapeInstance::CreateTransform(cylCenter, cylRot, Vector3(CYL_RADIUS, CYL_LENGTH, CYL_RADIUS));
+        auto shapes          = std::vector<DebugShapeRecord>
+        {
+            createRecord(DebugShapeType::Sphere,   true,  sphereTransform, Color(1.0f, 0.0f, 0.0f)),
+            createRecord(DebugShapeType::Cylinder, false, cylTransform,    Color(0.0f, 1.0f, 0.0f)),
+            createRecord(DebugShapeType::Sphere,   true,  sphereTransform, Color(0.0f, 0.0f, 1.0f)),
+            createRecord(DebugShapeType::Sphere,   false, sphereTransform, Color::White)
+        };
+
+        auto batcher = DebugShapeBatcher();
+        batcher.Build(shapes);
+
+        // Check one draw per used mesh in mesh order, with instances grouped in submission order.
+        auto draws     = batcher.GetDraws();
+        auto instances = batcher.GetInstances();
+        Check(draws.size() == 3,     Fmt("Built {} draws, expected 3.", draws.size()));
+        Check(instances.size() == 4, Fmt("Built {} instances, expected 4.", instances.size()));
+        Check(draws[0].Type == DebugShapeType::Sphere && draws[0].IsWireframe && draws[0].InstanceStart == 0 && draws[0].InstanceCount == 2,
+              "Wireframe sphere draw doesn't hold both wireframe sphere instances first.");
+        Check(draws[1].Type == DebugShapeType::Sphere && !draws[1].IsWireframe && draws[1].InstanceStart == 2 && draws[1].InstanceCount == 1,
+              "Solid sphere draw doesn't follow wireframe sphere draw.");
+        Check(draws[2].Type == DebugShapeType::Cylinder && !draws[2].IsWireframe && draws[2].InstanceStart == 3 && draws[2].InstanceCount == 1,
+              "Solid cylinder draw doesn't follow sphere draws.");
+        Check(instances[0].Col == shapes[0].Instance.Col && instances[1].Col == shapes[2].Instance.Col,
+              "Wireframe sphere instances aren't in submission order.");
+
+        // Check transformed sphere meshes lie on the sphere.
+        auto verts = DebugShapeBatcher::GetMeshVertices();
+        for (bool isWireframe : { true, false })
+        {
+            const auto* draw = FindDraw(batcher, DebugShapeType::Sphere, isWireframe);
+            Check(draw != nullptr && draw->VertexCount > 0, "Sphere draw has no vertices.");
+
+            const auto& transform = instances[draw->InstanceStart].Transform;
+            for (const auto& vert : verts.subspan(draw->VertexStart, draw->VertexCount))
+            {
+                auto pos = Vector3::Transform(vert, transform);
+                CheckNear(Vector3::Distance(pos, sphereCenter), SPHERE_RADIUS, DEBUG_SHAPE_TOLERANCE, "Sphere vertex distance from center");
+            }
+        }
+
+        // Check transformed cylinder mesh is scaled before rotation, so its length lies along the rotated X axis.
+        const auto* cylDraw = FindDraw(batcher, DebugShapeType::Cylinder, false);
+        Check(cylDraw != nullptr, "Cylinder draw is missing.");
+
+        float axisExtent = 0.0f;
+        for (const auto& vert : verts.subspan(cylDraw->VertexStart, cylDraw->VertexCount))
+        {
+            auto offset = Vector3::Transform(vert, instances[cylDraw->InstanceStart].Transform) - cylCenter;
+            axisExtent  = std::max(axisExtent, std::abs(offset.x));
+            Check(glm::length(glm::vec2(offset.y, offset.z)) <= (CYL_RADIUS + DEBUG_SHAPE_TOLERANCE), "Cylinder vertex lies outside its radius.");
+        }
+        CheckNear(axisExtent, CYL_LENGTH / 2.0f, DEBUG_SHAPE_TOLERANCE, "Cylinder half length along rotated axis");
+
+        // Check rebuilding clears previous instances.
+        batcher.Build(std::span<const DebugShapeRecord>(shapes).first(1));
+        Check(batcher.GetDraws().size() == 1 && batcher.GetInstances().size() == 1, "Rebuild didn't clear previous draws.");
+    }
+}
@@ -0,0 +1,94 @@
+#include "Framework.h"
+#include "Tests/Tests.h"
+
+#include "Utils/DistanceField.h"
+
+using namespace Silent::Utils;
+
+namespace Silent::Tests
+{
+    /** @brief Creates an anti-aliased coverage bitmap of a disc by supersampling.
+     *
+     * @param size Bitmap size.
+     * @param center Disc center in pixels.
+     * @param radius Disc radius in pixels.
+     * @return Coverage bitmap.
+     */
+    static std::vector<byte> CreateDiscCoverage(const Vector2i& size, const Vector2& center, float radius)
+    {
+        constexpr int SUBSAMPLE_COUNT = 8;
+
+        auto coverage = std::vector<byte>(size.x * size.y);
+        for (int y = 0; y < size.y; y++)
+        {
+            for (int x = 0; x < size.x; x++)
+            {
+                int insideCount = 0;
+                for (int subY = 0; subY < SUBSAMPLE_COUNT; subY++)
+                {
+                    for (int subX = 0; subX < SUBSAMPLE_COUNT; subX++)
+                    {
+                        auto pos     = Vector2(x + ((subX + 0.5f) / SUBSAMPLE_COUNT), y + ((subY + 0.5f) / SUBSAMPLE_COUNT));
+                        insideCount += (Vector2::Distance(pos, center) < radius) ? 1 : 0;
+                    }
+                }
+
+                float alpha                = (float)insideCount / (float)(SUBSAMPLE_COUNT * SUBSAMPLE_COUNT);
+                coverage[(y * size.x) + x] = (byte)(uint8)std::lround(alpha * 255.0f);
+            }
+        }
+
+        return coverage;
+    }
+
+    void TestDistanceField()
+    {
+        constexpr auto  SIZE      = Vector2i(24);
+        constexpr int   SPREAD    = 4;
+        constexpr float RADIUS    = 7.0f;
+        constexpr float TOLERANCE = 0.75f; // Pixels.
+
+        auto center    = SIZE.ToVector2() / 2.0f;
+        auto coverage  = CreateDiscCoverage(SIZE, center, RADIUS);
+        auto field     = GenerateDistanceField(coverage, SIZE, SPREAD);
+        auto fieldSize = SIZE + Vector2i(SPREAD * 2);
+        Check(field.size() == (fieldSize.x * fieldSize.y), Fmt("Field has {} pixels, expected {}.", field.size(), fieldSize.x * fieldSize.y));
+
+        // Decode every field pixel and compare against the analytic signed distance to the circle.
+        float scale    = 127.5f / (float)SPREAD;
+        float errorMax = 0.0f;
+        for (int y = 0; y < fieldSize.y; y++)
+        {
+            for (int x = 0; x < fieldSize.x; x++)
+            {
+                auto  pixelCenter = Vector2((x - SPREAD) + 0.5f, (y - SPREAD) + 0.5f);
+                float expected    = RADIUS - Vector2::Distance(pixelCenter, center);
+                float value       = (float)(uint8)field[(y * fieldSize.x) + x];
+
+                // Skip saturated range near spread limit.
+                if (std::abs(expected) >= (float)(SPREAD - 1))
+                {
+                    continue;
+                }
+
+                float dist = (value - 127.5f) / scale;
+                errorMax   = std::max(errorMax, std::abs(dist - expected));
+
+                // Inside must encode above the edge value and outside below it.
+                if (std::abs(expected) > TOLERANCE)
+                {
+                    Check((expected > 0.0f) == (value > 128.0f), Fmt("Pixel ({}, {}) is on the wrong side of the edge.", x, y));
+                }
+            }
+        }
+        Check(errorMax <= TOLERANCE, Fmt("Largest distance error is {} pixels, expected at most {}.", errorMax, TOLERANCE));
+
+        // Deep inside and far outside saturate.
+        auto fieldCenter = fieldSize / 2;
+        Check((uint8)field[(fieldCenter.y * fieldSize.x) + fieldCenter.x] == 255, "Disc center isn't saturated inside.");
+        Check((uint8)field[0] == 0, "Field corner isn't saturated outside.");
+
+        // Invalid input yields an empty field.
+        Check(GenerateDistanceField(coverage, SIZE, -1).empty(), "Negative spread produced a field.");
+    }
+}
@@ -0,0 +1,70 @@
+#include "Framework.h"
+#include "Tests/Tests.h"
+
+#include "Renderer/Common/Objects/Graphic/OrderingTable.h"
+
+using namespace Silent::Renderer;
+
+namespace Silent::Tests
+{
+    /** @brief Traverses an ordering table and collects its packets' item indices in draw order.
+     *
+     * @param ot Ordering table.
+     * @return Item indices in draw order.
+     */
+    static std::vector<uint> GetDrawOrder(const OrderingTable& ot)
+    {
+        auto itemIdxs = std::vector<uint>{};
+        ot.Traverse([&](const OtPacket& packet)
+        {
+            itemIdxs.push_back(packet.ItemIdx);
+        });
+
+        return itemIdxs;
+    }
+
+    void TestOrderingTable()
+    {
+        constexpr uint LENGTH           = 8;
+        constexpr uint PACKET_COUNT_MAX = 6;
+
+        auto ot = OrderingTable(LENGTH, PACKET_COUNT_MAX);
+        Check(ot.GetLength() == LENGTH && ot.GetPacketCount() == 0, "New ordering table isn't empty.");
+
+        // Higher Z draws first. Within a bucket, the last inserted packet draws first.
+        Check(ot.Insert(2, OtPacketType::Primitive2d, 0), "Insert failed.");
+        Check(ot.Insert(5, OtPacketType::Sprite2d,    1), "Insert failed.");
+        Check(ot.Insert(2, OtPacketType::Primitive2d, 2), "Insert failed.");
+        Check(ot.Insert(0, OtPacketType::Primitive2d, 3), "Insert failed.");
+        Check(ot.Insert(2, OtPacketType::Sprite2d,    4), "Insert failed.");
+
+        // Z beyond the last bucket clamps into it, drawing first and still in LIFO order.
+        Check(ot.Insert(LENGTH + 100, OtPacketType::Primitive2d, 5), "Insert beyond last bucket failed.");
+        Check(ot.GetPacketCount() == PACKET_COUNT_MAX, Fmt("Packet count is {}, expected {}.", ot.GetPacketCount(), PACKET_COUNT_MAX));
+        Check(GetDrawOrder(ot) == std::vector<uint>{ 5, 1, 4, 2, 0, 3 }, "Traversal order is wrong.");
+
+        // Full packet arena rejects inserts without disturbing the table.
+        Check(!ot.Insert(3, OtPacketType::Primitive2d, 6), "Insert into full packet arena succeeded.");
+        Check(GetDrawOrder(ot).size() == PACKET_COUNT_MAX, "Rejected insert changed the table.");
+
+        // Check packet types survive linking.
+        auto types = std::vector<OtPacketType>{};
+        ot.Traverse([&](const OtPacket& packet)
+        {
+            types.push_back(packet.Type);
+        });
+        Check(types[1] == OtPacketType::Sprite2d && types[2] == OtPacketType::Sprite2d && types[3] == OtPacketType::Primitive2d, "Packet types are wrong.");
+
+        // Clearing drops every bucket, including ones not written again afterward.
+        ot.Clear();
+        Check(ot.GetPacketCount() == 0 && GetDrawOrder(ot).empty(), "Cleared table isn't empty.");
+
+        Check(ot.Insert(7, OtPacketType::Primitive2d, 10), "Insert after clear failed.");
+        Check(ot.Insert(2, OtPacketType::Primitive2d, 11), "Insert after clear failed.");
+        Check(GetDrawOrder(ot) == std::vector<uint>{ 10, 11 }, "Stale packets survived clear.");
+
+        // Default table has no buckets.
+        auto emptyOt = OrderingTable();
+        Check(!emptyOt.Insert(0, OtPacketType::Primitive2d, 0), "Insert into table without buckets succeeded.");
+    }
+}
@@ -0,0 +1,57 @@
+#include "Framework.h"
+#include "Tests/Tests.h"
+
+namespace Silent::Tests
+{
+    constexpr char ALL_SUITES_NAME[] = "all";
+
+    /** @brief Test suites runnable from the command line. */
+    static const std::pair<std::string_view, void(*)()> SUITES[] =
+    {
+        { "batcher",        TestBatcher },
+        { "debug-shapes",   TestDebugShapeBatcher },
+        { "texture-atlas",  TestTextureAtlas },
+        { "upload-ring",    TestUploadRing },
+        { "ordering-table", TestOrderingTable },
+        { "distance-field", TestDistanceField }
+    };
+
+    void Check(bool cond, const std::string& msg)
+    {
+        if (!cond)
+        {
+            throw std::runtime_error(Fmt("Test failed: {}", msg));
+        }
+    }
+
+    void CheckNear(float value, float expected, float tolerance, const std::string& msg)
+    {
+        if (!(std::abs(value - expected) <= tolerance))
+        {
+            throw std::runtime_error(Fmt("Test failed: {} (got {}, expected {} +/- {})", msg, value, expected, tolerance));
+        }
+    }
+
+    void RunTests(const std::string& name)
+    {
+        uint suiteCount = 0;
+        for (const auto& [suiteName, suite] : SUITES)
+        {
+            if (name != ALL_SUITES_NAME && name != suiteName)
+            {
+                continue;
+            }
+
+            Debug::Log(Fmt("Running {} tests...", suiteName));
+            suite();
+            suiteCount++;
+        }
+
+        if (suiteCount == 0)
+        {
+            throw std::runtime_error(Fmt("Unknown test suite `{}`.", name));
+        }
+
+        Debug::Log(Fmt("Passed {} test suites.", suiteCount));
+    }
+}
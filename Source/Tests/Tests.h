@@ -0,0 +1,47 @@
+#pragma once
+
+namespace Silent::Tests
+{
+    /** @brief Checks a test condition. Unlike `Debug::Assert`, checks are functional in every build.
+     *
+     * @param cond Condition expected to hold.
+     * @param msg Failure message.
+     * @exception `std::runtime_error` if the condition doesn't hold.
+     */
+    void Check(bool cond, const std::string& msg);
+
+    /** @brief Checks that a value is within a tolerance of an expected value.
+     *
+     * @param value Value to check.
+     * @param expected Expected value.
+     * @param tolerance Maximum absolute difference.
+     * @param msg Failure message.
+     * @exception `std::runtime_error` if the value is out of tolerance.
+     */
+    void CheckNear(float value, float expected, float tolerance, const std::string& msg);
+
+    /** @brief Runs a CPU-side test suite by name.
+     *
+     * @param name Test suite name, or `all` to run every suite.
+     * @exception `std::runtime_error` if a check fails or no suite matches the name.
+     */
+    void RunTests(const std::string& name);
+
+    /** @brief Tests 2D batch merging of sorted primitives and sprites. */
+    void TestBatcher();
+
+    /** @brief Tests debug shape instance grouping and unit mesh transforms. */
+    void TestDebugShapeBatcher();
+
+    /** @brief Tests texture atlas packing, padding, texture indices, and UV remapping. */
+    void TestTextureAtlas();
+
+    /** @brief Tests upload ring allocation, alignment, and frame-in-flight page lifetimes. */
+    void TestUploadRing();
+
+    /** @brief Tests ordering table insertion, traversal order, clamping, and clearing. */
+    void TestOrderingTable();
+
+    /** @brief Tests signed distance field generation against an analytic disc. */
+    void TestDistanceField();
+}
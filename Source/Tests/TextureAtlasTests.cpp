@@ -0,0 +1,130 @@
+#include "Framework.h"
+#include "Tests/Tests.h"
+
+#include "Renderer/Common/Objects/Graphic/TextureAtlas.h"
+
+using namespace Silent::Renderer;
+
+namespace Silent::Tests
+{
+    constexpr int COLOR_CHANNEL_COUNT = 4; // RGBA.
+
+    /** @brief Creates RGBA8 image pixels whose red and green channels encode each pixel's position.
+     *
+     * @param res Image resolution in pixels.
+     * @return Image pixels.
+     */
+    static std::vector<byte> CreateImage(const Vector2i& res)
+    {
+        auto pixels = std::vector<byte>((res.x * res.y) * COLOR_CHANNEL_COUNT);
+        for (int y = 0; y < res.y; y++)
+        {
+            for (int x = 0; x < res.x; x++)
+            {
+                auto* pixel = &pixels[((y * res.x) + x) * COLOR_CHANNEL_COUNT];
+                pixel[0]    = (byte)x;
+                pixel[1]    = (byte)y;
+                pixel[2]    = (byte)0;
+                pixel[3]    = (byte)255;
+            }
+        }
+
+        return pixels;
+    }
+
+    /** @brief Gets a page pixel's red and green channels.
+     *
+     * @param page Atlas page.
+     * @param pos Pixel position.
+     * @return Red and green channels.
+     */
+    static Vector2i GetPagePixel(const AtlasPage& page, const Vector2i& pos)
+    {
+        const auto* pixel = &page.Pixels[((pos.y * TextureAtlas::PAGE_SIZE) + pos.x) * COLOR_CHANNEL_COUNT];
+        return Vector2i((uint8)pixel[0], (uint8)pixel[1]);
+    }
+
+    void TestTextureAtlas()
+    {
+        constexpr int  ASSET_IDX_0  = 3;
+        constexpr int  ASSET_IDX_1  = 4;
+        constexpr int  LARGE_IDX    = 5;
+        constexpr auto RES_0        = Vector2i(16, 8);
+        constexpr auto RES_1        = Vector2i(32);
+        constexpr auto LARGE_RES    = Vector2i(TextureAtlas::IMAGE_SIZE_MAX + 1, 1);
+        constexpr auto TEXEL_SIZE   = 1.0f / (float)TextureAtlas::PAGE_SIZE;
+        constexpr auto UV_TOLERANCE = TEXEL_SIZE / 16.0f;
+
+        auto atlas = TextureAtlas();
+
+        // Check first image placement.
+        auto        image0  = CreateImage(RES_0);
+        const auto* region0 = atlas.Add(ASSET_IDX_0, RES_0, image0);
+        Check(region0 != nullptr && region0->PageIdx == 0, "First image wasn't packed into first page.");
+        CheckNear((region0->UvMax - region0->UvMin).x, RES_0.x * TEXEL_SIZE, UV_TOLERANCE, "First image UV width");
+        CheckNear((region0->UvMax - region0->UvMin).y, RES_0.y * TEXEL_SIZE, UV_TOLERANCE, "First image UV height");
+
+        auto imagePos = Vector2i((int)std::round(region0->UvMin.x * TextureAtlas::PAGE_SIZE), (int)std::round(region0->UvMin.y * TextureAtlas::PAGE_SIZE));
+        Check(imagePos.x >= TextureAtlas::IMAGE_PADDING && imagePos.y >= TextureAtlas::IMAGE_PADDING, "First image overlaps page border padding.");
+
+        // Check pixels were copied in place and edge texels extruded into padding.
+        const auto& page = atlas.GetPages()[0];
+        Check(GetPagePixel(page, imagePos) == Vector2i(0, 0),                                "Image origin texel is misplaced.");
+        Check(GetPagePixel(page, imagePos + Vector2i(5, 3)) == Vector2i(5, 3),               "Image inner texel is misplaced.");
+        Check(GetPagePixel(page, imagePos + RES_0 - Vector2i(1)) == (RES_0 - Vector2i(1)),   "Image last texel is misplaced.");
+        Check(GetPagePixel(page, imagePos - Vector2i(1)) == Vector2i(0, 0),                  "Top-left padding doesn't extrude the corner texel.");
+        Check(GetPagePixel(page, imagePos + Vector2i(RES_0.x, 2)) == Vector2i(RES_0.x - 1, 2), "Right padding doesn't extrude the edge texel.");
+        Check(page.IsDirty, "Page isn't dirty after packing.");
+
+        // Check second image doesn't overlap first, including padding.
+        auto        image1  = CreateImage(RES_1);
+        const auto* region1 = atlas.Add(ASSET_IDX_1, RES_1, image1);
+        Check(region1 != nullptr && region1->PageIdx == 0, "Second image wasn't packed into first page.");
+
+        float padding    = TextureAtlas::IMAGE_PADDING * TEXEL_SIZE;
+        bool  isDisjoint = (region0->UvMax.x + padding) <= (region1->UvMin.x - padding) || (region1->UvMax.x + padding) <= (region0->UvMin.x - padding) ||
+                           (region0->UvMax.y + padding) <= (region1->UvMin.y - padding) || (region1->UvMax.y + padding) <= (region0->UvMin.y - padding);
+        Check(isDisjoint, "Padded image regions overlap.");
+
+        // Check repeated adds return existing region and large images are rejected.
+        Check(atlas.Add(ASSET_IDX_0, RES_0, image0) == region0, "Repeated add repacked image.");
+        Check(atlas.Add(LARGE_IDX, LARGE_RES, CreateImage(LARGE_RES)) == nullptr, "Oversized image was packed.");
+        Check(atlas.IsKnown(LARGE_IDX) && atlas.GetRegion(LARGE_IDX) == nullptr, "Oversized image isn't remembered as rejected.");
+
+        auto stats = atlas.GetStats();
+        Check(stats.PageCount == 1 && stats.ImageCount == 2 && stats.RejectedCount == 1,
+              Fmt("Stats report {} pages, {} images, {} rejected, expected 1, 2, 1.", stats.PageCount, stats.ImageCount, stats.RejectedCount));
+
+        // Check texture indices. Wrapping UV regions and unknown assets keep standalone textures.
+        Check(atlas.GetTextureIdx(ASSET_IDX_0, Vector2::Zero, Vector2::One) == TextureAtlas::PAGE_TEXTURE_IDX_BASE, "Atlased image doesn't bind its page.");
+        Check(atlas.GetTextureIdx(ASSET_IDX_0, Vector2::Zero, Vector2(2.0f)) == ASSET_IDX_0,                      "Wrapping UV region binds a page.");
+        Check(atlas.GetTextureIdx(LARGE_IDX, Vector2::Zero, Vector2::One) == LARGE_IDX,                           "Rejected image binds a page.");
+        Check(TextureAtlas::IsPageTextureIdx(TextureAtlas::PAGE_TEXTURE_IDX_BASE) && !TextureAtlas::IsPageTextureIdx(ASSET_IDX_0),
+              "Page texture indices collide with asset indices.");
+
+        // Check UV remapping.
+        auto uvCenter = TextureAtlas::RemapUv(*region1, Vector2(0.5f));
+        auto uvEnd    = TextureAtlas::RemapUv(*region1, Vector2::One);
+        CheckNear(uvCenter.x, (region1->UvMin.x + region1->UvMax.x) / 2.0f, UV_TOLERANCE, "Remapped center U");
+        CheckNear(uvCenter.y, (region1->UvMin.y + region1->UvMax.y) / 2.0f, UV_TOLERANCE, "Remapped center V");
+        CheckNear(uvEnd.x, region1->UvMax.x, UV_TOLERANCE, "Remapped end U");
+        CheckNear(uvEnd.y, region1->UvMax.y, UV_TOLERANCE, "Remapped end V");
+
+        // Check filling every page rejects further images without exceeding the page limit.
+        auto maxImage = CreateImage(Vector2i(TextureAtlas::IMAGE_SIZE_MAX));
+        int  assetIdx = LARGE_IDX + 1;
+        while (atlas.GetStats().RejectedCount == 1)
+        {
+            const auto* region = atlas.Add(assetIdx, Vector2i(TextureAtlas::IMAGE_SIZE_MAX), maxImage);
+            Check(region == nullptr || region->PageIdx < TextureAtlas::PAGE_COUNT_MAX, "Image was packed beyond the page limit.");
+            assetIdx++;
+        }
+        Check(atlas.GetPages().size() == TextureAtlas::PAGE_COUNT_MAX, Fmt("Atlas filled {} pages, expected {}.", atlas.GetPages().size(), TextureAtlas::PAGE_COUNT_MAX));
+
+        // Check clearing.
+        atlas.ClearDirty(0);
+        Check(!atlas.GetPages()[0].IsDirty, "Page is dirty after clearing dirty flag.");
+        atlas.Clear();
+        Check(atlas.GetPages().empty() && !atlas.IsKnown(ASSET_IDX_0) && !atlas.IsKnown(LARGE_IDX), "Clear retained images.");
+    }
+}
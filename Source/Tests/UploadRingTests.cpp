@@ -0,0 +1,79 @@
+#include "Framework.h"
+#include "Tests/Tests.h"
+
+#include "Renderer/Backends/SdlGpu/UploadAllocator.h"
+
+using namespace Silent::Renderer;
+
+namespace Silent::Tests
+{
+    /** @brief Checks an allocation against its expected page and offset.
+     *
+     * @param alloc Allocation to check.
+     * @param pageIdx Expected page index.
+     * @param offset Expected byte offset.
+     * @param name Allocation name used in failure messages.
+     */
+    static void CheckAllocation(const std::optional<UploadAllocation>& alloc, uint pageIdx, uint offset, const std::string& name)
+    {
+        Check(alloc.has_value(), Fmt("{} failed.", name));
+        Check(alloc->PageIdx == pageIdx && alloc->Offset == offset,
+              Fmt("{} got page {} offset {}, expected page {} offset {}.", name, alloc->PageIdx, alloc->Offset, pageIdx, offset));
+    }
+
+    void TestUploadRing()
+    {
+        constexpr uint PAGE_SIZE      = 256;
+        constexpr uint PAGE_COUNT_MAX = 3;
+
+        auto ring = UploadRing(PAGE_SIZE, PAGE_COUNT_MAX);
+
+        // Frame 0: Bump allocate with alignment, then spill into a new page.
+        CheckAllocation(ring.Allocate(10),  0, 0,  "First allocation");
+        CheckAllocation(ring.Allocate(20),  0, 16, "Aligned allocation");
+        CheckAllocation(ring.Allocate(250), 1, 0,  "Spilling allocation");
+        Check(!ring.Allocate(PAGE_SIZE + 1).has_value(), "Allocation larger than a page succeeded.");
+        Check(!ring.Allocate(0).has_value(),             "Empty allocation succeeded.");
+        ring.EndFrame(100);
+
+        auto stats = ring.GetStats();
+        Check(stats.FrameSize == 280 && stats.FailCount == 1, Fmt("Frame 0 reports {} bytes and {} failures, expected 280 and 1.", stats.FrameSize, stats.FailCount));
+        Check(ring.GetInFlightFrameCount() == 1, "Frame 0 isn't in flight.");
+
+        // Frame 1: Pages of frames in flight are never handed out, so running out of pages fails.
+        CheckAllocation(ring.Allocate(200), 2, 0, "Frame 1 allocation");
+        Check(!ring.Allocate(200).has_value(), "Allocation succeeded with every page in flight.");
+        Check(ring.GetPageCount() == PAGE_COUNT_MAX, Fmt("Created {} pages, expected {}.", ring.GetPageCount(), PAGE_COUNT_MAX));
+        ring.EndFrame(101);
+
+        // Retire frame 0 and reuse its pages in frame 2 while frame 1 is still in flight.
+        Check(ring.RetireOldest() == 100, "Oldest frame didn't retire first.");
+        Check(ring.GetStats().FreePageCount == 2, "Retired frame didn't free both its pages.");
+
+        auto alloc0 = ring.Allocate(100);
+        auto alloc1 = ring.Allocate(200);
+        Check(alloc0.has_value() && alloc1.has_value(), "Allocation from retired pages failed.");
+        Check(alloc0->PageIdx != 2 && alloc1->PageIdx != 2 && alloc0->PageIdx != alloc1->PageIdx,
+              "Frame 2 allocations reused a page in flight or shared a page without room.");
+        Check(!ring.Allocate(100).has_value(), "Allocation succeeded beyond free pages.");
+
+        // Frames retire in submission order. The active frame isn't in flight until it ends.
+        Check(ring.RetireOldest() == 101,          "Frame 1 didn't retire second.");
+        Check(!ring.RetireOldest().has_value(),    "Active frame retired before ending.");
+        ring.EndFrame(102);
+        Check(ring.RetireOldest() == 102,          "Frame 2 didn't retire.");
+
+        // Frames without uploads are tracked so that retirement stays in step with submissions.
+        ring.EndFrame(103);
+        Check(ring.GetInFlightFrameCount() == 1, "Empty frame isn't tracked.");
+        Check(ring.RetireOldest() == 103,        "Empty frame didn't retire.");
+
+        // Check final counters.
+        ring.RecordStall();
+        stats = ring.GetStats();
+        Check(stats.PageCount == PAGE_COUNT_MAX && stats.FreePageCount == PAGE_COUNT_MAX && stats.InFlightFrameCount == 0,
+              Fmt("Final stats report {} pages, {} free, {} in flight.", stats.PageCount, stats.FreePageCount, stats.InFlightFrameCount));
+        Check(stats.FrameSize == 0 && stats.FrameSizePeak == 300, Fmt("Final stats report frame size {} and peak {}, expected 0 and 300.", stats.FrameSize, stats.FrameSizePeak));
+        Check(stats.StallCount == 1 && stats.FailCount == 1, "Stall and failure counters are wrong.");
+    }
+}
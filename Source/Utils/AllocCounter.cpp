@@ -0,0 +1,48 @@
+#include "Framework.h"
+#include "Utils/AllocCounter.h"
+
+/** Per-thread heap allocation counting state. Thread-local, so the hook never contends between threads. */
+static thread_local bool IsAllocCounting = false;
+static thread_local uint AllocCount      = 0;
+
+// Count global heap allocations. Aligned `new` overloads are left to the default implementation.
+void* operator new(std::size_t size)
+{
+    if (IsAllocCounting)
+    {
+        AllocCount++;
+    }
+
+    void* ptr = std::malloc((size != 0) ? size : 1);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t size) noexcept
+{
+    std::free(ptr);
+}
+
+namespace Silent::Utils
+{
+    void BeginAllocCount()
+    {
+        AllocCount      = 0;
+        IsAllocCounting = true;
+    }
+
+    uint EndAllocCount()
+    {
+        IsAllocCounting = false;
+        return AllocCount;
+    }
+}
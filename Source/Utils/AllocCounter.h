@@ -0,0 +1,15 @@
+#pragma once
+
+namespace Silent::Utils
+{
+    /** @brief Starts counting global heap allocations made by the calling thread.
+     * Allocations on other threads are never counted, so background workers can't skew the result.
+     */
+    void BeginAllocCount();
+
+    /** @brief Stops counting heap allocations on the calling thread.
+     *
+     * @return Number of global `operator new` calls made by the calling thread since `BeginAllocCount`.
+     */
+    uint EndAllocCount();
+}
@@ -0,0 +1,238 @@
+#include "Framework.h"
+#include "Utils/Compression.h"
+
+namespace Silent::Utils
+{
+    // Stream: varint decompressed size, then sequences of a token, literals, and a match.
+    // Token high nibble = literal length, low nibble = match length minus `MATCH_LENGTH_MIN`. Nibble value 15 is extended with 255-run bytes.
+    // Match offset follows literals as a varint distance back into dictionary and output. The last sequence has literals only.
+
+    constexpr uint MATCH_LENGTH_MIN = 4;
+    constexpr uint NIBBLE_MAX       = 15;
+    constexpr uint HASH_BIT_COUNT   = 14;
+    constexpr uint SKIP_TRIGGER     = 6; // Search step grows by 1 every 2^6 misses to skip incompressible data quickly.
+
+    /** @brief Writes a variable-length integer of 7 bits per byte, low bits first. */
+    static void WriteVarint(std::vector<byte>& output, uint64 value)
+    {
+        while (value >= 0x80)
+        {
+            output.push_back((byte)((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        output.push_back((byte)value);
+    }
+
+    /** @brief Reads a variable-length integer and advances the offset.
+     *
+     * @return `true` if read, `false` if truncated.
+     */
+    static bool ReadVarint(std::span<const byte> input, uint& offset, uint64& value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            if (offset >= input.size())
+            {
+                return false;
+            }
+
+            auto curByte  = (uint8)input[offset++];
+            value        |= (uint64)(curByte & 0x7F) << shift;
+            if (!(curByte & 0x80))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /** @brief Writes the remainder of a length that overflowed its token nibble. */
+    static void WriteLengthExtension(std::vector<byte>& output, uint length)
+    {
+        while (length >= UINT8_MAX)
+        {
+            output.push_back((byte)UINT8_MAX);
+            length -= UINT8_MAX;
+        }
+        output.push_back((byte)length);
+    }
+
+    /** @brief Reads and adds the remainder of a length that overflowed its token nibble.
+     *
+     * @return `true` if read, `false` if truncated.
+     */
+    static bool ReadLengthExtension(std::span<const byte> input, uint& offset, uint64& length)
+    {
+        while (offset < input.size())
+        {
+            auto curByte  = (uint8)input[offset++];
+            length       += curByte;
+            if (curByte != UINT8_MAX)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /** @brief Writes a sequence of literals followed by a match. A match length of 0 writes literals only. */
+    static void WriteSequence(std::vector<byte>& output, std::span<const byte> literals, uint matchLength, uint matchOffset)
+    {
+        uint literalNibble = std::min<uint>((uint)literals.size(), NIBBLE_MAX);
+        uint matchNibble   = (matchLength > 0) ? std::min(matchLength - MATCH_LENGTH_MIN, NIBBLE_MAX) : 0;
+        output.push_back((byte)((literalNibble << 4) | matchNibble));
+        if (literalNibble == NIBBLE_MAX)
+        {
+            WriteLengthExtension(output, (uint)literals.size() - NIBBLE_MAX);
+        }
+        output.insert(output.end(), literals.begin(), literals.end());
+
+        if (matchLength > 0)
+        {
+            WriteVarint(output, matchOffset);
+            if (matchNibble == NIBBLE_MAX)
+            {
+                WriteLengthExtension(output, matchLength - MATCH_LENGTH_MIN - NIBBLE_MAX);
+            }
+        }
+    }
+
+    std::vector<byte> Compress(std::span<const byte> data, std::span<const byte> dict)
+    {
+        // Concatenate dictionary and data so matches can reach across both.
+        auto window = std::vector<byte>();
+        window.reserve(dict.size() + data.size());
+        window.insert(window.end(), dict.begin(), dict.end());
+        window.insert(window.end(), data.begin(), data.end());
+
+        auto read32 = [&](uint pos)
+        {
+            uint32 value = 0;
+            std::memcpy(&value, &window[pos], sizeof(value));
+            return value;
+        };
+        auto hash = [](uint32 value)
+        {
+            return (value * 2654435761u) >> (32 - HASH_BIT_COUNT);
+        };
+
+        // Index dictionary positions.
+        auto hashTable = std::vector<int>(1 << HASH_BIT_COUNT, NO_VALUE);
+        uint endPos    = (uint)window.size();
+        for (uint pos = 0; pos < dict.size() && (pos + MATCH_LENGTH_MIN) <= endPos; pos++)
+        {
+            hashTable[hash(read32(pos))] = pos;
+        }
+
+        auto output = std::vector<byte>();
+        output.reserve((data.size() / 2) + 16);
+        WriteVarint(output, data.size());
+
+        // Greedily emit sequences at first hash match.
+        uint pos        = (uint)dict.size();
+        uint literalPos = pos;
+        uint missCount  = 0;
+        while ((pos + MATCH_LENGTH_MIN) <= endPos)
+        {
+            uint32 value     = read32(pos);
+            auto&  entry     = hashTable[hash(value)];
+            int    candidate = entry;
+            entry            = pos;
+            if (candidate == NO_VALUE || read32(candidate) != value)
+            {
+                pos += 1 + (missCount++ >> SKIP_TRIGGER);
+                continue;
+            }
+
+            uint matchLength = MATCH_LENGTH_MIN;
+            while ((pos + matchLength) < endPos && window[candidate + matchLength] == window[pos + matchLength])
+            {
+                matchLength++;
+            }
+
+            WriteSequence(output, std::span<const byte>(&window[literalPos], pos - literalPos), matchLength, pos - candidate);
+
+            // Index positions inside match.
+            for (uint i = pos + 1; i < (pos + matchLength) && (i + MATCH_LENGTH_MIN) <= endPos; i++)
+            {
+                hashTable[hash(read32(i))] = i;
+            }
+
+            pos        += matchLength;
+            literalPos  = pos;
+            missCount   = 0;
+        }
+
+        // Emit trailing literals.
+        if (literalPos < endPos)
+        {
+            WriteSequence(output, std::span<const byte>(&window[literalPos], endPos - literalPos), 0, 0);
+        }
+
+        return output;
+    }
+
+    bool Decompress(std::span<const byte> compressed, std::span<const byte> dict, std::vector<byte>& data)
+    {
+        uint   offset = 0;
+        uint64 size   = 0;
+        if (!ReadVarint(compressed, offset, size) || size > (compressed.size() * (uint64)UINT8_MAX))
+        {
+            return false;
+        }
+        data.resize(size);
+
+        uint64 outPos = 0;
+        while (outPos < size)
+        {
+            if (offset >= compressed.size())
+            {
+                return false;
+            }
+            auto token = (uint8)compressed[offset++];
+
+            // Copy literals.
+            uint64 literalLength = token >> 4;
+            if (literalLength == NIBBLE_MAX && !ReadLengthExtension(compressed, offset, literalLength))
+            {
+                return false;
+            }
+            if ((offset + literalLength) > compressed.size() || (outPos + literalLength) > size)
+            {
+                return false;
+            }
+            std::memcpy(&data[outPos], &compressed[offset], literalLength);
+            offset += (uint)literalLength;
+            outPos += literalLength;
+
+            if (outPos == size)
+            {
+                break;
+            }
+
+            // Copy match byte by byte, since it may overlap output being written.
+            uint64 matchOffset = 0;
+            uint64 matchLength = (token & 0xF) + MATCH_LENGTH_MIN;
+            if (!ReadVarint(compressed, offset, matchOffset) ||
+                ((token & 0xF) == NIBBLE_MAX && !ReadLengthExtension(compressed, offset, matchLength)))
+            {
+                return false;
+            }
+            if (matchOffset == 0 || matchOffset > (outPos + dict.size()) || (outPos + matchLength) > size)
+            {
+                return false;
+            }
+
+            auto srcPos = (int64)outPos - (int64)matchOffset;
+            for (uint64 i = 0; i < matchLength; i++, srcPos++)
+            {
+                data[outPos++] = (srcPos < 0) ? dict[dict.size() + srcPos] : data[srcPos];
+            }
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+namespace Silent::Utils
+{
+    /** @brief Compresses data with a fast LZ77 byte codec in the style of LZ4. Matches may reference an optional dictionary,
+     * so data compressed against similar data, such as a savegame against its base savegame, shrinks to a compact delta.
+     *
+     * @param data Data to compress.
+     * @param dict Optional dictionary. The same dictionary must be passed to `Decompress`.
+     * @return Compressed data.
+     */
+    std::vector<byte> Compress(std::span<const byte> data, std::span<const byte> dict = {});
+
+    /** @brief Decompresses data compressed with `Compress`.
+     *
+     * @param compressed Compressed data.
+     * @param dict Dictionary used to compress the data.
+     * @param[out] data Decompressed data.
+     * @return `true` if decompressed, `false` if the compressed data is corrupt.
+     */
+    bool Decompress(std::span<const byte> compressed, std::span<const byte> dict, std::vector<byte>& data);
+}
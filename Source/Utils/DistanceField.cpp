@@ -0,0 +1,137 @@
+#include "Framework.h"
+#include "Utils/DistanceField.h"
+
+namespace Silent::Utils
+{
+    static constexpr float DISTANCE_INF = 1e20f;
+
+    /** @brief Transforms squared distances along one row or column in place using the lower envelope of parabolas (Felzenszwalb and Huttenlocher).
+     *
+     * @param grid Squared distance grid.
+     * @param offset Index of the first element.
+     * @param stride Element stride.
+     * @param length Element count.
+     * @param f Scratch buffer of at least `length` elements.
+     * @param v Scratch buffer of at least `length` elements.
+     * @param z Scratch buffer of at least `length + 1` elements.
+     */
+    static void TransformDistances(std::vector<float>& grid, int offset, int stride, int length, std::vector<float>& f, std::vector<int>& v, std::vector<float>& z)
+    {
+        for (int i = 0; i < length; i++)
+        {
+            f[i] = grid[offset + (i * stride)];
+        }
+
+        // Build lower envelope.
+        int k = 0;
+        v[0]  = 0;
+        z[0]  = -DISTANCE_INF;
+        z[1]  = DISTANCE_INF;
+        for (int q = 1; q < length; q++)
+        {
+            float s = 0.0f;
+            do
+            {
+                int r = v[k];
+                s     = ((f[q] - f[r]) + (float)((q * q) - (r * r))) / (float)((q - r) * 2);
+            }
+            while (s <= z[k] && --k >= 0);
+
+            k++;
+            v[k]     = q;
+            z[k]     = s;
+            z[k + 1] = DISTANCE_INF;
+        }
+
+        // Sample lower envelope.
+        k = 0;
+        for (int q = 0; q < length; q++)
+        {
+            while (z[k + 1] < (float)q)
+            {
+                k++;
+            }
+
+            int r                       = v[k];
+            grid[offset + (q * stride)] = f[r] + (float)((q - r) * (q - r));
+        }
+    }
+
+    /** @brief Transforms a grid of squared seed distances into squared Euclidean distances in place.
+     *
+     * @param grid Squared distance grid.
+     * @param size Grid size.
+     */
+    static void TransformDistances(std::vector<float>& grid, const Vector2i& size)
+    {
+        int  length = std::max(size.x, size.y);
+        auto f      = std::vector<float>(length);
+        auto v      = std::vector<int>(length);
+        auto z      = std::vector<float>(length + 1);
+
+        for (int x = 0; x < size.x; x++)
+        {
+            TransformDistances(grid, x, size.x, size.y, f, v, z);
+        }
+
+        for (int y = 0; y < size.y; y++)
+        {
+            TransformDistances(grid, y * size.x, 1, size.x, f, v, z);
+        }
+    }
+
+    std::vector<byte> GenerateDistanceField(std::span<const byte> coverage, const Vector2i& size, int spread)
+    {
+        auto fieldSize = size + Vector2i(spread * 2);
+        if (fieldSize.x <= 0 || fieldSize.y <= 0 || spread < 0)
+        {
+            return {};
+        }
+
+        // Seed squared distances to nearest inside and outside pixels. Padding is outside.
+        int  fieldArea       = fieldSize.x * fieldSize.y;
+        auto insideDists     = std::vector<float>(fieldArea, DISTANCE_INF);
+        auto outsideDists    = std::vector<float>(fieldArea, 0.0f);
+        bool isCoverageValid = coverage.size() >= (size_t)(size.x * size.y);
+        for (int y = 0; y < size.y && isCoverageValid; y++)
+        {
+            for (int x = 0; x < size.x; x++)
+            {
+                // `byte` is signed, so read coverage unsigned.
+                float alpha = (float)(uint8)coverage[(y * size.x) + x] / 255.0f;
+                if (alpha <= 0.0f)
+                {
+                    continue;
+                }
+
+                int i = ((y + spread) * fieldSize.x) + (x + spread);
+                if (alpha >= 1.0f)
+                {
+                    insideDists[i]  = 0.0f;
+                    outsideDists[i] = DISTANCE_INF;
+                }
+                else
+                {
+                    float insideDist  = std::max(0.0f, 0.5f - alpha);
+                    float outsideDist = std::max(0.0f, alpha - 0.5f);
+                    insideDists[i]    = insideDist * insideDist;
+                    outsideDists[i]   = outsideDist * outsideDist;
+                }
+            }
+        }
+
+        TransformDistances(insideDists,  fieldSize);
+        TransformDistances(outsideDists, fieldSize);
+
+        // Map signed distances to bytes.
+        auto  field = std::vector<byte>(fieldArea);
+        float scale = (spread > 0) ? (127.5f / (float)spread) : 127.5f;
+        for (int i = 0; i < fieldArea; i++)
+        {
+            float dist = std::sqrt(outsideDists[i]) - std::sqrt(insideDists[i]);
+            field[i]   = (byte)(uint8)std::lround(std::clamp(127.5f + (dist * scale), 0.0f, 255.0f));
+        }
+
+        return field;
+    }
+}
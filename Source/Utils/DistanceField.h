@@ -0,0 +1,17 @@
+#pragma once
+
+namespace Silent::Utils
+{
+    /** @brief Generates a signed distance field from a monochrome coverage bitmap using an exact Euclidean distance transform.
+     * Partially covered pixels offset their edge distance by their coverage, so anti-aliased input yields subpixel-accurate edges.
+     *
+     * Output values map the signed distance linearly: `128` is the glyph edge, values above it are inside,
+     * and `0` and `255` are `spread` pixels outside and inside, respectively.
+     *
+     * @param coverage Coverage bitmap with `size.x * size.y` values.
+     * @param size Coverage bitmap size.
+     * @param spread Distance range in pixels. The field is padded by this amount on every side.
+     * @return Distance field bitmap of size `size + spread * 2`.
+     */
+    std::vector<byte> GenerateDistanceField(std::span<const byte> coverage, const Vector2i& size, int spread);
+}
@@ -3,6 +3,9 @@
 
 #include "Application.h"
 #include "Renderer/Renderer.h"
+#include "Utils/DistanceField.h"
+#include "Utils/Parallel.h"
+#include "Utils/Translator.h"
 #include "Utils/Utils.h"
 
 namespace Silent::Utils
@@ -16,12 +19,14 @@ namespace Silent::Utils
     };
 
     Font::Font(FT_Library& fontLib, const std::string& name, const std::vector<std::string>& filenames, const std::filesystem::path& path, int pointSize,
-               const std::string& precacheGlyphs)
+               GlyphRasterMode rasterMode, const std::string& precacheGlyphs)
     {
         constexpr int POINT_SIZE_MAX = ATLAS_SIZE / 8;
 
-        _name      = name;
-        _fontCount = filenames.size();
+        _name       = name;
+        _pointSize  = pointSize;
+        _rasterMode = rasterMode;
+        _fontCount  = filenames.size();
 
         // Clamp point size.
         if (pointSize > POINT_SIZE_MAX)
@@ -52,6 +57,27 @@ namespace Silent::Utils
         }
         Debug::Assert(_ftFonts.size() == _fontCount && _hbFonts.size() == _fontCount, Fmt("Invalid initialization for font `{}`.", name));
 
+        // Open private font chain for each raster worker.
+        _workerFtFonts.resize(RASTER_WORKER_COUNT);
+        _rasterResults.resize(RASTER_WORKER_COUNT);
+        for (auto& workerFtFonts : _workerFtFonts)
+        {
+            for (const auto& filename : filenames)
+            {
+                FT_Face ftFont = nullptr;
+                if (FT_New_Face(fontLib, (path / filename).string().c_str(), 0, &ftFont))
+                {
+                    throw std::runtime_error("Failed to initialize font for raster worker.");
+                }
+
+                workerFtFonts.push_back(ftFont);
+                if (FT_Set_Pixel_Sizes(ftFont, 0, pointSize))
+                {
+                    throw std::runtime_error("Failed to set font point size for raster worker.");
+                }
+            }
+        }
+
         // Set scale factor.
         _scaleFactor = (float)pointSize / (float)_ftFonts.front()->size->metrics.x_ppem;
 
@@ -59,18 +85,7 @@ namespace Silent::Utils
         AddAtlas();
 
         // Precache glyphs.
-        auto codePoints = GetCodePoints(precacheGlyphs);
-        for (char32 codePoint : codePoints)
-        {
-            if (Find(_glyphs, codePoint) != nullptr)
-            {
-                Debug::Log(Fmt("Attempted to precache existing glyph U+{:X} for font `{}`. Check precache string for duplicates.", (int)codePoint, name),
-                           Debug::LogLevel::Warning);
-                continue;
-            }
-
-            CacheGlyph(codePoint);
-        }
+        PrecacheGlyphs(precacheGlyphs);
 
         // Debug.
         for (int i = 0; i < _textureAtlases.size(); i++)
@@ -82,6 +97,12 @@ namespace Silent::Utils
 
     Font::~Font()
     {
+        // Wait for raster workers.
+        if (_rasterFuture.valid())
+        {
+            _rasterFuture.wait();
+        }
+
         for (auto* rectAtlas : _rectAtlases)
         {
             sma_atlas_destroy(rectAtlas);
@@ -96,6 +117,14 @@ namespace Silent::Utils
         {
             hb_font_destroy(hbFont);
         }
+
+        for (auto& workerFtFonts : _workerFtFonts)
+        {
+            for (auto& ftFont : workerFtFonts)
+            {
+                FT_Done_Face(ftFont);
+            }
+        }
     }
 
     int Font::GetPointSize() const
@@ -103,23 +132,155 @@ namespace Silent::Utils
         return _pointSize;
     }
 
+    GlyphRasterMode Font::GetRasterMode() const
+    {
+        return _rasterMode;
+    }
+
+    int Font::GetDistanceFieldSpread() const
+    {
+        return (_rasterMode == GlyphRasterMode::DistanceField) ? DISTANCE_FIELD_SPREAD : 0;
+    }
+
     const std::vector<std::vector<byte>>& Font::GetTextureAtlases() const
     {
         return _textureAtlases;
     }
 
-    ShapedText Font::GetShapedText(const std::string& msg)
+    std::span<const GlyphAtlasDirtyRect> Font::GetDirtyRects() const
     {
-        // Cache new glyphs.
-        auto codePoints = GetCodePoints(msg);
-        for (char32 codePoint : codePoints)
+        return _dirtyRects;
+    }
+
+    GlyphAtlasStats Font::GetAtlasStats() const
+    {
+        constexpr uint64 ATLAS_AREA = ATLAS_SIZE * ATLAS_SIZE;
+
+        return GlyphAtlasStats
         {
-            if (Find(_glyphs, codePoint) != nullptr)
+            .AtlasCount = (uint)_textureAtlases.size(),
+            .GlyphCount = _glyphCount,
+            .MemorySize = _textureAtlases.size() * ATLAS_AREA,
+            .Occupancy  = _textureAtlases.empty() ? 0.0f : ((float)_usedArea / (float)(_textureAtlases.size() * ATLAS_AREA))
+        };
+    }
+
+    const ShapedText& Font::GetShapedText(const std::string& msg)
+    {
+        // Invalidate cache if locale changed.
+        uint localeRevision = g_App.GetTranslator().GetLocaleRevision();
+        if (localeRevision != _localeRevision)
+        {
+            ClearShapedTextCache();
+            _localeRevision = localeRevision;
+        }
+
+        // Get cached shaped text and mark it most recently used.
+        uint64 hash  = std::hash<std::string>{}(msg);
+        auto*  entry = Find(_shapedTextLookup, hash);
+        if (entry != nullptr)
+        {
+            auto it = *entry;
+            if (it->Message == msg)
             {
-                continue;
+                _shapedTexts.splice(_shapedTexts.begin(), _shapedTexts, it);
+                _shapedTextStats.HitCount++;
+                return it->Text;
             }
 
-            CacheGlyph(codePoint);
+            // Evict entry with colliding hash.
+            _shapedTexts.erase(it);
+            _shapedTextLookup.erase(hash);
+        }
+        else if (_shapedTexts.size() >= SHAPED_TEXT_CACHE_SIZE)
+        {
+            // Evict least recently used entry.
+            _shapedTextLookup.erase(_shapedTexts.back().Hash);
+            _shapedTexts.pop_back();
+        }
+
+        // Shape and cache.
+        _shapedTexts.push_front(ShapedTextEntry
+        {
+            .Hash    = hash,
+            .Message = msg,
+            .Text    = ShapeText(msg)
+        });
+        _shapedTextLookup[hash] = _shapedTexts.begin();
+        _shapedTextStats.ShapeCount++;
+        return _shapedTexts.front().Text;
+    }
+
+    ShapedTextStats Font::GetShapedTextStats() const
+    {
+        auto stats       = _shapedTextStats;
+        stats.EntryCount = (uint)_shapedTexts.size();
+        return stats;
+    }
+
+    void Font::ClearDirtyRects()
+    {
+        _dirtyRects.clear();
+    }
+
+    void Font::ClearShapedTextCache()
+    {
+        _shapedTexts.clear();
+        _shapedTextLookup.clear();
+    }
+
+    void Font::QueueGlyphs(const std::string& glyphs)
+    {
+        auto codePoints = GetCodePoints(glyphs);
+        for (char32 codePoint : codePoints)
+        {
+            RequestGlyph(codePoint);
+        }
+    }
+
+    void Font::PrecacheGlyphs(const std::string& glyphs)
+    {
+        QueueGlyphs(glyphs);
+
+        // Rasterize all pending glyphs in parallel and wait.
+        WaitForGlyphs();
+        while (!_pendingCodePoints.empty())
+        {
+            DispatchGlyphs();
+            WaitForGlyphs();
+        }
+    }
+
+    void Font::Update()
+    {
+        // Publish finished glyphs.
+        if (_rasterFuture.valid() && _rasterFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        {
+            PublishGlyphs();
+        }
+
+        // Dispatch newly requested glyphs.
+        DispatchGlyphs();
+    }
+
+    void Font::WaitForGlyphs()
+    {
+        if (!_rasterFuture.valid())
+        {
+            return;
+        }
+
+        _rasterFuture.wait();
+        PublishGlyphs();
+    }
+
+    ShapedText Font::ShapeText(const std::string& msg)
+    {
+        // Request new glyphs. Placeholders are used until they're rasterized.
+        auto codePoints = GetCodePoints(msg);
+        for (char32 codePoint : codePoints)
+        {
+            RequestGlyph(codePoint);
         }
 
         auto shapingInfos = std::vector<ShapingInfo>(_fontCount);
@@ -219,38 +380,131 @@ namespace Silent::Utils
         return buffer;
     }
 
-    void Font::CacheGlyph(char32 codePoint)
+    void Font::RequestGlyph(char32 codePoint)
+    {
+        if (Find(_glyphs, codePoint) != nullptr)
+        {
+            return;
+        }
+
+        // Register placeholder.
+        _glyphs[codePoint] = GlyphMetadata
+        {
+            .CodePoint = codePoint,
+            .AtlasIdx  = _activeAtlasIdx
+        };
+        _pendingCodePoints.push_back(codePoint);
+    }
+
+    void Font::DispatchGlyphs()
     {
-        // Load valid glyph from font chain.
-        FT_Face ftFont = nullptr;
-        for (int i = 0; i < _ftFonts.size(); i++)
+        if (_rasterFuture.valid() || _pendingCodePoints.empty())
+        {
+            return;
+        }
+
+        _inFlightCodePoints.swap(_pendingCodePoints);
+        _pendingCodePoints.clear();
+
+        // Split glyphs between raster workers. Each worker uses its own font chain.
+        auto tasks = ParallelTasks{};
+        tasks.reserve(RASTER_WORKER_COUNT);
+        for (int i = 0; i < RASTER_WORKER_COUNT; i++)
         {
-            // Check if glyph is valid.
-            uint charIdx = FT_Get_Char_Index(_ftFonts[i], codePoint);
-            if (charIdx == 0)
+            if (i >= _inFlightCodePoints.size())
             {
-                // If no valid glyphs exist, use first font's invalid glyph.
-                if (i < (_ftFonts.size() - 1))
-                {
-                    continue;
-                }
-                else
+                break;
+            }
+
+            tasks.push_back([this, i]()
+            {
+                auto& results = _rasterResults[i];
+                for (int j = i; j < _inFlightCodePoints.size(); j += RASTER_WORKER_COUNT)
                 {
-                    i = 0;
+                    results.push_back(RasterizeGlyph(i, _inFlightCodePoints[j]));
                 }
+            });
+        }
+
+        _rasterFuture = g_App.GetExecutor().AddTasks(tasks);
+    }
+
+    void Font::PublishGlyphs()
+    {
+        _rasterFuture.get();
+
+        for (auto& results : _rasterResults)
+        {
+            for (const auto& bitmap : results)
+            {
+                PublishGlyph(bitmap);
             }
 
-            FT_Load_Glyph(_ftFonts[i], charIdx, FT_LOAD_DEFAULT);
-            ftFont = _ftFonts[i];
-            break;
+            results.clear();
+        }
+
+        _inFlightCodePoints.clear();
+    }
+
+    Font::GlyphBitmap Font::RasterizeGlyph(int workerIdx, char32 codePoint) const
+    {
+        const auto& ftFonts = _workerFtFonts[workerIdx];
+
+        // Load valid glyph from font chain. If no valid glyphs exist, use first font's invalid glyph.
+        FT_Face ftFont  = ftFonts.front();
+        uint    charIdx = 0;
+        for (auto* chainFtFont : ftFonts)
+        {
+            charIdx = FT_Get_Char_Index(chainFtFont, codePoint);
+            if (charIdx != 0)
+            {
+                ftFont = chainFtFont;
+                break;
+            }
+        }
+
+        if (FT_Load_Glyph(ftFont, charIdx, FT_LOAD_DEFAULT) || FT_Render_Glyph(ftFont->glyph, FT_RENDER_MODE_NORMAL))
+        {
+            return GlyphBitmap{ .CodePoint = codePoint };
         }
-        Debug::Assert(ftFont != nullptr, Fmt("Failed to cache glyph U+{:X} for font `{}`.", (int)codePoint, _name));
 
         const auto& metrics = ftFont->glyph->metrics;
-        auto        size    = Vector2i(FP_FROM(metrics.width, Q6_SHIFT), FP_FROM(metrics.height, Q6_SHIFT)) + Vector2i(GLYPH_PADDING * 2);
+        const auto& bitmap  = ftFont->glyph->bitmap;
+
+        // Copy bitmap rows.
+        auto glyphBitmap = GlyphBitmap
+        {
+            .CodePoint  = codePoint,
+            .Size       = Vector2i(FP_FROM(metrics.width, Q6_SHIFT), FP_FROM(metrics.height, Q6_SHIFT)) + Vector2i(GLYPH_PADDING * 2),
+            .BitmapSize = Vector2i(bitmap.width, bitmap.rows),
+            .Pixels     = std::vector<byte>(bitmap.width * bitmap.rows)
+        };
+        for (int y = 0; y < bitmap.rows; y++)
+        {
+            std::memcpy(&glyphBitmap.Pixels[y * bitmap.width], &bitmap.buffer[y * bitmap.pitch], bitmap.width);
+        }
+
+        // Convert coverage to distance field. Atlas rectangle includes spread margin.
+        if (_rasterMode == GlyphRasterMode::DistanceField && glyphBitmap.BitmapSize != Vector2i::Zero)
+        {
+            glyphBitmap.Pixels      = GenerateDistanceField(glyphBitmap.Pixels, glyphBitmap.BitmapSize, DISTANCE_FIELD_SPREAD);
+            glyphBitmap.BitmapSize += Vector2i(DISTANCE_FIELD_SPREAD * 2);
+            glyphBitmap.Size        = glyphBitmap.BitmapSize + Vector2i(GLYPH_PADDING * 2);
+        }
+
+        return glyphBitmap;
+    }
+
+    void Font::PublishGlyph(const GlyphBitmap& bitmap)
+    {
+        auto* glyph = Find(_glyphs, bitmap.CodePoint);
+        if (glyph == nullptr || bitmap.Size == Vector2i::Zero)
+        {
+            return;
+        }
 
         // Add glyph rectangle.
-        auto* rect = sma_item_add(_rectAtlases[_activeAtlasIdx], size.x, size.y);
+        auto* rect = sma_item_add(_rectAtlases[_activeAtlasIdx], bitmap.Size.x, bitmap.Size.y);
         if (rect == nullptr)
         {
             Debug::Log(Fmt("Active atlas {} for font `{}` is full. Creating new atlas.", _activeAtlasIdx, _name), Debug::LogLevel::Info);
@@ -258,32 +512,43 @@ namespace Silent::Utils
             // Start new atlas.
             AddAtlas();
             _activeAtlasIdx++;
-            rect = sma_item_add(_rectAtlases[_activeAtlasIdx], size.x, size.y);
+            rect = sma_item_add(_rectAtlases[_activeAtlasIdx], bitmap.Size.x, bitmap.Size.y);
         }
 
-        // Register new glyph.
-        _glyphs[codePoint] = GlyphMetadata
-        {
-            .CodePoint = codePoint,
-            .AtlasIdx  = _activeAtlasIdx,
-            .Position  = Vector2i(sma_item_x(rect), sma_item_y(rect)) + Vector2i(GLYPH_PADDING),
-            .Size      = size
-        };
-        const auto& glyph = _glyphs[codePoint];
+        // Update placeholder in place so that shaped text referencing it picks up the real metrics.
+        glyph->AtlasIdx = _activeAtlasIdx;
+        glyph->Position = Vector2i(sma_item_x(rect), sma_item_y(rect)) + Vector2i(GLYPH_PADDING);
+        glyph->Size     = bitmap.Size;
+        glyph->IsReady  = true;
 
-        // Rasterize.
-        FT_Render_Glyph(ftFont->glyph, FT_RENDER_MODE_NORMAL);
-        const auto& bitmap     = ftFont->glyph->bitmap;
-        byte*       pixelsTo   = &_textureAtlases.back()[(glyph.Position.y * ATLAS_SIZE) + glyph.Position.x];
-        byte*       pixelsFrom = (byte*)bitmap.buffer;
+        // Track atlas usage.
+        _usedArea += bitmap.Size.x * bitmap.Size.y;
+        _glyphCount++;
 
         // Copy pixels to atlas.
-        for (int y = 0; y < bitmap.rows; y++)
+        auto& atlas    = _textureAtlases[_activeAtlasIdx];
+        int   rowSize  = std::min(bitmap.BitmapSize.x, ATLAS_SIZE - glyph->Position.x);
+        int   rowCount = std::min(bitmap.BitmapSize.y, ATLAS_SIZE - glyph->Position.y);
+        for (int y = 0; y < rowCount; y++)
         {
-            for (int x = 0; x < bitmap.width; x++)
-            {
-                pixelsTo[(ATLAS_SIZE * y) + x] = pixelsFrom[(bitmap.width * y) + x];
-            }
+            std::memcpy(&atlas[((glyph->Position.y + y) * ATLAS_SIZE) + glyph->Position.x], &bitmap.Pixels[y * bitmap.BitmapSize.x], rowSize);
+        }
+
+        // Extend dirty rectangle of atlas.
+        auto rectMin = Vector2i(sma_item_x(rect), sma_item_y(rect));
+        auto rectMax = rectMin + bitmap.Size;
+        auto it      = std::find_if(_dirtyRects.begin(), _dirtyRects.end(), [&](const GlyphAtlasDirtyRect& dirtyRect)
+        {
+            return dirtyRect.AtlasIdx == _activeAtlasIdx;
+        });
+        if (it == _dirtyRects.end())
+        {
+            _dirtyRects.push_back(GlyphAtlasDirtyRect{ .AtlasIdx = _activeAtlasIdx, .Min = rectMin, .Max = rectMax });
+        }
+        else
+        {
+            it->Min = Vector2i(std::min(it->Min.x, rectMin.x), std::min(it->Min.y, rectMin.y));
+            it->Max = Vector2i(std::max(it->Max.x, rectMax.x), std::max(it->Max.y, rectMax.y));
         }
     }
 
@@ -319,8 +584,79 @@ namespace Silent::Utils
         return font;
     }
 
+    void FontManager::Update()
+    {
+        // Queue glyphs of newly loaded locale.
+        const auto& translator = g_App.GetTranslator();
+        if (translator.GetLocaleRevision() != _localeRevision)
+        {
+            auto chars = translator.GetActiveLocaleCharacters();
+            for (auto& [name, font] : _fonts)
+            {
+                font.QueueGlyphs(chars);
+            }
+
+            _localeRevision = translator.GetLocaleRevision();
+        }
+
+        // Publish and dispatch background glyph rasterization.
+        for (auto& [name, font] : _fonts)
+        {
+            font.Update();
+        }
+
+        UpdateStats();
+    }
+
+    void FontManager::PrecacheGlyphs(const std::string& glyphs)
+    {
+        for (auto& [name, font] : _fonts)
+        {
+            font.PrecacheGlyphs(glyphs);
+        }
+
+        UpdateStats();
+        auto stats = GetAtlasStats();
+        Debug::Log(Fmt("Precached {} glyphs in {} atlases using {} KB for locale `{}`.", stats.GlyphCount, stats.AtlasCount, stats.MemorySize / 1024,
+                       stats.LocaleName));
+    }
+
+    void FontManager::WaitForGlyphs()
+    {
+        for (auto& [name, font] : _fonts)
+        {
+            font.WaitForGlyphs();
+        }
+
+        UpdateStats();
+    }
+
+    GlyphAtlasStats FontManager::GetAtlasStats() const
+    {
+        // @lock Restrict stats access, which the game thread writes after publishing glyphs.
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        return _atlasStats;
+    }
+
+    ShapedTextStats FontManager::GetShapedTextStats() const
+    {
+        // @lock Restrict stats access, which the game thread writes on update.
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        return _shapedTextStats;
+    }
+
+    void FontManager::ClearShapedTextCaches()
+    {
+        for (auto& [name, font] : _fonts)
+        {
+            font.ClearShapedTextCache();
+        }
+
+        UpdateStats();
+    }
+
     void FontManager::LoadFont(const std::string& name, const std::vector<std::string>& filenames, const std::filesystem::path& path, int pointSize,
-                               const std::string& glyphPrecache)
+                               GlyphRasterMode rasterMode, const std::string& glyphPrecache)
     {
         // Check if font is already loaded.
         if (Find(_fonts, name) != nullptr)
@@ -331,7 +667,7 @@ namespace Silent::Utils
         // Handle load.
         try
         {
-            _fonts[name] = Font(_library, name, filenames, path, pointSize, glyphPrecache);
+            _fonts[name] = Font(_library, name, filenames, path, pointSize, rasterMode, glyphPrecache);
 
             Debug::Log(Fmt("Loaded font `{}` at point size {}.", name, pointSize));
         }
@@ -340,4 +676,100 @@ namespace Silent::Utils
             Debug::Log(Fmt("Failed to load font `{}`: {}", name, ex.what()), Debug::LogLevel::Error);
         }
     }
+
+    void FontManager::BenchmarkShaping(uint frameCount)
+    {
+        constexpr uint MESSAGE_COUNT  = 32;
+        constexpr uint MESSAGE_LENGTH = 16; // Code points per message.
+
+        if (frameCount == 0)
+        {
+            return;
+        }
+
+        // Build screen of messages from active locale's characters.
+        auto chars      = g_App.GetTranslator().GetActiveLocaleCharacters();
+        auto codePoints = std::vector<char32>{};
+        utf8::utf8to32(chars.begin(), chars.end(), std::back_inserter(codePoints));
+        if (codePoints.empty())
+        {
+            Debug::Log("Attempted to benchmark text shaping without locale characters.", Debug::LogLevel::Warning);
+            return;
+        }
+
+        auto msgs = std::vector<std::string>{};
+        msgs.reserve(MESSAGE_COUNT);
+        for (int i = 0; i < MESSAGE_COUNT; i++)
+        {
+            auto msg = std::string{};
+            for (int j = 0; j < MESSAGE_LENGTH; j++)
+            {
+                utf8::append(codePoints[((i * MESSAGE_LENGTH) + j) % codePoints.size()], std::back_inserter(msg));
+            }
+
+            msgs.push_back(std::move(msg));
+        }
+
+        // Shape screen every frame, with and without cache.
+        for (auto& [name, font] : _fonts)
+        {
+            for (bool isCached : { true, false })
+            {
+                font.ClearShapedTextCache();
+                auto prevStats = font.GetShapedTextStats();
+
+                auto startTime = std::chrono::steady_clock::now();
+                for (int i = 0; i < frameCount; i++)
+                {
+                    if (!isCached)
+                    {
+                        font.ClearShapedTextCache();
+                    }
+
+                    for (const auto& msg : msgs)
+                    {
+                        font.GetShapedText(msg);
+                    }
+                }
+                auto duration = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime);
+
+                auto stats = font.GetShapedTextStats();
+                Debug::Log(Fmt("Shaping benchmark for font `{}` {}: {} frames of {} messages, {} shaped, {} cache hits, {:.1f} ns per frame.",
+                               name, isCached ? "with cache" : "without cache", frameCount, msgs.size(), stats.ShapeCount - prevStats.ShapeCount,
+                               stats.HitCount - prevStats.HitCount, duration.count() / frameCount));
+            }
+
+            font.ClearShapedTextCache();
+        }
+
+        WaitForGlyphs();
+    }
+
+    void FontManager::UpdateStats()
+    {
+        auto atlasStats = GlyphAtlasStats{};
+        auto usedArea   = 0.0f;
+        auto textStats  = ShapedTextStats{};
+        for (const auto& [name, font] : _fonts)
+        {
+            auto fontAtlasStats    = font.GetAtlasStats();
+            atlasStats.AtlasCount += fontAtlasStats.AtlasCount;
+            atlasStats.GlyphCount += fontAtlasStats.GlyphCount;
+            atlasStats.MemorySize += fontAtlasStats.MemorySize;
+            usedArea              += fontAtlasStats.Occupancy * (float)fontAtlasStats.MemorySize;
+
+            auto fontTextStats    = font.GetShapedTextStats();
+            textStats.ShapeCount += fontTextStats.ShapeCount;
+            textStats.HitCount   += fontTextStats.HitCount;
+            textStats.EntryCount += fontTextStats.EntryCount;
+        }
+
+        atlasStats.Occupancy  = (atlasStats.MemorySize != 0) ? (usedArea / (float)atlasStats.MemorySize) : 0.0f;
+        atlasStats.LocaleName = g_App.GetTranslator().GetActiveLocaleName();
+
+        // @lock Restrict stats access, which the render worker reads for the debug GUI.
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        _atlasStats      = std::move(atlasStats);
+        _shapedTextStats = textStats;
+    }
 }
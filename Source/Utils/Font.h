@@ -2,6 +2,15 @@
 
 namespace Silent::Utils
 {
+    /** @brief Glyph atlas raster modes. */
+    enum class GlyphRasterMode
+    {
+        Coverage,      /** Anti-aliased coverage at the font point size. */
+        DistanceField, /** Signed distance field, sampled with a threshold at any scale. */
+
+        Count
+    };
+
     /** @brief Rasterized glyph metadata. */
     struct GlyphMetadata
     {
@@ -9,6 +18,25 @@ namespace Silent::Utils
         int      AtlasIdx  = 0;
         Vector2i Position  = Vector2i::Zero;
         Vector2i Size      = Vector2i::Zero;
+        bool     IsReady   = false; /** Placeholder with zero size until rasterized by a worker and published. */
+    };
+
+    /** @brief Modified glyph atlas region pending upload. */
+    struct GlyphAtlasDirtyRect
+    {
+        int      AtlasIdx = 0;
+        Vector2i Min      = Vector2i::Zero;
+        Vector2i Max      = Vector2i::Zero; /** Exclusive. */
+    };
+
+    /** @brief Glyph atlas memory statistics. */
+    struct GlyphAtlasStats
+    {
+        uint        AtlasCount = 0;
+        uint        GlyphCount = 0;    /** Published glyphs. */
+        uint64      MemorySize = 0;    /** Atlas pixel memory in bytes. */
+        float       Occupancy  = 0.0f; /** Fraction of atlas area used by glyphs. */
+        std::string LocaleName = {};   /** Locale whose glyphs were last queued. Set by `FontManager` only. */
     };
 
     /** @brief Shaped glyph data. */
@@ -26,7 +54,18 @@ namespace Silent::Utils
         int                      Width  = 0;
     };
 
-    /** @brief Atlased font chain. */
+    /** @brief Shaped text cache statistics. */
+    struct ShapedTextStats
+    {
+        uint ShapeCount = 0; /** Messages shaped with HarfBuzz. */
+        uint HitCount   = 0; /** Messages served from the cache. */
+        uint EntryCount = 0;
+    };
+
+    /** @brief Atlased font chain. Missed glyphs are rasterized in the background by workers with private FreeType faces,
+     * and zero-size placeholders are used until they're published to the atlases on the calling thread.
+     * In distance field mode, glyphs are stored as signed distance fields so that one atlas serves every draw scale.
+     */
     class Font
     {
         // ==========
@@ -36,7 +75,27 @@ namespace Silent::Utils
         static constexpr int ATLAS_SIZE = 1024;
 
     private:
-        static constexpr int GLYPH_PADDING = 1;
+        static constexpr int  GLYPH_PADDING          = 1;
+        static constexpr uint SHAPED_TEXT_CACHE_SIZE = 256;
+        static constexpr uint RASTER_WORKER_COUNT    = 4;
+        static constexpr int  DISTANCE_FIELD_SPREAD  = 4;
+
+        /** @brief Glyph bitmap rasterized by a worker. */
+        struct GlyphBitmap
+        {
+            char32            CodePoint  = 0;
+            Vector2i          Size       = Vector2i::Zero; /** Padded atlas size. Zero if rasterization failed. */
+            Vector2i          BitmapSize = Vector2i::Zero;
+            std::vector<byte> Pixels     = {};
+        };
+
+        /** @brief Cached shaped text. */
+        struct ShapedTextEntry
+        {
+            uint64      Hash    = 0;
+            std::string Message = {};
+            ShapedText  Text    = {};
+        };
 
         // =======
         // Fields
@@ -45,16 +104,31 @@ namespace Silent::Utils
         std::string                               _name        = {};
         int                                       _pointSize   = 0;
         float                                     _scaleFactor = 0.0f;
+        GlyphRasterMode                           _rasterMode  = GlyphRasterMode::Coverage;
         std::unordered_map<char32, GlyphMetadata> _glyphs      = {}; /** Key = code point, value = rasterized glyph metadata. */
         
         std::vector<smol_atlas_t*>     _rectAtlases    = {};
         std::vector<std::vector<byte>> _textureAtlases = {};
         int                            _activeAtlasIdx = 0;
+        uint64                         _usedArea       = 0; /** Atlas area of published glyphs. */
+        uint                           _glyphCount     = 0; /** Published glyphs. */
         
         int                     _fontCount = 0;
         std::vector<FT_Face>    _ftFonts   = {};
         std::vector<hb_font_t*> _hbFonts   = {};
 
+        std::vector<std::vector<FT_Face>>     _workerFtFonts      = {}; /** Index = raster worker, value = private font chain. Faces aren't thread-safe. */
+        std::vector<std::vector<GlyphBitmap>> _rasterResults      = {}; /** Index = raster worker, value = glyphs rasterized by the in-flight job. */
+        std::vector<char32>                   _pendingCodePoints  = {}; /** Requested glyphs not yet dispatched. */
+        std::vector<char32>                   _inFlightCodePoints = {}; /** Glyphs being rasterized. Read-only while `_rasterFuture` is pending. */
+        std::future<void>                     _rasterFuture       = {};
+        std::vector<GlyphAtlasDirtyRect>      _dirtyRects         = {}; /** One merged bounding rectangle per modified atlas, so the list never outgrows the atlas count. */
+
+        std::list<ShapedTextEntry>                                       _shapedTexts      = {}; /** LRU shaped text cache, most recently used first. */
+        std::unordered_map<uint64, std::list<ShapedTextEntry>::iterator> _shapedTextLookup = {}; /** Key = message hash, value = cache entry. */
+        uint                                                             _localeRevision   = 0;  /** Translator locale revision the cache was built for. */
+        ShapedTextStats                                                  _shapedTextStats  = {};
+
     public:
         // =============
         // Constructors
@@ -70,14 +144,20 @@ namespace Silent::Utils
          * @param filenames Font chain filenames.
          * @param path Path containing font files.
          * @param pointSize Point size at which to load the font.
+         * @param rasterMode Glyph atlas raster mode.
          * @param precacheGlyphs Glyphs to precache.
          */
         Font(FT_Library& fontLib, const std::string& name, const std::vector<std::string>& filenames, const std::filesystem::path& path, int pointSize,
-             const std::string& precacheGlyphs);
+             GlyphRasterMode rasterMode, const std::string& precacheGlyphs);
 
-        /** @brief Gracefully destroys the `Font`, freeing resources. */
+        /** @brief Gracefully destroys the `Font`, waiting for raster workers and freeing resources. */
         ~Font();
 
+        Font(const Font&)            = delete;
+        Font(Font&&)                 = default;
+        Font& operator=(const Font&) = delete;
+        Font& operator=(Font&&)      = default;
+
         // ========
         // Getters
         // ========
@@ -88,24 +168,91 @@ namespace Silent::Utils
          */
         int GetPointSize() const;
 
+        /** @brief Gets the glyph atlas raster mode.
+         *
+         * @return Raster mode.
+         */
+        GlyphRasterMode GetRasterMode() const;
+
+        /** @brief Gets the distance range in pixels encoded around each glyph. Glyph atlas rectangles include this margin.
+         *
+         * @return Distance field spread, or `0` in coverage mode.
+         */
+        int GetDistanceFieldSpread() const;
+
         /** @brief Gets the monochrome texture atlases containing cached font glyphs.
          *
          * @return Glyph texture atlases.
          */
         const std::vector<std::vector<byte>>& GetTextureAtlases() const;
 
-        /** @brief Gets the shaped text for a message.
+        /** @brief Gets the atlas regions modified by published glyphs since the last `ClearDirtyRects` call.
          *
-         * @param msg Message to parse.
-         * @return Shaped text.
+         * @return Dirty rectangles, at most one per atlas.
+         */
+        std::span<const GlyphAtlasDirtyRect> GetDirtyRects() const;
+
+        /** @brief Gets the glyph atlas memory statistics.
+         *
+         * @return Glyph atlas statistics.
+         */
+        GlyphAtlasStats GetAtlasStats() const;
+
+        /** @brief Gets the shaped text for a message. Shaped messages are kept in an LRU cache, so static strings are shaped once.
+         * A font has a fixed point size, so each cache entry is specific to the font, its size, and the message hash.
+         * The cache is invalidated when the translator locale changes.
+         *
+         * @param msg Message to shape.
+         * @return Shaped text. Valid until the next call.
          */
-        ShapedText GetShapedText(const std::string& msg);
+        const ShapedText& GetShapedText(const std::string& msg);
+
+        /** @brief Gets the shaped text cache statistics.
+         *
+         * @return Shaped text statistics.
+         */
+        ShapedTextStats GetShapedTextStats() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Clears the dirty rectangles once their atlas regions are uploaded. */
+        void ClearDirtyRects();
+
+        /** @brief Clears the shaped text cache. Must be called when glyph atlases are rebuilt, since entries reference glyph metadata. */
+        void ClearShapedTextCache();
+
+        /** @brief Queues glyphs for background rasterization. Known glyphs are skipped.
+         *
+         * @param glyphs UTF-8 glyphs to queue.
+         */
+        void QueueGlyphs(const std::string& glyphs);
+
+        /** @brief Rasterizes glyphs in parallel and waits until they're published. Used at load time.
+         *
+         * @param glyphs UTF-8 glyphs to precache.
+         */
+        void PrecacheGlyphs(const std::string& glyphs);
+
+        /** @brief Publishes glyphs finished by raster workers to the atlases and dispatches newly requested glyphs. Never blocks. */
+        void Update();
+
+        /** @brief Waits for the in-flight raster job and publishes its glyphs. */
+        void WaitForGlyphs();
 
     private:
         // ========
         // Helpers
         // ========
 
+        /** @brief Shapes a message with HarfBuzz, queueing any new glyphs for rasterization.
+         *
+         * @param msg Message to shape.
+         * @return Shaped text.
+         */
+        ShapedText ShapeText(const std::string& msg);
+
         /** @brief Gets the code points for the glyphs in a message.
          *
          * @param msg Message to parse.
@@ -120,11 +267,32 @@ namespace Silent::Utils
          */
         hb_buffer_t* GetShapingBuffer(const std::string& msg) const;
 
-        /** @brief Caches a new glyph in the texture atlas.
+        /** @brief Registers a placeholder for a new glyph and queues it for rasterization.
          *
-         * @param codePoint Code point of the glyph to cache.
+         * @param codePoint Code point of the glyph to request.
          */
-        void CacheGlyph(char32 codePoint);
+        void RequestGlyph(char32 codePoint);
+
+        /** @brief Starts a raster job for queued glyphs on worker threads if none is in flight. */
+        void DispatchGlyphs();
+
+        /** @brief Waits for the in-flight raster job and publishes its glyphs. */
+        void PublishGlyphs();
+
+        /** @brief Rasterizes a glyph with a worker's private font chain, converting it to a distance field in distance field mode.
+         * Called on worker threads.
+         *
+         * @param workerIdx Raster worker index.
+         * @param codePoint Code point of the glyph to rasterize.
+         * @return Rasterized glyph bitmap.
+         */
+        GlyphBitmap RasterizeGlyph(int workerIdx, char32 codePoint) const;
+
+        /** @brief Packs a rasterized glyph into the active atlas, updates its placeholder, and marks the region dirty.
+         *
+         * @param bitmap Rasterized glyph bitmap.
+         */
+        void PublishGlyph(const GlyphBitmap& bitmap);
 
         /** @brief Adds a new glyph texture atlas to use for caching. */
         void AddAtlas();
@@ -138,8 +306,13 @@ namespace Silent::Utils
         // Fields
         // =======
 
-        FT_Library                            _library = {};
-        std::unordered_map<std::string, Font> _fonts   = {}; /** Key = font name, value = atlased font. */
+        FT_Library                            _library        = {};
+        std::unordered_map<std::string, Font> _fonts          = {}; /** Key = font name, value = atlased font. */
+        uint                                  _localeRevision = 0;  /** Translator locale revision whose glyphs were last queued. */
+
+        GlyphAtlasStats    _atlasStats      = {}; /** Combined statistics refreshed after glyphs are published. */
+        ShapedTextStats    _shapedTextStats = {}; /** Combined statistics refreshed on update. */
+        mutable std::mutex _statsMutex      = {};
 
     public:
         // =============
@@ -163,19 +336,63 @@ namespace Silent::Utils
          */
         Font* GetFont(const std::string& name);
 
+        /** @brief Gets the combined glyph atlas statistics of all loaded fonts as of the last update. Safe to call from the render worker.
+         *
+         * @return Glyph atlas statistics.
+         */
+        GlyphAtlasStats GetAtlasStats() const;
+
+        /** @brief Gets the combined shaped text cache statistics of all loaded fonts as of the last update. Safe to call from the render worker.
+         *
+         * @return Shaped text statistics.
+         */
+        ShapedTextStats GetShapedTextStats() const;
+
         // ==========
         // Utilities
         // ==========
 
+        /** @brief Clears the shaped text caches of all loaded fonts. Must be called when glyph atlases are rebuilt. */
+        void ClearShapedTextCaches();
+
+        /** @brief Queues glyphs of a newly loaded translator locale, then publishes and dispatches background glyph rasterization. */
+        void Update();
+
+        /** @brief Rasterizes glyphs for all loaded fonts in parallel and waits until they're published.
+         * Used at load time with a whole locale's character set.
+         *
+         * @param glyphs UTF-8 glyphs to precache.
+         */
+        void PrecacheGlyphs(const std::string& glyphs);
+
+        /** @brief Waits for in-flight background glyph rasterization of all loaded fonts. */
+        void WaitForGlyphs();
+
         /** @brief Loads and registers a font chain.
          *
          * @param name Font name to use for retrieval.
          * @param filenames Font chain filenames.
          * @param path Path containing font files.
          * @param pointSize Vertical rasterization point size.
+         * @param rasterMode Glyph atlas raster mode.
          * @param precacheGlyphs Glyphs to precache in the atlas upon font initialization.
          */
         void LoadFont(const std::string& name, const std::vector<std::string>& filenames, const std::filesystem::path& path, int pointSize,
-                      const std::string& precacheGlyphs = {});
+                      GlyphRasterMode rasterMode = GlyphRasterMode::Coverage, const std::string& precacheGlyphs = {});
+
+        /** @brief Benchmarks text shaping. Shapes a fixed screen of messages from the active locale every frame with every loaded font,
+         * once with the shaped text cache and once with it cleared each frame, then logs shaping counts and times.
+         *
+         * @param frameCount Number of frames to simulate.
+         */
+        void BenchmarkShaping(uint frameCount);
+
+    private:
+        // ========
+        // Helpers
+        // ========
+
+        /** @brief Combines the glyph atlas and shaped text statistics of all loaded fonts for `GetAtlasStats` and `GetShapedTextStats`. */
+        void UpdateStats();
     };
 }
@@ -0,0 +1,69 @@
+#include "Framework.h"
+#include "Utils/FrameArena.h"
+
+namespace Silent::Utils
+{
+    FrameArena::FrameArena(uint capacity, uint bufferCount)
+    {
+        _capacity = capacity;
+
+        // @heapalloc Allocate buffers once.
+        _buffers.resize(std::max(bufferCount, 1u));
+        for (auto& buffer : _buffers)
+        {
+            buffer = std::make_unique_for_overwrite<byte[]>(_capacity);
+        }
+    }
+
+    uint FrameArena::GetCapacity() const
+    {
+        return _capacity;
+    }
+
+    uint FrameArena::GetUsedSize() const
+    {
+        return _offset;
+    }
+
+    uint FrameArena::GetPeakSize() const
+    {
+        return _peakSize;
+    }
+
+    uint FrameArena::GetOverflowCount() const
+    {
+        return _overflowCount;
+    }
+
+    void FrameArena::Swap()
+    {
+        if (_buffers.empty())
+        {
+            return;
+        }
+
+        _bufferIdx     = (_bufferIdx + 1) % _buffers.size();
+        _offset        = 0;
+        _overflowCount = 0;
+    }
+
+    void* FrameArena::AllocateRaw(uint size, uint align)
+    {
+        // Align offset.
+        uint alignedOffset = (_offset + (align - 1)) & ~(align - 1);
+        if ((alignedOffset + size) > _capacity || _buffers.empty())
+        {
+            if (_overflowCount == 0)
+            {
+                Debug::Log("Attempted to allocate from full frame arena.", Debug::LogLevel::Warning, Debug::LogMode::Debug);
+            }
+
+            _overflowCount++;
+            return nullptr;
+        }
+
+        _offset   = alignedOffset + size;
+        _peakSize = std::max(_peakSize, _offset);
+        return &_buffers[_bufferIdx][alignedOffset];
+    }
+}
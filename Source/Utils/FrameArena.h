@@ -0,0 +1,159 @@
+#pragma once
+
+namespace Silent::Utils
+{
+    /** @brief Multi-buffered per-frame linear allocator.
+     * Allocations bump an offset into the active buffer and are never freed individually. `Swap` flips to the next buffer
+     * and resets it in O(1), so data allocated in previous frames remains valid until its buffer comes around again.
+     * With a single buffer, `Swap` simply resets it.
+     *
+     * @note Not thread-safe. Only trivially destructible types may be allocated since destructors are never run.
+     */
+    class FrameArena
+    {
+    public:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr uint BUFFER_COUNT = 2;
+        static constexpr uint ALIGNMENT    = alignof(std::max_align_t);
+
+    private:
+        // =======
+        // Fields
+        // =======
+
+        std::vector<std::unique_ptr<byte[]>> _buffers       = {};
+        uint                                 _capacity      = 0; /** Capacity per buffer in bytes. */
+        uint                                 _bufferIdx     = 0; /** Active buffer. */
+        uint                                 _offset        = 0; /** Bump offset into the active buffer. */
+        uint                                 _peakSize      = 0; /** Peak used size since construction. */
+        uint                                 _overflowCount = 0; /** Failed allocations since the last swap. */
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs an empty default `FrameArena`. */
+        FrameArena() = default;
+
+        /** @brief Constructs a `FrameArena` and allocates its buffers up front.
+         *
+         * @param capacity Capacity per buffer in bytes.
+         * @param bufferCount Number of buffers to cycle through.
+         */
+        FrameArena(uint capacity, uint bufferCount = BUFFER_COUNT);
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the capacity per buffer.
+         *
+         * @return Capacity in bytes.
+         */
+        uint GetCapacity() const;
+
+        /** @brief Gets the used size of the active buffer.
+         *
+         * @return Used size in bytes.
+         */
+        uint GetUsedSize() const;
+
+        /** @brief Gets the peak used size of any buffer since construction.
+         *
+         * @return Peak used size in bytes.
+         */
+        uint GetPeakSize() const;
+
+        /** @brief Gets the number of allocations which failed due to insufficient capacity since the last swap.
+         *
+         * @return Overflow count.
+         */
+        uint GetOverflowCount() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Allocates default-constructed elements from the active buffer.
+         *
+         * @tparam T Element type.
+         * @param count Element count.
+         * @return Span of allocated elements, empty if the arena is full.
+         */
+        template <typename T>
+        requires std::is_trivially_destructible_v<T>
+        std::span<T> Allocate(uint count);
+
+        /** @brief Copies elements into the active buffer.
+         *
+         * @tparam T Element type.
+         * @param data Elements to copy.
+         * @return Span of copied elements, empty if the arena is full.
+         */
+        template <typename T>
+        requires std::is_trivially_destructible_v<T>
+        std::span<const T> Copy(std::span<const T> data);
+
+        /** @brief Flips to the next buffer and resets it. */
+        void Swap();
+
+    private:
+        // ========
+        // Helpers
+        // ========
+
+        /** @brief Reserves aligned raw memory in the active buffer.
+         *
+         * @param size Size in bytes.
+         * @param align Alignment in bytes.
+         * @return Pointer to reserved memory, `nullptr` if the arena is full.
+         */
+        void* AllocateRaw(uint size, uint align);
+    };
+
+    template <typename T>
+    requires std::is_trivially_destructible_v<T>
+    std::span<T> FrameArena::Allocate(uint count)
+    {
+        static_assert(alignof(T) <= ALIGNMENT, "Type alignment exceeds frame arena alignment.");
+
+        if (count == 0)
+        {
+            return {};
+        }
+
+        auto* ptr = (T*)AllocateRaw(count * sizeof(T), alignof(T));
+        if (ptr == nullptr)
+        {
+            return {};
+        }
+
+        std::uninitialized_value_construct_n(ptr, count);
+        return std::span<T>(ptr, count);
+    }
+
+    template <typename T>
+    requires std::is_trivially_destructible_v<T>
+    std::span<const T> FrameArena::Copy(std::span<const T> data)
+    {
+        static_assert(alignof(T) <= ALIGNMENT, "Type alignment exceeds frame arena alignment.");
+
+        if (data.empty())
+        {
+            return {};
+        }
+
+        auto* ptr = (T*)AllocateRaw((uint)data.size_bytes(), alignof(T));
+        if (ptr == nullptr)
+        {
+            return {};
+        }
+
+        std::uninitialized_copy(data.begin(), data.end(), ptr);
+        return std::span<const T>(ptr, data.size());
+    }
+}
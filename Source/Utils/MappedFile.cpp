@@ -0,0 +1,107 @@
+#include "Framework.h"
+#include "Utils/MappedFile.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+    #define NOMINMAX
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Silent::Utils
+{
+    MappedFile::MappedFile(const std::filesystem::path& filename)
+    {
+#if defined(_WIN32) || defined(_WIN64)
+        auto fileHandle = CreateFileW(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            return;
+        }
+        _fileHandle = fileHandle;
+
+        auto size = LARGE_INTEGER{};
+        if (!GetFileSizeEx(fileHandle, &size) || size.QuadPart == 0)
+        {
+            Close();
+            return;
+        }
+
+        _mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (_mappingHandle == nullptr)
+        {
+            Close();
+            return;
+        }
+
+        _data = (const byte*)MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+        _size = (_data != nullptr) ? (uint64)size.QuadPart : 0;
+#else
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return;
+        }
+
+        // Mapping stays valid after file descriptor is closed.
+        struct stat fileStat = {};
+        if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+        {
+            void* data = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED)
+            {
+                _data = (const byte*)data;
+                _size = (uint64)fileStat.st_size;
+            }
+        }
+        close(fd);
+#endif
+    }
+
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    std::span<const byte> MappedFile::GetData() const
+    {
+        return std::span<const byte>(_data, _size);
+    }
+
+    bool MappedFile::IsOpen() const
+    {
+        return _data != nullptr;
+    }
+
+    void MappedFile::Close()
+    {
+#if defined(_WIN32) || defined(_WIN64)
+        if (_data != nullptr)
+        {
+            UnmapViewOfFile(_data);
+        }
+        if (_mappingHandle != nullptr)
+        {
+            CloseHandle(_mappingHandle);
+            _mappingHandle = nullptr;
+        }
+        if (_fileHandle != nullptr)
+        {
+            CloseHandle(_fileHandle);
+            _fileHandle = nullptr;
+        }
+#else
+        if (_data != nullptr)
+        {
+            munmap((void*)_data, _size);
+        }
+#endif
+
+        _data = nullptr;
+        _size = 0;
+    }
+}
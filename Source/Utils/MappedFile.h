@@ -0,0 +1,65 @@
+#pragma once
+
+namespace Silent::Utils
+{
+    /** @brief Read-only memory-mapped file. Pages are loaded on first access, so reading a small part of a file only touches that part. */
+    class MappedFile
+    {
+    private:
+        // =======
+        // Fields
+        // =======
+
+        const byte* _data = nullptr;
+        uint64      _size = 0;       /** Size in bytes. */
+
+#if defined(_WIN32) || defined(_WIN64)
+        void* _fileHandle    = nullptr;
+        void* _mappingHandle = nullptr;
+#endif
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Maps a file for reading. Check `IsOpen` for success.
+         *
+         * @param filename Full file path.
+         */
+        MappedFile(const std::filesystem::path& filename);
+
+        /** @brief Gracefully destroys the `MappedFile` and unmaps the file. */
+        ~MappedFile();
+
+        MappedFile(const MappedFile&)            = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the mapped file data.
+         *
+         * @return File data, or an empty span if not open.
+         */
+        std::span<const byte> GetData() const;
+
+        // ==========
+        // Inquirers
+        // ==========
+
+        /** @brief Checks if the file is mapped.
+         *
+         * @return `true` if the file is mapped, `false` otherwise.
+         */
+        bool IsOpen() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Unmaps the file. */
+        void Close();
+    };
+}
@@ -59,6 +59,12 @@ namespace Silent::Utils
     {
         const auto& options = g_App.GetOptions();
 
+        // If there are no tasks, return early.
+        if (tasks.empty())
+        {
+            return GenerateReadyFuture();
+        }
+
         // If parallelism is disabled, execute tasks sequentially.
         if (!options->EnableParallelism)
         {
@@ -77,6 +83,7 @@ namespace Silent::Utils
         auto counter = std::make_shared<std::atomic<int>>();
         auto promise = std::make_shared<std::promise<void>>();
 
+        // Set counter for task group before queueing so that early completions can't resolve the promise prematurely.
         counter->store((int)tasks.size(), std::memory_order::release);
 
         // Add group tasks.
@@ -130,9 +137,6 @@ namespace Silent::Utils
 
     void ParallelExecutor::AddTask(const ParallelTask& task, std::shared_ptr<std::atomic<int>> counter, std::shared_ptr<std::promise<void>> promise)
     {
-        // Increment counter for task group.
-        counter->fetch_add(1, std::memory_order_relaxed);
-
         // @lock Restrict task queue access.
         {
             auto taskLock = std::lock_guard(_taskMutex);
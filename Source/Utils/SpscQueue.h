@@ -0,0 +1,99 @@
+#pragma once
+
+namespace Silent::Utils
+{
+    /** @brief Lock-free single-producer, single-consumer bounded queue.
+     * Elements live in a fixed ring allocated up front, and the producer and consumer each own one index that the other only reads.
+     * Neither side ever blocks or allocates, so the queue is safe to drain from real-time threads.
+     *
+     * @note `Push` must only be called from the producer thread, `Pop` only from the consumer thread.
+     * One slot is kept empty to distinguish a full queue from an empty one.
+     */
+    template <typename T, uint CAPACITY>
+    class SpscQueue
+    {
+        static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0, "Capacity must be a power of 2.");
+
+    private:
+        static constexpr uint INDEX_MASK = CAPACITY - 1;
+
+        // =======
+        // Fields
+        // =======
+
+        std::array<T, CAPACITY>       _elements = {};
+        alignas(64) std::atomic<uint> _head     = 0; /** Next element to pop. Written by the consumer. */
+        alignas(64) std::atomic<uint> _tail     = 0; /** Next slot to push. Written by the producer. */
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs an empty `SpscQueue`. */
+        SpscQueue() = default;
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Checks if the queue is empty. Approximate when called from neither side.
+         *
+         * @return `true` if empty, `false` otherwise.
+         */
+        bool IsEmpty() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Pushes an element without blocking.
+         *
+         * @param element Element to push.
+         * @return `true` if pushed, `false` if the queue is full.
+         */
+        bool Push(const T& element);
+
+        /** @brief Pops the oldest element without blocking.
+         *
+         * @param element Destination for the popped element.
+         * @return `true` if popped, `false` if the queue is empty.
+         */
+        bool Pop(T& element);
+    };
+
+    template <typename T, uint CAPACITY>
+    bool SpscQueue<T, CAPACITY>::IsEmpty() const
+    {
+        return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+    }
+
+    template <typename T, uint CAPACITY>
+    bool SpscQueue<T, CAPACITY>::Push(const T& element)
+    {
+        uint tail     = _tail.load(std::memory_order_relaxed);
+        uint nextTail = (tail + 1) & INDEX_MASK;
+        if (nextTail == _head.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        _elements[tail] = element;
+        _tail.store(nextTail, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T, uint CAPACITY>
+    bool SpscQueue<T, CAPACITY>::Pop(T& element)
+    {
+        uint head = _head.load(std::memory_order_relaxed);
+        if (head == _tail.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        element = _elements[head];
+        _head.store((head + 1) & INDEX_MASK, std::memory_order_release);
+        return true;
+    }
+}
@@ -9,6 +9,27 @@ using namespace Silent::Services;
 
 namespace Silent::Utils
 {
+    /** @brief Recursively collects the code points of all string values in a JSON node.
+     *
+     * @param node JSON node.
+     * @param codePoints Output code points.
+     */
+    static void CollectCodePoints(const json& node, std::vector<char32>& codePoints)
+    {
+        if (node.is_string())
+        {
+            const auto& str = node.get_ref<const std::string&>();
+            utf8::utf8to32(str.begin(), str.end(), std::back_inserter(codePoints));
+        }
+        else if (node.is_structured())
+        {
+            for (const auto& child : node)
+            {
+                CollectCodePoints(child, codePoints);
+            }
+        }
+    }
+
     void TranslationManager::Initialize(const std::filesystem::path& localesPath, const std::vector<std::string>& localeNames)
     {
         constexpr char LOCALE_FILENAME[] = "Locale";
@@ -39,6 +60,32 @@ namespace Silent::Utils
         return _activeLocaleName;
     }
 
+    uint TranslationManager::GetLocaleRevision() const
+    {
+        return _localeRevision;
+    }
+
+    std::string TranslationManager::GetActiveLocaleCharacters() const
+    {
+        auto codePoints = std::vector<char32>{};
+        auto knownChars = std::unordered_set<char32>{};
+
+        // Collect code points of all string values.
+        CollectCodePoints(_activeLocale, codePoints);
+
+        // Remove duplicates in first-seen order.
+        auto chars = std::string{};
+        for (char32 codePoint : codePoints)
+        {
+            if (knownChars.insert(codePoint).second)
+            {
+                utf8::append(codePoint, std::back_inserter(chars));
+            }
+        }
+
+        return chars;
+    }
+
     const std::vector<std::string>& TranslationManager::GetLocaleNames() const
     {
         return _localeNames;
@@ -111,6 +158,7 @@ namespace Silent::Utils
         }
 
         _activeLocaleName = localeName;
+        _localeRevision++;
         stream.Close();
     }
 }
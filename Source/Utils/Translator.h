@@ -12,6 +12,7 @@ namespace Silent::Utils
         json        _activeLocale     = {};
         std::string _activeLocaleName = {};
         std::string _queuedLocaleName = {};
+        uint        _localeRevision   = 0; /** Incremented whenever a locale is loaded. */
         bool        _isLocked         = false;
 
         std::vector<std::string> _localeNames = {};
@@ -49,6 +50,18 @@ namespace Silent::Utils
          */
         const std::string& GetActiveLocaleName() const;
 
+        /** @brief Gets the locale revision, which changes whenever a locale is loaded. Used to invalidate locale-dependent caches.
+         *
+         * @return Locale revision.
+         */
+        uint GetLocaleRevision() const;
+
+        /** @brief Gets the unique characters used by all translations of the active locale. Used to precache font glyphs.
+         *
+         * @return UTF-8 string of unique characters.
+         */
+        std::string GetActiveLocaleCharacters() const;
+
         /** @brief Gets the registered locale names.
          *
          * @return Registered locale names.
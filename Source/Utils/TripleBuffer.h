@@ -0,0 +1,107 @@
+#pragma once
+
+namespace Silent::Utils
+{
+    /** @brief Lock-free single-producer, single-consumer triple buffer.
+     * The producer writes into its own buffer and publishes it by swapping it with a shared middle buffer. The consumer acquires the
+     * most recently published buffer the same way. Neither side ever blocks on the other, and unconsumed publishes are overwritten.
+     *
+     * @note `GetWriteBuffer` and `Publish` must only be called from the producer thread, `GetReadBuffer` and `Acquire` only from the consumer thread.
+     */
+    template <typename T>
+    class TripleBuffer
+    {
+    public:
+        // ==========
+        // Constants
+        // ==========
+
+        static constexpr uint BUFFER_COUNT = 3;
+
+    private:
+        static constexpr uint INDEX_MASK = 0x3;
+        static constexpr uint DIRTY_FLAG = 1 << 2;
+
+        // =======
+        // Fields
+        // =======
+
+        std::array<T, BUFFER_COUNT> _buffers   = {};
+        uint                        _writeIdx  = 0; /** Buffer owned by the producer. */
+        std::atomic<uint>           _sharedIdx = 1; /** Middle buffer with a flag marking unconsumed publishes. */
+        uint                        _readIdx   = 2; /** Buffer owned by the consumer. */
+
+    public:
+        // =============
+        // Constructors
+        // =============
+
+        /** @brief Constructs a `TripleBuffer` with default buffers. */
+        TripleBuffer() = default;
+
+        // ========
+        // Getters
+        // ========
+
+        /** @brief Gets the producer's buffer.
+         *
+         * @return Write buffer.
+         */
+        T& GetWriteBuffer();
+
+        /** @brief Gets the consumer's buffer, which holds the most recently acquired publish.
+         *
+         * @return Read buffer.
+         */
+        const T& GetReadBuffer() const;
+
+        // ==========
+        // Utilities
+        // ==========
+
+        /** @brief Publishes the write buffer to the consumer and takes over the middle buffer for writing.
+         * The new write buffer holds stale data from an earlier publish.
+         *
+         * @return `true` if the previous publish was consumed, `false` if it was overwritten.
+         */
+        bool Publish();
+
+        /** @brief Acquires the most recently published buffer for reading if one is pending.
+         *
+         * @return `true` if a new buffer was acquired, `false` if the read buffer is unchanged.
+         */
+        bool Acquire();
+    };
+
+    template <typename T>
+    T& TripleBuffer<T>::GetWriteBuffer()
+    {
+        return _buffers[_writeIdx];
+    }
+
+    template <typename T>
+    const T& TripleBuffer<T>::GetReadBuffer() const
+    {
+        return _buffers[_readIdx];
+    }
+
+    template <typename T>
+    bool TripleBuffer<T>::Publish()
+    {
+        uint prevSharedIdx = _sharedIdx.exchange(_writeIdx | DIRTY_FLAG, std::memory_order_acq_rel);
+        _writeIdx          = prevSharedIdx & INDEX_MASK;
+        return !(prevSharedIdx & DIRTY_FLAG);
+    }
+
+    template <typename T>
+    bool TripleBuffer<T>::Acquire()
+    {
+        if (!(_sharedIdx.load(std::memory_order_relaxed) & DIRTY_FLAG))
+        {
+            return false;
+        }
+
+        _readIdx = _sharedIdx.exchange(_readIdx, std::memory_order_acq_rel) & INDEX_MASK;
+        return true;
+    }
+}
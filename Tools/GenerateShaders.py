@@ -2,6 +2,7 @@
 Platform-Specific Shader Generator
 
 Generates shaders from .HLSL sources to be used by a platform-specific engine executable at runtime.
+All generated shaders are then packed into a single `Shaders.pack` file which the engine reads with one I/O call.
 
 Usage:
     `python Tools/GenerateShaders.py <build_os>`
@@ -16,6 +17,7 @@ Arguments:
 import os
 import platform
 import shutil
+import struct
 import subprocess
 import sys
 
@@ -27,6 +29,10 @@ SHADERCROSS_PATH = BASE_PATH / SHADERCROSS_NAME
 SOURCES_PATH     = BASE_PATH / "../Source/Renderer/Shaders"
 OUTPUT_PATH      = BASE_PATH / "../Build/Debug/Debug/Shaders" # @todo Make common output path for Debug and Release. .EXEs can be in Bin/Debug and Bin/Release.
 TEMP_OUTPUT_PATH = OUTPUT_PATH / ".Temp"
+PACK_NAME        = "Shaders.pack"
+PACK_MAGIC       = 0x50485353 # "SSHP". Must match `ShaderPack::MAGIC`.
+PACK_VERSION     = 1          # Must match `ShaderPack::VERSION`.
+PACK_EXTENSIONS  = [".spv", ".dxil", ".msl"]
 
 def generate_shaders():
     """
@@ -95,6 +101,9 @@ def generate_shaders():
             shutil.copy(TEMP_OUTPUT_PATH / shader_output, OUTPUT_PATH / shader_output)
         shutil.rmtree(TEMP_OUTPUT_PATH)
 
+        # Pack shaders.
+        pack_count = write_shader_pack()
+
         # Report status.
         if build_count == 0 and len(fail_names) == 0:
             print("Shaders are up-to-date.")
@@ -102,6 +111,7 @@ def generate_shaders():
             print(f"{build_count} shader{"" if build_count == 1 else "s"} built successfully." + f" {len(fail_names)} failed:" if len(fail_names) > 0 else "")
             for fail_name in fail_names:
                 print(fail_name)
+        print(f"Packed {pack_count} shader{"" if pack_count == 1 else "s"} into `{PACK_NAME}`.")
     except Exception as ex:
         # Ensure temporary output folder is deleted.
         if os.path.isfile(TEMP_OUTPUT_PATH):
@@ -111,6 +121,39 @@ def generate_shaders():
         print(f"Error: {ex}")
         sys.exit(1)
 
+def write_shader_pack():
+    """
+    Pack all generated shaders in the output folder into a single file. Layout is little-endian:
+    magic (4) | version (2) | entry count (4) | entries | blobs, where each entry is
+    name length (4) | name | blob offset from file start (4) | blob size (4).
+    """
+    # Collect generated shaders.
+    names = sorted(
+        file for file in os.listdir(OUTPUT_PATH)
+        if os.path.splitext(file)[1] in PACK_EXTENSIONS
+    )
+    blobs = []
+    for name in names:
+        with open(OUTPUT_PATH / name, "rb") as file:
+            blobs.append(file.read())
+
+    # Compute blob offsets after header and entries.
+    encoded_names = [name.encode("utf-8") for name in names]
+    offset        = 4 + 2 + 4 + sum(4 + len(encoded_name) + 4 + 4 for encoded_name in encoded_names)
+
+    # Write pack.
+    with open(OUTPUT_PATH / PACK_NAME, "wb") as file:
+        file.write(struct.pack("<IHI", PACK_MAGIC, PACK_VERSION, len(names)))
+        for encoded_name, blob in zip(encoded_names, blobs):
+            file.write(struct.pack("<i", len(encoded_name)))
+            file.write(encoded_name)
+            file.write(struct.pack("<II", offset, len(blob)))
+            offset += len(blob)
+        for blob in blobs:
+            file.write(blob)
+
+    return len(names)
+
 def get_shadercross_executable():
     """
     Get the path to the appropriate `shadercross` executable based on the system OS.